@@ -0,0 +1,169 @@
+/*  arena.c -- Memory that is freed all at once.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+/* Everything is aligned like malloc aligns it.  */
+#define ARENA_ALIGN		(2 * sizeof (void *))
+#define ARENA_ROUND(size)	(((size) + ARENA_ALIGN - 1) \
+				 & ~(ARENA_ALIGN - 1))
+
+/* The size of a block.  Larger objects get a block of their own.  */
+#define ARENA_BLOCK_SIZE	16384
+
+/* Return the memory of BLOCK.  */
+static inline char *
+arena_block_data (struct arena_block *block)
+{
+  return (char *) block + ARENA_ROUND (sizeof (*block));
+}
+
+/* Return a new block with SIZE bytes for ARENA, or NULL.  */
+static struct arena_block *
+arena_block_new (struct arena *arena, size_t size)
+{
+  struct arena_block *block;
+
+  block = malloc (ARENA_ROUND (sizeof (*block)) + size);
+  if (!block)
+    return NULL;
+  block->size = size;
+  block->used = 0;
+  arena->size += size;
+  return block;
+}
+
+/* Initialize the empty arena ARENA.  */
+void
+arena_init (struct arena *arena)
+{
+  arena->blocks = NULL;
+  arena->last = NULL;
+  arena->size = 0;
+}
+
+/* Return SIZE bytes from ARENA, or NULL when there is not enough
+   memory.  */
+void *
+arena_alloc (struct arena *arena, size_t size)
+{
+  struct arena_block *block = arena->blocks;
+  void *p;
+
+  size = ARENA_ROUND (size ? : 1);
+  if (!block || block->size - block->used < size)
+    {
+      if (size > ARENA_BLOCK_SIZE / 4)
+	{
+	  /* The block goes behind the current one, whose free space
+	     is still used.  */
+	  block = arena_block_new (arena, size);
+	  if (!block)
+	    return NULL;
+	  block->used = size;
+	  if (arena->blocks)
+	    {
+	      block->next = arena->blocks->next;
+	      arena->blocks->next = block;
+	    }
+	  else
+	    {
+	      block->next = NULL;
+	      arena->blocks = block;
+	      arena->last = NULL;
+	    }
+	  return arena_block_data (block);
+	}
+
+      block = arena_block_new (arena, ARENA_BLOCK_SIZE);
+      if (!block)
+	return NULL;
+      block->next = arena->blocks;
+      arena->blocks = block;
+    }
+
+  p = arena_block_data (block) + block->used;
+  block->used += size;
+  arena->last = p;
+  return p;
+}
+
+/* Return N cleared elements of SIZE bytes from ARENA.  */
+void *
+arena_calloc (struct arena *arena, size_t n, size_t size)
+{
+  void *p;
+
+  if (size && n > (size_t) -1 / size)
+    return NULL;
+  p = arena_alloc (arena, n * size);
+  if (p)
+    memset (p, 0, n * size);
+  return p;
+}
+
+/* Grow or shrink PTR, which has OLDSIZE bytes and was allocated from
+   ARENA, to SIZE bytes.  PTR may be NULL.  */
+void *
+arena_realloc (struct arena *arena, void *ptr, size_t oldsize, size_t size)
+{
+  void *p;
+
+  if (ptr && ptr == arena->last)
+    {
+      struct arena_block *block = arena->blocks;
+      size_t offset = (char *) ptr - arena_block_data (block);
+
+      if (ARENA_ROUND (size ? : 1) <= block->size - offset)
+	{
+	  block->used = offset + ARENA_ROUND (size ? : 1);
+	  return ptr;
+	}
+    }
+
+  p = arena_alloc (arena, size);
+  if (p && ptr)
+    memcpy (p, ptr, oldsize < size ? oldsize : size);
+  return p;
+}
+
+/* Return a terminated copy of the LEN characters at S from ARENA.  */
+char *
+arena_strndup (struct arena *arena, const char *s, size_t len)
+{
+  char *p;
+
+  p = arena_alloc (arena, len + 1);
+  if (p)
+    {
+      memcpy (p, s, len);
+      p[len] = '\0';
+    }
+  return p;
+}
+
+/* Free all memory of ARENA, it is empty again afterwards.  */
+void
+arena_free (struct arena *arena)
+{
+  while (arena->blocks)
+    {
+      struct arena_block *next = arena->blocks->next;
+
+      free (arena->blocks);
+      arena->blocks = next;
+    }
+  arena_init (arena);
+}
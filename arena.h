@@ -0,0 +1,64 @@
+/*  arena.h -- Memory that is freed all at once.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* An arena hands out memory from a few large blocks and frees all of
+   it at once.  Nothing in it is freed on its own.  Allocating bumps a
+   pointer in the current block, and the last allocation can grow in
+   place, so arrays that are filled one element at a time don't move
+   around.  */
+
+#ifndef _ARENA_H_
+#define _ARENA_H_ 1
+
+#include <stddef.h>
+
+/* A block of an arena, the memory follows it.  */
+struct arena_block
+{
+  struct arena_block *next;
+  size_t size;
+  size_t used;
+};
+
+struct arena
+{
+  /* The blocks, the current one first.  */
+  struct arena_block *blocks;
+  /* The last allocation in the current block, which can grow in
+     place.  */
+  void *last;
+  /* The size of all blocks.  */
+  size_t size;
+};
+
+/* Initialize the empty arena ARENA.  */
+void arena_init (struct arena *arena);
+
+/* Return SIZE bytes from ARENA, or NULL when there is not enough
+   memory.  */
+void *arena_alloc (struct arena *arena, size_t size);
+
+/* Return N cleared elements of SIZE bytes from ARENA.  */
+void *arena_calloc (struct arena *arena, size_t n, size_t size);
+
+/* Grow or shrink PTR, which has OLDSIZE bytes and was allocated from
+   ARENA, to SIZE bytes.  PTR may be NULL.  */
+void *arena_realloc (struct arena *arena, void *ptr, size_t oldsize,
+		     size_t size);
+
+/* Return a terminated copy of the LEN characters at S from ARENA.  */
+char *arena_strndup (struct arena *arena, const char *s, size_t len);
+
+/* Free all memory of ARENA, it is empty again afterwards.  */
+void arena_free (struct arena *arena);
+
+#endif /* _ARENA_H_ */
@@ -0,0 +1,234 @@
+/*  cache.c -- Files with precompiled data.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+
+#include "cache.h"
+
+/* Map the file FILE with the protection PROT.  Store the mapping in
+   DATA and its size in SIZE.  */
+static error_t
+map_file (const char *file, int prot, void **data, size_t *size)
+{
+  struct stat st;
+  void *map;
+  int fd;
+
+  fd = open (file, O_RDONLY);
+  if (fd < 0)
+    return errno;
+  if (fstat (fd, &st) < 0)
+    {
+      close (fd);
+      return errno;
+    }
+  if (st.st_size == 0)
+    {
+      close (fd);
+      return EINVAL;
+    }
+
+  map = mmap (NULL, st.st_size, prot, MAP_PRIVATE, fd, 0);
+  close (fd);
+  if (map == MAP_FAILED)
+    return errno;
+
+  *data = map;
+  *size = st.st_size;
+  return 0;
+}
+
+/* Map the file FILE read only.  Store the mapping in DATA and its size
+   in SIZE.  */
+error_t
+cache_map (const char *file, void **data, size_t *size)
+{
+  return map_file (file, PROT_READ, data, size);
+}
+
+/* Map the file FILE writable, without writing changes back to it.
+   Store the mapping in DATA and its size in SIZE.  */
+error_t
+cache_map_private (const char *file, void **data, size_t *size)
+{
+  return map_file (file, PROT_READ | PROT_WRITE, data, size);
+}
+
+/* Write the IOVCNT buffers IOV to FILE.  The cache is written to a
+   temporary file first, so a driver that starts at the same time never
+   maps half a cache.  Every writer has a temporary file of its own,
+   also the threads of one driver that write the same cache.  */
+error_t
+cache_write (const char *file, const struct iovec *iov, int iovcnt)
+{
+  char *tmpname;
+  FILE *cache;
+  error_t err = 0;
+  int fd;
+  int i;
+
+  if (asprintf (&tmpname, "%s.XXXXXX", file) < 0)
+    return ENOMEM;
+
+  fd = mkstemp (tmpname);
+  if (fd < 0)
+    {
+      err = errno;
+      free (tmpname);
+      return err;
+    }
+  /* mkstemp makes the file private, but caches are shared.  */
+  fchmod (fd, 0644);
+  cache = fdopen (fd, "w");
+  if (!cache)
+    {
+      err = errno;
+      close (fd);
+      unlink (tmpname);
+      free (tmpname);
+      return err;
+    }
+
+  for (i = 0; i < iovcnt && !err; i++)
+    if (iov[i].iov_len
+	&& fwrite (iov[i].iov_base, iov[i].iov_len, 1, cache) != 1)
+      err = errno;
+  if (fclose (cache) && !err)
+    err = errno;
+  if (!err && rename (tmpname, file) < 0)
+    err = errno;
+  if (err)
+    unlink (tmpname);
+
+  free (tmpname);
+  return err;
+}
+
+/* Add the file PATH with the status ST to the NDEPS dependencies
+   DEPS.  */
+error_t
+cache_dep_add (struct cache_dep **deps, unsigned int *ndeps,
+	       const char *path, const struct stat *st)
+{
+  struct cache_dep *newdeps;
+
+  newdeps = realloc (*deps, (*ndeps + 1) * sizeof (*newdeps));
+  if (!newdeps)
+    return ENOMEM;
+  *deps = newdeps;
+  newdeps[*ndeps].path = strdup (path);
+  if (!newdeps[*ndeps].path)
+    return ENOMEM;
+  newdeps[*ndeps].st = *st;
+  (*ndeps)++;
+  return 0;
+}
+
+/* Free the NDEPS dependencies DEPS.  */
+void
+cache_deps_free (struct cache_dep *deps, unsigned int ndeps)
+{
+  while (ndeps--)
+    free (deps[ndeps].path);
+  free (deps);
+}
+
+/* Return the size of the NDEPS dependencies DEPS in a cache.  */
+size_t
+cache_deps_size (const struct cache_dep *deps, unsigned int ndeps)
+{
+  size_t size = 0;
+  unsigned int i;
+
+  for (i = 0; i < ndeps; i++)
+    size += (sizeof (struct cache_dep_header)
+	     + CACHE_DEP_PATHSIZE (strlen (deps[i].path)));
+  return size;
+}
+
+/* Store the NDEPS dependencies DEPS in BUF, which has room for
+   cache_deps_size bytes.  */
+void
+cache_deps_store (const struct cache_dep *deps, unsigned int ndeps,
+		  void *buf)
+{
+  char *p = buf;
+  unsigned int i;
+
+  memset (buf, 0, cache_deps_size (deps, ndeps));
+  for (i = 0; i < ndeps; i++)
+    {
+      struct cache_dep_header *dep = (struct cache_dep_header *) p;
+
+      dep->mtime_sec = deps[i].st.st_mtim.tv_sec;
+      dep->mtime_nsec = deps[i].st.st_mtim.tv_nsec;
+      dep->size = deps[i].st.st_size;
+      dep->pathlen = strlen (deps[i].path);
+      strcpy ((char *) (dep + 1), deps[i].path);
+      p += sizeof (*dep) + CACHE_DEP_PATHSIZE (dep->pathlen);
+    }
+}
+
+/* Return nonzero if the NDEPS dependencies of SIZE bytes at BUF are
+   well formed and unchanged.  Relative paths are looked up in the
+   NDIRS directories DIRFDS in order.  When FIRST is not NULL the first
+   dependency must be the file FIRST.  */
+int
+cache_deps_valid (const int *dirfds, int ndirs, const void *buf, size_t size,
+		  unsigned int ndeps, const char *first)
+{
+  const char *deps = buf;
+  size_t offset = 0;
+  unsigned int i;
+  int d;
+  error_t err;
+
+  for (i = 0; i < ndeps; i++)
+    {
+      const struct cache_dep_header *dep;
+      const char *path;
+      struct stat st;
+
+      if (size - offset < sizeof (*dep))
+	return 0;
+      dep = (const struct cache_dep_header *) (deps + offset);
+      path = (const char *) (dep + 1);
+      offset += sizeof (*dep);
+      if (dep->pathlen >= size - offset
+	  || CACHE_DEP_PATHSIZE (dep->pathlen) > size - offset
+	  || path[dep->pathlen] != '\0'
+	  || (i == 0 && first && strcmp (path, first)))
+	return 0;
+      offset += CACHE_DEP_PATHSIZE (dep->pathlen);
+
+      /* A file that now is in a directory before the one it was
+	 found in is a change as well.  */
+      err = ENOENT;
+      for (d = 0; d < ndirs && err == ENOENT; d++)
+	err = fstatat (dirfds[d], path, &st, 0) < 0 ? errno : 0;
+      if (err
+	  || dep->mtime_sec != st.st_mtim.tv_sec
+	  || dep->mtime_nsec != st.st_mtim.tv_nsec
+	  || dep->size != st.st_size)
+	return 0;
+    }
+
+  return ndeps > 0 && offset == size;
+}
@@ -0,0 +1,93 @@
+/*  cache.h -- Files with precompiled data.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* Parsed data is written to a cache file exactly as it is kept in
+   memory, so the next start maps the cache read only and uses it in
+   place.  Every cache starts with its own header that says which
+   source it was made from; checking it is up to the user of the
+   cache.
+
+   A cache made from several files stores their paths, modification
+   times and sizes in the same format, one after the other:
+
+     struct cache_dep_header
+     char path[pathlen + 1], padded with zeroes to a multiple of 8  */
+
+#ifndef _CACHE_H_
+#define _CACHE_H_ 1
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/uio.h>
+#include <sys/stat.h>
+
+/* The directory caches are kept in by default.  */
+#ifndef XKB_CACHE_DIR
+#define XKB_CACHE_DIR	"/var/cache/xkb"
+#endif
+
+/* Map the file FILE read only.  Store the mapping in DATA and its size
+   in SIZE.  Release it with munmap.  */
+error_t cache_map (const char *file, void **data, size_t *size);
+
+/* Map the file FILE like cache_map, but writable.  Changes stay private
+   to the mapping, so pointers stored in the cache can be relocated in
+   place.  */
+error_t cache_map_private (const char *file, void **data, size_t *size);
+
+/* Write the IOVCNT buffers IOV to FILE.  */
+error_t cache_write (const char *file, const struct iovec *iov, int iovcnt);
+
+/* A file a cache is made from.  */
+struct cache_dep
+{
+  char *path;
+  struct stat st;
+};
+
+/* A dependency as it is stored in a cache.  */
+struct cache_dep_header
+{
+  int64_t mtime_sec;
+  int64_t mtime_nsec;
+  int64_t size;
+  uint32_t pathlen;
+  uint32_t unused;
+};
+
+#define CACHE_DEP_PATHSIZE(len)	(((len) + 8) & ~(size_t) 7)
+
+/* Add the file PATH with the status ST to the NDEPS dependencies
+   DEPS.  */
+error_t cache_dep_add (struct cache_dep **deps, unsigned int *ndeps,
+		       const char *path, const struct stat *st);
+
+/* Free the NDEPS dependencies DEPS.  */
+void cache_deps_free (struct cache_dep *deps, unsigned int ndeps);
+
+/* Return the size of the NDEPS dependencies DEPS in a cache.  */
+size_t cache_deps_size (const struct cache_dep *deps, unsigned int ndeps);
+
+/* Store the NDEPS dependencies DEPS in BUF, which has room for
+   cache_deps_size bytes.  */
+void cache_deps_store (const struct cache_dep *deps, unsigned int ndeps,
+		       void *buf);
+
+/* Return nonzero if the NDEPS dependencies of SIZE bytes at BUF are
+   well formed and unchanged.  Relative paths are looked up in the
+   NDIRS directories DIRFDS in order, which may be AT_FDCWD.  When
+   FIRST is not NULL the first dependency must be the file FIRST.  */
+int cache_deps_valid (const int *dirfds, int ndirs, const void *buf,
+		      size_t size, unsigned int ndeps, const char *first);
+
+#endif /* _CACHE_H_ */
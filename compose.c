@@ -21,13 +21,32 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#define XK_MISCELLANY
 #include "keysymdef.h"
 #include "xkb.h"
 #include <ctype.h>
 #include <string.h>
+#include <stdint.h>
+#include <locale.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <cthreads.h>
+
+#include "kshash.h"
+#include "cache.h"
+
+#define NEEDDEADTABLE
+#include "ks_tables.h"
 
 #define	NoSymbol	0
 
+/* The directory with the Compose files of all locales, unless
+   XLOCALEDIR is set in the environment.  */
+#ifndef XLOCALEDIR
+#define XLOCALEDIR	"/share/X11/locale"
+#endif
+
 /* Tokens that can be recognised by the scanner.  */
 enum tokentype
   {
@@ -40,383 +59,1231 @@ enum tokentype
     END
   };
 
-/* The current token.  */
+/* The current token.  The value of REQKS, STR and PRODKS tokens points
+   into the Compose file and is not terminated.  The value of a STR
+   token still has its backslash escapes.  */
 struct token
 {
   enum tokentype toktype;
-  char value[50];
-} tok;
+  const char *value;
+  size_t len;
+};
 
-/* The linenumber of the line currently parsed, used for returning
-   errors and warnings.  */
-static int linenum;
+/* A Compose file that is tokenized in one pass over a single buffer.
+   Tokens are never copied.  */
+struct scanner
+{
+  const char *pos;
+  const char *end;
+  struct token tok;
+  /* The name of the file, the linenumber of the line currently parsed,
+     used for returning errors and warnings.  */
+  const char *file;
+  int linenum;
+  /* A number for the file, see compose_origin.  */
+  unsigned int origin;
+  /* The file that includes this one, or NULL, and the amount of
+     includes that lead to this file.  */
+  struct scanner *parent;
+  int depth;
+  /* The file, to recognise include loops.  */
+  dev_t dev;
+  ino_t ino;
+};
 
-/* Read a token from the file CF.  */
+/* Read a token from the scanner SC.  A `<' or `"' that isn't closed on
+   the same line gives an UNKNOWN token, so a broken line never eats the
+   lines that follow it.  */
 static void
-read_token (FILE *cf)
+read_token (struct scanner *sc)
 {
-  int c = fgetc (cf);
-  int pos = 0;
+  const char *p = sc->pos;
+  const char *end = sc->end;
+  struct token *tok = &sc->tok;
+  const char *q;
 
   /* Remove whitespaces.  */
-  while (c == ' ' || c == '\t')
-    c = fgetc (cf);
+  while (p < end && (*p == ' ' || *p == '\t'))
+    p++;
+
+  tok->value = NULL;
+  tok->len = 0;
 
-  /* Comment, remove until end of line and return a EOL token.  */
-  if (c == '#')
+  /* Comment, remove until end of line.  */
+  if (p < end && *p == '#')
     {
-      while (c != '\n')
-	c = fgetc (cf);
-      tok.toktype = EOL;
-      linenum++;
-      return;
+      p = memchr (p, '\n', end - p);
+      if (!p)
+	p = end;
     }
 
   /* End of file.  */
-  if (c == EOF)
+  if (p == end)
     {
-      tok.toktype = END;
+      tok->toktype = END;
+      sc->pos = p;
       return;
     }
 
-  /* Semicolon.  */
-  if (c == ':')
+  switch (*p)
     {
-      tok.toktype = SEMICOL;
-      return;
-    }
+    case ':':
+      /* Semicolon.  */
+      tok->toktype = SEMICOL;
+      p++;
+      break;
 
-  /* End of line.  */
-  if (c == '\n')
-    {
-      linenum++;
-      tok.toktype = EOL;
-      return;
-    }
-  
+    case '\n':
+      /* End of line.  */
+      sc->linenum++;
+      tok->toktype = EOL;
+      p++;
+      break;
 
-  /* Required keysym.  */
-  if (c == '<')
-    {
-      while ((c = fgetc (cf)) != '>')
-	tok.value[pos++] = c;
-      tok.value[pos] = '\0';
-      tok.toktype = REQKS;
-      return;
-    }
+    case '<':
+      /* Required keysym.  */
+      for (q = p + 1; q < end && *q != '>' && *q != '\n' && *q; q++)
+	;
+      if (q == end || *q != '>')
+	{
+	  tok->toktype = UNKNOWN;
+	  p = q;
+	  break;
+	}
+      tok->toktype = REQKS;
+      tok->value = p + 1;
+      tok->len = q - p - 1;
+      p = q + 1;
+      break;
 
-  /* Character string.  */
-  if (c == '"')
-    {
-      while ((c = fgetc (cf)) != '"')
+    case '"':
+      /* Character string.  */
+      for (q = p + 1; q < end && *q != '"' && *q != '\n'; q++)
+	if (*q == '\\' && q + 1 < end && q[1] != '\n')
+	  q++;
+      if (q == end || *q != '"')
 	{
- 	  if (c == '\\')
-	    c = fgetc (cf);
+	  tok->toktype = UNKNOWN;
+	  p = q;
+	  break;
+	}
+      tok->toktype = STR;
+      tok->value = p + 1;
+      tok->len = q - p - 1;
+      p = q + 1;
+      break;
 
-	  tok.value[pos++] = c;
+    default:
+      /* Produced keysym.  */
+      if (isalpha ((unsigned char) *p))
+	{
+	  for (q = p + 1; q < end && isgraph ((unsigned char) *q); q++)
+	    ;
+	  tok->toktype = PRODKS;
+	  tok->value = p;
+	  tok->len = q - p;
+	  p = q;
+	  break;
 	}
-      tok.value[pos] = '\0';
-      tok.toktype = STR;
-      return;
-    }
 
-  /* Produced keysym.  */
-  if (isalpha (c))
-    {
-      tok.value[pos++] = c;
-      while (isgraph (c = fgetc (cf)))
-	tok.value[pos++] = c;
-      tok.value[pos] = '\0';
-      tok.toktype = PRODKS;
-      ungetc (c, cf);
-      return;
+      /* Unknown token.  */
+      tok->toktype = UNKNOWN;
+      p++;
+      break;
     }
 
-  /* Unknown token.  */
-  tok.toktype = UNKNOWN;
-  return;
+  sc->pos = p;
 }
 
-/* Compose sequence.  */
-struct compose
+/* The Compose sequences are kept in a trie.  Every state of the trie
+   is a prefix of one or more sequences, state 0 is the empty prefix.
+   The edges between states are kept in one hash table, keyed on the
+   state and the keysym, so every typed keysym costs a single lookup
+   no matter how many sequences start the same way.  */
+
+/* A state of the trie.  A state that produces a keysym or a string
+   ends a sequence, other states expect more keysyms.  */
+struct compose_state
 {
-  struct compose *left;
-  struct compose *right;
-  symbol *expected;
+  /* The keysym produced when this state is reached, or NoSymbol.  */
   symbol produced;
-} *compose_tree;
+  /* The UTF-8 string produced when this state is reached, as an offset
+     in the string pool, and its length.  The length is 0 when there is
+     no string, the keysym is used then.  */
+  unsigned int string;
+  unsigned int stringlen;
+};
 
+/* An edge from the state FROM to the state TO for the keysym KS.  An
+   edge with TO 0 is unused, because no edge leads back to state 0.  An
+   edge with FROM COMPOSE_NO_STATE was removed, see compose_prune.  */
+struct compose_edge
+{
+  unsigned int from;
+  symbol ks;
+  unsigned int to;
+};
 
-/* Compare symbol sequence s1 to symbol sequence s1. This function
-   works just like the strcmp function.  */
-static int
-symbolscmp (symbol *s1, symbol *s2)
+#define COMPOSE_NO_STATE	(~0U)
+
+static struct compose_state *compose_states;
+static unsigned int compose_nstates;
+static unsigned int compose_allocstates;
+
+/* The file that last defined a sequence through every state, only
+   kept while compiling.  A file may override the sequences of the
+   files before it, for example the ones it includes, but defining a
+   sequence twice in one file is most likely a mistake.  */
+static unsigned int *compose_origin;
+static unsigned int compose_norigins;
+
+/* The strings produced by the states.  They are not terminated.  */
+static char *compose_strings;
+static unsigned int compose_stringsize;
+static unsigned int compose_allocstrings;
+
+/* Return nonzero if the state STATE ends a sequence.  */
+static inline int
+compose_final (unsigned int state)
+{
+  return compose_states[state].produced || compose_states[state].stringlen;
+}
+
+/* The edge hash table, its size is a power of two.  */
+static struct compose_edge *compose_edges;
+static unsigned int compose_edgesize;
+static unsigned int compose_nedges;
+
+/* The slot of the edge for KS from state FROM.  */
+static inline unsigned int
+compose_edge_hash (unsigned int from, symbol ks)
 {
-  while (*s1 && *s2 && (*s1 == *s2))
+  unsigned int h = (from * 0x9e3779b1U) ^ (unsigned int) ks;
+
+  h *= 0x85ebca6bU;
+  return h ^ (h >> 16);
+}
+
+/* Return the state reached from FROM with the keysym KS, or 0 if there
+   is no such state.  */
+static inline unsigned int
+compose_edge_find (unsigned int from, symbol ks)
+{
+  unsigned int mask = compose_edgesize - 1;
+  unsigned int i;
+
+  if (!compose_edges)
+    return 0;
+
+  for (i = compose_edge_hash (from, ks) & mask; compose_edges[i].to;
+       i = (i + 1) & mask)
+    if (compose_edges[i].from == from && compose_edges[i].ks == ks)
+      return compose_edges[i].to;
+  return 0;
+}
+
+/* Store EDGE in the edge table, which has room for it.  */
+static void
+compose_edge_insert (struct compose_edge *edge)
+{
+  unsigned int mask = compose_edgesize - 1;
+  unsigned int i;
+
+  for (i = compose_edge_hash (edge->from, edge->ks) & mask;
+       compose_edges[i].to; i = (i + 1) & mask)
+    ;
+  compose_edges[i] = *edge;
+}
+
+/* Store a new state in STATE.  */
+static error_t
+compose_state_new (unsigned int *state)
+{
+  if (compose_nstates == compose_allocstates)
     {
-      s1++;s2++;
+      unsigned int n = compose_allocstates ? compose_allocstates * 2 : 256;
+      struct compose_state *states;
+      unsigned int *origin;
+
+      states = realloc (compose_states, n * sizeof (*states));
+      if (!states)
+	return ENOMEM;
+      compose_states = states;
+      origin = realloc (compose_origin, n * sizeof (*origin));
+      if (!origin)
+	return ENOMEM;
+      compose_origin = origin;
+      compose_allocstates = n;
     }
-  if (*s1 < *s2)
-    return -1;
-  if (*s1 > *s2)
-    return 1;
-  return 0;  
+
+  compose_states[compose_nstates].produced = NoSymbol;
+  compose_states[compose_nstates].string = 0;
+  compose_states[compose_nstates].stringlen = 0;
+  compose_origin[compose_nstates] = 0;
+  *state = compose_nstates++;
+  return 0;
 }
 
-/* Compare symbol sequence s1 to symbol sequence s1, compare a maximum
-   of N symbols. This function works just like the strcmp function.
-   */
-static int
-symbolsncmp (symbol *s1, symbol *s2, int n)
+/* Add an edge from the state FROM for the keysym KS to a new state and
+   return the new state, or 0 if there is no memory.  */
+static unsigned int
+compose_edge_add (unsigned int from, symbol ks)
 {
-  int cnt = 0;
-  while (*s1 && *s2 && (*s1 == *s2))
+  struct compose_edge edge;
+
+  /* Keep the table at most half full.  */
+  if ((compose_nedges + 1) * 2 > compose_edgesize)
     {
-      if (++cnt == n)
-	break;
-      s1++;s2++;
+      struct compose_edge *old = compose_edges;
+      unsigned int oldsize = compose_edgesize;
+      unsigned int i;
+
+      compose_edgesize = oldsize ? oldsize * 2 : 1024;
+      compose_edges = calloc (compose_edgesize, sizeof (*compose_edges));
+      if (!compose_edges)
+	{
+	  compose_edges = old;
+	  compose_edgesize = oldsize;
+	  return 0;
+	}
+      /* Removed edges are dropped here.  */
+      compose_nedges = 0;
+      for (i = 0; i < oldsize; i++)
+	if (old[i].to && old[i].from != COMPOSE_NO_STATE)
+	  {
+	    compose_edge_insert (&old[i]);
+	    compose_nedges++;
+	  }
+      free (old);
     }
 
-  if (*s1 < *s2)
-    return -1;
-  if (*s1 > *s2)
-    return 1;
-  return 0;  
+  edge.from = from;
+  edge.ks = ks;
+  if (compose_state_new (&edge.to))
+    return 0;
+  compose_edge_insert (&edge);
+  compose_nedges++;
+  return edge.to;
 }
 
+/* Decode the escapes of the LEN characters of the string token VALUE
+   into the string pool.  Store the offset of the string in the pool in
+   STRING and its length in STRINGLEN.  Only UTF-8 strings are kept,
+   for other strings STRINGLEN is 0.  */
+static error_t
+compose_string_add (const char *value, size_t len, unsigned int *string,
+		    unsigned int *stringlen)
+{
+  const char *end = value + len;
+  char *out;
+
+  /* Escapes never make a string longer.  */
+  if (compose_stringsize + len > compose_allocstrings)
+    {
+      unsigned int n = compose_allocstrings ? compose_allocstrings : 4096;
+      char *strings;
+
+      while (n < compose_stringsize + len)
+	n *= 2;
+      strings = realloc (compose_strings, n);
+      if (!strings)
+	return ENOMEM;
+      compose_strings = strings;
+      compose_allocstrings = n;
+    }
+
+  out = &compose_strings[compose_stringsize];
+  while (value < end)
+    {
+      int c = (unsigned char) *value++;
+
+      if (c == '\\' && value < end)
+	{
+	  c = (unsigned char) *value++;
+	  if (c >= '0' && c <= '7')
+	    {
+	      /* Up to three octal digits.  */
+	      int i;
 
-/* Add the compose sequence EXP to the binary tree, store RESULT as
-   the keysym produced by EXP.  */
-static struct compose *
-composetree_add (struct compose *tree, symbol *exp, symbol result)
+	      c -= '0';
+	      for (i = 1; i < 3 && value < end
+		     && *value >= '0' && *value <= '7'; i++)
+		c = c * 8 + *value++ - '0';
+	    }
+	  else if ((c == 'x' || c == 'X') && value < end
+		   && isxdigit ((unsigned char) *value))
+	    {
+	      /* Up to two hexadecimal digits.  */
+	      int i;
+
+	      c = 0;
+	      for (i = 0; i < 2 && value < end
+		     && isxdigit ((unsigned char) *value); i++, value++)
+		c = c * 16 + (isdigit ((unsigned char) *value) ? *value - '0'
+			      : (tolower ((unsigned char) *value) - 'a' + 10));
+	    }
+	  else if (c == 'n')
+	    c = '\n';
+	  else if (c == 't')
+	    c = '\t';
+	}
+      *out++ = c;
+    }
+
+  *string = compose_stringsize;
+  *stringlen = out - &compose_strings[compose_stringsize];
+  if (*stringlen && !utf8_valid (&compose_strings[*string], *stringlen))
+    *stringlen = 0;
+  compose_stringsize += *stringlen;
+  return 0;
+}
+
+/* Remove all sequences that continue after the state STATE.  Their
+   edges stay in the table with the source COMPOSE_NO_STATE, so the
+   probe sequences of other edges are not broken.  */
+static void
+compose_prune (unsigned int state)
 {
-  int cmp;
+  unsigned int i;
 
-  if (tree == NULL)
+  for (i = 0; i < compose_edgesize; i++)
+    if (compose_edges[i].to && compose_edges[i].from == state)
+      {
+	compose_edges[i].from = COMPOSE_NO_STATE;
+	compose_prune (compose_edges[i].to);
+      }
+}
+
+/* Add the compose sequence EXP of EXPCNT keysyms, read from the line
+   LINENUM of the file of SC, to the trie.  Store RESULT as the keysym
+   and the STRINGLEN bytes at STRING in the string pool as the string
+   produced by EXP.  A sequence replaces the sequences it conflicts
+   with, so the last definition wins.  */
+static error_t
+compose_add (struct scanner *sc, int linenum, symbol *exp, size_t expcnt,
+	     symbol result, unsigned int string, unsigned int stringlen)
+{
+  unsigned int state = 0;
+  int new = 0;
+  size_t i;
+
+  /* State 0, the start of every sequence.  */
+  if (!compose_states && compose_state_new (&state))
+    return ENOMEM;
+
+  for (i = 0; i < expcnt; i++)
     {
-      tree = malloc (sizeof (struct compose));
-      tree->expected = exp;
-      tree->produced = result;
-      tree->left = tree->right = NULL;
-      
-      return tree;
+      unsigned int next = compose_edge_find (state, exp[i]);
+
+      new = !next;
+      if (!next)
+	{
+	  next = compose_edge_add (state, exp[i]);
+	  if (!next)
+	    return ENOMEM;
+	}
+      else if (compose_final (next) && i < expcnt - 1)
+	{
+	  if (compose_origin[next] == sc->origin)
+	    printf ("Warning: %s:%d: Sequence starts with another "
+		    "sequence.\n", sc->file, linenum);
+	  compose_states[next].produced = NoSymbol;
+	  compose_states[next].stringlen = 0;
+	}
+      else if (i == expcnt - 1 && compose_origin[next] == sc->origin)
+	{
+	  if (compose_final (next))
+	    printf ("Warning: %s:%d: Double sequence.\n", sc->file, linenum);
+	  else
+	    printf ("Warning: %s:%d: Sequence is the start of another "
+		    "sequence.\n", sc->file, linenum);
+	}
+      compose_origin[next] = sc->origin;
+      state = next;
     }
-  
-  cmp = symbolscmp (exp, tree->expected);
-  if (cmp == 0)
+
+  if (!new && !compose_final (state))
+    compose_prune (state);
+  compose_states[state].produced = result;
+  compose_states[state].string = string;
+  compose_states[state].stringlen = stringlen;
+  return 0;
+}
+
+/* The longest compose sequence, longer ones are rejected.  */
+#define COMPOSE_MAX_SEQUENCE	32
+/* How deep includes may be nested.  */
+#define COMPOSE_MAX_INCLUDE	8
+
+/* Add the sequences of a dead key and a letter, and of a dead key and
+   a space, from ks_tables.h to the trie.  A dead key is then just the
+   first keysym of a sequence.  They are added before the Compose file,
+   so its sequences replace them silently.  */
+static error_t
+compose_add_dead (void)
+{
+  struct scanner sc;
+  unsigned int i;
+  error_t err;
+
+  sc.file = "dead keys";
+  sc.origin = ++compose_norigins;
+  for (i = 0; i < KSDEAD; i++)
     {
-      printf ("Warning: line %d: Double sequence.\n", linenum);
-      free (exp);
+      symbol exp[2] = { ks_dead[i][0], ks_dead[i][1] };
+
+      err = compose_add (&sc, 0, exp, 2, ks_dead[i][2], 0, 0);
+      if (err)
+	return err;
     }
-  else if (cmp < 0)
-    tree->left = composetree_add (tree->left, exp, result);
-  else
-    tree->right = composetree_add (tree->right, exp, result);
-  return tree;
+  return 0;
 }
 
-/* Parse the composefile CF and put all sequences in the binary tree
-   COMPOSE_TREE. This function may never fail because of syntactical or
+static error_t compose_parse_file (const char *file, struct scanner *parent);
+static error_t compose_expand (const char *value, size_t len, char **path);
+
+/* Parse the composefile in SC and put all sequences in the compose
+   trie.  This function may never fail because of syntactical or
    lexalical errors, generate a warning instead.  */
 static error_t
-parse_composefile (FILE *cf)
+parse_composefile (struct scanner *sc)
 {
+  struct token *tok = &sc->tok;
+
   void skip_line (void)
     {
-      while (tok.toktype != EOL && tok.toktype != END)
-	read_token (cf);
+      while (tok->toktype != EOL && tok->toktype != END)
+	read_token (sc);
     }
 
   for (;;)
     {  
       /* Expected keysyms.  */
-      symbol exp[50];
-      symbol *exps;
+      symbol exp[COMPOSE_MAX_SEQUENCE];
       size_t expcnt = 0;
       symbol sym;
+      unsigned int string;
+      unsigned int stringlen;
+      error_t err;
+      int line = sc->linenum;
 
-      read_token (cf);
+      read_token (sc);
       /* Blank line.  */
-      if (tok.toktype == EOL)
+      if (tok->toktype == EOL)
 	continue;
 
       /* End of file, done parsing.  */
-      if (tok.toktype == END)
+      if (tok->toktype == END)
 	return 0;
 
-      if (tok.toktype != REQKS)
+      /* Include another Compose file here.  */
+      if (tok->toktype == PRODKS && tok->len == 7
+	  && !memcmp (tok->value, "include", 7))
 	{
-	  printf ("Warning: line %d: Keysym expected on beginning of line.\n",
-		  linenum);
-	  skip_line ();
+	  char *path;
+
+	  read_token (sc);
+	  if (tok->toktype != STR)
+	    {
+	      printf ("Warning: %s:%d: string expected.\n", sc->file, line);
+	      skip_line ();
+	      continue;
+	    }
+	  err = compose_expand (tok->value, tok->len, &path);
+	  if (err == ENOMEM)
+	    return err;
+	  if (err)
+	    {
+	      printf ("Warning: %s:%d: Can't expand \"%.*s\".\n", sc->file,
+		      line, (int) tok->len, tok->value);
+	      skip_line ();
+	      continue;
+	    }
+
+	  err = compose_parse_file (path, sc);
+	  if (err && err != ENOMEM)
+	    printf ("Warning: %s:%d: Can't include %s: %s.\n", sc->file, line,
+		    path, strerror (err));
+	  free (path);
+	  if (err == ENOMEM)
+	    return err;
+
+	  read_token (sc);
+	  if (tok->toktype != EOL && tok->toktype != END)
+	    {
+	      printf ("Warning: %s:%d: end of line or end of file "
+		      "expected.\n", sc->file, line);
+	      skip_line ();
+	    }
 	  continue;
 	}
 
-      /* Keysym was recognised, add it.  */
-      sym = XStringToKeysym (tok.value);
-      if (!sym)
+      if (tok->toktype != REQKS)
 	{
-	  printf ("Warning: line %d: Unknown keysym \"%s\".\n", linenum, 
-		  tok.value);
+	  printf ("Warning: %s:%d: Keysym expected on beginning of line.\n",
+		  sc->file, line);
 	  skip_line ();
 	  continue;
 	}
-      exp[expcnt++] = sym;
 
+      /* Add the required keysyms.  On an error the loop stops at the
+	 offending keysym.  */
       do
 	{
-	  read_token (cf);
-	  /* If another required keysym is recognised, add it.  */
-	  if (tok.toktype == REQKS)
+	  if (expcnt == COMPOSE_MAX_SEQUENCE)
+	    {
+	      printf ("Warning: %s:%d: Sequence too long.\n", sc->file, line);
+	      break;
+	    }
+
+	  sym = XStringToKeysymLen (tok->value, tok->len);
+	  if (!sym)
 	    {
-	      sym = XStringToKeysym (tok.value);
-	      if (!sym)
-		{
-		  printf ("Warning: line %d: Unknown keysym \"%s\".\n", 
-			  linenum, tok.value);
-		  skip_line ();
-		  continue;
-		}
-	      exp[expcnt++] = sym;
+	      printf ("Warning: %s:%d: Unknown keysym \"%.*s\".\n",
+		      sc->file, line, (int) tok->len, tok->value);
+	      break;
 	    }
-	} while (tok.toktype == REQKS);
+	  exp[expcnt++] = sym;
 
-      if (tok.toktype != SEMICOL)
+	  read_token (sc);
+	} while (tok->toktype == REQKS);
+
+      if (tok->toktype == REQKS)
 	{
-	  printf ("Warning: line %d: Semicolon expected.\n", linenum);
 	  skip_line ();
 	  continue;
 	}
 
-      read_token (cf);
-      /* Force token and ignore it.  */
-      if (tok.toktype != STR)
+      if (tok->toktype != SEMICOL)
 	{
-	  printf ("Warning: line %d: string expected.\n", linenum);
+	  printf ("Warning: %s:%d: Semicolon expected.\n", sc->file, line);
 	  skip_line ();
 	  continue;
 	}
 
-      read_token (cf);
-      if (tok.toktype != PRODKS)
+      /* The result, a string, a keysym or both.  */
+      read_token (sc);
+      string = stringlen = 0;
+      if (tok->toktype == STR)
+	{
+	  err = compose_string_add (tok->value, tok->len, &string,
+				    &stringlen);
+	  if (err)
+	    return err;
+	  read_token (sc);
+	}
+      else if (tok->toktype != PRODKS)
 	{
-	  printf ("Warning: line %d: keysym expected.\n", linenum);
+	  printf ("Warning: %s:%d: string or keysym expected.\n", sc->file,
+		  line);
 	  skip_line ();
 	  continue;
 	}
-      sym = XStringToKeysym (tok.value);
-      if (!sym)
+
+      sym = NoSymbol;
+      if (tok->toktype == PRODKS)
 	{
-	  printf ("Warning: line %d: Unknown keysym \"%s\".\n", linenum,
-		  tok.value);
+	  sym = XStringToKeysymLen (tok->value, tok->len);
+	  if (!sym)
+	    {
+	      printf ("Warning: %s:%d: Unknown keysym \"%.*s\".\n",
+		      sc->file, line, (int) tok->len, tok->value);
+	      skip_line ();
+	      continue;
+	    }
+	}
+      else if (!stringlen)
+	{
+	  printf ("Warning: %s:%d: String is not UTF-8 and no keysym "
+		  "is given.\n", sc->file, line);
 	  skip_line ();
 	  continue;
 	}
 
-      read_token (cf);
-      if (tok.toktype != EOL && tok.toktype != END)
+      if (tok->toktype == PRODKS)
+	read_token (sc);
+      if (tok->toktype != EOL && tok->toktype != END)
 	{
-	  printf ("Warning: line %d: end of line or end of file expected.\n",
-		  linenum);
+	  printf ("Warning: %s:%d: end of line or end of file expected.\n",
+		  sc->file, line);
 	  skip_line ();
 	  continue;
 	}
 
       /* Add the production rule.  */
-      exp[expcnt++] = 0;
-      exps = malloc (sizeof (symbol) * expcnt);
-      memcpy (exps, exp, sizeof (symbol) * expcnt);
-      compose_tree = composetree_add (compose_tree, exps, sym);
+      err = compose_add (sc, line, exp, expcnt, sym, string, stringlen);
+      if (err)
+	return err;
     }
   return 0;
 }
 
+/* The Compose file and the cache directory given to compose_init.  The
+   table is only loaded when a Multi_key or a dead key is pressed for
+   the first time, so a session that never composes doesn't pay for
+   it.  */
+static const char *compose_file;
+static const char *compose_cachedir;
+/* Set when the table was loaded, or couldn't be loaded.  */
+static int compose_loaded;
+static struct mutex compose_lock = MUTEX_INITIALIZER;
+
+static void compose_load (void);
+
 /* Read keysyms passed to this function by S until a keysym can be
    composed. If the first keysym cannot start a compose sequence return
-   the keysym.  */
+   the keysym.  When the sequence produces a string it is stored in
+   *STRING and its length in *STRINGLEN, *STRING is NULL otherwise.
+   The progress of the sequence is kept in CTX, the trie itself is only
+   read, so every context can be used by its own thread.  */
 symbol
-compose_symbols (symbol s)
+compose_symbols (struct compose_context *ctx, symbol s,
+		 const char **string, size_t *stringlen)
 {
-  /* Current position in the compose tree.  */
-  static struct compose *treepos = NULL;
-  /* Current compose sequence.  */
-  static symbol syms[100];
-  /* Current position in the compose sequence.  */
-  static int pos = 0;
-  int cmp;
-
-  if (!treepos)
-    treepos = compose_tree;
-
-  /* Maximum sequence length reached. Some idiot typed this many
-     symbols and now we throw it all away, wheee!!!  */
-  if (pos == 99)
+  unsigned int next;
+
+  *string = NULL;
+  if (!__atomic_load_n (&compose_loaded, __ATOMIC_ACQUIRE))
     {
-      treepos = compose_tree;
-      pos = 0;
+      if (s != XK_Multi_key && !(keysym_class (s) & KS_DEAD))
+	return s;
+      compose_load ();
     }
 
-  /* Put the keysym in the compose sequence array.  */
-  syms[pos++] = s;
-  syms[pos] = 0;
+  next = compose_edge_find (ctx->state, s);
+  if (!next)
+    {
+      /* This ks should've started a sequence but couldn't be found,
+	 just return it.  */
+      if (ctx->state == 0)
+	return s;
+
+      debug_printf ("Invalid compose sequence at %s\n", KEYSYM_NAME (s));
+      /* Invalid keysym sequence.  */
+      ctx->state = 0;
+      return -1;
+    }
 
-  /* Search the tree for a keysym sequence that can match the current one.  */
-  while (treepos)
+  /* The sequence is complete.  */
+  if (compose_final (next))
     {
-      cmp = symbolsncmp (syms, treepos->expected, pos);
-      if (cmp == 0)
+      ctx->state = 0;
+      if (compose_states[next].stringlen)
 	{
-	  /* The keysym sequence was partially recognised, check if it
-	     can completely match.  */
-	  if (!symbolscmp (syms, treepos->expected))
-	    {
-	      symbol ret = treepos->produced;
-	      treepos = compose_tree;
-	      pos = 0;
-	      return ret;
-	    }
-
-	  /* The sequence was partially recognised.  */
-	  return -1;
+	  *string = &compose_strings[compose_states[next].string];
+	  *stringlen = compose_states[next].stringlen;
 	}
+      return compose_states[next].produced;
+    }
+
+  /* The sequence was partially recognised.  */
+  ctx->state = next;
+  return -1;
+}
+
+/* The files the table is compiled from: the Compose file, the files it
+   includes and compose.dir when it was needed to find them.  Only kept
+   while compiling.  */
+static struct cache_dep *compose_deps;
+static unsigned int compose_ndeps;
+
+/* Add the file PATH with the status ST to the dependencies.  */
+static error_t
+compose_dep_add (const char *path, struct stat *st)
+{
+  return cache_dep_add (&compose_deps, &compose_ndeps, path, st);
+}
 
-      if (cmp < 0)
-	treepos = treepos->left;
+/* Forget the dependencies and the origins of the states, they are not
+   needed after compiling.  */
+static void
+compose_compiled (void)
+{
+  cache_deps_free (compose_deps, compose_ndeps);
+  compose_deps = NULL;
+  compose_ndeps = 0;
+  free (compose_origin);
+  compose_origin = NULL;
+}
+
+/* The directory with the Compose files of all locales.  */
+static const char *
+compose_localedir (void)
+{
+  return getenv ("XLOCALEDIR") ? : XLOCALEDIR;
+}
+
+/* Return nonzero if the LEN characters at A name the locale B.  The
+   spelling of the codeset doesn't matter, en_US.utf8 is en_US.UTF-8.  */
+static int
+compose_locale_equal (const char *a, size_t len, const char *b)
+{
+  const char *end = a + len;
+  int codeset = 0;
+
+  while (a < end && *b)
+    {
+      if (codeset && (*a == '-' || *a == '_'))
+	a++;
+      else if (codeset && (*b == '-' || *b == '_'))
+	b++;
+      else if (codeset ? tolower ((unsigned char) *a)
+	       != tolower ((unsigned char) *b) : *a != *b)
+	return 0;
       else
-	treepos = treepos->right;
-    }  
+	{
+	  if (*a == '.')
+	    codeset = 1;
+	  else if (*a == '@')
+	    codeset = 0;
+	  a++;
+	  b++;
+	}
+    }
+  return a == end && !*b;
+}
 
-  /* Nothing can be found.  */
-  treepos = compose_tree;
+/* Store the Compose file of the current locale in FILE.  It is looked
+   up in the compose.dir file of the locale directory.  When DEP is
+   nonzero compose.dir is added to the dependencies.  */
+static error_t
+compose_locale_file (char **file, int dep)
+{
+  struct stat st;
+  const char *locale = setlocale (LC_CTYPE, NULL);
+  const char *dir = compose_localedir ();
+  const char *p;
+  const char *end;
+  char *dirfile;
+  void *map;
+  size_t size;
+  error_t err;
+
+  if (!locale)
+    return ENOENT;
 
-  /* This ks should've started a sequence but couldn't be found,
-     just return it.  */
-  if (pos == 1)
+  if (asprintf (&dirfile, "%s/compose.dir", dir) < 0)
+    return ENOMEM;
+  err = stat (dirfile, &st) < 0 ? errno : cache_map (dirfile, &map, &size);
+  if (!err && dep)
     {
-      pos = 0;   
-      return s;
+      err = compose_dep_add (dirfile, &st);
+      if (err)
+	munmap (map, size);
     }
+  free (dirfile);
+  if (err)
+    return err;
 
-  debug_printf ("Invalid\n");
-  /* Invalid keysym sequence.  */
-  pos = 0;   
-  return -1;
+  /* Every line is the name of a Compose file, relative to the locale
+     directory, and the name of a locale.  */
+  err = ENOENT;
+  for (p = map, end = p + size; p < end && err == ENOENT; )
+    {
+      const char *eol = memchr (p, '\n', end - p) ? : end;
+      const char *name = p;
+      const char *namend;
+      const char *loc;
+      const char *locend;
+
+      p = eol + 1;
+      while (name < eol && isspace ((unsigned char) *name))
+	name++;
+      if (name == eol || *name == '#')
+	continue;
+      for (namend = name; namend < eol && !isspace ((unsigned char) *namend);
+	   namend++)
+	;
+      for (loc = namend; loc < eol && isspace ((unsigned char) *loc); loc++)
+	;
+      for (locend = loc; locend < eol && !isspace ((unsigned char) *locend);
+	   locend++)
+	;
+      /* Old files put a colon after the name of the Compose file.  */
+      if (namend > name && namend[-1] == ':')
+	namend--;
+
+      if (loc < locend && compose_locale_equal (loc, locend - loc, locale)
+	  && asprintf (file, "%s/%.*s", dir, (int) (namend - name), name) >= 0)
+	err = 0;
+    }
+
+  munmap (map, size);
+  return err;
 }
 
-/* Read a Compose file.  */
-error_t
-read_composefile (char *composefn)
+/* Expand the LEN characters of the include path VALUE into a new
+   string in PATH.  %H is the home directory, %L the Compose file of
+   the locale, %S the locale directory and %% a percent sign.  */
+static error_t
+compose_expand (const char *value, size_t len, char **path)
 {
-  FILE *cf;
+  const char *end = value + len;
+  char *buf;
+  size_t size;
+  FILE *out;
+  error_t err = 0;
+
+  out = open_memstream (&buf, &size);
+  if (!out)
+    return ENOMEM;
+
+  for (; value < end && !err; value++)
+    if (*value != '%')
+      putc (*value, out);
+    else if (++value == end)
+      err = EINVAL;
+    else
+      switch (*value)
+	{
+	case 'H':
+	  if (getenv ("HOME"))
+	    fputs (getenv ("HOME"), out);
+	  else
+	    err = ENOENT;
+	  break;
+
+	case 'L':
+	  {
+	    char *file;
 
+	    /* A change of compose.dir may change the file that is
+	       included.  */
+	    err = compose_locale_file (&file, 1);
+	    if (err)
+	      break;
+	    fputs (file, out);
+	    free (file);
+	    break;
+	  }
+
+	case 'S':
+	  fputs (compose_localedir (), out);
+	  break;
+
+	case '%':
+	  putc ('%', out);
+	  break;
+
+	default:
+	  err = EINVAL;
+	  break;
+	}
+
+  if (fclose (out) && !err)
+    err = ENOMEM;
+  if (err)
+    free (buf);
+  else
+    *path = buf;
+  return err;
+}
+
+/* Parse the Compose file FILE, which is included by the file of PARENT
+   if it is not NULL, into the trie.  */
+static error_t
+compose_parse_file (const char *file, struct scanner *parent)
+{
+  struct scanner sc;
+  struct scanner *p;
+  struct stat st;
+  void *map;
+  size_t size;
   error_t err;
-  cf = fopen (composefn, "r");
-  if (cf == NULL)
+
+  if (stat (file, &st) < 0)
     return errno;
-  
-  err = parse_composefile (cf);
+
+  sc.depth = parent ? parent->depth + 1 : 0;
+  if (sc.depth > COMPOSE_MAX_INCLUDE)
+    return ELOOP;
+  for (p = parent; p; p = p->parent)
+    if (p->dev == st.st_dev && p->ino == st.st_ino)
+      return ELOOP;
+  err = compose_dep_add (file, &st);
   if (err)
-    fclose (cf);
-  
+    return err;
+
+  /* The whole file is mapped and tokenized in place.  An empty file
+     has no sequences.  */
+  if (st.st_size == 0)
+    return 0;
+  err = cache_map (file, &map, &size);
+  if (err)
+    return err;
+
+  sc.pos = map;
+  sc.end = sc.pos + size;
+  sc.file = file;
+  sc.linenum = 1;
+  sc.origin = ++compose_norigins;
+  sc.parent = parent;
+  sc.dev = st.st_dev;
+  sc.ino = st.st_ino;
+  err = parse_composefile (&sc);
+  munmap (map, size);
   return err;
 }
+
+/* The compiled trie is cached, see cache.h.  A cache is only used for
+   the Compose file it was made from, so it is named after the path of
+   that file.  It stores the path, the modification time and the size
+   of that file and of every file that was needed to compile it.  It
+   looks like this:
+
+     struct compose_cache_header
+     the dependencies, depsize bytes, the first is the Compose file
+     struct compose_state states[nstates]
+     struct compose_edge edges[edgesize]
+     char strings[stringsize]  */
+
+#define COMPOSE_CACHE_MAGIC	"XKBCOMP"
+/* Increase this when the layout of the cache or of the trie, or the
+   dead key sequences of ks_tables.h change.  */
+#define COMPOSE_CACHE_VERSION	4
+
+struct compose_cache_header
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t nstates;
+  uint32_t edgesize;
+  uint32_t nedges;
+  uint32_t stringsize;
+  uint32_t ndeps;
+  uint32_t depsize;
+  uint32_t unused;
+};
+
+/* Check that the cache HEADER of SIZE bytes is valid and made from the
+   Compose file COMPOSEFN as it is now.  */
+static int
+compose_cache_valid (struct compose_cache_header *header, size_t size,
+		     const char *composefn)
+{
+  struct compose_state *states;
+  struct compose_edge *edges;
+  size_t empty = 0;
+  size_t i;
+  int cwd = AT_FDCWD;
+
+  if (size < sizeof (*header)
+      || memcmp (header->magic, COMPOSE_CACHE_MAGIC, sizeof (header->magic))
+      || header->version != COMPOSE_CACHE_VERSION
+      || header->depsize % 8 || header->depsize > size - sizeof (*header))
+    return 0;
+
+  size -= sizeof (*header) + header->depsize;
+  if (header->nstates == 0
+      || header->edgesize == 0 || (header->edgesize & (header->edgesize - 1))
+      || header->nedges >= header->edgesize
+      || header->nstates > size / sizeof (*states)
+      || header->edgesize > size / sizeof (*edges)
+      || size != (header->nstates * sizeof (*states)
+		  + header->edgesize * sizeof (*edges) + header->stringsize))
+    return 0;
+
+  if (!cache_deps_valid (&cwd, 1, header + 1, header->depsize,
+			 header->ndeps, composefn))
+    return 0;
+
+  /* Every edge must stay inside the trie.  Without an empty slot a
+     lookup would never end.  */
+  states = (struct compose_state *) ((char *) (header + 1)
+				     + header->depsize);
+  edges = (struct compose_edge *) (states + header->nstates);
+  for (i = 0; i < header->edgesize; i++)
+    if (!edges[i].to)
+      empty++;
+    else if (edges[i].to >= header->nstates
+	     || (edges[i].from >= header->nstates
+		 && edges[i].from != COMPOSE_NO_STATE))
+      return 0;
+  if (!empty)
+    return 0;
+
+  /* Every string must be inside the pool.  */
+  for (i = 0; i < header->nstates; i++)
+    if (states[i].string > header->stringsize
+	|| states[i].stringlen > header->stringsize - states[i].string)
+      return 0;
+
+  return 1;
+}
+
+/* Use the cache CACHEFILE for the Compose file COMPOSEFN if it is
+   valid.  */
+static error_t
+compose_map_cache (const char *cachefile, const char *composefn)
+{
+  struct compose_cache_header *header;
+  void *map;
+  size_t size;
+  error_t err;
+
+  err = cache_map (cachefile, &map, &size);
+  if (err)
+    return err;
+
+  header = map;
+  if (!compose_cache_valid (header, size, composefn))
+    {
+      munmap (map, size);
+      return EINVAL;
+    }
+
+  /* The trie is used in place, it is never changed after loading.  */
+  compose_states = (struct compose_state *)
+    ((char *) (header + 1) + header->depsize);
+  compose_nstates = compose_allocstates = header->nstates;
+  compose_edges = (struct compose_edge *) (compose_states + header->nstates);
+  compose_edgesize = header->edgesize;
+  compose_nedges = header->nedges;
+  compose_strings = (char *) (compose_edges + header->edgesize);
+  compose_stringsize = compose_allocstrings = header->stringsize;
+  return 0;
+}
+
+/* Write the trie and its dependencies to CACHEFILE.  */
+static error_t
+compose_write_cache (const char *cachefile)
+{
+  struct compose_cache_header header;
+  struct iovec iov[5];
+  char *deps;
+  size_t depsize;
+  error_t err;
+
+  depsize = cache_deps_size (compose_deps, compose_ndeps);
+  deps = malloc (depsize);
+  if (!deps)
+    return ENOMEM;
+  cache_deps_store (compose_deps, compose_ndeps, deps);
+
+  memset (&header, 0, sizeof (header));
+  memcpy (header.magic, COMPOSE_CACHE_MAGIC, sizeof (header.magic));
+  header.version = COMPOSE_CACHE_VERSION;
+  header.nstates = compose_nstates;
+  header.edgesize = compose_edgesize;
+  header.nedges = compose_nedges;
+  header.stringsize = compose_stringsize;
+  header.ndeps = compose_ndeps;
+  header.depsize = depsize;
+
+  iov[0].iov_base = &header;
+  iov[0].iov_len = sizeof (header);
+  iov[1].iov_base = deps;
+  iov[1].iov_len = depsize;
+  iov[2].iov_base = compose_states;
+  iov[2].iov_len = compose_nstates * sizeof (*compose_states);
+  iov[3].iov_base = compose_edges;
+  iov[3].iov_len = compose_edgesize * sizeof (*compose_edges);
+  iov[4].iov_base = compose_strings;
+  iov[4].iov_len = compose_stringsize;
+  err = cache_write (cachefile, iov, 5);
+  free (deps);
+  return err;
+}
+
+/* Read the Compose file COMPOSEFN and the files it includes, on top of
+   the dead key sequences.  When
+   CACHEDIR is not NULL a cache of the compiled files in that directory
+   is used if it is up to date, otherwise it is rebuilt.  */
+static error_t
+read_composefile (const char *composefn, const char *cachedir)
+{
+  char *cachefile = NULL;
+  char *key;
+  error_t err;
+
+  /* The includes are expanded with the locale, the home directory and
+     the locale directory, so the cache is only used with the same
+     ones.  Only the files they expanded to are dependencies.  */
+  if (cachedir
+      && asprintf (&key, "%s:%s:%s:%s", composefn,
+		   setlocale (LC_CTYPE, NULL) ? : "", getenv ("HOME") ? : "",
+		   compose_localedir ()) >= 0)
+    {
+      if (asprintf (&cachefile, "%s/Compose-%08x.cache", cachedir,
+		    (unsigned int) ks_hash (key)) < 0)
+	cachefile = NULL;
+      free (key);
+    }
+
+  if (cachefile && !compose_map_cache (cachefile, composefn))
+    {
+      free (cachefile);
+      return 0;
+    }
+
+  err = compose_add_dead ();
+  if (!err)
+    err = compose_parse_file (composefn, NULL);
+
+  /* Like the keysym database, the Compose file still works without a
+     cache.  */
+  if (!err && cachefile)
+    compose_write_cache (cachefile);
+
+  compose_compiled ();
+  free (cachefile);
+  return err;
+}
+
+/* Load the Compose table, unless that was done already.  */
+static void
+compose_load (void)
+{
+  char *locale_file = NULL;
+  const char *file;
+  error_t err;
+
+  mutex_lock (&compose_lock);
+  if (compose_loaded)
+    {
+      mutex_unlock (&compose_lock);
+      return;
+    }
+
+  file = compose_file ? : getenv ("XCOMPOSEFILE");
+  if (!file && !compose_locale_file (&locale_file, 0))
+    file = locale_file;
+
+  if (file)
+    {
+      err = read_composefile (file, compose_cachedir);
+      if (err)
+	printf ("Warning: Can't load the Compose file %s: %s.\n", file,
+		strerror (err));
+    }
+  else
+    {
+      /* Without a Compose file the dead keys still work.  */
+      err = compose_add_dead ();
+      if (err)
+	printf ("Warning: Can't load the dead keys: %s.\n", strerror (err));
+      compose_compiled ();
+    }
+  free (locale_file);
+
+  __atomic_store_n (&compose_loaded, 1, __ATOMIC_RELEASE);
+  mutex_unlock (&compose_lock);
+}
+
+/* Use the Compose file COMPOSEFN, or when it is NULL the file in
+   XCOMPOSEFILE or the Compose file of the locale.  Compiled files are
+   cached in CACHEDIR if it is not NULL.  The file is only read when it
+   is needed.  */
+error_t
+compose_init (const char *composefn, const char *cachedir)
+{
+  struct stat st;
+
+  /* A Compose file that was asked for should at least exist.  */
+  if (composefn && stat (composefn, &st) < 0)
+    return errno;
+
+  compose_file = composefn;
+  compose_cachedir = cachedir;
+  return 0;
+}
@@ -0,0 +1,322 @@
+/*  inject.c -- Type text through the keymap.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* Text is typed by pressing the keys that produce it, so it goes
+   through xkb_input like keyboard input does.  Every character is
+   converted to a keysym with Ucs4ToKeySym and looked up in an index
+   of all keysyms in the keymap, which holds the key, group and
+   modifiers that type it.  The index is built once for every keymap,
+   the first time text is typed with it, and is freed with it, so
+   typing does not search the keymap.  A keymap that never types text,
+   like the default keymap on a rescue boot, needs no memory for it.
+
+   xkb_type_key changes the modifiers of every key with XKB_INPUT_LOCK
+   held, like the keys of the keyboard are handled, so keys that are
+   typed at the same time don't mix their modifiers with the injected
+   ones.  The keyboard gets its turn between two characters.  Typed
+   text is never composed.
+
+   With --inject NODE the console gets a node to which text can be
+   written to type it, for example by a test harness.  */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <wchar.h>
+#include <hurd/ihash.h>
+#define XK_MISCELLANY
+#include "keysymdef.h"
+#include "xkb.h"
+#include "inputdev.h"
+
+/* The key that types a keysym.  */
+struct inject_key
+{
+  keycode_t keycode;
+  group_t group;
+  modmap_t mods;
+};
+
+/* Control characters don't have a key of their own in most keymaps,
+   they are typed with these keysyms.  */
+static const struct
+{
+  wchar_t c;
+  symbol keysym;
+} inject_controls[] =
+  {
+    { L'\b', XK_BackSpace },
+    { L'\t', XK_Tab },
+    { L'\n', XK_Return },
+    { L'\r', XK_Return },
+    { L'\e', XK_Escape },
+    { 0x7f, XK_Delete }
+  };
+
+/* Store the modifiers that select the shift level LEVEL of the keytype
+   KT in MODS.  Return 0 if no modifiers do.  */
+static int
+level_mods (struct keytype *kt, int level, modmap_t *mods)
+{
+  struct typemap *map;
+
+  mods->rmods = mods->vmods = 0;
+  if (level == 0)
+    return 1;
+
+  if (!kt)
+    return 0;
+  for (map = kt->maps; map; map = map->next)
+    if (map->level == level)
+      {
+	*mods = map->mods;
+	return 1;
+      }
+  return 0;
+}
+
+/* Only one writer builds or uses the index of a keymap at a time.  */
+static struct mutex inject_lock = MUTEX_INITIALIZER;
+
+/* Build the index that maps keysyms on the keys of the keymap KM that
+   type them, unless it is built already.  The caller holds
+   INJECT_LOCK.  */
+static error_t
+inject_index_build (struct keymap *km)
+{
+  struct key *keys = km->keys;
+  struct inject_key *inject_keys;
+  keycode_t kc;
+  group_t group;
+  int level;
+  int maxwidth = 0;
+  int nkeys = 0;
+  int n = 0;
+
+  if (km->inject_keys)
+    return 0;
+
+  for (kc = km->min_keys; kc < km->max_keys; kc++)
+    for (group = 0; group < 4; group++)
+      {
+	nkeys += keys[kc].groups[group].width;
+	if (keys[kc].groups[group].width > maxwidth)
+	  maxwidth = keys[kc].groups[group].width;
+      }
+
+  inject_keys = arena_alloc (&km->arena, nkeys * sizeof (*inject_keys));
+  if (!inject_keys)
+    return ENOMEM;
+
+  /* Prefer the first group and the lowest shift level, so a keysym is
+     typed with as few modifiers as possible.  */
+  for (group = 0; group < 4; group++)
+    for (level = 0; level < maxwidth; level++)
+      for (kc = km->min_keys; kc < km->max_keys; kc++)
+	{
+	  struct keygroup *kg = &keys[kc].groups[group];
+	  struct inject_key *ik = &inject_keys[n];
+	  symbol ks;
+	  error_t err;
+
+	  if (level >= kg->width || !kg->symbols)
+	    continue;
+	  ks = kg->symbols[level];
+	  if (!ks || hurd_ihash_find (&km->inject_index, ks))
+	    continue;
+	  if (!level_mods (kg->keytype, level, &ik->mods))
+	    continue;
+
+	  ik->keycode = kc;
+	  ik->group = group;
+	  err = hurd_ihash_add (&km->inject_index, ks, ik);
+	  if (err)
+	    {
+	      hurd_ihash_destroy (&km->inject_index);
+	      hurd_ihash_init (&km->inject_index, HURD_IHASH_NO_LOCP);
+	      return err;
+	    }
+	  n++;
+	}
+
+  km->inject_keys = inject_keys;
+  debug_printf ("inject: %d of %d keysyms can be typed\n", n, nkeys);
+  return 0;
+}
+
+/* Find the key of the keymap KM that types the character C.  */
+static struct inject_key *
+inject_find (struct keymap *km, wchar_t c)
+{
+  struct inject_key *ik;
+  unsigned int ks;
+  int i;
+
+  ks = Ucs4ToKeySym (c);
+  if (!ks)
+    return NULL;
+  ik = hurd_ihash_find (&km->inject_index, ks);
+  if (ik)
+    return ik;
+
+  /* The keymap may use the Unicode keysym for a character that has a
+     keysym of its own.  */
+  if (!(ks & 0x01000000))
+    {
+      ik = hurd_ihash_find (&km->inject_index, c | 0x01000000);
+      if (ik)
+	return ik;
+    }
+
+  for (i = 0; i < sizeof (inject_controls) / sizeof (inject_controls[0]); i++)
+    if (inject_controls[i].c == c)
+      return hurd_ihash_find (&km->inject_index, inject_controls[i].keysym);
+
+  return NULL;
+}
+
+/* Type the N UCS-4 characters TEXT and store how many were typed in
+   *DONE.  Return EILSEQ when a character can't be typed with this
+   keymap, the characters before it are typed.  */
+static error_t
+inject_ucs4 (const wchar_t *text, size_t n, size_t *done)
+{
+  error_t err = 0;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      struct inject_key *ik;
+      struct keymap *km;
+      int phase;
+
+      km = keymap_enter (&phase);
+      mutex_lock (&inject_lock);
+      err = inject_index_build (km);
+      if (!err)
+	{
+	  ik = inject_find (km, text[i]);
+	  if (ik)
+	    xkb_type_key (km, ik->keycode, ik->group, ik->mods);
+	  else
+	    err = EILSEQ;
+	}
+      mutex_unlock (&inject_lock);
+      keymap_leave (phase);
+      if (err)
+	break;
+    }
+
+  *done = i;
+  return err;
+}
+
+/* Type the UTF-8 string TEXT of LEN bytes and store how many bytes
+   were typed in *DONE.  */
+static error_t
+inject_utf8 (const char *text, size_t len, size_t *done)
+{
+  wchar_t buf[256];
+
+  *done = 0;
+  while (len)
+    {
+      size_t used;
+      size_t n = utf8_to_ucs4 (text, len, buf, sizeof (buf) / sizeof (buf[0]),
+			       &used);
+      size_t typed;
+      error_t err;
+
+      /* Only a cut off character is left.  */
+      if (!n)
+	return EILSEQ;
+
+      err = inject_ucs4 (buf, n, &typed);
+      if (err)
+	{
+	  /* The bytes of the characters that were typed.  */
+	  utf8_to_ucs4 (text, len, buf, typed, &used);
+	  *done += used;
+	  return err;
+	}
+      text += used;
+      len -= used;
+      *done += used;
+    }
+
+  return 0;
+}
+
+/* Type the N UCS-4 characters TEXT.  Return EILSEQ when a character
+   can't be typed with this keymap, the characters before it are
+   typed.  */
+error_t
+xkb_inject_ucs4 (const wchar_t *text, size_t n)
+{
+  size_t done;
+
+  return inject_ucs4 (text, n, &done);
+}
+
+/* Type the UTF-8 string TEXT of LEN bytes.  */
+error_t
+xkb_inject_utf8 (const char *text, size_t len)
+{
+  size_t done;
+
+  return inject_utf8 (text, len, &done);
+}
+
+/* Type the text that is written to the inject node.  A write that
+   ends in a character that can't be typed is cut short before it,
+   every write has to hold whole characters.  */
+static error_t
+inject_write (struct protid *cred, char *data,
+	      mach_msg_type_number_t datalen, off_t offset,
+	      mach_msg_type_number_t *amount)
+{
+  size_t done;
+  error_t err;
+
+  if (!cred)
+    return EOPNOTSUPP;
+  else if (!(cred->po->openstat & O_WRITE))
+    return EBADF;
+
+  err = inject_utf8 (data, datalen, &done);
+  *amount = done;
+  return done ? 0 : err;
+}
+
+/* Make the node NODENAME to which text is written to type it, and
+   return it in *CN.  */
+error_t
+inject_setnode (const char *nodename, consnode_t *cn)
+{
+  error_t err;
+
+  err = console_create_consnode (nodename, cn);
+  if (err)
+    return err;
+
+  (*cn)->read = 0;
+  (*cn)->write = inject_write;
+  (*cn)->select = 0;
+  (*cn)->open = 0;
+  (*cn)->close = 0;
+  (*cn)->demuxer = 0;
+
+  console_register_consnode (*cn);
+
+  return 0;
+}
@@ -0,0 +1,471 @@
+/*  keysymdb.c -- The X keysym database.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* XKeysymDB adds vendor keysyms (hpmute_acute, osfCopy, SunFA_Grave,
+   ...) to the ones in keysymdef.h.  Every line has the form
+
+     name	:hexvalue
+
+   and lines that start with `!' are comments.
+
+   The parsed database is a hash table with open addressing over a
+   pool of names.  It is written to a cache file exactly as it is
+   kept in memory, so the next time the database is loaded the cache
+   is mapped and used without parsing anything.  The cache stores the
+   modification time and size of the database it was made from and is
+   rebuilt when they change.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "kshash.h"
+#include "cache.h"
+
+#define	NoSymbol	0
+
+typedef unsigned long KeySym;
+
+#define KEYSYMDB_MAGIC		"XKSYMDB"
+/* Increase this when the layout of the cache or ks_hash changes.  */
+#define KEYSYMDB_VERSION	1
+
+/* The name offset of an unused slot.  */
+#define KEYSYMDB_EMPTY		0xffffffffU
+
+struct keysymdb_header
+{
+  char magic[8];
+  uint32_t version;
+  /* The amount of slots, a power of two.  */
+  uint32_t nslots;
+  /* The size of the name pool that follows the slots.  */
+  uint32_t poolsize;
+  uint32_t unused;
+  /* The database this cache was made from.  */
+  int64_t mtime_sec;
+  int64_t mtime_nsec;
+  int64_t size;
+};
+
+struct keysymdb_slot
+{
+  /* The low bits of ks_hash of the name.  */
+  uint32_t hash;
+  /* Offset of the name in the pool, or KEYSYMDB_EMPTY.  */
+  uint32_t name;
+  uint32_t value;
+};
+
+/* The loaded database: a header, the slots and the name pool.  */
+static struct keysymdb_header *keysymdb;
+static size_t keysymdb_size;
+/* Set when KEYSYMDB is a mapping of the cache.  */
+static int keysymdb_mapped;
+
+static struct keysymdb_slot *keysymdb_slots;
+static const char *keysymdb_pool;
+
+/* The slots that hold a name, sorted on their value, so keysymdb_name
+   finds the name of a value with a binary search.  It is not part of
+   the cache, it is made when the database is loaded.  */
+static uint32_t *keysymdb_byvalue;
+static size_t keysymdb_nnames;
+
+/* A name and value read from the database.  */
+struct dbentry
+{
+  char *name;
+  KeySym value;
+};
+
+/* Read the database DB into a list of entries, store the amount of
+   entries in NENTRIES and the total size of the names in POOLSIZE.  */
+static error_t
+keysymdb_parse (FILE *db, struct dbentry **entries, size_t *nentries,
+		size_t *poolsize)
+{
+  struct dbentry *list = NULL;
+  size_t n = 0;
+  size_t size = 0;
+  size_t alloced = 0;
+  char line[256];
+
+  *poolsize = 0;
+  while (fgets (line, sizeof (line), db))
+    {
+      char *name = line;
+      char *p;
+      char *end;
+      KeySym value;
+
+      while (isspace (*name))
+	name++;
+      if (*name == '!' || *name == '\0')
+	continue;
+
+      for (p = name; *p && *p != ':' && !isspace (*p); p++)
+	;
+      end = p;
+      while (isspace (*p))
+	p++;
+      if (*p != ':' || end == name)
+	continue;
+      *end = '\0';
+
+      p++;
+      while (isspace (*p))
+	p++;
+      value = strtoul (p, &end, 16);
+      if (end == p || value == NoSymbol)
+	continue;
+
+      if (n == alloced)
+	{
+	  struct dbentry *newlist;
+
+	  alloced = alloced ? alloced * 2 : 256;
+	  newlist = realloc (list, alloced * sizeof (*list));
+	  if (!newlist)
+	    goto nomem;
+	  list = newlist;
+	}
+
+      list[n].name = strdup (name);
+      if (!list[n].name)
+	goto nomem;
+      list[n].value = value;
+      size += strlen (name) + 1;
+      n++;
+    }
+
+  *entries = list;
+  *nentries = n;
+  *poolsize = size;
+  return 0;
+
+ nomem:
+  while (n--)
+    free (list[n].name);
+  free (list);
+  return ENOMEM;
+}
+
+/* Build the in memory database from ENTRIES for a database file with
+   the status ST.  */
+static error_t
+keysymdb_build (struct dbentry *entries, size_t nentries, size_t poolsize,
+		struct stat *st)
+{
+  struct keysymdb_header *header;
+  struct keysymdb_slot *slots;
+  char *pool;
+  size_t nslots = 16;
+  size_t size;
+  size_t offset = 0;
+  size_t i;
+
+  /* Keep the table at most half full, so probe sequences stay
+     short.  */
+  while (nslots < nentries * 2)
+    nslots *= 2;
+
+  size = sizeof (*header) + nslots * sizeof (*slots) + poolsize;
+  header = malloc (size);
+  if (!header)
+    return ENOMEM;
+
+  memset (header, 0, sizeof (*header));
+  memcpy (header->magic, KEYSYMDB_MAGIC, sizeof (header->magic));
+  header->version = KEYSYMDB_VERSION;
+  header->nslots = nslots;
+  header->poolsize = poolsize;
+  header->mtime_sec = st->st_mtim.tv_sec;
+  header->mtime_nsec = st->st_mtim.tv_nsec;
+  header->size = st->st_size;
+
+  slots = (struct keysymdb_slot *) (header + 1);
+  pool = (char *) (slots + nslots);
+  for (i = 0; i < nslots; i++)
+    slots[i].name = KEYSYMDB_EMPTY;
+
+  for (i = 0; i < nentries; i++)
+    {
+      uint64_t h = ks_hash (entries[i].name);
+      size_t slot;
+
+      for (slot = h & (nslots - 1); slots[slot].name != KEYSYMDB_EMPTY;
+	   slot = (slot + 1) & (nslots - 1))
+	if (slots[slot].hash == (uint32_t) h
+	    && !strcmp (&pool[slots[slot].name], entries[i].name))
+	  break;
+
+      /* The first definition of a name is used.  */
+      if (slots[slot].name != KEYSYMDB_EMPTY)
+	continue;
+
+      slots[slot].hash = (uint32_t) h;
+      slots[slot].name = offset;
+      slots[slot].value = entries[i].value;
+      strcpy (&pool[offset], entries[i].name);
+      offset += strlen (entries[i].name) + 1;
+    }
+
+  /* Names that were defined twice are not in the pool.  */
+  header->poolsize = offset;
+  size -= poolsize - offset;
+
+  keysymdb = header;
+  keysymdb_size = size;
+  keysymdb_mapped = 0;
+  return 0;
+}
+
+/* Compare the slots A and B on their value, and names with the same
+   value on their order in the pool.  */
+static int
+keysymdb_value_cmp (const void *a, const void *b)
+{
+  const struct keysymdb_slot *sa = &keysymdb_slots[*(const uint32_t *) a];
+  const struct keysymdb_slot *sb = &keysymdb_slots[*(const uint32_t *) b];
+
+  if (sa->value != sb->value)
+    return sa->value < sb->value ? -1 : 1;
+  if (sa->name != sb->name)
+    return sa->name < sb->name ? -1 : 1;
+  return 0;
+}
+
+/* Make KEYSYMDB_BYVALUE for the loaded database.  Without it the
+   database still works, only its names are not found by value.  */
+static void
+keysymdb_index_values (void)
+{
+  uint32_t i;
+  size_t n = 0;
+
+  for (i = 0; i < keysymdb->nslots; i++)
+    if (keysymdb_slots[i].name != KEYSYMDB_EMPTY)
+      n++;
+
+  keysymdb_byvalue = malloc (n * sizeof (*keysymdb_byvalue));
+  if (!keysymdb_byvalue)
+    return;
+
+  n = 0;
+  for (i = 0; i < keysymdb->nslots; i++)
+    if (keysymdb_slots[i].name != KEYSYMDB_EMPTY)
+      keysymdb_byvalue[n++] = i;
+  qsort (keysymdb_byvalue, n, sizeof (*keysymdb_byvalue),
+	 keysymdb_value_cmp);
+  keysymdb_nnames = n;
+}
+
+/* Check that the cache HEADER of SIZE bytes is valid and made from the
+   database with the status ST.  */
+static int
+keysymdb_valid (struct keysymdb_header *header, size_t size, struct stat *st)
+{
+  struct keysymdb_slot *slots;
+  size_t empty = 0;
+  size_t i;
+
+  if (size < sizeof (*header)
+      || memcmp (header->magic, KEYSYMDB_MAGIC, sizeof (header->magic))
+      || header->version != KEYSYMDB_VERSION
+      || header->mtime_sec != st->st_mtim.tv_sec
+      || header->mtime_nsec != st->st_mtim.tv_nsec
+      || header->size != st->st_size)
+    return 0;
+
+  if (header->nslots == 0 || (header->nslots & (header->nslots - 1))
+      || header->nslots > (size - sizeof (*header)) / sizeof (*slots)
+      || size != (sizeof (*header) + header->nslots * sizeof (*slots)
+		  + header->poolsize))
+    return 0;
+
+  /* Every name must be inside the pool, and the pool must end with
+     the terminator of the last name.  Without an empty slot a lookup
+     would never end.  */
+  slots = (struct keysymdb_slot *) (header + 1);
+  for (i = 0; i < header->nslots; i++)
+    if (slots[i].name == KEYSYMDB_EMPTY)
+      empty++;
+    else if (slots[i].name >= header->poolsize)
+      return 0;
+  if (!empty)
+    return 0;
+  if (header->poolsize && ((char *) (slots + header->nslots))
+      [header->poolsize - 1] != '\0')
+    return 0;
+
+  return 1;
+}
+
+/* Map the cache CACHEFILE if it is valid for the database with the
+   status ST.  */
+static error_t
+keysymdb_map_cache (const char *cachefile, struct stat *st)
+{
+  void *map;
+  size_t size;
+  error_t err;
+
+  err = cache_map (cachefile, &map, &size);
+  if (err)
+    return err;
+
+  if (!keysymdb_valid (map, size, st))
+    {
+      munmap (map, size);
+      return EINVAL;
+    }
+
+  keysymdb = map;
+  keysymdb_size = size;
+  keysymdb_mapped = 1;
+  return 0;
+}
+
+/* Load the keysym database DBFILE.  When CACHEFILE is not NULL it is
+   used if it is up to date, otherwise it is rebuilt.  */
+error_t
+keysymdb_load (const char *dbfile, const char *cachefile)
+{
+  struct dbentry *entries;
+  size_t nentries;
+  size_t poolsize;
+  struct stat st;
+  FILE *db;
+  error_t err;
+
+  db = fopen (dbfile, "r");
+  if (!db)
+    return errno;
+  if (fstat (fileno (db), &st) < 0)
+    {
+      err = errno;
+      fclose (db);
+      return err;
+    }
+
+  if (cachefile && !keysymdb_map_cache (cachefile, &st))
+    {
+      fclose (db);
+      goto loaded;
+    }
+
+  err = keysymdb_parse (db, &entries, &nentries, &poolsize);
+  fclose (db);
+  if (err)
+    return err;
+
+  err = keysymdb_build (entries, nentries, poolsize, &st);
+  while (nentries--)
+    free (entries[nentries].name);
+  free (entries);
+  if (err)
+    return err;
+
+  /* Without a cache the database still works, it is only parsed
+     again next time.  So a cache that can't be written is not an
+     error.  */
+  if (cachefile)
+    {
+      struct iovec iov = { keysymdb, keysymdb_size };
+
+      cache_write (cachefile, &iov, 1);
+    }
+
+ loaded:
+  keysymdb_slots = (struct keysymdb_slot *) (keysymdb + 1);
+  keysymdb_pool = (const char *) (keysymdb_slots + keysymdb->nslots);
+  keysymdb_index_values ();
+  return 0;
+}
+
+/* Unload the keysym database.  */
+void
+keysymdb_free (void)
+{
+  if (!keysymdb)
+    return;
+
+  if (keysymdb_mapped)
+    munmap (keysymdb, keysymdb_size);
+  else
+    free (keysymdb);
+  keysymdb = NULL;
+  keysymdb_slots = NULL;
+  keysymdb_pool = NULL;
+  free (keysymdb_byvalue);
+  keysymdb_byvalue = NULL;
+  keysymdb_nnames = 0;
+}
+
+/* Look up the keysym with the name of the LEN characters at NAME in
+   the keysym database.  Return NoSymbol when there is no database or
+   the name is not in it.  */
+KeySym
+keysymdb_lookup (const char *name, size_t len)
+{
+  uint32_t mask;
+  uint32_t slot;
+  uint32_t h;
+
+  if (!keysymdb)
+    return NoSymbol;
+
+  h = (uint32_t) ks_hash_len (name, len);
+  mask = keysymdb->nslots - 1;
+  for (slot = h & mask; keysymdb_slots[slot].name != KEYSYMDB_EMPTY;
+       slot = (slot + 1) & mask)
+    if (keysymdb_slots[slot].hash == h)
+      {
+	const char *s = &keysymdb_pool[keysymdb_slots[slot].name];
+
+	if (!strncmp (name, s, len) && s[len] == '\0')
+	  return keysymdb_slots[slot].value;
+      }
+
+  return NoSymbol;
+}
+
+/* Return the name of the keysym KS in the keysym database, the first
+   one when it has more names.  Return NULL when there is no database
+   or KS is not in it.  */
+const char *
+keysymdb_name (KeySym ks)
+{
+  size_t lo = 0;
+  size_t hi = keysymdb_nnames;
+
+  while (lo < hi)
+    {
+      size_t mid = lo + (hi - lo) / 2;
+
+      if (keysymdb_slots[keysymdb_byvalue[mid]].value < ks)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+
+  if (lo == keysymdb_nnames
+      || keysymdb_slots[keysymdb_byvalue[lo]].value != ks)
+    return NULL;
+  return &keysymdb_pool[keysymdb_slots[keysymdb_byvalue[lo]].name];
+}
@@ -1,2380 +1,7157 @@
-/* This file is generated from keysymdef.h. */
+/* This file is generated from keysymdef.h by makekeys. */
 /* Do not edit. */
 
 #ifdef NEEDKTABLE
-const unsigned char _XkeyTable[] = {
-0,
-0x80, 0xaa, 0x00, 0x00, 'V','o','i','d','S','y','m','b','o','l',0,
-0xa3, 0xff, 0xff, 0x08, 'B','a','c','k','S','p','a','c','e',0,
-0x02, 0x74, 0xff, 0x09, 'T','a','b',0,
-0x5a, 0x42, 0xff, 0x0a, 'L','i','n','e','f','e','e','d',0,
-0x0a, 0x58, 0xff, 0x0b, 'C','l','e','a','r',0,
-0x17, 0x56, 0xff, 0x0d, 'R','e','t','u','r','n',0,
-0x0b, 0x27, 0xff, 0x13, 'P','a','u','s','e',0,
-0xef, 0x3d, 0xff, 0x14, 'S','c','r','o','l','l','_','L','o','c','k',0,
-0x30, 0x8b, 0xff, 0x15, 'S','y','s','_','R','e','q',0,
-0x15, 0xb1, 0xff, 0x1b, 'E','s','c','a','p','e',0,
-0x15, 0x11, 0xff, 0xff, 'D','e','l','e','t','e',0,
-0xbd, 0x77, 0xff, 0x20, 'M','u','l','t','i','_','k','e','y',0,
-0xad, 0x3e, 0xff, 0x37, 'C','o','d','e','i','n','p','u','t',0,
-0x1a, 0x01, 0xff, 0x3c, 'S','i','n','g','l','e','C','a','n','d','i','d','a','t','e',0,
-0x32, 0x01, 0xff, 0x3d, 'M','u','l','t','i','p','l','e','C','a','n','d','i','d','a','t','e',0,
-0x6a, 0x01, 0xff, 0x3e, 'P','r','e','v','i','o','u','s','C','a','n','d','i','d','a','t','e',0,
-0x0a, 0xad, 0xff, 0x21, 'K','a','n','j','i',0,
-0x5d, 0x5c, 0xff, 0x22, 'M','u','h','e','n','k','a','n',0,
-0xbe, 0xc1, 0xff, 0x23, 'H','e','n','k','a','n','_','M','o','d','e',0,
-0x15, 0x9c, 0xff, 0x23, 'H','e','n','k','a','n',0,
-0x17, 0x59, 0xff, 0x24, 'R','o','m','a','j','i',0,
-0x58, 0x89, 0xff, 0x25, 'H','i','r','a','g','a','n','a',0,
-0x58, 0x69, 0xff, 0x26, 'K','a','t','a','k','a','n','a',0,
-0xc9, 0x69, 0xff, 0x27, 'H','i','r','a','g','a','n','a','_','K','a','t','a','k','a','n','a',0,
-0x30, 0x27, 0xff, 0x28, 'Z','e','n','k','a','k','u',0,
-0x2b, 0x27, 0xff, 0x29, 'H','a','n','k','a','k','u',0,
-0x81, 0xa7, 0xff, 0x2a, 'Z','e','n','k','a','k','u','_','H','a','n','k','a','k','u',0,
-0x30, 0xc7, 0xff, 0x2b, 'T','o','u','r','o','k','u',0,
-0x16, 0x75, 0xff, 0x2c, 'M','a','s','s','y','o',0,
-0xae, 0x5d, 0xff, 0x2d, 'K','a','n','a','_','L','o','c','k',0,
-0x5d, 0x74, 0xff, 0x2e, 'K','a','n','a','_','S','h','i','f','t',0,
-0x60, 0xf4, 0xff, 0x2f, 'E','i','s','u','_','S','h','i','f','t',0,
-0xc6, 0xc1, 0xff, 0x30, 'E','i','s','u','_','t','o','g','g','l','e',0,
-0x82, 0xef, 0xff, 0x37, 'K','a','n','j','i','_','B','a','n','g','o','u',0,
-0x5f, 0x43, 0xff, 0x3d, 'Z','e','n','_','K','o','h','o',0,
-0x56, 0xa3, 0xff, 0x3e, 'M','a','e','_','K','o','h','o',0,
-0x05, 0x3b, 0xff, 0x50, 'H','o','m','e',0,
-0x05, 0x34, 0xff, 0x51, 'L','e','f','t',0,
-0x01, 0x1a, 0xff, 0x52, 'U','p',0,
-0x0b, 0x48, 0xff, 0x53, 'R','i','g','h','t',0,
-0x05, 0x38, 0xff, 0x54, 'D','o','w','n',0,
-0x0b, 0x84, 0xff, 0x55, 'P','r','i','o','r',0,
-0x2c, 0x4e, 0xff, 0x55, 'P','a','g','e','_','U','p',0,
-0x05, 0x68, 0xff, 0x56, 'N','e','x','t',0,
-0xb2, 0x08, 0xff, 0x56, 'P','a','g','e','_','D','o','w','n',0,
-0x02, 0x54, 0xff, 0x57, 'E','n','d',0,
-0x0a, 0x24, 0xff, 0x58, 'B','e','g','i','n',0,
-0x16, 0xde, 0xff, 0x60, 'S','e','l','e','c','t',0,
-0x0b, 0x84, 0xff, 0x61, 'P','r','i','n','t',0,
-0x2c, 0xc9, 0xff, 0x62, 'E','x','e','c','u','t','e',0,
-0x16, 0x84, 0xff, 0x63, 'I','n','s','e','r','t',0,
-0x05, 0x97, 0xff, 0x65, 'U','n','d','o',0,
-0x05, 0x5b, 0xff, 0x66, 'R','e','d','o',0,
-0x05, 0x4d, 0xff, 0x67, 'M','e','n','u',0,
-0x05, 0x14, 0xff, 0x68, 'F','i','n','d',0,
-0x14, 0xa2, 0xff, 0x69, 'C','a','n','c','e','l',0,
-0x05, 0x1c, 0xff, 0x6a, 'H','e','l','p',0,
-0x0a, 0x71, 0xff, 0x6b, 'B','r','e','a','k',0,
-0xdc, 0x56, 0xff, 0x7e, 'M','o','d','e','_','s','w','i','t','c','h',0,
-0xbf, 0xd6, 0xff, 0x7e, 's','c','r','i','p','t','_','s','w','i','t','c','h',0,
-0x5d, 0x1d, 0xff, 0x7f, 'N','u','m','_','L','o','c','k',0,
-0x50, 0xbf, 0xff, 0x80, 'K','P','_','S','p','a','c','e',0,
-0x13, 0xcc, 0xff, 0x89, 'K','P','_','T','a','b',0,
-0x50, 0x2c, 0xff, 0x8d, 'K','P','_','E','n','t','e','r',0,
-0x09, 0x69, 0xff, 0x91, 'K','P','_','F','1',0,
-0x09, 0x6a, 0xff, 0x92, 'K','P','_','F','2',0,
-0x09, 0x6b, 0xff, 0x93, 'K','P','_','F','3',0,
-0x09, 0x6c, 0xff, 0x94, 'K','P','_','F','4',0,
-0x27, 0xeb, 0xff, 0x95, 'K','P','_','H','o','m','e',0,
-0x27, 0xe4, 0xff, 0x96, 'K','P','_','L','e','f','t',0,
-0x09, 0xc6, 0xff, 0x97, 'K','P','_','U','p',0,
-0x50, 0xa8, 0xff, 0x98, 'K','P','_','R','i','g','h','t',0,
-0x27, 0xe8, 0xff, 0x99, 'K','P','_','D','o','w','n',0,
-0x50, 0xe4, 0xff, 0x9a, 'K','P','_','P','r','i','o','r',0,
-0x41, 0xce, 0xff, 0x9a, 'K','P','_','P','a','g','e','_','U','p',0,
-0x28, 0x18, 0xff, 0x9b, 'K','P','_','N','e','x','t',0,
-0x08, 0x08, 0xff, 0x9b, 'K','P','_','P','a','g','e','_','D','o','w','n',0,
-0x13, 0xac, 0xff, 0x9c, 'K','P','_','E','n','d',0,
-0x4f, 0x84, 0xff, 0x9d, 'K','P','_','B','e','g','i','n',0,
-0xa1, 0x44, 0xff, 0x9e, 'K','P','_','I','n','s','e','r','t',0,
-0x9f, 0xd1, 0xff, 0x9f, 'K','P','_','D','e','l','e','t','e',0,
-0x50, 0x3a, 0xff, 0xbd, 'K','P','_','E','q','u','a','l',0,
-0x89, 0xd9, 0xff, 0xaa, 'K','P','_','M','u','l','t','i','p','l','y',0,
-0x13, 0x88, 0xff, 0xab, 'K','P','_','A','d','d',0,
-0x10, 0xe8, 0xff, 0xac, 'K','P','_','S','e','p','a','r','a','t','o','r',0,
-0x8b, 0x8e, 0xff, 0xad, 'K','P','_','S','u','b','t','r','a','c','t',0,
-0x3f, 0x7a, 0xff, 0xae, 'K','P','_','D','e','c','i','m','a','l',0,
-0xa0, 0x51, 0xff, 0xaf, 'K','P','_','D','i','v','i','d','e',0,
-0x04, 0x86, 0xff, 0xb0, 'K','P','_','0',0,
-0x04, 0x87, 0xff, 0xb1, 'K','P','_','1',0,
-0x04, 0x88, 0xff, 0xb2, 'K','P','_','2',0,
-0x04, 0x89, 0xff, 0xb3, 'K','P','_','3',0,
-0x04, 0x8a, 0xff, 0xb4, 'K','P','_','4',0,
-0x04, 0x8b, 0xff, 0xb5, 'K','P','_','5',0,
-0x04, 0x8c, 0xff, 0xb6, 'K','P','_','6',0,
-0x04, 0x8d, 0xff, 0xb7, 'K','P','_','7',0,
-0x04, 0x8e, 0xff, 0xb8, 'K','P','_','8',0,
-0x04, 0x8f, 0xff, 0xb9, 'K','P','_','9',0,
-0x00, 0xbd, 0xff, 0xbe, 'F','1',0,
-0x00, 0xbe, 0xff, 0xbf, 'F','2',0,
-0x00, 0xbf, 0xff, 0xc0, 'F','3',0,
-0x00, 0xc0, 0xff, 0xc1, 'F','4',0,
-0x00, 0xc1, 0xff, 0xc2, 'F','5',0,
-0x00, 0xc2, 0xff, 0xc3, 'F','6',0,
-0x00, 0xc3, 0xff, 0xc4, 'F','7',0,
-0x00, 0xc4, 0xff, 0xc5, 'F','8',0,
-0x00, 0xc5, 0xff, 0xc6, 'F','9',0,
-0x01, 0xaa, 0xff, 0xc7, 'F','1','0',0,
-0x01, 0xab, 0xff, 0xc8, 'F','1','1',0,
-0x00, 0xc9, 0xff, 0xc8, 'L','1',0,
-0x01, 0xac, 0xff, 0xc9, 'F','1','2',0,
-0x00, 0xca, 0xff, 0xc9, 'L','2',0,
-0x01, 0xad, 0xff, 0xca, 'F','1','3',0,
-0x00, 0xcb, 0xff, 0xca, 'L','3',0,
-0x01, 0xae, 0xff, 0xcb, 'F','1','4',0,
-0x00, 0xcc, 0xff, 0xcb, 'L','4',0,
-0x01, 0xaf, 0xff, 0xcc, 'F','1','5',0,
-0x00, 0xcd, 0xff, 0xcc, 'L','5',0,
-0x01, 0xb0, 0xff, 0xcd, 'F','1','6',0,
-0x00, 0xce, 0xff, 0xcd, 'L','6',0,
-0x01, 0xb1, 0xff, 0xce, 'F','1','7',0,
-0x00, 0xcf, 0xff, 0xce, 'L','7',0,
-0x01, 0xb2, 0xff, 0xcf, 'F','1','8',0,
-0x00, 0xd0, 0xff, 0xcf, 'L','8',0,
-0x01, 0xb3, 0xff, 0xd0, 'F','1','9',0,
-0x00, 0xd1, 0xff, 0xd0, 'L','9',0,
-0x01, 0xac, 0xff, 0xd1, 'F','2','0',0,
-0x01, 0xc2, 0xff, 0xd1, 'L','1','0',0,
-0x01, 0xad, 0xff, 0xd2, 'F','2','1',0,
-0x00, 0xd5, 0xff, 0xd2, 'R','1',0,
-0x01, 0xae, 0xff, 0xd3, 'F','2','2',0,
-0x00, 0xd6, 0xff, 0xd3, 'R','2',0,
-0x01, 0xaf, 0xff, 0xd4, 'F','2','3',0,
-0x00, 0xd7, 0xff, 0xd4, 'R','3',0,
-0x01, 0xb0, 0xff, 0xd5, 'F','2','4',0,
-0x00, 0xd8, 0xff, 0xd5, 'R','4',0,
-0x01, 0xb1, 0xff, 0xd6, 'F','2','5',0,
-0x00, 0xd9, 0xff, 0xd6, 'R','5',0,
-0x01, 0xb2, 0xff, 0xd7, 'F','2','6',0,
-0x00, 0xda, 0xff, 0xd7, 'R','6',0,
-0x01, 0xb3, 0xff, 0xd8, 'F','2','7',0,
-0x00, 0xdb, 0xff, 0xd8, 'R','7',0,
-0x01, 0xb4, 0xff, 0xd9, 'F','2','8',0,
-0x00, 0xdc, 0xff, 0xd9, 'R','8',0,
-0x01, 0xb5, 0xff, 0xda, 'F','2','9',0,
-0x00, 0xdd, 0xff, 0xda, 'R','9',0,
-0x01, 0xae, 0xff, 0xdb, 'F','3','0',0,
-0x01, 0xda, 0xff, 0xdb, 'R','1','0',0,
-0x01, 0xaf, 0xff, 0xdc, 'F','3','1',0,
-0x01, 0xdb, 0xff, 0xdc, 'R','1','1',0,
-0x01, 0xb0, 0xff, 0xdd, 'F','3','2',0,
-0x01, 0xdc, 0xff, 0xdd, 'R','1','2',0,
-0x01, 0xb1, 0xff, 0xde, 'F','3','3',0,
-0x01, 0xdd, 0xff, 0xde, 'R','1','3',0,
-0x01, 0xb2, 0xff, 0xdf, 'F','3','4',0,
-0x01, 0xde, 0xff, 0xdf, 'R','1','4',0,
-0x01, 0xb3, 0xff, 0xe0, 'F','3','5',0,
-0x01, 0xdf, 0xff, 0xe0, 'R','1','5',0,
-0x2e, 0x5a, 0xff, 0xe1, 'S','h','i','f','t','_','L',0,
-0x2e, 0x60, 0xff, 0xe2, 'S','h','i','f','t','_','R',0,
-0xb1, 0xd2, 0xff, 0xe3, 'C','o','n','t','r','o','l','_','L',0,
-0xb1, 0xd8, 0xff, 0xe4, 'C','o','n','t','r','o','l','_','R',0,
-0xa9, 0x1d, 0xff, 0xe5, 'C','a','p','s','_','L','o','c','k',0,
-0x75, 0xbd, 0xff, 0xe6, 'S','h','i','f','t','_','L','o','c','k',0,
-0x16, 0x1e, 0xff, 0xe7, 'M','e','t','a','_','L',0,
-0x16, 0x24, 0xff, 0xe8, 'M','e','t','a','_','R',0,
-0x0a, 0x4a, 0xff, 0xe9, 'A','l','t','_','L',0,
-0x0a, 0x50, 0xff, 0xea, 'A','l','t','_','R',0,
-0x30, 0x5a, 0xff, 0xeb, 'S','u','p','e','r','_','L',0,
-0x30, 0x60, 0xff, 0xec, 'S','u','p','e','r','_','R',0,
-0x2e, 0x1a, 0xff, 0xed, 'H','y','p','e','r','_','L',0,
-0x2e, 0x20, 0xff, 0xee, 'H','y','p','e','r','_','R',0,
-0x4e, 0x5d, 0xfe, 0x01, 'I','S','O','_','L','o','c','k',0,
-0xae, 0x26, 0xfe, 0x02, 'I','S','O','_','L','e','v','e','l','2','_','L','a','t','c','h',0,
-0xae, 0xf4, 0xfe, 0x03, 'I','S','O','_','L','e','v','e','l','3','_','S','h','i','f','t',0,
-0xae, 0x66, 0xfe, 0x04, 'I','S','O','_','L','e','v','e','l','3','_','L','a','t','c','h',0,
-0x57, 0x1d, 0xfe, 0x05, 'I','S','O','_','L','e','v','e','l','3','_','L','o','c','k',0,
-0x64, 0xb4, 0xff, 0x7e, 'I','S','O','_','G','r','o','u','p','_','S','h','i','f','t',0,
-0x64, 0x26, 0xfe, 0x06, 'I','S','O','_','G','r','o','u','p','_','L','a','t','c','h',0,
-0xb1, 0xfd, 0xfe, 0x07, 'I','S','O','_','G','r','o','u','p','_','L','o','c','k',0,
-0xb4, 0xf6, 0xfe, 0x08, 'I','S','O','_','N','e','x','t','_','G','r','o','u','p',0,
-0xa9, 0xfd, 0xfe, 0x09, 'I','S','O','_','N','e','x','t','_','G','r','o','u','p','_','L','o','c','k',0,
-0xbc, 0xf6, 0xfe, 0x0a, 'I','S','O','_','P','r','e','v','_','G','r','o','u','p',0,
-0xa9, 0xfd, 0xfe, 0x0b, 'I','S','O','_','P','r','e','v','_','G','r','o','u','p','_','L','o','c','k',0,
-0x51, 0x76, 0xfe, 0x0c, 'I','S','O','_','F','i','r','s','t','_','G','r','o','u','p',0,
-0x39, 0xfd, 0xfe, 0x0d, 'I','S','O','_','F','i','r','s','t','_','G','r','o','u','p','_','L','o','c','k',0,
-0xaa, 0x76, 0xfe, 0x0e, 'I','S','O','_','L','a','s','t','_','G','r','o','u','p',0,
-0x59, 0xfd, 0xfe, 0x0f, 'I','S','O','_','L','a','s','t','_','G','r','o','u','p','_','L','o','c','k',0,
-0xe9, 0xac, 0xfe, 0x20, 'I','S','O','_','L','e','f','t','_','T','a','b',0,
-0xe1, 0x3e, 0xfe, 0x21, 'I','S','O','_','M','o','v','e','_','L','i','n','e','_','U','p',0,
-0x85, 0xc8, 0xfe, 0x22, 'I','S','O','_','M','o','v','e','_','L','i','n','e','_','D','o','w','n',0,
-0x8e, 0x3e, 0xfe, 0x23, 'I','S','O','_','P','a','r','t','i','a','l','_','L','i','n','e','_','U','p',0,
-0x39, 0xc8, 0xfe, 0x24, 'I','S','O','_','P','a','r','t','i','a','l','_','L','i','n','e','_','D','o','w','n',0,
-0x83, 0x04, 0xfe, 0x25, 'I','S','O','_','P','a','r','t','i','a','l','_','S','p','a','c','e','_','L','e','f','t',0,
-0x06, 0xe8, 0xfe, 0x26, 'I','S','O','_','P','a','r','t','i','a','l','_','S','p','a','c','e','_','R','i','g','h','t',0,
-0xe6, 0xa4, 0xfe, 0x27, 'I','S','O','_','S','e','t','_','M','a','r','g','i','n','_','L','e','f','t',0,
-0xce, 0x28, 0xfe, 0x28, 'I','S','O','_','S','e','t','_','M','a','r','g','i','n','_','R','i','g','h','t',0,
-0x36, 0xa4, 0xfe, 0x29, 'I','S','O','_','R','e','l','e','a','s','e','_','M','a','r','g','i','n','_','L','e','f','t',0,
-0x6e, 0x28, 0xfe, 0x2a, 'I','S','O','_','R','e','l','e','a','s','e','_','M','a','r','g','i','n','_','R','i','g','h','t',0,
-0x48, 0x2b, 0xfe, 0x2b, 'I','S','O','_','R','e','l','e','a','s','e','_','B','o','t','h','_','M','a','r','g','i','n','s',0,
-0xae, 0xa4, 0xfe, 0x2c, 'I','S','O','_','F','a','s','t','_','C','u','r','s','o','r','_','L','e','f','t',0,
-0x5e, 0x28, 0xfe, 0x2d, 'I','S','O','_','F','a','s','t','_','C','u','r','s','o','r','_','R','i','g','h','t',0,
-0xeb, 0x76, 0xfe, 0x2e, 'I','S','O','_','F','a','s','t','_','C','u','r','s','o','r','_','U','p',0,
-0xae, 0xa8, 0xfe, 0x2f, 'I','S','O','_','F','a','s','t','_','C','u','r','s','o','r','_','D','o','w','n',0,
-0x81, 0x05, 0xfe, 0x30, 'I','S','O','_','C','o','n','t','i','n','u','o','u','s','_','U','n','d','e','r','l','i','n','e',0,
-0x81, 0x05, 0xfe, 0x31, 'I','S','O','_','D','i','s','c','o','n','t','i','n','u','o','u','s','_','U','n','d','e','r','l','i','n','e',0,
-0xd3, 0x25, 0xfe, 0x32, 'I','S','O','_','E','m','p','h','a','s','i','z','e',0,
-0xe3, 0xde, 0xfe, 0x33, 'I','S','O','_','C','e','n','t','e','r','_','O','b','j','e','c','t',0,
-0x9c, 0xec, 0xfe, 0x34, 'I','S','O','_','E','n','t','e','r',0,
-0x8f, 0x35, 0xfe, 0x50, 'd','e','a','d','_','g','r','a','v','e',0,
-0x8e, 0xa9, 0xfe, 0x51, 'd','e','a','d','_','a','c','u','t','e',0,
-0xe8, 0x52, 0xfe, 0x52, 'd','e','a','d','_','c','i','r','c','u','m','f','l','e','x',0,
-0x8f, 0xc5, 0xfe, 0x53, 'd','e','a','d','_','t','i','l','d','e',0,
-0x1e, 0x9c, 0xfe, 0x54, 'd','e','a','d','_','m','a','c','r','o','n',0,
-0x8e, 0xf5, 0xfe, 0x55, 'd','e','a','d','_','b','r','e','v','e',0,
-0x77, 0x4a, 0xfe, 0x56, 'd','e','a','d','_','a','b','o','v','e','d','o','t',0,
-0xf0, 0xb9, 0xfe, 0x57, 'd','e','a','d','_','d','i','a','e','r','e','s','i','s',0,
-0xef, 0x47, 0xfe, 0x58, 'd','e','a','d','_','a','b','o','v','e','r','i','n','g',0,
-0xdf, 0xe9, 0xfe, 0x59, 'd','e','a','d','_','d','o','u','b','l','e','a','c','u','t','e',0,
-0x8e, 0xac, 0xfe, 0x5a, 'd','e','a','d','_','c','a','r','o','n',0,
-0x3b, 0x51, 0xfe, 0x5b, 'd','e','a','d','_','c','e','d','i','l','l','a',0,
-0x1f, 0x75, 0xfe, 0x5c, 'd','e','a','d','_','o','g','o','n','e','k',0,
-0xc7, 0x7d, 0xfe, 0x5d, 'd','e','a','d','_','i','o','t','a',0,
-0x36, 0x1c, 0xfe, 0x5e, 'd','e','a','d','_','v','o','i','c','e','d','_','s','o','u','n','d',0,
-0xf6, 0x1c, 0xfe, 0x5f, 'd','e','a','d','_','s','e','m','i','v','o','i','c','e','d','_','s','o','u','n','d',0,
-0x78, 0x4a, 0xfe, 0x60, 'd','e','a','d','_','b','e','l','o','w','d','o','t',0,
-0xc7, 0x75, 0xfe, 0x61, 'd','e','a','d','_','h','o','o','k',0,
-0xc7, 0x7e, 0xfe, 0x62, 'd','e','a','d','_','h','o','r','n',0,
-0x1f, 0xac, 0xfe, 0xd0, 'F','i','r','s','t','_','V','i','r','t','u','a','l','_','S','c','r','e','e','n',0,
-0x1f, 0xac, 0xfe, 0xd1, 'P','r','e','v','_','V','i','r','t','u','a','l','_','S','c','r','e','e','n',0,
-0x1f, 0xac, 0xfe, 0xd2, 'N','e','x','t','_','V','i','r','t','u','a','l','_','S','c','r','e','e','n',0,
-0x1f, 0xac, 0xfe, 0xd4, 'L','a','s','t','_','V','i','r','t','u','a','l','_','S','c','r','e','e','n',0,
-0xe7, 0x94, 0xfe, 0xd5, 'T','e','r','m','i','n','a','t','e','_','S','e','r','v','e','r',0,
-0xae, 0x0d, 0xfe, 0x70, 'A','c','c','e','s','s','X','_','E','n','a','b','l','e',0,
-0x1f, 0x8d, 0xfe, 0x71, 'A','c','c','e','s','s','X','_','F','e','e','d','b','a','c','k','_','E','n','a','b','l','e',0,
-0xa5, 0x8d, 0xfe, 0x72, 'R','e','p','e','a','t','K','e','y','s','_','E','n','a','b','l','e',0,
-0xbd, 0x8d, 0xfe, 0x73, 'S','l','o','w','K','e','y','s','_','E','n','a','b','l','e',0,
-0xad, 0x8d, 0xfe, 0x74, 'B','o','u','n','c','e','K','e','y','s','_','E','n','a','b','l','e',0,
-0xed, 0x8d, 0xfe, 0x75, 'S','t','i','c','k','y','K','e','y','s','_','E','n','a','b','l','e',0,
-0x0d, 0x8d, 0xfe, 0x76, 'M','o','u','s','e','K','e','y','s','_','E','n','a','b','l','e',0,
-0x32, 0x0d, 0xfe, 0x77, 'M','o','u','s','e','K','e','y','s','_','A','c','c','e','l','_','E','n','a','b','l','e',0,
-0x90, 0x8d, 0xfe, 0x78, 'O','v','e','r','l','a','y','1','_','E','n','a','b','l','e',0,
-0x91, 0x0d, 0xfe, 0x79, 'O','v','e','r','l','a','y','2','_','E','n','a','b','l','e',0,
-0x09, 0x0d, 0xfe, 0x7a, 'A','u','d','i','b','l','e','B','e','l','l','_','E','n','a','b','l','e',0,
-0xe8, 0xa4, 0xfe, 0xe0, 'P','o','i','n','t','e','r','_','L','e','f','t',0,
-0xd2, 0x28, 0xfe, 0xe1, 'P','o','i','n','t','e','r','_','R','i','g','h','t',0,
-0x79, 0xf6, 0xfe, 0xe2, 'P','o','i','n','t','e','r','_','U','p',0,
-0xe8, 0xa8, 0xfe, 0xe3, 'P','o','i','n','t','e','r','_','D','o','w','n',0,
-0xa4, 0x94, 0xfe, 0xe4, 'P','o','i','n','t','e','r','_','U','p','L','e','f','t',0,
-0x4a, 0x08, 0xfe, 0xe5, 'P','o','i','n','t','e','r','_','U','p','R','i','g','h','t',0,
-0x8f, 0xb4, 0xfe, 0xe6, 'P','o','i','n','t','e','r','_','D','o','w','n','L','e','f','t',0,
-0x20, 0x48, 0xfe, 0xe7, 'P','o','i','n','t','e','r','_','D','o','w','n','R','i','g','h','t',0,
-0x8c, 0x74, 0xfe, 0xe8, 'P','o','i','n','t','e','r','_','B','u','t','t','o','n','_','D','f','l','t',0,
-0x48, 0x49, 0xfe, 0xe9, 'P','o','i','n','t','e','r','_','B','u','t','t','o','n','1',0,
-0x48, 0x4a, 0xfe, 0xea, 'P','o','i','n','t','e','r','_','B','u','t','t','o','n','2',0,
-0x48, 0x4b, 0xfe, 0xeb, 'P','o','i','n','t','e','r','_','B','u','t','t','o','n','3',0,
-0x48, 0x4c, 0xfe, 0xec, 'P','o','i','n','t','e','r','_','B','u','t','t','o','n','4',0,
-0x48, 0x4d, 0xfe, 0xed, 'P','o','i','n','t','e','r','_','B','u','t','t','o','n','5',0,
-0x37, 0x94, 0xfe, 0xee, 'P','o','i','n','t','e','r','_','D','b','l','C','l','i','c','k','_','D','f','l','t',0,
-0x12, 0xfb, 0xfe, 0xef, 'P','o','i','n','t','e','r','_','D','b','l','C','l','i','c','k','1',0,
-0x12, 0xfc, 0xfe, 0xf0, 'P','o','i','n','t','e','r','_','D','b','l','C','l','i','c','k','2',0,
-0x12, 0xfd, 0xfe, 0xf1, 'P','o','i','n','t','e','r','_','D','b','l','C','l','i','c','k','3',0,
-0x12, 0xfe, 0xfe, 0xf2, 'P','o','i','n','t','e','r','_','D','b','l','C','l','i','c','k','4',0,
-0x12, 0xff, 0xfe, 0xf3, 'P','o','i','n','t','e','r','_','D','b','l','C','l','i','c','k','5',0,
-0x1b, 0x14, 0xfe, 0xf4, 'P','o','i','n','t','e','r','_','D','r','a','g','_','D','f','l','t',0,
-0xd1, 0x33, 0xfe, 0xf5, 'P','o','i','n','t','e','r','_','D','r','a','g','1',0,
-0xd1, 0x34, 0xfe, 0xf6, 'P','o','i','n','t','e','r','_','D','r','a','g','2',0,
-0xd1, 0x35, 0xfe, 0xf7, 'P','o','i','n','t','e','r','_','D','r','a','g','3',0,
-0xd1, 0x36, 0xfe, 0xf8, 'P','o','i','n','t','e','r','_','D','r','a','g','4',0,
-0xd1, 0x37, 0xfe, 0xfd, 'P','o','i','n','t','e','r','_','D','r','a','g','5',0,
-0x36, 0x21, 0xfe, 0xf9, 'P','o','i','n','t','e','r','_','E','n','a','b','l','e','K','e','y','s',0,
-0x25, 0xf1, 0xfe, 0xfa, 'P','o','i','n','t','e','r','_','A','c','c','e','l','e','r','a','t','e',0,
-0x65, 0x48, 0xfe, 0xfb, 'P','o','i','n','t','e','r','_','D','f','l','t','B','t','n','N','e','x','t',0,
-0x65, 0x68, 0xfe, 0xfc, 'P','o','i','n','t','e','r','_','D','f','l','t','B','t','n','P','r','e','v',0,
-0x6a, 0x79, 0xfd, 0x01, '3','2','7','0','_','D','u','p','l','i','c','a','t','e',0,
-0x62, 0xbb, 0xfd, 0x02, '3','2','7','0','_','F','i','e','l','d','M','a','r','k',0,
-0xad, 0x82, 0xfd, 0x03, '3','2','7','0','_','R','i','g','h','t','2',0,
-0xd5, 0xfa, 0xfd, 0x04, '3','2','7','0','_','L','e','f','t','2',0,
-0x56, 0x1c, 0xfd, 0x05, '3','2','7','0','_','B','a','c','k','T','a','b',0,
-0xb2, 0x70, 0xfd, 0x06, '3','2','7','0','_','E','r','a','s','e','E','O','F',0,
-0xcc, 0xfe, 0xfd, 0x07, '3','2','7','0','_','E','r','a','s','e','I','n','p','u','t',0,
-0xd6, 0xb2, 0xfd, 0x08, '3','2','7','0','_','R','e','s','e','t',0,
-0x6b, 0x52, 0xfd, 0x09, '3','2','7','0','_','Q','u','i','t',0,
-0x34, 0xcb, 0xfd, 0x0a, '3','2','7','0','_','P','A','1',0,
-0x34, 0xcc, 0xfd, 0x0b, '3','2','7','0','_','P','A','2',0,
-0x34, 0xcd, 0xfd, 0x0c, '3','2','7','0','_','P','A','3',0,
-0x6b, 0x3e, 0xfd, 0x0d, '3','2','7','0','_','T','e','s','t',0,
-0x6a, 0xde, 0xfd, 0x0e, '3','2','7','0','_','A','t','t','n',0,
-0xad, 0xeb, 0xfd, 0x0f, '3','2','7','0','_','C','u','r','s','o','r','B','l','i','n','k',0,
-0x60, 0x5c, 0xfd, 0x10, '3','2','7','0','_','A','l','t','C','u','r','s','o','r',0,
-0xb3, 0x45, 0xfd, 0x11, '3','2','7','0','_','K','e','y','C','l','i','c','k',0,
-0x6b, 0x1e, 0xfd, 0x12, '3','2','7','0','_','J','u','m','p',0,
-0xd5, 0xf4, 0xfd, 0x13, '3','2','7','0','_','I','d','e','n','t',0,
-0x6b, 0x51, 0xfd, 0x14, '3','2','7','0','_','R','u','l','e',0,
-0x6a, 0xdd, 0xfd, 0x15, '3','2','7','0','_','C','o','p','y',0,
-0x6b, 0x1b, 0xfd, 0x16, '3','2','7','0','_','P','l','a','y',0,
-0xd6, 0xe2, 0xfd, 0x17, '3','2','7','0','_','S','e','t','u','p',0,
-0xad, 0x6c, 0xfd, 0x18, '3','2','7','0','_','R','e','c','o','r','d',0,
-0xfb, 0xac, 0xfd, 0x19, '3','2','7','0','_','C','h','a','n','g','e','S','c','r','e','e','n',0,
-0xc2, 0xcc, 0xfd, 0x1a, '3','2','7','0','_','D','e','l','e','t','e','W','o','r','d',0,
-0xb2, 0x5e, 0xfd, 0x1b, '3','2','7','0','_','E','x','S','e','l','e','c','t',0,
-0x5d, 0xde, 0xfd, 0x1c, '3','2','7','0','_','C','u','r','s','o','r','S','e','l','e','c','t',0,
-0xcf, 0xec, 0xfd, 0x1d, '3','2','7','0','_','P','r','i','n','t','S','c','r','e','e','n',0,
-0xd6, 0x2c, 0xfd, 0x1e, '3','2','7','0','_','E','n','t','e','r',0,
-0x0d, 0x5f, 0x00, 0x20, 's','p','a','c','e',0,
-0x1a, 0x17, 0x00, 0x21, 'e','x','c','l','a','m',0,
-0x70, 0xc8, 0x00, 0x22, 'q','u','o','t','e','d','b','l',0,
-0xba, 0x38, 0x00, 0x23, 'n','u','m','b','e','r','s','i','g','n',0,
-0x19, 0xb4, 0x00, 0x24, 'd','o','l','l','a','r',0,
-0x35, 0xbc, 0x00, 0x25, 'p','e','r','c','e','n','t',0,
-0xcd, 0x9c, 0x00, 0x26, 'a','m','p','e','r','s','a','n','d',0,
-0xa2, 0x4d, 0x00, 0x27, 'a','p','o','s','t','r','o','p','h','e',0,
-0xc5, 0x68, 0x00, 0x27, 'q','u','o','t','e','r','i','g','h','t',0,
-0xd6, 0xb4, 0x00, 0x28, 'p','a','r','e','n','l','e','f','t',0,
-0xae, 0x48, 0x00, 0x29, 'p','a','r','e','n','r','i','g','h','t',0,
-0x68, 0x95, 0x00, 0x2a, 'a','s','t','e','r','i','s','k',0,
-0x06, 0x8d, 0x00, 0x2b, 'p','l','u','s',0,
-0x0c, 0x97, 0x00, 0x2c, 'c','o','m','m','a',0,
-0x0d, 0x2d, 0x00, 0x2d, 'm','i','n','u','s',0,
-0x1a, 0xc6, 0x00, 0x2e, 'p','e','r','i','o','d',0,
-0x0d, 0x62, 0x00, 0x2f, 's','l','a','s','h',0,
-0x00, 0x30, 0x00, 0x30, '0',0,
-0x00, 0x31, 0x00, 0x31, '1',0,
-0x00, 0x32, 0x00, 0x32, '2',0,
-0x00, 0x33, 0x00, 0x33, '3',0,
-0x00, 0x34, 0x00, 0x34, '4',0,
-0x00, 0x35, 0x00, 0x35, '5',0,
-0x00, 0x36, 0x00, 0x36, '6',0,
-0x00, 0x37, 0x00, 0x37, '7',0,
-0x00, 0x38, 0x00, 0x38, '8',0,
-0x00, 0x39, 0x00, 0x39, '9',0,
-0x0c, 0xa4, 0x00, 0x3a, 'c','o','l','o','n',0,
-0xda, 0x84, 0x00, 0x3b, 's','e','m','i','c','o','l','o','n',0,
-0x06, 0x4d, 0x00, 0x3c, 'l','e','s','s',0,
-0x0c, 0xda, 0x00, 0x3d, 'e','q','u','a','l',0,
-0x34, 0x64, 0x00, 0x3e, 'g','r','e','a','t','e','r',0,
-0x70, 0x20, 0x00, 0x3f, 'q','u','e','s','t','i','o','n',0,
-0x01, 0x36, 0x00, 0x40, 'a','t',0,
-0x00, 0x41, 0x00, 0x41, 'A',0,
-0x00, 0x42, 0x00, 0x42, 'B',0,
-0x00, 0x43, 0x00, 0x43, 'C',0,
-0x00, 0x44, 0x00, 0x44, 'D',0,
-0x00, 0x45, 0x00, 0x45, 'E',0,
-0x00, 0x46, 0x00, 0x46, 'F',0,
-0x00, 0x47, 0x00, 0x47, 'G',0,
-0x00, 0x48, 0x00, 0x48, 'H',0,
-0x00, 0x49, 0x00, 0x49, 'I',0,
-0x00, 0x4a, 0x00, 0x4a, 'J',0,
-0x00, 0x4b, 0x00, 0x4b, 'K',0,
-0x00, 0x4c, 0x00, 0x4c, 'L',0,
-0x00, 0x4d, 0x00, 0x4d, 'M',0,
-0x00, 0x4e, 0x00, 0x4e, 'N',0,
-0x00, 0x4f, 0x00, 0x4f, 'O',0,
-0x00, 0x50, 0x00, 0x50, 'P',0,
-0x00, 0x51, 0x00, 0x51, 'Q',0,
-0x00, 0x52, 0x00, 0x52, 'R',0,
-0x00, 0x53, 0x00, 0x53, 'S',0,
-0x00, 0x54, 0x00, 0x54, 'T',0,
-0x00, 0x55, 0x00, 0x55, 'U',0,
-0x00, 0x56, 0x00, 0x56, 'V',0,
-0x00, 0x57, 0x00, 0x57, 'W',0,
-0x00, 0x58, 0x00, 0x58, 'X',0,
-0x00, 0x59, 0x00, 0x59, 'Y',0,
-0x00, 0x5a, 0x00, 0x5a, 'Z',0,
-0x33, 0x54, 0x00, 0x5b, 'b','r','a','c','k','e','t','l','e','f','t',0,
-0xc6, 0x02, 0x00, 0x5c, 'b','a','c','k','s','l','a','s','h',0,
-0x67, 0x88, 0x00, 0x5d, 'b','r','a','c','k','e','t','r','i','g','h','t',0,
-0x35, 0x23, 0x00, 0x5e, 'a','s','c','i','i','c','i','r','c','u','m',0,
-0xbe, 0xcd, 0x00, 0x5f, 'u','n','d','e','r','s','c','o','r','e',0,
-0x0c, 0xd5, 0x00, 0x60, 'g','r','a','v','e',0,
-0xe2, 0x44, 0x00, 0x60, 'q','u','o','t','e','l','e','f','t',0,
-0x00, 0x61, 0x00, 0x61, 'a',0,
-0x00, 0x62, 0x00, 0x62, 'b',0,
-0x00, 0x63, 0x00, 0x63, 'c',0,
-0x00, 0x64, 0x00, 0x64, 'd',0,
-0x00, 0x65, 0x00, 0x65, 'e',0,
-0x00, 0x66, 0x00, 0x66, 'f',0,
-0x00, 0x67, 0x00, 0x67, 'g',0,
-0x00, 0x68, 0x00, 0x68, 'h',0,
-0x00, 0x69, 0x00, 0x69, 'i',0,
-0x00, 0x6a, 0x00, 0x6a, 'j',0,
-0x00, 0x6b, 0x00, 0x6b, 'k',0,
-0x00, 0x6c, 0x00, 0x6c, 'l',0,
-0x00, 0x6d, 0x00, 0x6d, 'm',0,
-0x00, 0x6e, 0x00, 0x6e, 'n',0,
-0x00, 0x6f, 0x00, 0x6f, 'o',0,
-0x00, 0x70, 0x00, 0x70, 'p',0,
-0x00, 0x71, 0x00, 0x71, 'q',0,
-0x00, 0x72, 0x00, 0x72, 'r',0,
-0x00, 0x73, 0x00, 0x73, 's',0,
-0x00, 0x74, 0x00, 0x74, 't',0,
-0x00, 0x75, 0x00, 0x75, 'u',0,
-0x00, 0x76, 0x00, 0x76, 'v',0,
-0x00, 0x77, 0x00, 0x77, 'w',0,
-0x00, 0x78, 0x00, 0x78, 'x',0,
-0x00, 0x79, 0x00, 0x79, 'y',0,
-0x00, 0x7a, 0x00, 0x7a, 'z',0,
-0xcc, 0x24, 0x00, 0x7b, 'b','r','a','c','e','l','e','f','t',0,
-0x02, 0xbc, 0x00, 0x7c, 'b','a','r',0,
-0x99, 0x28, 0x00, 0x7d, 'b','r','a','c','e','r','i','g','h','t',0,
-0x9b, 0x45, 0x00, 0x7e, 'a','s','c','i','i','t','i','l','d','e',0,
-0xc7, 0x7f, 0x00, 0xa0, 'n','o','b','r','e','a','k','s','p','a','c','e',0,
-0xa7, 0xa8, 0x00, 0xa1, 'e','x','c','l','a','m','d','o','w','n',0,
-0x05, 0xfc, 0x00, 0xa2, 'c','e','n','t',0,
-0x70, 0x87, 0x00, 0xa3, 's','t','e','r','l','i','n','g',0,
-0x6a, 0x3f, 0x00, 0xa4, 'c','u','r','r','e','n','c','y',0,
-0x03, 0x1c, 0x00, 0xa5, 'y','e','n',0,
-0xd0, 0x9c, 0x00, 0xa6, 'b','r','o','k','e','n','b','a','r',0,
-0x36, 0x20, 0x00, 0xa7, 's','e','c','t','i','o','n',0,
-0xca, 0xb9, 0x00, 0xa8, 'd','i','a','e','r','e','s','i','s',0,
-0xd2, 0xe8, 0x00, 0xa9, 'c','o','p','y','r','i','g','h','t',0,
-0x6a, 0xc5, 0x00, 0xaa, 'o','r','d','f','e','m','i','n','i','n','e',0,
-0x69, 0x14, 0x00, 0xab, 'g','u','i','l','l','e','m','o','t','l','e','f','t',0,
-0x37, 0x18, 0x00, 0xac, 'n','o','t','s','i','g','n',0,
-0x1a, 0xe8, 0x00, 0xad, 'h','y','p','h','e','n',0,
-0xb2, 0x7e, 0x00, 0xae, 'r','e','g','i','s','t','e','r','e','d',0,
-0x19, 0xdc, 0x00, 0xaf, 'm','a','c','r','o','n',0,
-0x18, 0xff, 0x00, 0xb0, 'd','e','g','r','e','e',0,
-0xde, 0xcd, 0x00, 0xb1, 'p','l','u','s','m','i','n','u','s',0,
-0x9e, 0x94, 0x00, 0xb2, 't','w','o','s','u','p','e','r','i','o','r',0,
-0xe8, 0x94, 0x00, 0xb3, 't','h','r','e','e','s','u','p','e','r','i','o','r',0,
-0x0c, 0x49, 0x00, 0xb4, 'a','c','u','t','e',0,
-0x01, 0x4f, 0x00, 0xb5, 'm','u',0,
-0xd5, 0xec, 0x00, 0xb6, 'p','a','r','a','g','r','a','p','h',0,
-0x2b, 0xde, 0x00, 0xb7, 'p','e','r','i','o','d','c','e','n','t','e','r','e','d',0,
-0x31, 0xd1, 0x00, 0xb8, 'c','e','d','i','l','l','a',0,
-0x6e, 0x94, 0x00, 0xb9, 'o','n','e','s','u','p','e','r','i','o','r',0,
-0xd4, 0x35, 0x00, 0xba, 'm','a','s','c','u','l','i','n','e',0,
-0xd3, 0x08, 0x00, 0xbb, 'g','u','i','l','l','e','m','o','t','r','i','g','h','t',0,
-0xb6, 0x0c, 0x00, 0xbc, 'o','n','e','q','u','a','r','t','e','r',0,
-0x35, 0xd2, 0x00, 0xbd, 'o','n','e','h','a','l','f',0,
-0xe6, 0x8b, 0x00, 0xbe, 't','h','r','e','e','q','u','a','r','t','e','r','s',0,
-0x08, 0x38, 0x00, 0xbf, 'q','u','e','s','t','i','o','n','d','o','w','n',0,
-0x14, 0xf5, 0x00, 0xc0, 'A','g','r','a','v','e',0,
-0x14, 0x69, 0x00, 0xc1, 'A','a','c','u','t','e',0,
-0xa0, 0x52, 0x00, 0xc2, 'A','c','i','r','c','u','m','f','l','e','x',0,
-0x15, 0x85, 0x00, 0xc3, 'A','t','i','l','d','e',0,
-0x4c, 0xb9, 0x00, 0xc4, 'A','d','i','a','e','r','e','s','i','s',0,
-0x0a, 0x87, 0x00, 0xc5, 'A','r','i','n','g',0,
-0x00, 0xc7, 0x00, 0xc6, 'A','E',0,
-0x53, 0x51, 0x00, 0xc7, 'C','c','e','d','i','l','l','a',0,
-0x15, 0x75, 0x00, 0xc8, 'E','g','r','a','v','e',0,
-0x14, 0xe9, 0x00, 0xc9, 'E','a','c','u','t','e',0,
-0xb0, 0x52, 0x00, 0xca, 'E','c','i','r','c','u','m','f','l','e','x',0,
-0x54, 0xb9, 0x00, 0xcb, 'E','d','i','a','e','r','e','s','i','s',0,
-0x15, 0xf5, 0x00, 0xcc, 'I','g','r','a','v','e',0,
-0x15, 0x69, 0x00, 0xcd, 'I','a','c','u','t','e',0,
-0xc0, 0x52, 0x00, 0xce, 'I','c','i','r','c','u','m','f','l','e','x',0,
-0x5c, 0xb9, 0x00, 0xcf, 'I','d','i','a','e','r','e','s','i','s',0,
-0x02, 0x04, 0x00, 0xd0, 'E','T','H',0,
-0x02, 0x64, 0x00, 0xd0, 'E','t','h',0,
-0x17, 0x25, 0x00, 0xd1, 'N','t','i','l','d','e',0,
-0x16, 0xb5, 0x00, 0xd2, 'O','g','r','a','v','e',0,
-0x16, 0x29, 0x00, 0xd3, 'O','a','c','u','t','e',0,
-0xd8, 0x52, 0x00, 0xd4, 'O','c','i','r','c','u','m','f','l','e','x',0,
-0x17, 0x45, 0x00, 0xd5, 'O','t','i','l','d','e',0,
-0x68, 0xb9, 0x00, 0xd6, 'O','d','i','a','e','r','e','s','i','s',0,
-0x6e, 0xd9, 0x00, 0xd7, 'm','u','l','t','i','p','l','y',0,
-0x5c, 0x9b, 0x00, 0xd8, 'O','o','b','l','i','q','u','e',0,
-0x17, 0x75, 0x00, 0xd9, 'U','g','r','a','v','e',0,
-0x16, 0xe9, 0x00, 0xda, 'U','a','c','u','t','e',0,
-0xf0, 0x52, 0x00, 0xdb, 'U','c','i','r','c','u','m','f','l','e','x',0,
-0x74, 0xb9, 0x00, 0xdc, 'U','d','i','a','e','r','e','s','i','s',0,
-0x17, 0x69, 0x00, 0xdd, 'Y','a','c','u','t','e',0,
-0x09, 0xae, 0x00, 0xde, 'T','H','O','R','N',0,
-0x0b, 0x8e, 0x00, 0xde, 'T','h','o','r','n',0,
-0x1b, 0xa8, 0x00, 0xdf, 's','s','h','a','r','p',0,
-0x18, 0xf5, 0x00, 0xe0, 'a','g','r','a','v','e',0,
-0x18, 0x69, 0x00, 0xe1, 'a','a','c','u','t','e',0,
-0x20, 0x52, 0x00, 0xe2, 'a','c','i','r','c','u','m','f','l','e','x',0,
-0x19, 0x85, 0x00, 0xe3, 'a','t','i','l','d','e',0,
-0x8c, 0xb9, 0x00, 0xe4, 'a','d','i','a','e','r','e','s','i','s',0,
-0x0c, 0x87, 0x00, 0xe5, 'a','r','i','n','g',0,
-0x01, 0x27, 0x00, 0xe6, 'a','e',0,
-0x63, 0x51, 0x00, 0xe7, 'c','c','e','d','i','l','l','a',0,
-0x19, 0x75, 0x00, 0xe8, 'e','g','r','a','v','e',0,
-0x18, 0xe9, 0x00, 0xe9, 'e','a','c','u','t','e',0,
-0x30, 0x52, 0x00, 0xea, 'e','c','i','r','c','u','m','f','l','e','x',0,
-0x94, 0xb9, 0x00, 0xeb, 'e','d','i','a','e','r','e','s','i','s',0,
-0x19, 0xf5, 0x00, 0xec, 'i','g','r','a','v','e',0,
-0x19, 0x69, 0x00, 0xed, 'i','a','c','u','t','e',0,
-0x40, 0x52, 0x00, 0xee, 'i','c','i','r','c','u','m','f','l','e','x',0,
-0x9c, 0xb9, 0x00, 0xef, 'i','d','i','a','e','r','e','s','i','s',0,
-0x02, 0xe4, 0x00, 0xf0, 'e','t','h',0,
-0x1b, 0x25, 0x00, 0xf1, 'n','t','i','l','d','e',0,
-0x1a, 0xb5, 0x00, 0xf2, 'o','g','r','a','v','e',0,
-0x1a, 0x29, 0x00, 0xf3, 'o','a','c','u','t','e',0,
-0x58, 0x52, 0x00, 0xf4, 'o','c','i','r','c','u','m','f','l','e','x',0,
-0x1b, 0x45, 0x00, 0xf5, 'o','t','i','l','d','e',0,
-0xa8, 0xb9, 0x00, 0xf6, 'o','d','i','a','e','r','e','s','i','s',0,
-0x68, 0x18, 0x00, 0xf7, 'd','i','v','i','s','i','o','n',0,
-0x1b, 0x42, 0x00, 0xf8, 'o','s','l','a','s','h',0,
-0x1b, 0x75, 0x00, 0xf9, 'u','g','r','a','v','e',0,
-0x1a, 0xe9, 0x00, 0xfa, 'u','a','c','u','t','e',0,
-0x70, 0x52, 0x00, 0xfb, 'u','c','i','r','c','u','m','f','l','e','x',0,
-0xb4, 0xb9, 0x00, 0xfc, 'u','d','i','a','e','r','e','s','i','s',0,
-0x1b, 0x69, 0x00, 0xfd, 'y','a','c','u','t','e',0,
-0x0d, 0x8e, 0x00, 0xfe, 't','h','o','r','n',0,
-0xbc, 0xb9, 0x00, 0xff, 'y','d','i','a','e','r','e','s','i','s',0,
-0x2a, 0xf5, 0x01, 0xa1, 'A','o','g','o','n','e','k',0,
-0x0c, 0x95, 0x01, 0xa2, 'b','r','e','v','e',0,
-0x2f, 0x27, 0x01, 0xa3, 'L','s','t','r','o','k','e',0,
-0x15, 0xcc, 0x01, 0xa5, 'L','c','a','r','o','n',0,
-0x16, 0xa9, 0x01, 0xa6, 'S','a','c','u','t','e',0,
-0x16, 0xac, 0x01, 0xa9, 'S','c','a','r','o','n',0,
-0x5b, 0x51, 0x01, 0xaa, 'S','c','e','d','i','l','l','a',0,
-0x16, 0xcc, 0x01, 0xab, 'T','c','a','r','o','n',0,
-0x17, 0x89, 0x01, 0xac, 'Z','a','c','u','t','e',0,
-0x17, 0x8c, 0x01, 0xae, 'Z','c','a','r','o','n',0,
-0xbe, 0x4a, 0x01, 0xaf, 'Z','a','b','o','v','e','d','o','t',0,
-0x32, 0xf5, 0x01, 0xb1, 'a','o','g','o','n','e','k',0,
-0x1a, 0xb5, 0x01, 0xb2, 'o','g','o','n','e','k',0,
-0x37, 0x27, 0x01, 0xb3, 'l','s','t','r','o','k','e',0,
-0x19, 0xcc, 0x01, 0xb5, 'l','c','a','r','o','n',0,
-0x1a, 0xa9, 0x01, 0xb6, 's','a','c','u','t','e',0,
-0x0c, 0x4c, 0x01, 0xb7, 'c','a','r','o','n',0,
-0x1a, 0xac, 0x01, 0xb9, 's','c','a','r','o','n',0,
-0x6b, 0x51, 0x01, 0xba, 's','c','e','d','i','l','l','a',0,
-0x1a, 0xcc, 0x01, 0xbb, 't','c','a','r','o','n',0,
-0x1b, 0x89, 0x01, 0xbc, 'z','a','c','u','t','e',0,
-0x47, 0xe9, 0x01, 0xbd, 'd','o','u','b','l','e','a','c','u','t','e',0,
-0x1b, 0x8c, 0x01, 0xbe, 'z','c','a','r','o','n',0,
-0xde, 0x4a, 0x01, 0xbf, 'z','a','b','o','v','e','d','o','t',0,
-0x16, 0x89, 0x01, 0xc0, 'R','a','c','u','t','e',0,
-0x14, 0xb5, 0x01, 0xc3, 'A','b','r','e','v','e',0,
-0x15, 0xc9, 0x01, 0xc5, 'L','a','c','u','t','e',0,
-0x14, 0xa9, 0x01, 0xc6, 'C','a','c','u','t','e',0,
-0x14, 0xac, 0x01, 0xc8, 'C','c','a','r','o','n',0,
-0x2b, 0xf5, 0x01, 0xca, 'E','o','g','o','n','e','k',0,
-0x14, 0xec, 0x01, 0xcc, 'E','c','a','r','o','n',0,
-0x14, 0xcc, 0x01, 0xcf, 'D','c','a','r','o','n',0,
-0x2d, 0x27, 0x01, 0xd0, 'D','s','t','r','o','k','e',0,
-0x16, 0x09, 0x01, 0xd1, 'N','a','c','u','t','e',0,
-0x16, 0x0c, 0x01, 0xd2, 'N','c','a','r','o','n',0,
-0xbf, 0xe9, 0x01, 0xd5, 'O','d','o','u','b','l','e','a','c','u','t','e',0,
-0x16, 0x8c, 0x01, 0xd8, 'R','c','a','r','o','n',0,
-0x0b, 0xc7, 0x01, 0xd9, 'U','r','i','n','g',0,
-0xef, 0xe9, 0x01, 0xdb, 'U','d','o','u','b','l','e','a','c','u','t','e',0,
-0x5b, 0xd1, 0x01, 0xde, 'T','c','e','d','i','l','l','a',0,
-0x1a, 0x89, 0x01, 0xe0, 'r','a','c','u','t','e',0,
-0x18, 0xb5, 0x01, 0xe3, 'a','b','r','e','v','e',0,
-0x19, 0xc9, 0x01, 0xe5, 'l','a','c','u','t','e',0,
-0x18, 0xa9, 0x01, 0xe6, 'c','a','c','u','t','e',0,
-0x18, 0xac, 0x01, 0xe8, 'c','c','a','r','o','n',0,
-0x33, 0xf5, 0x01, 0xea, 'e','o','g','o','n','e','k',0,
-0x18, 0xec, 0x01, 0xec, 'e','c','a','r','o','n',0,
-0x18, 0xcc, 0x01, 0xef, 'd','c','a','r','o','n',0,
-0x35, 0x27, 0x01, 0xf0, 'd','s','t','r','o','k','e',0,
-0x1a, 0x09, 0x01, 0xf1, 'n','a','c','u','t','e',0,
-0x1a, 0x0c, 0x01, 0xf2, 'n','c','a','r','o','n',0,
-0xbf, 0xe9, 0x01, 0xf5, 'o','d','o','u','b','l','e','a','c','u','t','e',0,
-0xef, 0xe9, 0x01, 0xfb, 'u','d','o','u','b','l','e','a','c','u','t','e',0,
-0x1a, 0x8c, 0x01, 0xf8, 'r','c','a','r','o','n',0,
-0x0d, 0xc7, 0x01, 0xf9, 'u','r','i','n','g',0,
-0x6b, 0xd1, 0x01, 0xfe, 't','c','e','d','i','l','l','a',0,
-0x64, 0x4a, 0x01, 0xff, 'a','b','o','v','e','d','o','t',0,
-0x2e, 0x27, 0x02, 0xa1, 'H','s','t','r','o','k','e',0,
-0xbc, 0x52, 0x02, 0xa6, 'H','c','i','r','c','u','m','f','l','e','x',0,
-0xad, 0x4a, 0x02, 0xa9, 'I','a','b','o','v','e','d','o','t',0,
-0x15, 0x75, 0x02, 0xab, 'G','b','r','e','v','e',0,
-0xc4, 0x52, 0x02, 0xac, 'J','c','i','r','c','u','m','f','l','e','x',0,
-0x36, 0x27, 0x02, 0xb1, 'h','s','t','r','o','k','e',0,
-0x3c, 0x52, 0x02, 0xb6, 'h','c','i','r','c','u','m','f','l','e','x',0,
-0x68, 0xed, 0x02, 0xb9, 'i','d','o','t','l','e','s','s',0,
-0x19, 0x75, 0x02, 0xbb, 'g','b','r','e','v','e',0,
-0x44, 0x52, 0x02, 0xbc, 'j','c','i','r','c','u','m','f','l','e','x',0,
-0xa7, 0x4a, 0x02, 0xc5, 'C','a','b','o','v','e','d','o','t',0,
-0xa8, 0x52, 0x02, 0xc6, 'C','c','i','r','c','u','m','f','l','e','x',0,
-0xab, 0x4a, 0x02, 0xd5, 'G','a','b','o','v','e','d','o','t',0,
-0xb8, 0x52, 0x02, 0xd8, 'G','c','i','r','c','u','m','f','l','e','x',0,
-0x17, 0x35, 0x02, 0xdd, 'U','b','r','e','v','e',0,
-0xe8, 0x52, 0x02, 0xde, 'S','c','i','r','c','u','m','f','l','e','x',0,
-0xc7, 0x4a, 0x02, 0xe5, 'c','a','b','o','v','e','d','o','t',0,
-0x28, 0x52, 0x02, 0xe6, 'c','c','i','r','c','u','m','f','l','e','x',0,
-0xcb, 0x4a, 0x02, 0xf5, 'g','a','b','o','v','e','d','o','t',0,
-0x38, 0x52, 0x02, 0xf8, 'g','c','i','r','c','u','m','f','l','e','x',0,
-0x1b, 0x35, 0x02, 0xfd, 'u','b','r','e','v','e',0,
-0x68, 0x52, 0x02, 0xfe, 's','c','i','r','c','u','m','f','l','e','x',0,
-0x02, 0xf1, 0x03, 0xa2, 'k','r','a',0,
-0x0c, 0xb9, 0x03, 0xa2, 'k','a','p','p','a',0,
-0x5a, 0xd1, 0x03, 0xa3, 'R','c','e','d','i','l','l','a',0,
-0x16, 0x85, 0x03, 0xa5, 'I','t','i','l','d','e',0,
-0x57, 0xd1, 0x03, 0xa6, 'L','c','e','d','i','l','l','a',0,
-0x2b, 0x1c, 0x03, 0xaa, 'E','m','a','c','r','o','n',0,
-0x55, 0x51, 0x03, 0xab, 'G','c','e','d','i','l','l','a',0,
-0x17, 0xe2, 0x03, 0xac, 'T','s','l','a','s','h',0,
-0x6a, 0xd1, 0x03, 0xb3, 'r','c','e','d','i','l','l','a',0,
-0x1a, 0x85, 0x03, 0xb5, 'i','t','i','l','d','e',0,
-0x67, 0xd1, 0x03, 0xb6, 'l','c','e','d','i','l','l','a',0,
-0x33, 0x1c, 0x03, 0xba, 'e','m','a','c','r','o','n',0,
-0x65, 0x51, 0x03, 0xbb, 'g','c','e','d','i','l','l','a',0,
-0x1b, 0xe2, 0x03, 0xbc, 't','s','l','a','s','h',0,
-0x01, 0xf7, 0x03, 0xbd, 'E','N','G',0,
-0x02, 0xd7, 0x03, 0xbf, 'e','n','g',0,
-0x2a, 0x1c, 0x03, 0xc0, 'A','m','a','c','r','o','n',0,
-0x2c, 0xf5, 0x03, 0xc7, 'I','o','g','o','n','e','k',0,
-0xa9, 0x4a, 0x03, 0xcc, 'E','a','b','o','v','e','d','o','t',0,
-0x2c, 0x1c, 0x03, 0xcf, 'I','m','a','c','r','o','n',0,
-0x58, 0xd1, 0x03, 0xd1, 'N','c','e','d','i','l','l','a',0,
-0x2d, 0x9c, 0x03, 0xd2, 'O','m','a','c','r','o','n',0,
-0x57, 0x51, 0x03, 0xd3, 'K','c','e','d','i','l','l','a',0,
-0x2f, 0xf5, 0x03, 0xd9, 'U','o','g','o','n','e','k',0,
-0x18, 0x05, 0x03, 0xdd, 'U','t','i','l','d','e',0,
-0x2f, 0x1c, 0x03, 0xde, 'U','m','a','c','r','o','n',0,
-0x32, 0x1c, 0x03, 0xe0, 'a','m','a','c','r','o','n',0,
-0x34, 0xf5, 0x03, 0xe7, 'i','o','g','o','n','e','k',0,
-0xc9, 0x4a, 0x03, 0xec, 'e','a','b','o','v','e','d','o','t',0,
-0x34, 0x1c, 0x03, 0xef, 'i','m','a','c','r','o','n',0,
-0x68, 0xd1, 0x03, 0xf1, 'n','c','e','d','i','l','l','a',0,
-0x35, 0x9c, 0x03, 0xf2, 'o','m','a','c','r','o','n',0,
-0x67, 0x51, 0x03, 0xf3, 'k','c','e','d','i','l','l','a',0,
-0x37, 0xf5, 0x03, 0xf9, 'u','o','g','o','n','e','k',0,
-0x1c, 0x05, 0x03, 0xfd, 'u','t','i','l','d','e',0,
-0x37, 0x1c, 0x03, 0xfe, 'u','m','a','c','r','o','n',0,
-0xa6, 0x4a, 0x12, 0xa1, 'B','a','b','o','v','e','d','o','t',0,
-0xc6, 0x4a, 0x12, 0xa2, 'b','a','b','o','v','e','d','o','t',0,
-0xa8, 0x4a, 0x12, 0xa6, 'D','a','b','o','v','e','d','o','t',0,
-0x17, 0xb5, 0x12, 0xa8, 'W','g','r','a','v','e',0,
-0x17, 0x29, 0x12, 0xaa, 'W','a','c','u','t','e',0,
-0xc8, 0x4a, 0x12, 0xab, 'd','a','b','o','v','e','d','o','t',0,
-0x17, 0xf5, 0x12, 0xac, 'Y','g','r','a','v','e',0,
-0xaa, 0x4a, 0x12, 0xb0, 'F','a','b','o','v','e','d','o','t',0,
-0xca, 0x4a, 0x12, 0xb1, 'f','a','b','o','v','e','d','o','t',0,
-0xb1, 0x4a, 0x12, 0xb4, 'M','a','b','o','v','e','d','o','t',0,
-0xd1, 0x4a, 0x12, 0xb5, 'm','a','b','o','v','e','d','o','t',0,
-0xb4, 0x4a, 0x12, 0xb7, 'P','a','b','o','v','e','d','o','t',0,
-0x1b, 0xb5, 0x12, 0xb8, 'w','g','r','a','v','e',0,
-0xd4, 0x4a, 0x12, 0xb9, 'p','a','b','o','v','e','d','o','t',0,
-0x1b, 0x29, 0x12, 0xba, 'w','a','c','u','t','e',0,
-0xb7, 0x4a, 0x12, 0xbb, 'S','a','b','o','v','e','d','o','t',0,
-0x1b, 0xf5, 0x12, 0xbc, 'y','g','r','a','v','e',0,
-0x78, 0xb9, 0x12, 0xbd, 'W','d','i','a','e','r','e','s','i','s',0,
-0xb8, 0xb9, 0x12, 0xbe, 'w','d','i','a','e','r','e','s','i','s',0,
-0xd7, 0x4a, 0x12, 0xbf, 's','a','b','o','v','e','d','o','t',0,
-0xf8, 0x52, 0x12, 0xd0, 'W','c','i','r','c','u','m','f','l','e','x',0,
-0xb8, 0x4a, 0x12, 0xd7, 'T','a','b','o','v','e','d','o','t',0,
-0x00, 0x52, 0x12, 0xde, 'Y','c','i','r','c','u','m','f','l','e','x',0,
-0x78, 0x52, 0x12, 0xf0, 'w','c','i','r','c','u','m','f','l','e','x',0,
-0xd8, 0x4a, 0x12, 0xf7, 't','a','b','o','v','e','d','o','t',0,
-0x80, 0x52, 0x12, 0xfe, 'y','c','i','r','c','u','m','f','l','e','x',0,
-0x00, 0xe3, 0x13, 0xbc, 'O','E',0,
-0x01, 0x43, 0x13, 0xbd, 'o','e',0,
-0x7c, 0xb9, 0x13, 0xbe, 'Y','d','i','a','e','r','e','s','i','s',0,
-0x6f, 0x05, 0x04, 0x7e, 'o','v','e','r','l','i','n','e',0,
-0xfc, 0x36, 0x04, 0xa1, 'k','a','n','a','_','f','u','l','l','s','t','o','p',0,
-0xa6, 0x52, 0x04, 0xa2, 'k','a','n','a','_','o','p','e','n','i','n','g','b','r','a','c','k','e','t',0,
-0x4a, 0x52, 0x04, 0xa3, 'k','a','n','a','_','c','l','o','s','i','n','g','b','r','a','c','k','e','t',0,
-0x9e, 0xb7, 0x04, 0xa4, 'k','a','n','a','_','c','o','m','m','a',0,
-0xcc, 0xc5, 0x04, 0xa5, 'k','a','n','a','_','c','o','n','j','u','n','c','t','i','v','e',0,
-0xf5, 0xca, 0x04, 0xa5, 'k','a','n','a','_','m','i','d','d','l','e','d','o','t',0,
-0x33, 0x41, 0x04, 0xa6, 'k','a','n','a','_','W','O',0,
-0x19, 0x83, 0x04, 0xa7, 'k','a','n','a','_','a',0,
-0x19, 0x8b, 0x04, 0xa8, 'k','a','n','a','_','i',0,
-0x19, 0x97, 0x04, 0xa9, 'k','a','n','a','_','u',0,
-0x19, 0x87, 0x04, 0xaa, 'k','a','n','a','_','e',0,
-0x19, 0x91, 0x04, 0xab, 'k','a','n','a','_','o',0,
-0x33, 0x97, 0x04, 0xac, 'k','a','n','a','_','y','a',0,
-0x33, 0xab, 0x04, 0xad, 'k','a','n','a','_','y','u',0,
-0x33, 0xa5, 0x04, 0xae, 'k','a','n','a','_','y','o',0,
-0x67, 0xb3, 0x04, 0xaf, 'k','a','n','a','_','t','s','u',0,
-0x33, 0xa1, 0x04, 0xaf, 'k','a','n','a','_','t','u',0,
-0xfa, 0xfc, 0x04, 0xb0, 'p','r','o','l','o','n','g','e','d','s','o','u','n','d',0,
-0x19, 0x63, 0x04, 0xb1, 'k','a','n','a','_','A',0,
-0x19, 0x6b, 0x04, 0xb2, 'k','a','n','a','_','I',0,
-0x19, 0x77, 0x04, 0xb3, 'k','a','n','a','_','U',0,
-0x19, 0x67, 0x04, 0xb4, 'k','a','n','a','_','E',0,
-0x19, 0x71, 0x04, 0xb5, 'k','a','n','a','_','O',0,
-0x33, 0x1b, 0x04, 0xb6, 'k','a','n','a','_','K','A',0,
-0x33, 0x23, 0x04, 0xb7, 'k','a','n','a','_','K','I',0,
-0x33, 0x2f, 0x04, 0xb8, 'k','a','n','a','_','K','U',0,
-0x33, 0x1f, 0x04, 0xb9, 'k','a','n','a','_','K','E',0,
-0x33, 0x29, 0x04, 0xba, 'k','a','n','a','_','K','O',0,
-0x33, 0x2b, 0x04, 0xbb, 'k','a','n','a','_','S','A',0,
-0x66, 0xad, 0x04, 0xbc, 'k','a','n','a','_','S','H','I',0,
-0x33, 0x3f, 0x04, 0xbd, 'k','a','n','a','_','S','U',0,
-0x33, 0x2f, 0x04, 0xbe, 'k','a','n','a','_','S','E',0,
-0x33, 0x39, 0x04, 0xbf, 'k','a','n','a','_','S','O',0,
-0x33, 0x2d, 0x04, 0xc0, 'k','a','n','a','_','T','A',0,
-0x66, 0x6d, 0x04, 0xc1, 'k','a','n','a','_','C','H','I',0,
-0x33, 0x35, 0x04, 0xc1, 'k','a','n','a','_','T','I',0,
-0x66, 0xd3, 0x04, 0xc2, 'k','a','n','a','_','T','S','U',0,
-0x33, 0x41, 0x04, 0xc2, 'k','a','n','a','_','T','U',0,
-0x33, 0x31, 0x04, 0xc3, 'k','a','n','a','_','T','E',0,
-0x33, 0x3b, 0x04, 0xc4, 'k','a','n','a','_','T','O',0,
-0x33, 0x21, 0x04, 0xc5, 'k','a','n','a','_','N','A',0,
-0x33, 0x29, 0x04, 0xc6, 'k','a','n','a','_','N','I',0,
-0x33, 0x35, 0x04, 0xc7, 'k','a','n','a','_','N','U',0,
-0x33, 0x25, 0x04, 0xc8, 'k','a','n','a','_','N','E',0,
-0x33, 0x2f, 0x04, 0xc9, 'k','a','n','a','_','N','O',0,
-0x33, 0x15, 0x04, 0xca, 'k','a','n','a','_','H','A',0,
-0x33, 0x1d, 0x04, 0xcb, 'k','a','n','a','_','H','I',0,
-0x33, 0x25, 0x04, 0xcc, 'k','a','n','a','_','F','U',0,
-0x33, 0x29, 0x04, 0xcc, 'k','a','n','a','_','H','U',0,
-0x33, 0x19, 0x04, 0xcd, 'k','a','n','a','_','H','E',0,
-0x33, 0x23, 0x04, 0xce, 'k','a','n','a','_','H','O',0,
-0x33, 0x1f, 0x04, 0xcf, 'k','a','n','a','_','M','A',0,
-0x33, 0x27, 0x04, 0xd0, 'k','a','n','a','_','M','I',0,
-0x33, 0x33, 0x04, 0xd1, 'k','a','n','a','_','M','U',0,
-0x33, 0x23, 0x04, 0xd2, 'k','a','n','a','_','M','E',0,
-0x33, 0x2d, 0x04, 0xd3, 'k','a','n','a','_','M','O',0,
-0x33, 0x37, 0x04, 0xd4, 'k','a','n','a','_','Y','A',0,
-0x33, 0x4b, 0x04, 0xd5, 'k','a','n','a','_','Y','U',0,
-0x33, 0x45, 0x04, 0xd6, 'k','a','n','a','_','Y','O',0,
-0x33, 0x29, 0x04, 0xd7, 'k','a','n','a','_','R','A',0,
-0x33, 0x31, 0x04, 0xd8, 'k','a','n','a','_','R','I',0,
-0x33, 0x3d, 0x04, 0xd9, 'k','a','n','a','_','R','U',0,
-0x33, 0x2d, 0x04, 0xda, 'k','a','n','a','_','R','E',0,
-0x33, 0x37, 0x04, 0xdb, 'k','a','n','a','_','R','O',0,
-0x33, 0x33, 0x04, 0xdc, 'k','a','n','a','_','W','A',0,
-0x19, 0x70, 0x04, 0xdd, 'k','a','n','a','_','N',0,
-0x83, 0xfc, 0x04, 0xde, 'v','o','i','c','e','d','s','o','u','n','d',0,
-0xfb, 0xfc, 0x04, 0xdf, 's','e','m','i','v','o','i','c','e','d','s','o','u','n','d',0,
-0x40, 0x56, 0xff, 0x7e, 'k','a','n','a','_','s','w','i','t','c','h',0,
-0x2a, 0xea, 0x05, 0x90, 'F','a','r','s','i','_','0',0,
-0x2a, 0xeb, 0x05, 0x91, 'F','a','r','s','i','_','1',0,
-0x2a, 0xec, 0x05, 0x92, 'F','a','r','s','i','_','2',0,
-0x2a, 0xed, 0x05, 0x93, 'F','a','r','s','i','_','3',0,
-0x2a, 0xee, 0x05, 0x94, 'F','a','r','s','i','_','4',0,
-0x2a, 0xef, 0x05, 0x95, 'F','a','r','s','i','_','5',0,
-0x2a, 0xf0, 0x05, 0x96, 'F','a','r','s','i','_','6',0,
-0x2a, 0xf1, 0x05, 0x97, 'F','a','r','s','i','_','7',0,
-0x2a, 0xf2, 0x05, 0x98, 'F','a','r','s','i','_','8',0,
-0x2a, 0xf3, 0x05, 0x99, 'F','a','r','s','i','_','9',0,
-0x6a, 0x3c, 0x05, 0xa5, 'A','r','a','b','i','c','_','p','e','r','c','e','n','t',0,
-0x0e, 0xd8, 0x05, 0xa6, 'A','r','a','b','i','c','_','s','u','p','e','r','s','c','r','i','p','t','_','a','l','e','f',0,
-0xad, 0x32, 0x05, 0xa7, 'A','r','a','b','i','c','_','t','t','e','h',0,
-0x56, 0x3a, 0x05, 0xa8, 'A','r','a','b','i','c','_','p','e','h',0,
-0x5a, 0x4a, 0x05, 0xa9, 'A','r','a','b','i','c','_','t','c','h','e','h',0,
-0xac, 0x6e, 0x05, 0xaa, 'A','r','a','b','i','c','_','d','d','a','l',0,
-0xad, 0x1a, 0x05, 0xab, 'A','r','a','b','i','c','_','r','r','e','h',0,
-0x59, 0xb7, 0x05, 0xac, 'A','r','a','b','i','c','_','c','o','m','m','a',0,
-0xd4, 0x36, 0x05, 0xae, 'A','r','a','b','i','c','_','f','u','l','l','s','t','o','p',0,
-0x55, 0x02, 0x05, 0xb0, 'A','r','a','b','i','c','_','0',0,
-0x55, 0x03, 0x05, 0xb1, 'A','r','a','b','i','c','_','1',0,
-0x55, 0x04, 0x05, 0xb2, 'A','r','a','b','i','c','_','2',0,
-0x55, 0x05, 0x05, 0xb3, 'A','r','a','b','i','c','_','3',0,
-0x55, 0x06, 0x05, 0xb4, 'A','r','a','b','i','c','_','4',0,
-0x55, 0x07, 0x05, 0xb5, 'A','r','a','b','i','c','_','5',0,
-0x55, 0x08, 0x05, 0xb6, 'A','r','a','b','i','c','_','6',0,
-0x55, 0x09, 0x05, 0xb7, 'A','r','a','b','i','c','_','7',0,
-0x55, 0x0a, 0x05, 0xb8, 'A','r','a','b','i','c','_','8',0,
-0x55, 0x0b, 0x05, 0xb9, 'A','r','a','b','i','c','_','9',0,
-0xac, 0x84, 0x05, 0xbb, 'A','r','a','b','i','c','_','s','e','m','i','c','o','l','o','n',0,
-0x30, 0x2b, 0x05, 0xbf, 'A','r','a','b','i','c','_','q','u','e','s','t','i','o','n','_','m','a','r','k',0,
-0x59, 0xb1, 0x05, 0xc1, 'A','r','a','b','i','c','_','h','a','m','z','a',0,
-0x86, 0xe8, 0x05, 0xc2, 'A','r','a','b','i','c','_','m','a','d','d','a','o','n','a','l','e','f',0,
-0x86, 0xe8, 0x05, 0xc3, 'A','r','a','b','i','c','_','h','a','m','z','a','o','n','a','l','e','f',0,
-0x43, 0x95, 0x05, 0xc4, 'A','r','a','b','i','c','_','h','a','m','z','a','o','n','w','a','w',0,
-0x40, 0xa8, 0x05, 0xc5, 'A','r','a','b','i','c','_','h','a','m','z','a','u','n','d','e','r','a','l','e','f',0,
-0x43, 0x96, 0x05, 0xc6, 'A','r','a','b','i','c','_','h','a','m','z','a','o','n','y','e','h',0,
-0xac, 0x78, 0x05, 0xc7, 'A','r','a','b','i','c','_','a','l','e','f',0,
-0x56, 0x02, 0x05, 0xc8, 'A','r','a','b','i','c','_','b','e','h',0,
-0x59, 0xad, 0x05, 0xc9, 'A','r','a','b','i','c','_','t','e','h','m','a','r','b','u','t','a',0,
-0x56, 0x4a, 0x05, 0xca, 'A','r','a','b','i','c','_','t','e','h',0,
-0xad, 0x02, 0x05, 0xcb, 'A','r','a','b','i','c','_','t','h','e','h',0,
-0xac, 0xab, 0x05, 0xcc, 'A','r','a','b','i','c','_','j','e','e','m',0,
-0x56, 0x12, 0x05, 0xcd, 'A','r','a','b','i','c','_','h','a','h',0,
-0xac, 0xb2, 0x05, 0xce, 'A','r','a','b','i','c','_','k','h','a','h',0,
-0x56, 0x06, 0x05, 0xcf, 'A','r','a','b','i','c','_','d','a','l',0,
-0xac, 0xfe, 0x05, 0xd0, 'A','r','a','b','i','c','_','t','h','a','l',0,
-0xaa, 0xe9, 0x05, 0xd1, 'A','r','a','b','i','c','_','r','a',0,
-0xad, 0x24, 0x05, 0xd2, 'A','r','a','b','i','c','_','z','a','i','n',0,
-0xac, 0xf4, 0x05, 0xd3, 'A','r','a','b','i','c','_','s','e','e','n',0,
-0x5a, 0x5c, 0x05, 0xd4, 'A','r','a','b','i','c','_','s','h','e','e','n',0,
-0x56, 0x3a, 0x05, 0xd5, 'A','r','a','b','i','c','_','s','a','d',0,
-0x55, 0xfe, 0x05, 0xd6, 'A','r','a','b','i','c','_','d','a','d',0,
-0x56, 0x42, 0x05, 0xd7, 'A','r','a','b','i','c','_','t','a','h',0,
-0x56, 0x5a, 0x05, 0xd8, 'A','r','a','b','i','c','_','z','a','h',0,
-0x56, 0x0c, 0x05, 0xd9, 'A','r','a','b','i','c','_','a','i','n',0,
-0x59, 0x94, 0x05, 0xda, 'A','r','a','b','i','c','_','g','h','a','i','n',0,
-0x6b, 0x62, 0x05, 0xe0, 'A','r','a','b','i','c','_','t','a','t','w','e','e','l',0,
-0x56, 0x12, 0x05, 0xe1, 'A','r','a','b','i','c','_','f','e','h',0,
-0x56, 0x34, 0x05, 0xe2, 'A','r','a','b','i','c','_','q','a','f',0,
-0x56, 0x1c, 0x05, 0xe3, 'A','r','a','b','i','c','_','k','a','f',0,
-0x56, 0x27, 0x05, 0xe4, 'A','r','a','b','i','c','_','l','a','m',0,
-0xac, 0xc3, 0x05, 0xe5, 'A','r','a','b','i','c','_','m','e','e','m',0,
-0xad, 0x08, 0x05, 0xe6, 'A','r','a','b','i','c','_','n','o','o','n',0,
-0xaa, 0xd5, 0x05, 0xe7, 'A','r','a','b','i','c','_','h','a',0,
-0x56, 0x1a, 0x05, 0xe7, 'A','r','a','b','i','c','_','h','e','h',0,
-0x56, 0x5d, 0x05, 0xe8, 'A','r','a','b','i','c','_','w','a','w',0,
-0x70, 0xc1, 0x05, 0xe9, 'A','r','a','b','i','c','_','a','l','e','f','m','a','k','s','u','r','a',0,
-0x56, 0x5e, 0x05, 0xea, 'A','r','a','b','i','c','_','y','e','h',0,
-0xcf, 0x48, 0x05, 0xeb, 'A','r','a','b','i','c','_','f','a','t','h','a','t','a','n',0,
-0xcd, 0xb8, 0x05, 0xec, 'A','r','a','b','i','c','_','d','a','m','m','a','t','a','n',0,
-0xd2, 0x48, 0x05, 0xed, 'A','r','a','b','i','c','_','k','a','s','r','a','t','a','n',0,
-0x59, 0x89, 0x05, 0xee, 'A','r','a','b','i','c','_','f','a','t','h','a',0,
-0x59, 0x57, 0x05, 0xef, 'A','r','a','b','i','c','_','d','a','m','m','a',0,
-0x59, 0xe9, 0x05, 0xf0, 'A','r','a','b','i','c','_','k','a','s','r','a',0,
-0xb4, 0xe1, 0x05, 0xf1, 'A','r','a','b','i','c','_','s','h','a','d','d','a',0,
-0x5a, 0xfc, 0x05, 0xf2, 'A','r','a','b','i','c','_','s','u','k','u','n',0,
-0x84, 0x4d, 0x05, 0xf3, 'A','r','a','b','i','c','_','m','a','d','d','a','_','a','b','o','v','e',0,
-0x84, 0x4d, 0x05, 0xf4, 'A','r','a','b','i','c','_','h','a','m','z','a','_','a','b','o','v','e',0,
-0x84, 0x6d, 0x05, 0xf5, 'A','r','a','b','i','c','_','h','a','m','z','a','_','b','e','l','o','w',0,
-0x56, 0x22, 0x05, 0xf6, 'A','r','a','b','i','c','_','j','e','h',0,
-0x56, 0x52, 0x05, 0xf7, 'A','r','a','b','i','c','_','v','e','h',0,
-0x59, 0xca, 0x05, 0xf8, 'A','r','a','b','i','c','_','k','e','h','e','h',0,
-0x56, 0x0c, 0x05, 0xf9, 'A','r','a','b','i','c','_','g','a','f',0,
-0xb5, 0xbd, 0x05, 0xfa, 'A','r','a','b','i','c','_','n','o','o','n','_','g','h','u','n','n','a',0,
-0xcb, 0xf3, 0x05, 0xfb, 'A','r','a','b','i','c','_','h','e','h','_','d','o','a','c','h','a','s','h','m','e','e',0,
-0xad, 0xfe, 0x05, 0xfc, 'F','a','r','s','i','_','y','e','h',0,
-0xaf, 0x7f, 0x05, 0xfd, 'A','r','a','b','i','c','_','y','e','h','_','b','a','r','e','e',0,
-0xcf, 0x52, 0x05, 0xfe, 'A','r','a','b','i','c','_','h','e','h','_','g','o','a','l',0,
-0xb6, 0x56, 0xff, 0x7e, 'A','r','a','b','i','c','_','s','w','i','t','c','h',0,
-0x29, 0x44, 0x06, 0x80, 'C','y','r','i','l','l','i','c','_','G','H','E','_','b','a','r',0,
-0x37, 0x44, 0x06, 0x90, 'C','y','r','i','l','l','i','c','_','g','h','e','_','b','a','r',0,
-0x9e, 0x2c, 0x06, 0x81, 'C','y','r','i','l','l','i','c','_','Z','H','E','_','d','e','s','c','e','n','d','e','r',0,
-0x1e, 0x2c, 0x06, 0x91, 'C','y','r','i','l','l','i','c','_','z','h','e','_','d','e','s','c','e','n','d','e','r',0,
-0x76, 0x2c, 0x06, 0x82, 'C','y','r','i','l','l','i','c','_','K','A','_','d','e','s','c','e','n','d','e','r',0,
-0xf6, 0x2c, 0x06, 0x92, 'C','y','r','i','l','l','i','c','_','k','a','_','d','e','s','c','e','n','d','e','r',0,
-0x17, 0x27, 0x06, 0x83, 'C','y','r','i','l','l','i','c','_','K','A','_','v','e','r','t','s','t','r','o','k','e',0,
-0x17, 0x27, 0x06, 0x93, 'C','y','r','i','l','l','i','c','_','k','a','_','v','e','r','t','s','t','r','o','k','e',0,
-0x7a, 0x2c, 0x06, 0x84, 'C','y','r','i','l','l','i','c','_','E','N','_','d','e','s','c','e','n','d','e','r',0,
-0xfa, 0x2c, 0x06, 0x94, 'C','y','r','i','l','l','i','c','_','e','n','_','d','e','s','c','e','n','d','e','r',0,
-0x9d, 0xf8, 0x06, 0x85, 'C','y','r','i','l','l','i','c','_','U','_','s','t','r','a','i','g','h','t',0,
-0xdd, 0xf8, 0x06, 0x95, 'C','y','r','i','l','l','i','c','_','u','_','s','t','r','a','i','g','h','t',0,
-0xe5, 0x34, 0x06, 0x86, 'C','y','r','i','l','l','i','c','_','U','_','s','t','r','a','i','g','h','t','_','b','a','r',0,
-0xe5, 0x34, 0x06, 0x96, 'C','y','r','i','l','l','i','c','_','u','_','s','t','r','a','i','g','h','t','_','b','a','r',0,
-0x5e, 0x2c, 0x06, 0x87, 'C','y','r','i','l','l','i','c','_','H','A','_','d','e','s','c','e','n','d','e','r',0,
-0xde, 0x2c, 0x06, 0x97, 'C','y','r','i','l','l','i','c','_','h','a','_','d','e','s','c','e','n','d','e','r',0,
-0x2e, 0x2c, 0x06, 0x88, 'C','y','r','i','l','l','i','c','_','C','H','E','_','d','e','s','c','e','n','d','e','r',0,
-0xae, 0x2c, 0x06, 0x98, 'C','y','r','i','l','l','i','c','_','c','h','e','_','d','e','s','c','e','n','d','e','r',0,
-0x87, 0x27, 0x06, 0x89, 'C','y','r','i','l','l','i','c','_','C','H','E','_','v','e','r','t','s','t','r','o','k','e',0,
-0x87, 0x27, 0x06, 0x99, 'C','y','r','i','l','l','i','c','_','c','h','e','_','v','e','r','t','s','t','r','o','k','e',0,
-0x65, 0x19, 0x06, 0x8a, 'C','y','r','i','l','l','i','c','_','S','H','H','A',0,
-0x66, 0xf9, 0x06, 0x9a, 'C','y','r','i','l','l','i','c','_','s','h','h','a',0,
-0xca, 0x77, 0x06, 0x8c, 'C','y','r','i','l','l','i','c','_','S','C','H','W','A',0,
-0xce, 0x57, 0x06, 0x9c, 'C','y','r','i','l','l','i','c','_','s','c','h','w','a',0,
-0x5f, 0x1c, 0x06, 0x8d, 'C','y','r','i','l','l','i','c','_','I','_','m','a','c','r','o','n',0,
-0x6f, 0x1c, 0x06, 0x9d, 'C','y','r','i','l','l','i','c','_','i','_','m','a','c','r','o','n',0,
-0xcb, 0xc4, 0x06, 0x8e, 'C','y','r','i','l','l','i','c','_','O','_','b','a','r',0,
-0xcd, 0xc4, 0x06, 0x9e, 'C','y','r','i','l','l','i','c','_','o','_','b','a','r',0,
-0x65, 0x1c, 0x06, 0x8f, 'C','y','r','i','l','l','i','c','_','U','_','m','a','c','r','o','n',0,
-0x75, 0x1c, 0x06, 0x9f, 'C','y','r','i','l','l','i','c','_','u','_','m','a','c','r','o','n',0,
-0xec, 0x01, 0x06, 0xa1, 'S','e','r','b','i','a','n','_','d','j','e',0,
-0xfd, 0xfd, 0x06, 0xa2, 'M','a','c','e','d','o','n','i','a','_','g','j','e',0,
-0xd9, 0x65, 0x06, 0xa3, 'C','y','r','i','l','l','i','c','_','i','o',0,
-0x02, 0x53, 0x06, 0xa4, 'U','k','r','a','i','n','i','a','n','_','i','e',0,
-0x01, 0x55, 0x06, 0xa4, 'U','k','r','a','n','i','a','n','_','j','e',0,
-0xfe, 0x03, 0x06, 0xa5, 'M','a','c','e','d','o','n','i','a','_','d','s','e',0,
-0x00, 0xf7, 0x06, 0xa6, 'U','k','r','a','i','n','i','a','n','_','i',0,
-0x80, 0x77, 0x06, 0xa6, 'U','k','r','a','n','i','a','n','_','i',0,
-0x02, 0x77, 0x06, 0xa7, 'U','k','r','a','i','n','i','a','n','_','y','i',0,
-0x01, 0x77, 0x06, 0xa7, 'U','k','r','a','n','i','a','n','_','y','i',0,
-0xd9, 0x5d, 0x06, 0xa8, 'C','y','r','i','l','l','i','c','_','j','e',0,
-0x75, 0xd5, 0x06, 0xa8, 'S','e','r','b','i','a','n','_','j','e',0,
-0xb3, 0x31, 0x06, 0xa9, 'C','y','r','i','l','l','i','c','_','l','j','e',0,
-0xec, 0x21, 0x06, 0xa9, 'S','e','r','b','i','a','n','_','l','j','e',0,
-0xb3, 0x39, 0x06, 0xaa, 'C','y','r','i','l','l','i','c','_','n','j','e',0,
-0xec, 0x29, 0x06, 0xaa, 'S','e','r','b','i','a','n','_','n','j','e',0,
-0xd9, 0x11, 0x06, 0xab, 'S','e','r','b','i','a','n','_','t','s','h','e',0,
-0xfe, 0x0d, 0x06, 0xac, 'M','a','c','e','d','o','n','i','a','_','k','j','e',0,
-0x12, 0x26, 0x06, 0xad, 'U','k','r','a','i','n','i','a','n','_','g','h','e','_','w','i','t','h','_','u','p','t','u','r','n',0,
-0x51, 0x3d, 0x06, 0xae, 'B','y','e','l','o','r','u','s','s','i','a','n','_','s','h','o','r','t','u',0,
-0x66, 0xcd, 0x06, 0xaf, 'C','y','r','i','l','l','i','c','_','d','z','h','e',0,
-0xec, 0x21, 0x06, 0xaf, 'S','e','r','b','i','a','n','_','d','z','e',0,
-0xbc, 0x68, 0x06, 0xb0, 'n','u','m','e','r','o','s','i','g','n',0,
-0xeb, 0x21, 0x06, 0xb1, 'S','e','r','b','i','a','n','_','D','J','E',0,
-0xfd, 0x1d, 0x06, 0xb2, 'M','a','c','e','d','o','n','i','a','_','G','J','E',0,
-0xd9, 0x05, 0x06, 0xb3, 'C','y','r','i','l','l','i','c','_','I','O',0,
-0x01, 0xf3, 0x06, 0xb4, 'U','k','r','a','i','n','i','a','n','_','I','E',0,
-0x00, 0xf5, 0x06, 0xb4, 'U','k','r','a','n','i','a','n','_','J','E',0,
-0xfd, 0x23, 0x06, 0xb5, 'M','a','c','e','d','o','n','i','a','_','D','S','E',0,
-0x00, 0xd7, 0x06, 0xb6, 'U','k','r','a','i','n','i','a','n','_','I',0,
-0x80, 0x57, 0x06, 0xb6, 'U','k','r','a','n','i','a','n','_','I',0,
-0x02, 0x17, 0x06, 0xb7, 'U','k','r','a','i','n','i','a','n','_','Y','I',0,
-0x01, 0x17, 0x06, 0xb7, 'U','k','r','a','n','i','a','n','_','Y','I',0,
-0xd8, 0xfd, 0x06, 0xb8, 'C','y','r','i','l','l','i','c','_','J','E',0,
-0x75, 0x75, 0x06, 0xb8, 'S','e','r','b','i','a','n','_','J','E',0,
-0xb2, 0x51, 0x06, 0xb9, 'C','y','r','i','l','l','i','c','_','L','J','E',0,
-0xeb, 0x41, 0x06, 0xb9, 'S','e','r','b','i','a','n','_','L','J','E',0,
-0xb2, 0x59, 0x06, 0xba, 'C','y','r','i','l','l','i','c','_','N','J','E',0,
-0xeb, 0x49, 0x06, 0xba, 'S','e','r','b','i','a','n','_','N','J','E',0,
-0xd7, 0x31, 0x06, 0xbb, 'S','e','r','b','i','a','n','_','T','S','H','E',0,
-0xfd, 0x2d, 0x06, 0xbc, 'M','a','c','e','d','o','n','i','a','_','K','J','E',0,
-0x1a, 0x46, 0x06, 0xbd, 'U','k','r','a','i','n','i','a','n','_','G','H','E','_','W','I','T','H','_','U','P','T','U','R','N',0,
-0x49, 0x5d, 0x06, 0xbe, 'B','y','e','l','o','r','u','s','s','i','a','n','_','S','H','O','R','T','U',0,
-0x64, 0xed, 0x06, 0xbf, 'C','y','r','i','l','l','i','c','_','D','Z','H','E',0,
-0xeb, 0x41, 0x06, 0xbf, 'S','e','r','b','i','a','n','_','D','Z','E',0,
-0xd9, 0x8b, 0x06, 0xc0, 'C','y','r','i','l','l','i','c','_','y','u',0,
-0x6c, 0x73, 0x06, 0xc1, 'C','y','r','i','l','l','i','c','_','a',0,
-0xd9, 0x4d, 0x06, 0xc2, 'C','y','r','i','l','l','i','c','_','b','e',0,
-0xb3, 0x63, 0x06, 0xc3, 'C','y','r','i','l','l','i','c','_','t','s','e',0,
-0xd9, 0x51, 0x06, 0xc4, 'C','y','r','i','l','l','i','c','_','d','e',0,
-0xd9, 0x5b, 0x06, 0xc5, 'C','y','r','i','l','l','i','c','_','i','e',0,
-0xd9, 0x54, 0x06, 0xc6, 'C','y','r','i','l','l','i','c','_','e','f',0,
-0xb3, 0x19, 0x06, 0xc7, 'C','y','r','i','l','l','i','c','_','g','h','e',0,
-0xd9, 0x55, 0x06, 0xc8, 'C','y','r','i','l','l','i','c','_','h','a',0,
-0x6c, 0x7b, 0x06, 0xc9, 'C','y','r','i','l','l','i','c','_','i',0,
-0x9d, 0xb1, 0x06, 0xca, 'C','y','r','i','l','l','i','c','_','s','h','o','r','t','i',0,
-0xd9, 0x5b, 0x06, 0xcb, 'C','y','r','i','l','l','i','c','_','k','a',0,
-0xd9, 0x5a, 0x06, 0xcc, 'C','y','r','i','l','l','i','c','_','e','l',0,
-0xd9, 0x5b, 0x06, 0xcd, 'C','y','r','i','l','l','i','c','_','e','m',0,
-0xd9, 0x5c, 0x06, 0xce, 'C','y','r','i','l','l','i','c','_','e','n',0,
-0x6c, 0x81, 0x06, 0xcf, 'C','y','r','i','l','l','i','c','_','o',0,
-0xd9, 0x69, 0x06, 0xd0, 'C','y','r','i','l','l','i','c','_','p','e',0,
-0xd9, 0x77, 0x06, 0xd1, 'C','y','r','i','l','l','i','c','_','y','a',0,
-0xd9, 0x60, 0x06, 0xd2, 'C','y','r','i','l','l','i','c','_','e','r',0,
-0xd9, 0x61, 0x06, 0xd3, 'C','y','r','i','l','l','i','c','_','e','s',0,
-0xd9, 0x71, 0x06, 0xd4, 'C','y','r','i','l','l','i','c','_','t','e',0,
-0x6c, 0x87, 0x06, 0xd5, 'C','y','r','i','l','l','i','c','_','u',0,
-0xb3, 0x65, 0x06, 0xd6, 'C','y','r','i','l','l','i','c','_','z','h','e',0,
-0xd9, 0x75, 0x06, 0xd7, 'C','y','r','i','l','l','i','c','_','v','e',0,
-0x78, 0xb8, 0x06, 0xd8, 'C','y','r','i','l','l','i','c','_','s','o','f','t','s','i','g','n',0,
-0x67, 0x45, 0x06, 0xd9, 'C','y','r','i','l','l','i','c','_','y','e','r','u',0,
-0xd9, 0x7d, 0x06, 0xda, 'C','y','r','i','l','l','i','c','_','z','e',0,
-0xb3, 0x45, 0x06, 0xdb, 'C','y','r','i','l','l','i','c','_','s','h','a',0,
-0x6c, 0x77, 0x06, 0xdc, 'C','y','r','i','l','l','i','c','_','e',0,
-0xce, 0x4d, 0x06, 0xdd, 'C','y','r','i','l','l','i','c','_','s','h','c','h','a',0,
-0xb3, 0x09, 0x06, 0xde, 'C','y','r','i','l','l','i','c','_','c','h','e',0,
-0x70, 0x38, 0x06, 0xdf, 'C','y','r','i','l','l','i','c','_','h','a','r','d','s','i','g','n',0,
-0xd9, 0x2b, 0x06, 0xe0, 'C','y','r','i','l','l','i','c','_','Y','U',0,
-0x6c, 0x53, 0x06, 0xe1, 'C','y','r','i','l','l','i','c','_','A',0,
-0xd8, 0xed, 0x06, 0xe2, 'C','y','r','i','l','l','i','c','_','B','E',0,
-0xb2, 0x83, 0x06, 0xe3, 'C','y','r','i','l','l','i','c','_','T','S','E',0,
-0xd8, 0xf1, 0x06, 0xe4, 'C','y','r','i','l','l','i','c','_','D','E',0,
-0xd8, 0xfb, 0x06, 0xe5, 'C','y','r','i','l','l','i','c','_','I','E',0,
-0xd8, 0xf4, 0x06, 0xe6, 'C','y','r','i','l','l','i','c','_','E','F',0,
-0xb2, 0x39, 0x06, 0xe7, 'C','y','r','i','l','l','i','c','_','G','H','E',0,
-0xd8, 0xf5, 0x06, 0xe8, 'C','y','r','i','l','l','i','c','_','H','A',0,
-0x6c, 0x5b, 0x06, 0xe9, 'C','y','r','i','l','l','i','c','_','I',0,
-0x95, 0xd1, 0x06, 0xea, 'C','y','r','i','l','l','i','c','_','S','H','O','R','T','I',0,
-0xd8, 0xfb, 0x06, 0xeb, 'C','y','r','i','l','l','i','c','_','K','A',0,
-0xd8, 0xfa, 0x06, 0xec, 'C','y','r','i','l','l','i','c','_','E','L',0,
-0xd8, 0xfb, 0x06, 0xed, 'C','y','r','i','l','l','i','c','_','E','M',0,
-0xd8, 0xfc, 0x06, 0xee, 'C','y','r','i','l','l','i','c','_','E','N',0,
-0x6c, 0x61, 0x06, 0xef, 'C','y','r','i','l','l','i','c','_','O',0,
-0xd9, 0x09, 0x06, 0xf0, 'C','y','r','i','l','l','i','c','_','P','E',0,
-0xd9, 0x17, 0x06, 0xf1, 'C','y','r','i','l','l','i','c','_','Y','A',0,
-0xd9, 0x00, 0x06, 0xf2, 'C','y','r','i','l','l','i','c','_','E','R',0,
-0xd9, 0x01, 0x06, 0xf3, 'C','y','r','i','l','l','i','c','_','E','S',0,
-0xd9, 0x11, 0x06, 0xf4, 'C','y','r','i','l','l','i','c','_','T','E',0,
-0x6c, 0x67, 0x06, 0xf5, 'C','y','r','i','l','l','i','c','_','U',0,
-0xb2, 0x85, 0x06, 0xf6, 'C','y','r','i','l','l','i','c','_','Z','H','E',0,
-0xd9, 0x15, 0x06, 0xf7, 'C','y','r','i','l','l','i','c','_','V','E',0,
-0x58, 0xd8, 0x06, 0xf8, 'C','y','r','i','l','l','i','c','_','S','O','F','T','S','I','G','N',0,
-0x65, 0x65, 0x06, 0xf9, 'C','y','r','i','l','l','i','c','_','Y','E','R','U',0,
-0xd9, 0x1d, 0x06, 0xfa, 'C','y','r','i','l','l','i','c','_','Z','E',0,
-0xb2, 0x65, 0x06, 0xfb, 'C','y','r','i','l','l','i','c','_','S','H','A',0,
-0x6c, 0x57, 0x06, 0xfc, 'C','y','r','i','l','l','i','c','_','E',0,
-0xca, 0x6d, 0x06, 0xfd, 'C','y','r','i','l','l','i','c','_','S','H','C','H','A',0,
-0xb2, 0x29, 0x06, 0xfe, 'C','y','r','i','l','l','i','c','_','C','H','E',0,
-0x50, 0x58, 0x06, 0xff, 'C','y','r','i','l','l','i','c','_','H','A','R','D','S','I','G','N',0,
-0xc0, 0x8c, 0x07, 0xa1, 'G','r','e','e','k','_','A','L','P','H','A','a','c','c','e','n','t',0,
-0x6d, 0x4c, 0x07, 0xa2, 'G','r','e','e','k','_','E','P','S','I','L','O','N','a','c','c','e','n','t',0,
-0x79, 0x8c, 0x07, 0xa3, 'G','r','e','e','k','_','E','T','A','a','c','c','e','n','t',0,
-0xf7, 0x8c, 0x07, 0xa4, 'G','r','e','e','k','_','I','O','T','A','a','c','c','e','n','t',0,
-0xe3, 0x39, 0x07, 0xa5, 'G','r','e','e','k','_','I','O','T','A','d','i','e','r','e','s','i','s',0,
-0xc7, 0x4c, 0x07, 0xa7, 'G','r','e','e','k','_','O','M','I','C','R','O','N','a','c','c','e','n','t',0,
-0x6d, 0x4c, 0x07, 0xa8, 'G','r','e','e','k','_','U','P','S','I','L','O','N','a','c','c','e','n','t',0,
-0xba, 0x39, 0x07, 0xa9, 'G','r','e','e','k','_','U','P','S','I','L','O','N','d','i','e','r','e','s','i','s',0,
-0xef, 0x0c, 0x07, 0xab, 'G','r','e','e','k','_','O','M','E','G','A','a','c','c','e','n','t',0,
-0xf2, 0x39, 0x07, 0xae, 'G','r','e','e','k','_','a','c','c','e','n','t','d','i','e','r','e','s','i','s',0,
-0x5c, 0x1c, 0x07, 0xaf, 'G','r','e','e','k','_','h','o','r','i','z','b','a','r',0,
-0xb8, 0x8c, 0x07, 0xb1, 'G','r','e','e','k','_','a','l','p','h','a','a','c','c','e','n','t',0,
-0x65, 0x4c, 0x07, 0xb2, 'G','r','e','e','k','_','e','p','s','i','l','o','n','a','c','c','e','n','t',0,
-0xb1, 0x8c, 0x07, 0xb3, 'G','r','e','e','k','_','e','t','a','a','c','c','e','n','t',0,
-0x6f, 0x8c, 0x07, 0xb4, 'G','r','e','e','k','_','i','o','t','a','a','c','c','e','n','t',0,
-0xc3, 0x39, 0x07, 0xb5, 'G','r','e','e','k','_','i','o','t','a','d','i','e','r','e','s','i','s',0,
-0xf2, 0x39, 0x07, 0xb6, 'G','r','e','e','k','_','i','o','t','a','a','c','c','e','n','t','d','i','e','r','e','s','i','s',0,
-0xbf, 0x4c, 0x07, 0xb7, 'G','r','e','e','k','_','o','m','i','c','r','o','n','a','c','c','e','n','t',0,
-0x65, 0x4c, 0x07, 0xb8, 'G','r','e','e','k','_','u','p','s','i','l','o','n','a','c','c','e','n','t',0,
-0x9a, 0x39, 0x07, 0xb9, 'G','r','e','e','k','_','u','p','s','i','l','o','n','d','i','e','r','e','s','i','s',0,
-0xb2, 0x39, 0x07, 0xba, 'G','r','e','e','k','_','u','p','s','i','l','o','n','a','c','c','e','n','t','d','i','e','r','e','s','i','s',0,
-0xe7, 0x0c, 0x07, 0xbb, 'G','r','e','e','k','_','o','m','e','g','a','a','c','c','e','n','t',0,
-0xc6, 0xa1, 0x07, 0xc1, 'G','r','e','e','k','_','A','L','P','H','A',0,
-0x63, 0x1d, 0x07, 0xc2, 'G','r','e','e','k','_','B','E','T','A',0,
-0xc6, 0xa7, 0x07, 0xc3, 'G','r','e','e','k','_','G','A','M','M','A',0,
-0xc6, 0xa1, 0x07, 0xc4, 'G','r','e','e','k','_','D','E','L','T','A',0,
-0x1d, 0x54, 0x07, 0xc5, 'G','r','e','e','k','_','E','P','S','I','L','O','N',0,
-0x63, 0xdd, 0x07, 0xc6, 'G','r','e','e','k','_','Z','E','T','A',0,
-0xb1, 0x85, 0x07, 0xc7, 'G','r','e','e','k','_','E','T','A',0,
-0xc7, 0x9d, 0x07, 0xc8, 'G','r','e','e','k','_','T','H','E','T','A',0,
-0x63, 0x7d, 0x07, 0xc9, 'G','r','e','e','k','_','I','O','T','A',0,
-0xc6, 0xf9, 0x07, 0xca, 'G','r','e','e','k','_','K','A','P','P','A',0,
-0xc6, 0xe5, 0x07, 0xcb, 'G','r','e','e','k','_','L','A','M','D','A',0,
-0x8e, 0x09, 0x07, 0xcb, 'G','r','e','e','k','_','L','A','M','B','D','A',0,
-0x58, 0xb3, 0x07, 0xcc, 'G','r','e','e','k','_','M','U',0,
-0x58, 0xb5, 0x07, 0xcd, 'G','r','e','e','k','_','N','U',0,
-0x58, 0xbd, 0x07, 0xce, 'G','r','e','e','k','_','X','I',0,
-0x1e, 0xbc, 0x07, 0xcf, 'G','r','e','e','k','_','O','M','I','C','R','O','N',0,
-0x58, 0xad, 0x07, 0xd0, 'G','r','e','e','k','_','P','I',0,
-0xb1, 0xaf, 0x07, 0xd1, 'G','r','e','e','k','_','R','H','O',0,
-0xc7, 0x8f, 0x07, 0xd2, 'G','r','e','e','k','_','S','I','G','M','A',0,
-0xb1, 0xaf, 0x07, 0xd4, 'G','r','e','e','k','_','T','A','U',0,
-0x21, 0x54, 0x07, 0xd5, 'G','r','e','e','k','_','U','P','S','I','L','O','N',0,
-0xb1, 0xa1, 0x07, 0xd6, 'G','r','e','e','k','_','P','H','I',0,
-0xb1, 0x6d, 0x07, 0xd7, 'G','r','e','e','k','_','C','H','I',0,
-0xb1, 0xb7, 0x07, 0xd8, 'G','r','e','e','k','_','P','S','I',0,
-0xc7, 0x5b, 0x07, 0xd9, 'G','r','e','e','k','_','O','M','E','G','A',0,
-0xca, 0x81, 0x07, 0xe1, 'G','r','e','e','k','_','a','l','p','h','a',0,
-0x64, 0xfd, 0x07, 0xe2, 'G','r','e','e','k','_','b','e','t','a',0,
-0xca, 0x87, 0x07, 0xe3, 'G','r','e','e','k','_','g','a','m','m','a',0,
-0xca, 0x81, 0x07, 0xe4, 'G','r','e','e','k','_','d','e','l','t','a',0,
-0x2d, 0x34, 0x07, 0xe5, 'G','r','e','e','k','_','e','p','s','i','l','o','n',0,
-0x65, 0xbd, 0x07, 0xe6, 'G','r','e','e','k','_','z','e','t','a',0,
-0xb2, 0x65, 0x07, 0xe7, 'G','r','e','e','k','_','e','t','a',0,
-0xcb, 0x7d, 0x07, 0xe8, 'G','r','e','e','k','_','t','h','e','t','a',0,
-0x65, 0x5d, 0x07, 0xe9, 'G','r','e','e','k','_','i','o','t','a',0,
-0xca, 0xd9, 0x07, 0xea, 'G','r','e','e','k','_','k','a','p','p','a',0,
-0xca, 0xc5, 0x07, 0xeb, 'G','r','e','e','k','_','l','a','m','d','a',0,
-0x95, 0xe9, 0x07, 0xeb, 'G','r','e','e','k','_','l','a','m','b','d','a',0,
-0x59, 0x13, 0x07, 0xec, 'G','r','e','e','k','_','m','u',0,
-0x59, 0x15, 0x07, 0xed, 'G','r','e','e','k','_','n','u',0,
-0x59, 0x1d, 0x07, 0xee, 'G','r','e','e','k','_','x','i',0,
-0x2e, 0x9c, 0x07, 0xef, 'G','r','e','e','k','_','o','m','i','c','r','o','n',0,
-0x59, 0x0d, 0x07, 0xf0, 'G','r','e','e','k','_','p','i',0,
-0xb2, 0x8f, 0x07, 0xf1, 'G','r','e','e','k','_','r','h','o',0,
-0xcb, 0x6f, 0x07, 0xf2, 'G','r','e','e','k','_','s','i','g','m','a',0,
-0x71, 0x4f, 0x07, 0xf3, 'G','r','e','e','k','_','f','i','n','a','l','s','m','a','l','l','s','i','g','m','a',0,
-0xb2, 0x8f, 0x07, 0xf4, 'G','r','e','e','k','_','t','a','u',0,
-0x31, 0x34, 0x07, 0xf5, 'G','r','e','e','k','_','u','p','s','i','l','o','n',0,
-0xb2, 0x81, 0x07, 0xf6, 'G','r','e','e','k','_','p','h','i',0,
-0xb2, 0x4d, 0x07, 0xf7, 'G','r','e','e','k','_','c','h','i',0,
-0xb2, 0x97, 0x07, 0xf8, 'G','r','e','e','k','_','p','s','i',0,
-0xcb, 0x3b, 0x07, 0xf9, 'G','r','e','e','k','_','o','m','e','g','a',0,
-0x98, 0x56, 0xff, 0x7e, 'G','r','e','e','k','_','s','w','i','t','c','h',0,
-0x4e, 0xe2, 0x08, 0xa1, 'l','e','f','t','r','a','d','i','c','a','l',0,
-0x3e, 0xe2, 0x08, 0xa2, 't','o','p','l','e','f','t','r','a','d','i','c','a','l',0,
-0xe8, 0x48, 0x08, 0xa3, 'h','o','r','i','z','c','o','n','n','e','c','t','o','r',0,
-0x88, 0xfe, 0x08, 0xa4, 't','o','p','i','n','t','e','g','r','a','l',0,
-0x44, 0xfe, 0x08, 0xa5, 'b','o','t','i','n','t','e','g','r','a','l',0,
-0x08, 0x48, 0x08, 0xa6, 'v','e','r','t','c','o','n','n','e','c','t','o','r',0,
-0x06, 0x52, 0x08, 0xa7, 't','o','p','l','e','f','t','s','q','b','r','a','c','k','e','t',0,
-0x86, 0x52, 0x08, 0xa8, 'b','o','t','l','e','f','t','s','q','b','r','a','c','k','e','t',0,
-0xee, 0x52, 0x08, 0xa9, 't','o','p','r','i','g','h','t','s','q','b','r','a','c','k','e','t',0,
-0xee, 0x52, 0x08, 0xaa, 'b','o','t','r','i','g','h','t','s','q','b','r','a','c','k','e','t',0,
-0x1f, 0x83, 0x08, 0xab, 't','o','p','l','e','f','t','p','a','r','e','n','s',0,
-0x0f, 0x83, 0x08, 0xac, 'b','o','t','l','e','f','t','p','a','r','e','n','s',0,
-0x5c, 0x83, 0x08, 0xad, 't','o','p','r','i','g','h','t','p','a','r','e','n','s',0,
-0x3c, 0x83, 0x08, 0xae, 'b','o','t','r','i','g','h','t','p','a','r','e','n','s',0,
-0x1e, 0x7f, 0x08, 0xaf, 'l','e','f','t','m','i','d','d','l','e','c','u','r','l','y','b','r','a','c','e',0,
-0x1e, 0x7f, 0x08, 0xb0, 'r','i','g','h','t','m','i','d','d','l','e','c','u','r','l','y','b','r','a','c','e',0,
-0x0b, 0x00, 0x08, 0xb1, 't','o','p','l','e','f','t','s','u','m','m','a','t','i','o','n',0,
-0x8b, 0x00, 0x08, 0xb2, 'b','o','t','l','e','f','t','s','u','m','m','a','t','i','o','n',0,
-0xd0, 0x48, 0x08, 0xb3, 't','o','p','v','e','r','t','s','u','m','m','a','t','i','o','n','c','o','n','n','e','c','t','o','r',0,
-0xd0, 0x48, 0x08, 0xb4, 'b','o','t','v','e','r','t','s','u','m','m','a','t','i','o','n','c','o','n','n','e','c','t','o','r',0,
-0xf3, 0x00, 0x08, 0xb5, 't','o','p','r','i','g','h','t','s','u','m','m','a','t','i','o','n',0,
-0xf3, 0x00, 0x08, 0xb6, 'b','o','t','r','i','g','h','t','s','u','m','m','a','t','i','o','n',0,
-0x1d, 0x00, 0x08, 0xb7, 'r','i','g','h','t','m','i','d','d','l','e','s','u','m','m','a','t','i','o','n',0,
-0x74, 0xda, 0x08, 0xbc, 'l','e','s','s','t','h','a','n','e','q','u','a','l',0,
-0x6e, 0x1a, 0x08, 0xbd, 'n','o','t','e','q','u','a','l',0,
-0xa2, 0xda, 0x08, 0xbe, 'g','r','e','a','t','e','r','t','h','a','n','e','q','u','a','l',0,
-0x6a, 0xfe, 0x08, 0xbf, 'i','n','t','e','g','r','a','l',0,
-0xdc, 0x05, 0x08, 0xc0, 't','h','e','r','e','f','o','r','e',0,
-0xdc, 0xc0, 0x08, 0xc1, 'v','a','r','i','a','t','i','o','n',0,
-0x69, 0xc5, 0x08, 0xc2, 'i','n','f','i','n','i','t','y',0,
-0x0c, 0xa9, 0x08, 0xc5, 'n','a','b','l','a',0,
-0x44, 0x89, 0x08, 0xc8, 'a','p','p','r','o','x','i','m','a','t','e',0,
-0xe8, 0x5a, 0x08, 0xc9, 's','i','m','i','l','a','r','e','q','u','a','l',0,
-0x69, 0x3c, 0x08, 0xcd, 'i','f','o','n','l','y','i','f',0,
-0x35, 0x21, 0x08, 0xce, 'i','m','p','l','i','e','s',0,
-0xcf, 0x42, 0x08, 0xcf, 'i','d','e','n','t','i','c','a','l',0,
-0x34, 0xe2, 0x08, 0xd6, 'r','a','d','i','c','a','l',0,
-0xa7, 0x58, 0x08, 0xda, 'i','n','c','l','u','d','e','d','i','n',0,
-0x69, 0x95, 0x08, 0xdb, 'i','n','c','l','u','d','e','s',0,
-0xbc, 0x20, 0x08, 0xdc, 'i','n','t','e','r','s','e','c','t','i','o','n',0,
-0x0d, 0xb0, 0x08, 0xdd, 'u','n','i','o','n',0,
-0xad, 0x54, 0x08, 0xde, 'l','o','g','i','c','a','l','a','n','d',0,
-0xd6, 0x98, 0x08, 0xdf, 'l','o','g','i','c','a','l','o','r',0,
-0x63, 0xa5, 0x08, 0xef, 'p','a','r','t','i','a','l','d','e','r','i','v','a','t','i','v','e',0,
-0x6a, 0xc0, 0x08, 0xf6, 'f','u','n','c','t','i','o','n',0,
-0xd3, 0x3d, 0x08, 0xfb, 'l','e','f','t','a','r','r','o','w',0,
-0x37, 0xfd, 0x08, 0xfc, 'u','p','a','r','r','o','w',0,
-0xb5, 0xbd, 0x08, 0xfd, 'r','i','g','h','t','a','r','r','o','w',0,
-0xd3, 0xbd, 0x08, 0xfe, 'd','o','w','n','a','r','r','o','w',0,
-0x0c, 0x4b, 0x09, 0xdf, 'b','l','a','n','k',0,
-0xf9, 0x94, 0x09, 0xe0, 's','o','l','i','d','d','i','a','m','o','n','d',0,
-0x4e, 0x64, 0x09, 0xe1, 'c','h','e','c','k','e','r','b','o','a','r','d',0,
-0x01, 0x44, 0x09, 0xe2, 'h','t',0,
-0x01, 0x32, 0x09, 0xe3, 'f','f',0,
-0x01, 0x38, 0x09, 0xe4, 'c','r',0,
-0x01, 0x3e, 0x09, 0xe5, 'l','f',0,
-0x01, 0x48, 0x09, 0xe8, 'n','l',0,
-0x01, 0x60, 0x09, 0xe9, 'v','t',0,
-0x93, 0xd4, 0x09, 0xea, 'l','o','w','r','i','g','h','t','c','o','r','n','e','r',0,
-0x3b, 0xd4, 0x09, 0xeb, 'u','p','r','i','g','h','t','c','o','r','n','e','r',0,
-0x0e, 0xd4, 0x09, 0xec, 'u','p','l','e','f','t','c','o','r','n','e','r',0,
-0xba, 0xd4, 0x09, 0xed, 'l','o','w','l','e','f','t','c','o','r','n','e','r',0,
-0x3e, 0xdd, 0x09, 0xee, 'c','r','o','s','s','i','n','g','l','i','n','e','s',0,
-0xed, 0x79, 0x09, 0xef, 'h','o','r','i','z','l','i','n','e','s','c','a','n','1',0,
-0xed, 0x7b, 0x09, 0xf0, 'h','o','r','i','z','l','i','n','e','s','c','a','n','3',0,
-0xed, 0x7d, 0x09, 0xf1, 'h','o','r','i','z','l','i','n','e','s','c','a','n','5',0,
-0xed, 0x7f, 0x09, 0xf2, 'h','o','r','i','z','l','i','n','e','s','c','a','n','7',0,
-0xed, 0x81, 0x09, 0xf3, 'h','o','r','i','z','l','i','n','e','s','c','a','n','9',0,
-0x0c, 0xdc, 0x09, 0xf4, 'l','e','f','t','t',0,
-0x1b, 0x04, 0x09, 0xf5, 'r','i','g','h','t','t',0,
-0x06, 0x28, 0x09, 0xf6, 'b','o','t','t',0,
-0x06, 0xb0, 0x09, 0xf7, 't','o','p','t',0,
-0x37, 0x9c, 0x09, 0xf8, 'v','e','r','t','b','a','r',0,
-0x34, 0x3f, 0x0a, 0xa1, 'e','m','s','p','a','c','e',0,
-0x34, 0x5f, 0x0a, 0xa2, 'e','n','s','p','a','c','e',0,
-0x61, 0x7f, 0x0a, 0xa3, 'e','m','3','s','p','a','c','e',0,
-0x61, 0x9f, 0x0a, 0xa4, 'e','m','4','s','p','a','c','e',0,
-0x9a, 0x9f, 0x0a, 0xa5, 'd','i','g','i','t','s','p','a','c','e',0,
-0xc0, 0x9f, 0x0a, 0xa6, 'p','u','n','c','t','s','p','a','c','e',0,
-0xdd, 0x5f, 0x0a, 0xa7, 't','h','i','n','s','p','a','c','e',0,
-0xce, 0x5f, 0x0a, 0xa8, 'h','a','i','r','s','p','a','c','e',0,
-0x19, 0x62, 0x0a, 0xa9, 'e','m','d','a','s','h',0,
-0x19, 0x72, 0x0a, 0xaa, 'e','n','d','a','s','h',0,
-0x6f, 0x4b, 0x0a, 0xac, 's','i','g','n','i','f','b','l','a','n','k',0,
-0x68, 0x21, 0x0a, 0xae, 'e','l','l','i','p','s','i','s',0,
-0x64, 0x8a, 0x0a, 0xaf, 'd','o','u','b','b','a','s','e','l','i','n','e','d','o','t',0,
-0x6d, 0x0c, 0x0a, 0xb0, 'o','n','e','t','h','i','r','d',0,
-0xe6, 0x8b, 0x0a, 0xb1, 't','w','o','t','h','i','r','d','s',0,
-0x6c, 0x30, 0x0a, 0xb2, 'o','n','e','f','i','f','t','h',0,
-0xe4, 0xd3, 0x0a, 0xb3, 't','w','o','f','i','f','t','h','s',0,
-0x77, 0x53, 0x0a, 0xb4, 't','h','r','e','e','f','i','f','t','h','s',0,
-0xab, 0x93, 0x0a, 0xb5, 'f','o','u','r','f','i','f','t','h','s',0,
-0x6d, 0x48, 0x0a, 0xb6, 'o','n','e','s','i','x','t','h',0,
-0xa5, 0x03, 0x0a, 0xb7, 'f','i','v','e','s','i','x','t','h','s',0,
-0x18, 0xd8, 0x0a, 0xb8, 'c','a','r','e','o','f',0,
-0x33, 0x02, 0x0a, 0xbb, 'f','i','g','d','a','s','h',0,
-0x9f, 0x52, 0x0a, 0xbc, 'l','e','f','t','a','n','g','l','e','b','r','a','c','k','e','t',0,
-0x4c, 0xac, 0x0a, 0xbd, 'd','e','c','i','m','a','l','p','o','i','n','t',0,
-0xdf, 0x52, 0x0a, 0xbe, 'r','i','g','h','t','a','n','g','l','e','b','r','a','c','k','e','t',0,
-0x1a, 0x28, 0x0a, 0xbf, 'm','a','r','k','e','r',0,
-0xd8, 0x98, 0x0a, 0xc3, 'o','n','e','e','i','g','h','t','h',0,
-0xee, 0xa3, 0x0a, 0xc4, 't','h','r','e','e','e','i','g','h','t','h','s',0,
-0x45, 0xa3, 0x0a, 0xc5, 'f','i','v','e','e','i','g','h','t','h','s',0,
-0xe7, 0x23, 0x0a, 0xc6, 's','e','v','e','n','e','i','g','h','t','h','s',0,
-0xde, 0x4b, 0x0a, 0xc9, 't','r','a','d','e','m','a','r','k',0,
-0xc3, 0x0b, 0x0a, 0xca, 's','i','g','n','a','t','u','r','e','m','a','r','k',0,
-0xb4, 0x49, 0x0a, 0xcb, 't','r','a','d','e','m','a','r','k','i','n','c','i','r','c','l','e',0,
-0x1f, 0xf9, 0x0a, 0xcc, 'l','e','f','t','o','p','e','n','t','r','i','a','n','g','l','e',0,
-0x5f, 0xf9, 0x0a, 0xcd, 'r','i','g','h','t','o','p','e','n','t','r','i','a','n','g','l','e',0,
-0x91, 0x49, 0x0a, 0xce, 'e','m','o','p','e','n','c','i','r','c','l','e',0,
-0x98, 0x19, 0x0a, 0xcf, 'e','m','o','p','e','n','r','e','c','t','a','n','g','l','e',0,
-0x54, 0x4b, 0x0a, 0xd0, 'l','e','f','t','s','i','n','g','l','e','q','u','o','t','e','m','a','r','k',0,
-0x54, 0x4b, 0x0a, 0xd1, 'r','i','g','h','t','s','i','n','g','l','e','q','u','o','t','e','m','a','r','k',0,
-0x9c, 0x4b, 0x0a, 0xd2, 'l','e','f','t','d','o','u','b','l','e','q','u','o','t','e','m','a','r','k',0,
-0x9c, 0x4b, 0x0a, 0xd3, 'r','i','g','h','t','d','o','u','b','l','e','q','u','o','t','e','m','a','r','k',0,
-0xed, 0xb0, 0x0a, 0xd4, 'p','r','e','s','c','r','i','p','t','i','o','n',0,
-0x35, 0xf5, 0x0a, 0xd6, 'm','i','n','u','t','e','s',0,
-0x35, 0xfb, 0x0a, 0xd7, 's','e','c','o','n','d','s',0,
-0xa7, 0xd5, 0x0a, 0xd9, 'l','a','t','i','n','c','r','o','s','s',0,
-0x68, 0x7f, 0x0a, 0xda, 'h','e','x','a','g','r','a','m',0,
-0xe9, 0x5e, 0x0a, 0xdb, 'f','i','l','l','e','d','r','e','c','t','b','u','l','l','e','t',0,
-0x09, 0x1e, 0x0a, 0xdc, 'f','i','l','l','e','d','l','e','f','t','t','r','i','b','u','l','l','e','t',0,
-0xf1, 0x1e, 0x0a, 0xdd, 'f','i','l','l','e','d','r','i','g','h','t','t','r','i','b','u','l','l','e','t',0,
-0xec, 0xc9, 0x0a, 0xde, 'e','m','f','i','l','l','e','d','c','i','r','c','l','e',0,
-0x7b, 0x3e, 0x0a, 0xdf, 'e','m','f','i','l','l','e','d','r','e','c','t',0,
-0x5a, 0x9e, 0x0a, 0xe0, 'e','n','o','p','e','n','c','i','r','c','b','u','l','l','e','t',0,
-0x13, 0x1e, 0x0a, 0xe1, 'e','n','o','p','e','n','s','q','u','a','r','e','b','u','l','l','e','t',0,
-0x71, 0x5e, 0x0a, 0xe2, 'o','p','e','n','r','e','c','t','b','u','l','l','e','t',0,
-0x05, 0xd2, 0x0a, 0xe3, 'o','p','e','n','t','r','i','b','u','l','l','e','t','u','p',0,
-0x18, 0x18, 0x0a, 0xe4, 'o','p','e','n','t','r','i','b','u','l','l','e','t','d','o','w','n',0,
-0x6d, 0x9c, 0x0a, 0xe5, 'o','p','e','n','s','t','a','r',0,
-0xd2, 0x9e, 0x0a, 0xe6, 'e','n','f','i','l','l','e','d','c','i','r','c','b','u','l','l','e','t',0,
-0xfd, 0x9e, 0x0a, 0xe7, 'e','n','f','i','l','l','e','d','s','q','b','u','l','l','e','t',0,
-0xf5, 0xd2, 0x0a, 0xe8, 'f','i','l','l','e','d','t','r','i','b','u','l','l','e','t','u','p',0,
-0xd8, 0x18, 0x0a, 0xe9, 'f','i','l','l','e','d','t','r','i','b','u','l','l','e','t','d','o','w','n',0,
-0x50, 0xec, 0x0a, 0xea, 'l','e','f','t','p','o','i','n','t','e','r',0,
-0xda, 0xec, 0x0a, 0xeb, 'r','i','g','h','t','p','o','i','n','t','e','r',0,
-0x06, 0x14, 0x0a, 0xec, 'c','l','u','b',0,
-0x32, 0x94, 0x0a, 0xed, 'd','i','a','m','o','n','d',0,
-0x0c, 0x84, 0x0a, 0xee, 'h','e','a','r','t',0,
-0xa0, 0xb5, 0x0a, 0xf0, 'm','a','l','t','e','s','e','c','r','o','s','s',0,
-0x18, 0xa0, 0x0a, 0xf1, 'd','a','g','g','e','r',0,
-0x8f, 0xe0, 0x0a, 0xf2, 'd','o','u','b','l','e','d','a','g','g','e','r',0,
-0xc9, 0x8b, 0x0a, 0xf3, 'c','h','e','c','k','m','a','r','k',0,
-0x23, 0x15, 0x0a, 0xf4, 'b','a','l','l','o','t','c','r','o','s','s',0,
-0xef, 0x88, 0x0a, 0xf5, 'm','u','s','i','c','a','l','s','h','a','r','p',0,
-0x77, 0x36, 0x0a, 0xf6, 'm','u','s','i','c','a','l','f','l','a','t',0,
-0xa6, 0x6a, 0x0a, 0xf7, 'm','a','l','e','s','y','m','b','o','l',0,
-0x6a, 0x6a, 0x0a, 0xf8, 'f','e','m','a','l','e','s','y','m','b','o','l',0,
-0xdb, 0x5d, 0x0a, 0xf9, 't','e','l','e','p','h','o','n','e',0,
-0xc8, 0xec, 0x0a, 0xfa, 't','e','l','e','p','h','o','n','e','r','e','c','o','r','d','e','r',0,
-0x2a, 0xe8, 0x0a, 0xfb, 'p','h','o','n','o','g','r','a','p','h','c','o','p','y','r','i','g','h','t',0,
-0x0c, 0x3e, 0x0a, 0xfc, 'c','a','r','e','t',0,
-0x7c, 0x4b, 0x0a, 0xfd, 's','i','n','g','l','e','l','o','w','q','u','o','t','e','m','a','r','k',0,
-0xbc, 0x4b, 0x0a, 0xfe, 'd','o','u','b','l','e','l','o','w','q','u','o','t','e','m','a','r','k',0,
-0x1a, 0x5c, 0x0a, 0xff, 'c','u','r','s','o','r',0,
-0xd2, 0xbe, 0x0b, 0xa3, 'l','e','f','t','c','a','r','e','t',0,
-0xb5, 0x3e, 0x0b, 0xa6, 'r','i','g','h','t','c','a','r','e','t',0,
-0xd3, 0x3e, 0x0b, 0xa8, 'd','o','w','n','c','a','r','e','t',0,
-0x37, 0x7e, 0x0b, 0xa9, 'u','p','c','a','r','e','t',0,
-0x37, 0x1c, 0x0b, 0xc0, 'o','v','e','r','b','a','r',0,
-0x69, 0xd5, 0x0b, 0xc2, 'd','o','w','n','t','a','c','k',0,
-0x1c, 0x1b, 0x0b, 0xc3, 'u','p','s','h','o','e',0,
-0xd4, 0xb1, 0x0b, 0xc4, 'd','o','w','n','s','t','i','l','e',0,
-0x6f, 0x1c, 0x0b, 0xc6, 'u','n','d','e','r','b','a','r',0,
-0x02, 0xfa, 0x0b, 0xca, 'j','o','t',0,
-0x06, 0x82, 0x0b, 0xcc, 'q','u','a','d',0,
-0x1b, 0xf5, 0x0b, 0xce, 'u','p','t','a','c','k',0,
-0x19, 0x49, 0x0b, 0xcf, 'c','i','r','c','l','e',0,
-0x38, 0xf1, 0x0b, 0xd3, 'u','p','s','t','i','l','e',0,
-0x69, 0xfb, 0x0b, 0xd6, 'd','o','w','n','s','h','o','e',0,
-0xda, 0xfb, 0x0b, 0xd8, 'r','i','g','h','t','s','h','o','e',0,
-0x69, 0xbb, 0x0b, 0xda, 'l','e','f','t','s','h','o','e',0,
-0x69, 0x95, 0x0b, 0xdc, 'l','e','f','t','t','a','c','k',0,
-0xda, 0xd5, 0x0b, 0xfc, 'r','i','g','h','t','t','a','c','k',0,
-0x45, 0x15, 0x0c, 0xdf, 'h','e','b','r','e','w','_','d','o','u','b','l','e','l','o','w','l','i','n','e',0,
-0x72, 0x6c, 0x0c, 0xe0, 'h','e','b','r','e','w','_','a','l','e','p','h',0,
-0x9c, 0x4e, 0x0c, 0xe1, 'h','e','b','r','e','w','_','b','e','t',0,
-0x39, 0x04, 0x0c, 0xe1, 'h','e','b','r','e','w','_','b','e','t','h',0,
-0x72, 0xc2, 0x0c, 0xe2, 'h','e','b','r','e','w','_','g','i','m','e','l',0,
-0xe6, 0x02, 0x0c, 0xe2, 'h','e','b','r','e','w','_','g','i','m','m','e','l',0,
-0x72, 0x56, 0x0c, 0xe3, 'h','e','b','r','e','w','_','d','a','l','e','t',0,
-0xe5, 0x14, 0x0c, 0xe3, 'h','e','b','r','e','w','_','d','a','l','e','t','h',0,
-0xcd, 0xf9, 0x0c, 0xe4, 'h','e','b','r','e','w','_','h','e',0,
-0x9c, 0x9d, 0x0c, 0xe5, 'h','e','b','r','e','w','_','w','a','w',0,
-0x39, 0xa4, 0x0c, 0xe6, 'h','e','b','r','e','w','_','z','a','i','n',0,
-0x73, 0xec, 0x0c, 0xe6, 'h','e','b','r','e','w','_','z','a','y','i','n',0,
-0x39, 0x06, 0x0c, 0xe7, 'h','e','b','r','e','w','_','c','h','e','t',0,
-0x9c, 0x66, 0x0c, 0xe7, 'h','e','b','r','e','w','_','h','e','t',0,
-0x9c, 0x96, 0x0c, 0xe8, 'h','e','b','r','e','w','_','t','e','t',0,
-0x39, 0x94, 0x0c, 0xe8, 'h','e','b','r','e','w','_','t','e','t','h',0,
-0x9c, 0xae, 0x0c, 0xe9, 'h','e','b','r','e','w','_','y','o','d',0,
-0x31, 0x04, 0x0c, 0xea, 'h','e','b','r','e','w','_','f','i','n','a','l','k','a','p','h',0,
-0x39, 0x34, 0x0c, 0xeb, 'h','e','b','r','e','w','_','k','a','p','h',0,
-0x72, 0xca, 0x0c, 0xec, 'h','e','b','r','e','w','_','l','a','m','e','d',0,
-0x98, 0x5b, 0x0c, 0xed, 'h','e','b','r','e','w','_','f','i','n','a','l','m','e','m',0,
-0x9c, 0x73, 0x0c, 0xee, 'h','e','b','r','e','w','_','m','e','m',0,
-0x98, 0x80, 0x0c, 0xef, 'h','e','b','r','e','w','_','f','i','n','a','l','n','u','n',0,
-0x9c, 0x98, 0x0c, 0xf0, 'h','e','b','r','e','w','_','n','u','n',0,
-0xe6, 0xda, 0x0c, 0xf1, 'h','e','b','r','e','w','_','s','a','m','e','c','h',0,
-0xe6, 0xea, 0x0c, 0xf1, 'h','e','b','r','e','w','_','s','a','m','e','k','h',0,
-0x39, 0x3c, 0x0c, 0xf2, 'h','e','b','r','e','w','_','a','y','i','n',0,
-0xcb, 0xfd, 0x0c, 0xf3, 'h','e','b','r','e','w','_','f','i','n','a','l','p','e',0,
-0xce, 0x09, 0x0c, 0xf4, 'h','e','b','r','e','w','_','p','e',0,
-0x31, 0x61, 0x0c, 0xf5, 'h','e','b','r','e','w','_','f','i','n','a','l','z','a','d','e',0,
-0x31, 0x65, 0x0c, 0xf5, 'h','e','b','r','e','w','_','f','i','n','a','l','z','a','d','i',0,
-0x39, 0x91, 0x0c, 0xf6, 'h','e','b','r','e','w','_','z','a','d','e',0,
-0x39, 0x95, 0x0c, 0xf6, 'h','e','b','r','e','w','_','z','a','d','i',0,
-0x39, 0x9c, 0x0c, 0xf7, 'h','e','b','r','e','w','_','q','o','p','h',0,
-0x9c, 0x84, 0x0c, 0xf7, 'h','e','b','r','e','w','_','k','u','f',0,
-0x39, 0x82, 0x0c, 0xf8, 'h','e','b','r','e','w','_','r','e','s','h',0,
-0x39, 0x88, 0x0c, 0xf9, 'h','e','b','r','e','w','_','s','h','i','n',0,
-0x9c, 0x91, 0x0c, 0xfa, 'h','e','b','r','e','w','_','t','a','w',0,
-0x9c, 0x80, 0x0c, 0xfa, 'h','e','b','r','e','w','_','t','a','f',0,
-0xe8, 0x56, 0xff, 0x7e, 'H','e','b','r','e','w','_','s','w','i','t','c','h',0,
-0x73, 0x9f, 0x0d, 0xa1, 'T','h','a','i','_','k','o','k','a','i',0,
-0xcf, 0x53, 0x0d, 0xa2, 'T','h','a','i','_','k','h','o','k','h','a','i',0,
-0x9f, 0x5a, 0x0d, 0xa3, 'T','h','a','i','_','k','h','o','k','h','u','a','t',0,
-0x9f, 0x57, 0x0d, 0xa4, 'T','h','a','i','_','k','h','o','k','h','w','a','i',0,
-0xcf, 0x74, 0x0d, 0xa5, 'T','h','a','i','_','k','h','o','k','h','o','n',0,
-0x7e, 0xd7, 0x0d, 0xa6, 'T','h','a','i','_','k','h','o','r','a','k','h','a','n','g',0,
-0xe7, 0xe3, 0x0d, 0xa7, 'T','h','a','i','_','n','g','o','n','g','u',0,
-0xcd, 0x18, 0x0d, 0xa8, 'T','h','a','i','_','c','h','o','c','h','a','n',0,
-0x9a, 0xb7, 0x0d, 0xa9, 'T','h','a','i','_','c','h','o','c','h','i','n','g',0,
-0x9a, 0x97, 0x0d, 0xaa, 'T','h','a','i','_','c','h','o','c','h','a','n','g',0,
-0xb9, 0xf9, 0x0d, 0xab, 'T','h','a','i','_','s','o','s','o',0,
-0xcd, 0x2b, 0x0d, 0xac, 'T','h','a','i','_','c','h','o','c','h','o','e',0,
-0xe9, 0xff, 0x0d, 0xad, 'T','h','a','i','_','y','o','y','i','n','g',0,
-0xcd, 0x7d, 0x0d, 0xae, 'T','h','a','i','_','d','o','c','h','a','d','a',0,
-0xd2, 0x65, 0x0d, 0xaf, 'T','h','a','i','_','t','o','p','a','t','a','k',0,
-0xd1, 0xe0, 0x0d, 0xb0, 'T','h','a','i','_','t','h','o','t','h','a','n',0,
-0x84, 0xcf, 0x0d, 0xb1, 'T','h','a','i','_','t','h','o','n','a','n','g','m','o','n','t','h','o',0,
-0x92, 0x41, 0x0d, 0xb2, 'T','h','a','i','_','t','h','o','p','h','u','t','h','a','o',0,
-0x73, 0xe8, 0x0d, 0xb3, 'T','h','a','i','_','n','o','n','e','n',0,
-0x73, 0x1d, 0x0d, 0xb4, 'T','h','a','i','_','d','o','d','e','k',0,
-0x74, 0x59, 0x0d, 0xb5, 'T','h','a','i','_','t','o','t','a','o',0,
-0xa4, 0x77, 0x0d, 0xb6, 'T','h','a','i','_','t','h','o','t','h','u','n','g',0,
-0x48, 0x98, 0x0d, 0xb7, 'T','h','a','i','_','t','h','o','t','h','a','h','a','n',0,
-0xa4, 0x5f, 0x0d, 0xb8, 'T','h','a','i','_','t','h','o','t','h','o','n','g',0,
-0xb9, 0xcd, 0x0d, 0xb9, 'T','h','a','i','_','n','o','n','u',0,
-0x9a, 0x37, 0x0d, 0xba, 'T','h','a','i','_','b','o','b','a','i','m','a','i',0,
-0x74, 0x11, 0x0d, 0xbb, 'T','h','a','i','_','p','o','p','l','a',0,
-0xa2, 0x37, 0x0d, 0xbc, 'T','h','a','i','_','p','h','o','p','h','u','n','g',0,
-0xb9, 0x69, 0x0d, 0xbd, 'T','h','a','i','_','f','o','f','a',0,
-0xd0, 0xc0, 0x0d, 0xbe, 'T','h','a','i','_','p','h','o','p','h','a','n',0,
-0x73, 0x40, 0x0d, 0xbf, 'T','h','a','i','_','f','o','f','a','n',0,
-0x89, 0x81, 0x0d, 0xc0, 'T','h','a','i','_','p','h','o','s','a','m','p','h','a','o',0,
-0xb9, 0xaf, 0x0d, 0xc1, 'T','h','a','i','_','m','o','m','a',0,
-0x74, 0xb9, 0x0d, 0xc2, 'T','h','a','i','_','y','o','y','a','k',0,
-0x74, 0x4b, 0x0d, 0xc3, 'T','h','a','i','_','r','o','r','u','a',0,
-0x2e, 0x2d, 0x0d, 0xc4, 'T','h','a','i','_','r','u',0,
-0xe7, 0xf7, 0x0d, 0xc5, 'T','h','a','i','_','l','o','l','i','n','g',0,
-0x2e, 0x21, 0x0d, 0xc6, 'T','h','a','i','_','l','u',0,
-0xe9, 0x84, 0x0d, 0xc7, 'T','h','a','i','_','w','o','w','a','e','n',0,
-0xe8, 0xe5, 0x0d, 0xc8, 'T','h','a','i','_','s','o','s','a','l','a',0,
-0xe9, 0x43, 0x0d, 0xc9, 'T','h','a','i','_','s','o','r','u','s','i',0,
-0x74, 0x5f, 0x0d, 0xca, 'T','h','a','i','_','s','o','s','u','a',0,
-0x73, 0x7a, 0x0d, 0xcb, 'T','h','a','i','_','h','o','h','i','p',0,
-0xcf, 0xdd, 0x0d, 0xcc, 'T','h','a','i','_','l','o','c','h','u','l','a',0,
-0xb9, 0x8f, 0x0d, 0xcd, 'T','h','a','i','_','o','a','n','g',0,
-0x9f, 0xbd, 0x0d, 0xce, 'T','h','a','i','_','h','o','n','o','k','h','u','k',0,
-0x40, 0x5f, 0x0d, 0xcf, 'T','h','a','i','_','p','a','i','y','a','n','n','o','i',0,
-0x73, 0xc3, 0x0d, 0xd0, 'T','h','a','i','_','s','a','r','a','a',0,
-0x76, 0x6a, 0x0d, 0xd1, 'T','h','a','i','_','m','a','i','h','a','n','a','k','a','t',0,
-0xe7, 0xe7, 0x0d, 0xd2, 'T','h','a','i','_','s','a','r','a','a','a',0,
-0xe7, 0xf3, 0x0d, 0xd3, 'T','h','a','i','_','s','a','r','a','a','m',0,
-0x73, 0xcb, 0x0d, 0xd4, 'T','h','a','i','_','s','a','r','a','i',0,
-0xe7, 0xff, 0x0d, 0xd5, 'T','h','a','i','_','s','a','r','a','i','i',0,
-0xe8, 0x13, 0x0d, 0xd6, 'T','h','a','i','_','s','a','r','a','u','e',0,
-0xd0, 0x8b, 0x0d, 0xd7, 'T','h','a','i','_','s','a','r','a','u','e','e',0,
-0x73, 0xd7, 0x0d, 0xd8, 'T','h','a','i','_','s','a','r','a','u',0,
-0xe8, 0x23, 0x0d, 0xd9, 'T','h','a','i','_','s','a','r','a','u','u',0,
-0xd0, 0x95, 0x0d, 0xda, 'T','h','a','i','_','p','h','i','n','t','h','u',0,
-0x66, 0xc7, 0x0d, 0xde, 'T','h','a','i','_','m','a','i','h','a','n','a','k','a','t','_','m','a','i','t','h','o',0,
-0xb9, 0x28, 0x0d, 0xdf, 'T','h','a','i','_','b','a','h','t',0,
-0x73, 0xc7, 0x0d, 0xe0, 'T','h','a','i','_','s','a','r','a','e',0,
-0xe7, 0xeb, 0x0d, 0xe1, 'T','h','a','i','_','s','a','r','a','a','e',0,
-0x73, 0xd1, 0x0d, 0xe2, 'T','h','a','i','_','s','a','r','a','o',0,
-0x2b, 0xdc, 0x0d, 0xe3, 'T','h','a','i','_','s','a','r','a','a','i','m','a','i','m','u','a','n',0,
-0x57, 0x93, 0x0d, 0xe4, 'T','h','a','i','_','s','a','r','a','a','i','m','a','i','m','a','l','a','i',0,
-0xed, 0xcd, 0x0d, 0xe5, 'T','h','a','i','_','l','a','k','k','h','a','n','g','y','a','o',0,
-0x9e, 0x75, 0x0d, 0xe6, 'T','h','a','i','_','m','a','i','y','a','m','o','k',0,
-0x3c, 0x89, 0x0d, 0xe7, 'T','h','a','i','_','m','a','i','t','a','i','k','h','u',0,
-0x73, 0x51, 0x0d, 0xe8, 'T','h','a','i','_','m','a','i','e','k',0,
-0xe7, 0x47, 0x0d, 0xe9, 'T','h','a','i','_','m','a','i','t','h','o',0,
-0xe7, 0x55, 0x0d, 0xea, 'T','h','a','i','_','m','a','i','t','r','i',0,
-0xec, 0x53, 0x0d, 0xeb, 'T','h','a','i','_','m','a','i','c','h','a','t','t','a','w','a',0,
-0x16, 0x3e, 0x0d, 0xec, 'T','h','a','i','_','t','h','a','n','t','h','a','k','h','a','t',0,
-0xa0, 0x0e, 0x0d, 0xed, 'T','h','a','i','_','n','i','k','h','a','h','i','t',0,
-0xe7, 0x8c, 0x0d, 0xf0, 'T','h','a','i','_','l','e','k','s','u','n',0,
-0xcf, 0x57, 0x0d, 0xf1, 'T','h','a','i','_','l','e','k','n','u','n','g',0,
-0xcf, 0x67, 0x0d, 0xf2, 'T','h','a','i','_','l','e','k','s','o','n','g',0,
-0xe7, 0x63, 0x0d, 0xf3, 'T','h','a','i','_','l','e','k','s','a','m',0,
-0x73, 0x83, 0x0d, 0xf4, 'T','h','a','i','_','l','e','k','s','i',0,
-0x73, 0x65, 0x0d, 0xf5, 'T','h','a','i','_','l','e','k','h','a',0,
-0xe7, 0x51, 0x0d, 0xf6, 'T','h','a','i','_','l','e','k','h','o','k',0,
-0xce, 0xc6, 0x0d, 0xf7, 'T','h','a','i','_','l','e','k','c','h','e','t',0,
-0xcf, 0x12, 0x0d, 0xf8, 'T','h','a','i','_','l','e','k','p','a','e','t',0,
-0xe7, 0x45, 0x0d, 0xf9, 'T','h','a','i','_','l','e','k','k','a','o',0,
-0x15, 0x72, 0xff, 0x31, 'H','a','n','g','u','l',0,
-0x74, 0x0c, 0xff, 0x32, 'H','a','n','g','u','l','_','S','t','a','r','t',0,
-0x5c, 0x6c, 0xff, 0x33, 'H','a','n','g','u','l','_','E','n','d',0,
-0x72, 0xd5, 0xff, 0x34, 'H','a','n','g','u','l','_','H','a','n','j','a',0,
-0xb9, 0x4d, 0xff, 0x35, 'H','a','n','g','u','l','_','J','a','m','o',0,
-0xe8, 0x11, 0xff, 0x36, 'H','a','n','g','u','l','_','R','o','m','a','j','a',0,
-0x33, 0x3e, 0xff, 0x37, 'H','a','n','g','u','l','_','C','o','d','e','i','n','p','u','t',0,
-0xe6, 0xb5, 0xff, 0x38, 'H','a','n','g','u','l','_','J','e','o','n','j','a',0,
-0x72, 0x75, 0xff, 0x39, 'H','a','n','g','u','l','_','B','a','n','j','a',0,
-0x9e, 0x95, 0xff, 0x3a, 'H','a','n','g','u','l','_','P','r','e','H','a','n','j','a',0,
-0x43, 0x35, 0xff, 0x3b, 'H','a','n','g','u','l','_','P','o','s','t','H','a','n','j','a',0,
-0x9a, 0x01, 0xff, 0x3c, 'H','a','n','g','u','l','_','S','i','n','g','l','e','C','a','n','d','i','d','a','t','e',0,
-0x32, 0x01, 0xff, 0x3d, 'H','a','n','g','u','l','_','M','u','l','t','i','p','l','e','C','a','n','d','i','d','a','t','e',0,
-0x6a, 0x01, 0xff, 0x3e, 'H','a','n','g','u','l','_','P','r','e','v','i','o','u','s','C','a','n','d','i','d','a','t','e',0,
-0xd0, 0x7a, 0xff, 0x3f, 'H','a','n','g','u','l','_','S','p','e','c','i','a','l',0,
-0xec, 0xd6, 0xff, 0x7e, 'H','a','n','g','u','l','_','s','w','i','t','c','h',0,
-0xe7, 0x51, 0x0e, 0xa1, 'H','a','n','g','u','l','_','K','i','y','e','o','g',0,
-0x12, 0x51, 0x0e, 0xa2, 'H','a','n','g','u','l','_','S','s','a','n','g','K','i','y','e','o','g',0,
-0x7a, 0x9d, 0x0e, 0xa3, 'H','a','n','g','u','l','_','K','i','y','e','o','g','S','i','o','s',0,
-0x73, 0x74, 0x0e, 0xa4, 'H','a','n','g','u','l','_','N','i','e','u','n',0,
-0x79, 0x50, 0x0e, 0xa5, 'H','a','n','g','u','l','_','N','i','e','u','n','J','i','e','u','j',0,
-0x79, 0x2e, 0x0e, 0xa6, 'H','a','n','g','u','l','_','N','i','e','u','n','H','i','e','u','h',0,
-0xe6, 0x0a, 0x0e, 0xa7, 'H','a','n','g','u','l','_','D','i','k','e','u','d',0,
-0x11, 0x0a, 0x0e, 0xa8, 'H','a','n','g','u','l','_','S','s','a','n','g','D','i','k','e','u','d',0,
-0x73, 0xb2, 0x0e, 0xa9, 'H','a','n','g','u','l','_','R','i','e','u','l',0,
-0x03, 0x11, 0x0e, 0xaa, 'H','a','n','g','u','l','_','R','i','e','u','l','K','i','y','e','o','g',0,
-0x81, 0x43, 0x0e, 0xab, 'H','a','n','g','u','l','_','R','i','e','u','l','M','i','e','u','m',0,
-0x81, 0x68, 0x0e, 0xac, 'H','a','n','g','u','l','_','R','i','e','u','l','P','i','e','u','b',0,
-0x40, 0xad, 0x0e, 0xad, 'H','a','n','g','u','l','_','R','i','e','u','l','S','i','o','s',0,
-0x81, 0xba, 0x0e, 0xae, 'H','a','n','g','u','l','_','R','i','e','u','l','T','i','e','u','t',0,
-0x03, 0x2c, 0x0e, 0xaf, 'H','a','n','g','u','l','_','R','i','e','u','l','P','h','i','e','u','f',0,
-0x80, 0xee, 0x0e, 0xb0, 'H','a','n','g','u','l','_','R','i','e','u','l','H','i','e','u','h',0,
-0x73, 0x63, 0x0e, 0xb1, 'H','a','n','g','u','l','_','M','i','e','u','m',0,
-0x73, 0x88, 0x0e, 0xb2, 'H','a','n','g','u','l','_','P','i','e','u','b',0,
-0x89, 0x08, 0x0e, 0xb3, 'H','a','n','g','u','l','_','S','s','a','n','g','P','i','e','u','b',0,
-0x3e, 0x0d, 0x0e, 0xb4, 'H','a','n','g','u','l','_','P','i','e','u','b','S','i','o','s',0,
-0xb9, 0xbd, 0x0e, 0xb5, 'H','a','n','g','u','l','_','S','i','o','s',0,
-0x44, 0x7d, 0x0e, 0xb6, 'H','a','n','g','u','l','_','S','s','a','n','g','S','i','o','s',0,
-0x73, 0x2f, 0x0e, 0xb7, 'H','a','n','g','u','l','_','I','e','u','n','g',0,
-0x73, 0x30, 0x0e, 0xb8, 'H','a','n','g','u','l','_','J','i','e','u','j',0,
-0x88, 0xb0, 0x0e, 0xb9, 'H','a','n','g','u','l','_','S','s','a','n','g','J','i','e','u','j',0,
-0x72, 0xb9, 0x0e, 0xba, 'H','a','n','g','u','l','_','C','i','e','u','c',0,
-0xe6, 0xd7, 0x0e, 0xbb, 'H','a','n','g','u','l','_','K','h','i','e','u','q',0,
-0x73, 0xda, 0x0e, 0xbc, 'H','a','n','g','u','l','_','T','i','e','u','t',0,
-0xe7, 0x6c, 0x0e, 0xbd, 'H','a','n','g','u','l','_','P','h','i','e','u','f',0,
-0x73, 0x0e, 0x0e, 0xbe, 'H','a','n','g','u','l','_','H','i','e','u','h',0,
-0x56, 0xc7, 0x0e, 0xbf, 'H','a','n','g','u','l','_','A',0,
-0xad, 0xd3, 0x0e, 0xc0, 'H','a','n','g','u','l','_','A','E',0,
-0xad, 0xff, 0x0e, 0xc1, 'H','a','n','g','u','l','_','Y','A',0,
-0x5c, 0x43, 0x0e, 0xc2, 'H','a','n','g','u','l','_','Y','A','E',0,
-0xad, 0xe5, 0x0e, 0xc3, 'H','a','n','g','u','l','_','E','O',0,
-0x56, 0xcb, 0x0e, 0xc4, 'H','a','n','g','u','l','_','E',0,
-0x5c, 0x55, 0x0e, 0xc5, 'H','a','n','g','u','l','_','Y','E','O',0,
-0xae, 0x03, 0x0e, 0xc6, 'H','a','n','g','u','l','_','Y','E',0,
-0x56, 0xd5, 0x0e, 0xc7, 'H','a','n','g','u','l','_','O',0,
-0xad, 0xfb, 0x0e, 0xc8, 'H','a','n','g','u','l','_','W','A',0,
-0x5c, 0x3b, 0x0e, 0xc9, 'H','a','n','g','u','l','_','W','A','E',0,
-0xad, 0xef, 0x0e, 0xca, 'H','a','n','g','u','l','_','O','E',0,
-0xae, 0x0d, 0x0e, 0xcb, 'H','a','n','g','u','l','_','Y','O',0,
-0x56, 0xdb, 0x0e, 0xcc, 'H','a','n','g','u','l','_','U',0,
-0x5c, 0x4d, 0x0e, 0xcd, 'H','a','n','g','u','l','_','W','E','O',0,
-0xad, 0xff, 0x0e, 0xce, 'H','a','n','g','u','l','_','W','E',0,
-0xae, 0x03, 0x0e, 0xcf, 'H','a','n','g','u','l','_','W','I',0,
-0xae, 0x13, 0x0e, 0xd0, 'H','a','n','g','u','l','_','Y','U',0,
-0xad, 0xeb, 0x0e, 0xd1, 'H','a','n','g','u','l','_','E','U',0,
-0xae, 0x07, 0x0e, 0xd2, 'H','a','n','g','u','l','_','Y','I',0,
-0x56, 0xcf, 0x0e, 0xd3, 'H','a','n','g','u','l','_','I',0,
-0x96, 0x51, 0x0e, 0xd4, 'H','a','n','g','u','l','_','J','_','K','i','y','e','o','g',0,
-0xf2, 0x51, 0x0e, 0xd5, 'H','a','n','g','u','l','_','J','_','S','s','a','n','g','K','i','y','e','o','g',0,
-0x6a, 0x9d, 0x0e, 0xd6, 'H','a','n','g','u','l','_','J','_','K','i','y','e','o','g','S','i','o','s',0,
-0xca, 0xf4, 0x0e, 0xd7, 'H','a','n','g','u','l','_','J','_','N','i','e','u','n',0,
-0x69, 0x50, 0x0e, 0xd8, 'H','a','n','g','u','l','_','J','_','N','i','e','u','n','J','i','e','u','j',0,
-0x69, 0x2e, 0x0e, 0xd9, 'H','a','n','g','u','l','_','J','_','N','i','e','u','n','H','i','e','u','h',0,
-0x95, 0x0a, 0x0e, 0xda, 'H','a','n','g','u','l','_','J','_','D','i','k','e','u','d',0,
-0xcb, 0x32, 0x0e, 0xdb, 'H','a','n','g','u','l','_','J','_','R','i','e','u','l',0,
-0xe3, 0x11, 0x0e, 0xdc, 'H','a','n','g','u','l','_','J','_','R','i','e','u','l','K','i','y','e','o','g',0,
-0x71, 0x43, 0x0e, 0xdd, 'H','a','n','g','u','l','_','J','_','R','i','e','u','l','M','i','e','u','m',0,
-0x71, 0x68, 0x0e, 0xde, 'H','a','n','g','u','l','_','J','_','R','i','e','u','l','P','i','e','u','b',0,
-0xb8, 0xad, 0x0e, 0xdf, 'H','a','n','g','u','l','_','J','_','R','i','e','u','l','S','i','o','s',0,
-0x71, 0xba, 0x0e, 0xe0, 'H','a','n','g','u','l','_','J','_','R','i','e','u','l','T','i','e','u','t',0,
-0xe3, 0x2c, 0x0e, 0xe1, 'H','a','n','g','u','l','_','J','_','R','i','e','u','l','P','h','i','e','u','f',0,
-0x70, 0xee, 0x0e, 0xe2, 'H','a','n','g','u','l','_','J','_','R','i','e','u','l','H','i','e','u','h',0,
-0xca, 0xe3, 0x0e, 0xe3, 'H','a','n','g','u','l','_','J','_','M','i','e','u','m',0,
-0xcb, 0x08, 0x0e, 0xe4, 'H','a','n','g','u','l','_','J','_','P','i','e','u','b',0,
-0xb6, 0x0d, 0x0e, 0xe5, 'H','a','n','g','u','l','_','J','_','P','i','e','u','b','S','i','o','s',0,
-0xe5, 0x7d, 0x0e, 0xe6, 'H','a','n','g','u','l','_','J','_','S','i','o','s',0,
-0xbc, 0x7d, 0x0e, 0xe7, 'H','a','n','g','u','l','_','J','_','S','s','a','n','g','S','i','o','s',0,
-0xca, 0xaf, 0x0e, 0xe8, 'H','a','n','g','u','l','_','J','_','I','e','u','n','g',0,
-0xca, 0xb0, 0x0e, 0xe9, 'H','a','n','g','u','l','_','J','_','J','i','e','u','j',0,
-0xca, 0x39, 0x0e, 0xea, 'H','a','n','g','u','l','_','J','_','C','i','e','u','c',0,
-0x95, 0xd7, 0x0e, 0xeb, 'H','a','n','g','u','l','_','J','_','K','h','i','e','u','q',0,
-0xcb, 0x5a, 0x0e, 0xec, 'H','a','n','g','u','l','_','J','_','T','i','e','u','t',0,
-0x96, 0x6c, 0x0e, 0xed, 'H','a','n','g','u','l','_','J','_','P','h','i','e','u','f',0,
-0xca, 0x8e, 0x0e, 0xee, 'H','a','n','g','u','l','_','J','_','H','i','e','u','h',0,
-0x98, 0xae, 0x0e, 0xef, 'H','a','n','g','u','l','_','R','i','e','u','l','Y','e','o','r','i','n','H','i','e','u','h',0,
-0x7f, 0x63, 0x0e, 0xf0, 'H','a','n','g','u','l','_','S','u','n','k','y','e','o','n','g','e','u','m','M','i','e','u','m',0,
-0x7f, 0x88, 0x0e, 0xf1, 'H','a','n','g','u','l','_','S','u','n','k','y','e','o','n','g','e','u','m','P','i','e','u','b',0,
-0xce, 0x0d, 0x0e, 0xf2, 'H','a','n','g','u','l','_','P','a','n','S','i','o','s',0,
-0xb1, 0xcf, 0x0e, 0xf3, 'H','a','n','g','u','l','_','K','k','o','g','j','i','D','a','l','r','i','n','I','e','u','n','g',0,
-0xff, 0x6c, 0x0e, 0xf4, 'H','a','n','g','u','l','_','S','u','n','k','y','e','o','n','g','e','u','m','P','h','i','e','u','f',0,
-0x20, 0xae, 0x0e, 0xf5, 'H','a','n','g','u','l','_','Y','e','o','r','i','n','H','i','e','u','h',0,
-0x72, 0x8f, 0x0e, 0xf6, 'H','a','n','g','u','l','_','A','r','a','e','A',0,
-0xe5, 0x63, 0x0e, 0xf7, 'H','a','n','g','u','l','_','A','r','a','e','A','E',0,
-0x2c, 0x0d, 0x0e, 0xf8, 'H','a','n','g','u','l','_','J','_','P','a','n','S','i','o','s',0,
-0xb1, 0xcf, 0x0e, 0xf9, 'H','a','n','g','u','l','_','J','_','K','k','o','g','j','i','D','a','l','r','i','n','I','e','u','n','g',0,
-0x00, 0xae, 0x0e, 0xfa, 'H','a','n','g','u','l','_','J','_','Y','e','o','r','i','n','H','i','e','u','h',0,
-0x6f, 0xe0, 0x0e, 0xff, 'K','o','r','e','a','n','_','W','o','n',0,
-0x30, 0xb5, 0x14, 0xa1, 'A','r','m','e','n','i','a','n','_','e','t','e','r','n','i','t','y',0,
-0x8a, 0x25, 0x14, 0xa2, 'A','r','m','e','n','i','a','n','_','l','i','g','a','t','u','r','e','_','e','w',0,
-0x63, 0xa6, 0x14, 0xa3, 'A','r','m','e','n','i','a','n','_','f','u','l','l','_','s','t','o','p',0,
-0x36, 0x12, 0x14, 0xa3, 'A','r','m','e','n','i','a','n','_','v','e','r','j','a','k','e','t',0,
-0xca, 0x48, 0x14, 0xa4, 'A','r','m','e','n','i','a','n','_','p','a','r','e','n','r','i','g','h','t',0,
-0x64, 0xb4, 0x14, 0xa5, 'A','r','m','e','n','i','a','n','_','p','a','r','e','n','l','e','f','t',0,
-0x93, 0x08, 0x14, 0xa6, 'A','r','m','e','n','i','a','n','_','g','u','i','l','l','e','m','o','t','r','i','g','h','t',0,
-0x49, 0x14, 0x14, 0xa7, 'A','r','m','e','n','i','a','n','_','g','u','i','l','l','e','m','o','t','l','e','f','t',0,
-0x96, 0x42, 0x14, 0xa8, 'A','r','m','e','n','i','a','n','_','e','m','_','d','a','s','h',0,
-0x79, 0x1a, 0x14, 0xa9, 'A','r','m','e','n','i','a','n','_','d','o','t',0,
-0x98, 0x72, 0x14, 0xa9, 'A','r','m','e','n','i','a','n','_','m','i','j','a','k','e','t',0,
-0x50, 0x2b, 0x14, 0xaa, 'A','r','m','e','n','i','a','n','_','s','e','p','a','r','a','t','i','o','n','_','m','a','r','k',0,
-0x79, 0x1e, 0x14, 0xaa, 'A','r','m','e','n','i','a','n','_','b','u','t',0,
-0xe5, 0x77, 0x14, 0xab, 'A','r','m','e','n','i','a','n','_','c','o','m','m','a',0,
-0x96, 0x62, 0x14, 0xac, 'A','r','m','e','n','i','a','n','_','e','n','_','d','a','s','h',0,
-0xcc, 0xa8, 0x14, 0xad, 'A','r','m','e','n','i','a','n','_','h','y','p','h','e','n',0,
-0x37, 0xb9, 0x14, 0xad, 'A','r','m','e','n','i','a','n','_','y','e','n','t','a','m','n','a',0,
-0x2f, 0x21, 0x14, 0xae, 'A','r','m','e','n','i','a','n','_','e','l','l','i','p','s','i','s',0,
-0xcb, 0xd7, 0x14, 0xaf, 'A','r','m','e','n','i','a','n','_','e','x','c','l','a','m',0,
-0xca, 0x9d, 0x14, 0xaf, 'A','r','m','e','n','i','a','n','_','a','m','a','n','a','k',0,
-0xca, 0x0c, 0x14, 0xb0, 'A','r','m','e','n','i','a','n','_','a','c','c','e','n','t',0,
-0xcc, 0xd8, 0x14, 0xb0, 'A','r','m','e','n','i','a','n','_','s','h','e','s','h','t',0,
-0x37, 0x20, 0x14, 0xb1, 'A','r','m','e','n','i','a','n','_','q','u','e','s','t','i','o','n',0,
-0xcc, 0x91, 0x14, 0xb1, 'A','r','m','e','n','i','a','n','_','p','a','r','u','y','k',0,
-0x78, 0x30, 0x14, 0xb2, 'A','r','m','e','n','i','a','n','_','A','Y','B',0,
-0x79, 0x10, 0x14, 0xb3, 'A','r','m','e','n','i','a','n','_','a','y','b',0,
-0x78, 0x18, 0x14, 0xb4, 'A','r','m','e','n','i','a','n','_','B','E','N',0,
-0x78, 0xf8, 0x14, 0xb5, 'A','r','m','e','n','i','a','n','_','b','e','n',0,
-0x78, 0x33, 0x14, 0xb6, 'A','r','m','e','n','i','a','n','_','G','I','M',0,
-0x79, 0x13, 0x14, 0xb7, 'A','r','m','e','n','i','a','n','_','g','i','m',0,
-0xbb, 0xe5, 0x14, 0xb8, 'A','r','m','e','n','i','a','n','_','D','A',0,
-0xbc, 0x45, 0x14, 0xb9, 'A','r','m','e','n','i','a','n','_','d','a',0,
-0xf1, 0x1a, 0x14, 0xba, 'A','r','m','e','n','i','a','n','_','Y','E','C','H',0,
-0xf2, 0xfa, 0x14, 0xbb, 'A','r','m','e','n','i','a','n','_','y','e','c','h',0,
-0xbc, 0x11, 0x14, 0xbc, 'A','r','m','e','n','i','a','n','_','Z','A',0,
-0xbc, 0x71, 0x14, 0xbd, 'A','r','m','e','n','i','a','n','_','z','a',0,
-0x5d, 0xd3, 0x14, 0xbe, 'A','r','m','e','n','i','a','n','_','E',0,
-0x5d, 0xf3, 0x14, 0xbf, 'A','r','m','e','n','i','a','n','_','e',0,
-0xbb, 0xf2, 0x14, 0xc0, 'A','r','m','e','n','i','a','n','_','A','T',0,
-0xbc, 0x52, 0x14, 0xc1, 'A','r','m','e','n','i','a','n','_','a','t',0,
-0xbc, 0x13, 0x14, 0xc2, 'A','r','m','e','n','i','a','n','_','T','O',0,
-0xbc, 0x73, 0x14, 0xc3, 'A','r','m','e','n','i','a','n','_','t','o',0,
-0x78, 0x75, 0x14, 0xc4, 'A','r','m','e','n','i','a','n','_','Z','H','E',0,
-0x79, 0x55, 0x14, 0xc5, 'A','r','m','e','n','i','a','n','_','z','h','e',0,
-0x78, 0x41, 0x14, 0xc6, 'A','r','m','e','n','i','a','n','_','I','N','I',0,
-0x79, 0x21, 0x14, 0xc7, 'A','r','m','e','n','i','a','n','_','i','n','i',0,
-0xf1, 0x2c, 0x14, 0xc8, 'A','r','m','e','n','i','a','n','_','L','Y','U','N',0,
-0xf3, 0x0c, 0x14, 0xc9, 'A','r','m','e','n','i','a','n','_','l','y','u','n',0,
-0x78, 0x39, 0x14, 0xca, 'A','r','m','e','n','i','a','n','_','K','H','E',0,
-0x79, 0x19, 0x14, 0xcb, 'A','r','m','e','n','i','a','n','_','k','h','e',0,
-0x78, 0x6f, 0x14, 0xcc, 'A','r','m','e','n','i','a','n','_','T','S','A',0,
-0x79, 0x4f, 0x14, 0xcd, 'A','r','m','e','n','i','a','n','_','t','s','a',0,
-0x78, 0x3c, 0x14, 0xce, 'A','r','m','e','n','i','a','n','_','K','E','N',0,
-0x79, 0x1c, 0x14, 0xcf, 'A','r','m','e','n','i','a','n','_','k','e','n',0,
-0xbb, 0xfb, 0x14, 0xd0, 'A','r','m','e','n','i','a','n','_','H','O',0,
-0xbc, 0x5b, 0x14, 0xd1, 'A','r','m','e','n','i','a','n','_','h','o',0,
-0x78, 0x3d, 0x14, 0xd2, 'A','r','m','e','n','i','a','n','_','D','Z','A',0,
-0x79, 0x1d, 0x14, 0xd3, 'A','r','m','e','n','i','a','n','_','d','z','a',0,
-0xf0, 0x9e, 0x14, 0xd4, 'A','r','m','e','n','i','a','n','_','G','H','A','T',0,
-0xf2, 0x7e, 0x14, 0xd5, 'A','r','m','e','n','i','a','n','_','g','h','a','t',0,
-0xf0, 0xf1, 0x14, 0xd6, 'A','r','m','e','n','i','a','n','_','T','C','H','E',0,
-0xf2, 0xd1, 0x14, 0xd7, 'A','r','m','e','n','i','a','n','_','t','c','h','e',0,
-0x78, 0x44, 0x14, 0xd8, 'A','r','m','e','n','i','a','n','_','M','E','N',0,
-0x79, 0x24, 0x14, 0xd9, 'A','r','m','e','n','i','a','n','_','m','e','n',0,
-0xbb, 0xf5, 0x14, 0xda, 'A','r','m','e','n','i','a','n','_','H','I',0,
-0xbc, 0x55, 0x14, 0xdb, 'A','r','m','e','n','i','a','n','_','h','i',0,
-0xbc, 0x0d, 0x14, 0xdc, 'A','r','m','e','n','i','a','n','_','N','U',0,
-0xbc, 0x6d, 0x14, 0xdd, 'A','r','m','e','n','i','a','n','_','n','u',0,
-0x78, 0x55, 0x14, 0xde, 'A','r','m','e','n','i','a','n','_','S','H','A',0,
-0x79, 0x35, 0x14, 0xdf, 'A','r','m','e','n','i','a','n','_','s','h','a',0,
-0xbc, 0x17, 0x14, 0xe0, 'A','r','m','e','n','i','a','n','_','V','O',0,
-0xbc, 0x77, 0x14, 0xe1, 'A','r','m','e','n','i','a','n','_','v','o',0,
-0x78, 0x15, 0x14, 0xe2, 'A','r','m','e','n','i','a','n','_','C','H','A',0,
-0x78, 0xf5, 0x14, 0xe3, 'A','r','m','e','n','i','a','n','_','c','h','a',0,
-0xbc, 0x01, 0x14, 0xe4, 'A','r','m','e','n','i','a','n','_','P','E',0,
-0xbc, 0x61, 0x14, 0xe5, 'A','r','m','e','n','i','a','n','_','p','e',0,
-0xbb, 0xf5, 0x14, 0xe6, 'A','r','m','e','n','i','a','n','_','J','E',0,
-0xbc, 0x55, 0x14, 0xe7, 'A','r','m','e','n','i','a','n','_','j','e',0,
-0xbc, 0x01, 0x14, 0xe8, 'A','r','m','e','n','i','a','n','_','R','A',0,
-0xbc, 0x61, 0x14, 0xe9, 'A','r','m','e','n','i','a','n','_','r','a',0,
-0xbc, 0x07, 0x14, 0xea, 'A','r','m','e','n','i','a','n','_','S','E',0,
-0xbc, 0x67, 0x14, 0xeb, 'A','r','m','e','n','i','a','n','_','s','e',0,
-0x78, 0x70, 0x14, 0xec, 'A','r','m','e','n','i','a','n','_','V','E','V',0,
-0x79, 0x50, 0x14, 0xed, 'A','r','m','e','n','i','a','n','_','v','e','v',0,
-0xf1, 0x6c, 0x14, 0xee, 'A','r','m','e','n','i','a','n','_','T','Y','U','N',0,
-0xf3, 0x4c, 0x14, 0xef, 'A','r','m','e','n','i','a','n','_','t','y','u','n',0,
-0xbc, 0x05, 0x14, 0xf0, 'A','r','m','e','n','i','a','n','_','R','E',0,
-0xbc, 0x65, 0x14, 0xf1, 'A','r','m','e','n','i','a','n','_','r','e',0,
-0x78, 0x7d, 0x14, 0xf2, 'A','r','m','e','n','i','a','n','_','T','S','O',0,
-0x79, 0x5d, 0x14, 0xf3, 'A','r','m','e','n','i','a','n','_','t','s','o',0,
-0xf1, 0x7c, 0x14, 0xf4, 'A','r','m','e','n','i','a','n','_','V','Y','U','N',0,
-0xf3, 0x5c, 0x14, 0xf5, 'A','r','m','e','n','i','a','n','_','v','y','u','n',0,
-0xf1, 0x50, 0x14, 0xf6, 'A','r','m','e','n','i','a','n','_','P','Y','U','R',0,
-0xf3, 0x30, 0x14, 0xf7, 'A','r','m','e','n','i','a','n','_','p','y','u','r',0,
-0xbb, 0xf7, 0x14, 0xf8, 'A','r','m','e','n','i','a','n','_','K','E',0,
-0xbc, 0x57, 0x14, 0xf9, 'A','r','m','e','n','i','a','n','_','k','e',0,
-0x5d, 0xdd, 0x14, 0xfa, 'A','r','m','e','n','i','a','n','_','O',0,
-0x5d, 0xfd, 0x14, 0xfb, 'A','r','m','e','n','i','a','n','_','o',0,
-0xbb, 0xed, 0x14, 0xfc, 'A','r','m','e','n','i','a','n','_','F','E',0,
-0xbc, 0x4d, 0x14, 0xfd, 'A','r','m','e','n','i','a','n','_','f','e',0,
-0xbe, 0x4d, 0x14, 0xfe, 'A','r','m','e','n','i','a','n','_','a','p','o','s','t','r','o','p','h','e',0,
-0x40, 0x68, 0x14, 0xff, 'A','r','m','e','n','i','a','n','_','s','e','c','t','i','o','n','_','s','i','g','n',0,
-0xc1, 0x0c, 0x15, 0xd0, 'G','e','o','r','g','i','a','n','_','a','n',0,
-0x82, 0x70, 0x15, 0xd1, 'G','e','o','r','g','i','a','n','_','b','a','n',0,
-0x82, 0x84, 0x15, 0xd2, 'G','e','o','r','g','i','a','n','_','g','a','n',0,
-0x82, 0x94, 0x15, 0xd3, 'G','e','o','r','g','i','a','n','_','d','o','n',0,
-0xc1, 0x14, 0x15, 0xd4, 'G','e','o','r','g','i','a','n','_','e','n',0,
-0x82, 0xd0, 0x15, 0xd5, 'G','e','o','r','g','i','a','n','_','v','i','n',0,
-0x82, 0xd8, 0x15, 0xd6, 'G','e','o','r','g','i','a','n','_','z','e','n',0,
-0x82, 0xb8, 0x15, 0xd7, 'G','e','o','r','g','i','a','n','_','t','a','n',0,
-0xc1, 0x1c, 0x15, 0xd8, 'G','e','o','r','g','i','a','n','_','i','n',0,
-0x82, 0x94, 0x15, 0xd9, 'G','e','o','r','g','i','a','n','_','k','a','n',0,
-0x82, 0x9d, 0x15, 0xda, 'G','e','o','r','g','i','a','n','_','l','a','s',0,
-0x82, 0x9c, 0x15, 0xdb, 'G','e','o','r','g','i','a','n','_','m','a','n',0,
-0x82, 0xa4, 0x15, 0xdc, 'G','e','o','r','g','i','a','n','_','n','a','r',0,
-0xc1, 0x28, 0x15, 0xdd, 'G','e','o','r','g','i','a','n','_','o','n',0,
-0x82, 0xac, 0x15, 0xde, 'G','e','o','r','g','i','a','n','_','p','a','r',0,
-0x06, 0x14, 0x15, 0xdf, 'G','e','o','r','g','i','a','n','_','z','h','a','r',0,
-0x82, 0xa7, 0x15, 0xe0, 'G','e','o','r','g','i','a','n','_','r','a','e',0,
-0x82, 0xb4, 0x15, 0xe1, 'G','e','o','r','g','i','a','n','_','s','a','n',0,
-0x82, 0xbc, 0x15, 0xe2, 'G','e','o','r','g','i','a','n','_','t','a','r',0,
-0xc1, 0x34, 0x15, 0xe3, 'G','e','o','r','g','i','a','n','_','u','n',0,
-0x05, 0xc4, 0x15, 0xe4, 'G','e','o','r','g','i','a','n','_','p','h','a','r',0,
-0x05, 0x9c, 0x15, 0xe5, 'G','e','o','r','g','i','a','n','_','k','h','a','r',0,
-0x05, 0x78, 0x15, 0xe6, 'G','e','o','r','g','i','a','n','_','g','h','a','n',0,
-0x82, 0xb0, 0x15, 0xe7, 'G','e','o','r','g','i','a','n','_','q','a','r',0,
-0x05, 0xe8, 0x15, 0xe8, 'G','e','o','r','g','i','a','n','_','s','h','i','n',0,
-0x05, 0x68, 0x15, 0xe9, 'G','e','o','r','g','i','a','n','_','c','h','i','n',0,
-0x82, 0x74, 0x15, 0xea, 'G','e','o','r','g','i','a','n','_','c','a','n',0,
-0x82, 0x9e, 0x15, 0xeb, 'G','e','o','r','g','i','a','n','_','j','i','l',0,
-0x82, 0x82, 0x15, 0xec, 'G','e','o','r','g','i','a','n','_','c','i','l',0,
-0x05, 0x5c, 0x15, 0xed, 'G','e','o','r','g','i','a','n','_','c','h','a','r',0,
-0x82, 0xc8, 0x15, 0xee, 'G','e','o','r','g','i','a','n','_','x','a','n',0,
-0x05, 0x90, 0x15, 0xef, 'G','e','o','r','g','i','a','n','_','j','h','a','n',0,
-0x82, 0x7f, 0x15, 0xf0, 'G','e','o','r','g','i','a','n','_','h','a','e',0,
-0xc1, 0x11, 0x15, 0xf1, 'G','e','o','r','g','i','a','n','_','h','e',0,
-0x82, 0x8f, 0x15, 0xf2, 'G','e','o','r','g','i','a','n','_','h','i','e',0,
-0xc1, 0x2f, 0x15, 0xf3, 'G','e','o','r','g','i','a','n','_','w','e',0,
-0x82, 0x8c, 0x15, 0xf4, 'G','e','o','r','g','i','a','n','_','h','a','r',0,
-0x82, 0x9b, 0x15, 0xf5, 'G','e','o','r','g','i','a','n','_','h','o','e',0,
-0xc1, 0x11, 0x15, 0xf6, 'G','e','o','r','g','i','a','n','_','f','i',0,
-0xb5, 0x4a, 0x16, 0xa2, 'C','c','e','d','i','l','l','a','a','b','o','v','e','d','o','t',0,
-0xbc, 0x4a, 0x16, 0xa3, 'X','a','b','o','v','e','d','o','t',0,
-0xb5, 0x4a, 0x16, 0xa5, 'Q','a','b','o','v','e','d','o','t',0,
-0x15, 0xb5, 0x16, 0xa6, 'I','b','r','e','v','e',0,
-0x00, 0xd7, 0x16, 0xa7, 'I','E',0,
-0x00, 0xf9, 0x16, 0xa8, 'U','O',0,
-0x32, 0xa7, 0x16, 0xa9, 'Z','s','t','r','o','k','e',0,
-0x15, 0x2c, 0x16, 0xaa, 'G','c','a','r','o','n',0,
-0x2c, 0x96, 0x16, 0xaf, 'O','b','a','r','r','e','d',0,
-0xb5, 0x4a, 0x16, 0xb2, 'c','c','e','d','i','l','l','a','a','b','o','v','e','d','o','t',0,
-0xdc, 0x4a, 0x16, 0xb3, 'x','a','b','o','v','e','d','o','t',0,
-0x16, 0x2c, 0x16, 0xb4, 'O','c','a','r','o','n',0,
-0xd5, 0x4a, 0x16, 0xb5, 'q','a','b','o','v','e','d','o','t',0,
-0x19, 0xb5, 0x16, 0xb6, 'i','b','r','e','v','e',0,
-0x01, 0x37, 0x16, 0xb7, 'i','e',0,
-0x01, 0x59, 0x16, 0xb8, 'u','o',0,
-0x3a, 0xa7, 0x16, 0xb9, 'z','s','t','r','o','k','e',0,
-0x19, 0x2c, 0x16, 0xba, 'g','c','a','r','o','n',0,
-0x1a, 0x2c, 0x16, 0xbd, 'o','c','a','r','o','n',0,
-0x34, 0x96, 0x16, 0xbf, 'o','b','a','r','r','e','d',0,
-0x09, 0x57, 0x16, 0xc6, 'S','C','H','W','A',0,
-0x0d, 0x37, 0x16, 0xf6, 's','c','h','w','a',0,
-0xb1, 0x4a, 0x16, 0xd1, 'L','b','e','l','o','w','d','o','t',0,
-0x8c, 0x4a, 0x16, 0xd2, 'L','s','t','r','o','k','e','b','e','l','o','w','d','o','t',0,
-0xd1, 0x4a, 0x16, 0xe1, 'l','b','e','l','o','w','d','o','t',0,
-0x8c, 0x4a, 0x16, 0xe2, 'l','s','t','r','o','k','e','b','e','l','o','w','d','o','t',0,
-0x16, 0x45, 0x16, 0xd3, 'G','t','i','l','d','e',0,
-0x1a, 0x45, 0x16, 0xe3, 'g','t','i','l','d','e',0,
-0xa6, 0x4a, 0x1e, 0xa0, 'A','b','e','l','o','w','d','o','t',0,
-0xc6, 0x4a, 0x1e, 0xa1, 'a','b','e','l','o','w','d','o','t',0,
-0x0a, 0x55, 0x1e, 0xa2, 'A','h','o','o','k',0,
-0x0c, 0x55, 0x1e, 0xa3, 'a','h','o','o','k',0,
-0x16, 0x89, 0x1e, 0xa4, 'A','c','i','r','c','u','m','f','l','e','x','a','c','u','t','e',0,
-0x16, 0x89, 0x1e, 0xa5, 'a','c','i','r','c','u','m','f','l','e','x','a','c','u','t','e',0,
-0x17, 0x15, 0x1e, 0xa6, 'A','c','i','r','c','u','m','f','l','e','x','g','r','a','v','e',0,
-0x17, 0x15, 0x1e, 0xa7, 'a','c','i','r','c','u','m','f','l','e','x','g','r','a','v','e',0,
-0x0b, 0x65, 0x1e, 0xa8, 'A','c','i','r','c','u','m','f','l','e','x','h','o','o','k',0,
-0x0b, 0x65, 0x1e, 0xa9, 'a','c','i','r','c','u','m','f','l','e','x','h','o','o','k',0,
-0x17, 0xa5, 0x1e, 0xaa, 'A','c','i','r','c','u','m','f','l','e','x','t','i','l','d','e',0,
-0x17, 0xa5, 0x1e, 0xab, 'a','c','i','r','c','u','m','f','l','e','x','t','i','l','d','e',0,
-0xb7, 0x4a, 0x1e, 0xac, 'A','c','i','r','c','u','m','f','l','e','x','b','e','l','o','w','d','o','t',0,
-0xb7, 0x4a, 0x1e, 0xad, 'a','c','i','r','c','u','m','f','l','e','x','b','e','l','o','w','d','o','t',0,
-0xa2, 0xe9, 0x1e, 0xae, 'A','b','r','e','v','e','a','c','u','t','e',0,
-0x22, 0xe9, 0x1e, 0xaf, 'a','b','r','e','v','e','a','c','u','t','e',0,
-0xa3, 0x75, 0x1e, 0xb0, 'A','b','r','e','v','e','g','r','a','v','e',0,
-0x23, 0x75, 0x1e, 0xb1, 'a','b','r','e','v','e','g','r','a','v','e',0,
-0x51, 0x95, 0x1e, 0xb2, 'A','b','r','e','v','e','h','o','o','k',0,
-0x91, 0x95, 0x1e, 0xb3, 'a','b','r','e','v','e','h','o','o','k',0,
-0xa4, 0x05, 0x1e, 0xb4, 'A','b','r','e','v','e','t','i','l','d','e',0,
-0x24, 0x05, 0x1e, 0xb5, 'a','b','r','e','v','e','t','i','l','d','e',0,
-0x1a, 0x4a, 0x1e, 0xb6, 'A','b','r','e','v','e','b','e','l','o','w','d','o','t',0,
-0x1a, 0x4a, 0x1e, 0xb7, 'a','b','r','e','v','e','b','e','l','o','w','d','o','t',0,
-0xaa, 0x4a, 0x1e, 0xb8, 'E','b','e','l','o','w','d','o','t',0,
-0xca, 0x4a, 0x1e, 0xb9, 'e','b','e','l','o','w','d','o','t',0,
-0x0a, 0x95, 0x1e, 0xba, 'E','h','o','o','k',0,
-0x0c, 0x95, 0x1e, 0xbb, 'e','h','o','o','k',0,
-0x16, 0x05, 0x1e, 0xbc, 'E','t','i','l','d','e',0,
-0x1a, 0x05, 0x1e, 0xbd, 'e','t','i','l','d','e',0,
-0x16, 0x89, 0x1e, 0xbe, 'E','c','i','r','c','u','m','f','l','e','x','a','c','u','t','e',0,
-0x16, 0x89, 0x1e, 0xbf, 'e','c','i','r','c','u','m','f','l','e','x','a','c','u','t','e',0,
-0x17, 0x15, 0x1e, 0xc0, 'E','c','i','r','c','u','m','f','l','e','x','g','r','a','v','e',0,
-0x17, 0x15, 0x1e, 0xc1, 'e','c','i','r','c','u','m','f','l','e','x','g','r','a','v','e',0,
-0x0b, 0x65, 0x1e, 0xc2, 'E','c','i','r','c','u','m','f','l','e','x','h','o','o','k',0,
-0x0b, 0x65, 0x1e, 0xc3, 'e','c','i','r','c','u','m','f','l','e','x','h','o','o','k',0,
-0x17, 0xa5, 0x1e, 0xc4, 'E','c','i','r','c','u','m','f','l','e','x','t','i','l','d','e',0,
-0x17, 0xa5, 0x1e, 0xc5, 'e','c','i','r','c','u','m','f','l','e','x','t','i','l','d','e',0,
-0xb7, 0x4a, 0x1e, 0xc6, 'E','c','i','r','c','u','m','f','l','e','x','b','e','l','o','w','d','o','t',0,
-0xb7, 0x4a, 0x1e, 0xc7, 'e','c','i','r','c','u','m','f','l','e','x','b','e','l','o','w','d','o','t',0,
-0x0a, 0xd5, 0x1e, 0xc8, 'I','h','o','o','k',0,
-0x0c, 0xd5, 0x1e, 0xc9, 'i','h','o','o','k',0,
-0xae, 0x4a, 0x1e, 0xca, 'I','b','e','l','o','w','d','o','t',0,
-0xce, 0x4a, 0x1e, 0xcb, 'i','b','e','l','o','w','d','o','t',0,
-0xb4, 0x4a, 0x1e, 0xcc, 'O','b','e','l','o','w','d','o','t',0,
-0xd4, 0x4a, 0x1e, 0xcd, 'o','b','e','l','o','w','d','o','t',0,
-0x0b, 0x35, 0x1e, 0xce, 'O','h','o','o','k',0,
-0x0d, 0x35, 0x1e, 0xcf, 'o','h','o','o','k',0,
-0x16, 0x89, 0x1e, 0xd0, 'O','c','i','r','c','u','m','f','l','e','x','a','c','u','t','e',0,
-0x16, 0x89, 0x1e, 0xd1, 'o','c','i','r','c','u','m','f','l','e','x','a','c','u','t','e',0,
-0x17, 0x15, 0x1e, 0xd2, 'O','c','i','r','c','u','m','f','l','e','x','g','r','a','v','e',0,
-0x17, 0x15, 0x1e, 0xd3, 'o','c','i','r','c','u','m','f','l','e','x','g','r','a','v','e',0,
-0x8b, 0x65, 0x1e, 0xd4, 'O','c','i','r','c','u','m','f','l','e','x','h','o','o','k',0,
-0x8b, 0x65, 0x1e, 0xd5, 'o','c','i','r','c','u','m','f','l','e','x','h','o','o','k',0,
-0x17, 0xa5, 0x1e, 0xd6, 'O','c','i','r','c','u','m','f','l','e','x','t','i','l','d','e',0,
-0x17, 0xa5, 0x1e, 0xd7, 'o','c','i','r','c','u','m','f','l','e','x','t','i','l','d','e',0,
-0xb7, 0x4a, 0x1e, 0xd8, 'O','c','i','r','c','u','m','f','l','e','x','b','e','l','o','w','d','o','t',0,
-0xb7, 0x4a, 0x1e, 0xd9, 'o','c','i','r','c','u','m','f','l','e','x','b','e','l','o','w','d','o','t',0,
-0x74, 0x09, 0x1e, 0xda, 'O','h','o','r','n','a','c','u','t','e',0,
-0xb4, 0x09, 0x1e, 0xdb, 'o','h','o','r','n','a','c','u','t','e',0,
-0x74, 0x95, 0x1e, 0xdc, 'O','h','o','r','n','g','r','a','v','e',0,
-0xb4, 0x95, 0x1e, 0xdd, 'o','h','o','r','n','g','r','a','v','e',0,
-0xba, 0x25, 0x1e, 0xde, 'O','h','o','r','n','h','o','o','k',0,
-0xda, 0x25, 0x1e, 0xdf, 'o','h','o','r','n','h','o','o','k',0,
-0x75, 0x25, 0x1e, 0xe0, 'O','h','o','r','n','t','i','l','d','e',0,
-0xb5, 0x25, 0x1e, 0xe1, 'o','h','o','r','n','t','i','l','d','e',0,
-0xa3, 0x4a, 0x1e, 0xe2, 'O','h','o','r','n','b','e','l','o','w','d','o','t',0,
-0xa3, 0x4a, 0x1e, 0xe3, 'o','h','o','r','n','b','e','l','o','w','d','o','t',0,
-0xba, 0x4a, 0x1e, 0xe4, 'U','b','e','l','o','w','d','o','t',0,
-0xda, 0x4a, 0x1e, 0xe5, 'u','b','e','l','o','w','d','o','t',0,
-0x0b, 0x95, 0x1e, 0xe6, 'U','h','o','o','k',0,
-0x0d, 0x95, 0x1e, 0xe7, 'u','h','o','o','k',0,
-0x80, 0x09, 0x1e, 0xe8, 'U','h','o','r','n','a','c','u','t','e',0,
-0xc0, 0x09, 0x1e, 0xe9, 'u','h','o','r','n','a','c','u','t','e',0,
-0x80, 0x95, 0x1e, 0xea, 'U','h','o','r','n','g','r','a','v','e',0,
-0xc0, 0x95, 0x1e, 0xeb, 'u','h','o','r','n','g','r','a','v','e',0,
-0xc0, 0x25, 0x1e, 0xec, 'U','h','o','r','n','h','o','o','k',0,
-0xe0, 0x25, 0x1e, 0xed, 'u','h','o','r','n','h','o','o','k',0,
-0x81, 0x25, 0x1e, 0xee, 'U','h','o','r','n','t','i','l','d','e',0,
-0xc1, 0x25, 0x1e, 0xef, 'u','h','o','r','n','t','i','l','d','e',0,
-0x03, 0x4a, 0x1e, 0xf0, 'U','h','o','r','n','b','e','l','o','w','d','o','t',0,
-0x03, 0x4a, 0x1e, 0xf1, 'u','h','o','r','n','b','e','l','o','w','d','o','t',0,
-0xbe, 0x4a, 0x1e, 0xf4, 'Y','b','e','l','o','w','d','o','t',0,
-0xde, 0x4a, 0x1e, 0xf5, 'y','b','e','l','o','w','d','o','t',0,
-0x0b, 0xd5, 0x1e, 0xf6, 'Y','h','o','o','k',0,
-0x0d, 0xd5, 0x1e, 0xf7, 'y','h','o','o','k',0,
-0x18, 0x85, 0x1e, 0xf8, 'Y','t','i','l','d','e',0,
-0x1c, 0x85, 0x1e, 0xf9, 'y','t','i','l','d','e',0,
-0x0b, 0x3e, 0x1e, 0xfa, 'O','h','o','r','n',0,
-0x0d, 0x3e, 0x1e, 0xfb, 'o','h','o','r','n',0,
-0x0b, 0x9e, 0x1e, 0xfc, 'U','h','o','r','n',0,
-0x0d, 0x9e, 0x1e, 0xfd, 'u','h','o','r','n',0,
-0xd3, 0x05, 0x1e, 0x9f, 'c','o','m','b','i','n','i','n','g','_','t','i','l','d','e',0,
-0xd2, 0x75, 0x1e, 0xf2, 'c','o','m','b','i','n','i','n','g','_','g','r','a','v','e',0,
-0xd1, 0xe9, 0x1e, 0xf3, 'c','o','m','b','i','n','i','n','g','_','a','c','u','t','e',0,
-0xe9, 0x15, 0x1e, 0xfe, 'c','o','m','b','i','n','i','n','g','_','h','o','o','k',0,
-0x92, 0x4a, 0x1e, 0xff, 'c','o','m','b','i','n','i','n','g','_','b','e','l','o','w','d','o','t',0,
-0x2a, 0x68, 0x20, 0xa0, 'E','c','u','S','i','g','n',0,
-0xaf, 0xb8, 0x20, 0xa1, 'C','o','l','o','n','S','i','g','n',0,
-0xab, 0x68, 0x20, 0xa2, 'C','r','u','z','e','i','r','o','S','i','g','n',0,
-0x3c, 0xa8, 0x20, 0xa3, 'F','F','r','a','n','c','S','i','g','n',0,
-0x5a, 0x08, 0x20, 0xa4, 'L','i','r','a','S','i','g','n',0,
-0x5a, 0x78, 0x20, 0xa5, 'M','i','l','l','S','i','g','n',0,
-0xb2, 0x88, 0x20, 0xa6, 'N','a','i','r','a','S','i','g','n',0,
-0x71, 0xc8, 0x20, 0xa7, 'P','e','s','e','t','a','S','i','g','n',0,
-0xc0, 0xe8, 0x20, 0xa8, 'R','u','p','e','e','S','i','g','n',0,
-0x2f, 0xf8, 0x20, 0xa9, 'W','o','n','S','i','g','n',0,
-0x59, 0x98, 0x20, 0xaa, 'N','e','w','S','h','e','q','e','l','S','i','g','n',0,
-0x57, 0x68, 0x20, 0xab, 'D','o','n','g','S','i','g','n',0,
-0x5a, 0x68, 0x20, 0xac, 'E','u','r','o','S','i','g','n',0
+#define KSNAMES		1705
+#define KSBUCKETS	427
+
+static const char ks_names[] =
+"Georgian_par\0"
+"Arabic_kaf\0"
+"c\0"
+"Armenian_eternity\0"
+"Greek_iotaaccentdieresis\0"
+"Obarred\0"
+"acircumflexbelowdot\0"
+"nabla\0"
+"F5\0"
+"Hangul_J_NieunJieuj\0"
+"rightanglebracket\0"
+"KP_Subtract\0"
+"kana_yu\0"
+"Hangul_PieubSios\0"
+"Dstroke\0"
+"kana_comma\0"
+"Armenian_khe\0"
+"Abrevehook\0"
+"I\0"
+"Greek_TAU\0"
+"SlowKeys_Enable\0"
+"Thai_saraa\0"
+"Thai_leknung\0"
+"kana_closingbracket\0"
+"Cyrillic_schwa\0"
+"Overlay1_Enable\0"
+"Georgian_an\0"
+"Hangul_SsangJieuj\0"
+"hebrew_ayin\0"
+"ucircumflex\0"
+"ballotcross\0"
+"3270_PA2\0"
+"ISO_Fast_Cursor_Right\0"
+"S\0"
+"Thai_topatak\0"
+"hebrew_zadi\0"
+"kana_HE\0"
+"maltesecross\0"
+"Armenian_DZA\0"
+"rightdoublequotemark\0"
+"Cyrillic_NJE\0"
+"Greek_delta\0"
+"KP_Up\0"
+"Armenian_ini\0"
+"Greek_finalsmallsigma\0"
+"Ibreve\0"
+"F28\0"
+"Cyrillic_de\0"
+"ntilde\0"
+"tslash\0"
+"Scaron\0"
+"rightpointer\0"
+"Georgian_zhar\0"
+"crossinglines\0"
+"3270_Right2\0"
+"Cyrillic_yu\0"
+"Pause\0"
+"i\0"
+"Arabic_madda_above\0"
+"infinity\0"
+"punctspace\0"
+"ISO_Center_Object\0"
+"Cyrillic_ZHE\0"
+"kana_RU\0"
+"ae\0"
+"grave\0"
+"Uhornacute\0"
+"Hangul_RieulSios\0"
+"Armenian_KE\0"
+"KP_F3\0"
+"Ocircumflextilde\0"
+"Thai_sarai\0"
+"Cyrillic_IO\0"
+"Greek_ETAaccent\0"
+"Cyrillic_CHE_descender\0"
+"Georgian_cil\0"
+"Thai_leksam\0"
+"Arabic_qaf\0"
+"marker\0"
+"otilde\0"
+"hebrew_zade\0"
+"Delete\0"
+"Thai_saraii\0"
+"9\0"
+"F26\0"
+"hebrew_lamed\0"
+"opentribulletdown\0"
+"kana_N\0"
+"0\0"
+"acircumflexacute\0"
+"Hangul_NieunHieuh\0"
+"degree\0"
+"Armenian_hi\0"
+"club\0"
+"Hangul_PanSios\0"
+"Greek_DELTA\0"
+"Armenian_apostrophe\0"
+"KP_8\0"
+"hebrew_tet\0"
+"yhook\0"
+"opentribulletup\0"
+"Wcircumflex\0"
+"Armenian_TSO\0"
+"Greek_EPSILON\0"
+"horizlinescan9\0"
+"Greek_sigma\0"
+"Abrevebelowdot\0"
+"threeeighths\0"
+"Georgian_un\0"
+"Cyrillic_shorti\0"
+"Cyrillic_ghe\0"
+"Hangul_Codeinput\0"
+"Georgian_char\0"
+"uhornbelowdot\0"
+"kana_MO\0"
+"Hangul_J_Tieut\0"
+"ht\0"
+"3270_Quit\0"
+"ISO_Prev_Group_Lock\0"
+"Cyrillic_er\0"
+"ecircumflexgrave\0"
+"Hangul_RieulMieum\0"
+"Hangul_Jamo\0"
+"botleftsummation\0"
+"Georgian_gan\0"
+"Pointer_DblClick5\0"
+"Hangul_J_YeorinHieuh\0"
+"Hangul_J_KiyeogSios\0"
+"aacute\0"
+"Armenian_SE\0"
+"Greek_lamda\0"
+"ohorntilde\0"
+"parenleft\0"
+"rightt\0"
+"sabovedot\0"
+"ISO_Level3_Lock\0"
+"Thai_saraaa\0"
+"Hangul_Romaja\0"
+"Thai_khokhon\0"
+"kana_E\0"
+"downcaret\0"
+"Henkan_Mode\0"
+"Thai_maitaikhu\0"
+"Georgian_las\0"
+"l\0"
+"prescription\0"
+"ISO_Set_Margin_Right\0"
+"Icircumflex\0"
+"emspace\0"
+"leftanglebracket\0"
+"Armenian_mijaket\0"
+"Hangul_Nieun\0"
+"uhornacute\0"
+"kana_I\0"
+"Hangul_WI\0"
+"Arabic_fullstop\0"
+"Hangul_SunkyeongeumPhieuf\0"
+"hebrew_finalnun\0"
+"Cyrillic_ze\0"
+"Greek_upsilondieresis\0"
+"Linefeed\0"
+"leftsinglequotemark\0"
+"Arabic_tatweel\0"
+"Overlay2_Enable\0"
+"downarrow\0"
+"Hangul_Dikeud\0"
+"uhorn\0"
+"Serbian_dze\0"
+"horizconnector\0"
+"Find\0"
+"Cyrillic_u_straight\0"
+"asterisk\0"
+"Armenian_MEN\0"
+"Break\0"
+"Wdiaeresis\0"
+"Thai_soso\0"
+"combining_hook\0"
+"masculine\0"
+"Shift_R\0"
+"Hangul_Sios\0"
+"Imacron\0"
+"Hcircumflex\0"
+"Greek_xi\0"
+"Hangul_J_PieubSios\0"
+"Georgian_har\0"
+"CruzeiroSign\0"
+"Armenian_en_dash\0"
+"Ohorn\0"
+"Armenian_KEN\0"
+"Hangul_EO\0"
+"Cyrillic_EF\0"
+"Ecaron\0"
+"ibelowdot\0"
+"Thai_thothahan\0"
+"Uhook\0"
+"Cyrillic_ie\0"
+"w\0"
+"Print\0"
+"Cyrillic_PE\0"
+"ISO_Continuous_Underline\0"
+"Alt_R\0"
+"M\0"
+"minus\0"
+"includes\0"
+"X\0"
+"Greek_IOTAdieresis\0"
+"Arabic_hamza_below\0"
+"Cyrillic_EN_descender\0"
+"Hangul_A\0"
+"Cyrillic_zhe\0"
+"kana_NI\0"
+"ISO_Next_Group_Lock\0"
+"ampersand\0"
+"hebrew_doublelowline\0"
+"Georgian_zen\0"
+"dead_acute\0"
+"Kcedilla\0"
+"botleftsqbracket\0"
+"Ukranian_JE\0"
+"ccedillaabovedot\0"
+"KP_Separator\0"
+"numbersign\0"
+"wgrave\0"
+"Armenian_DA\0"
+"Cyrillic_shcha\0"
+"ediaeresis\0"
+"oe\0"
+"Farsi_9\0"
+"colon\0"
+"ehook\0"
+"plus\0"
+"dagger\0"
+"scaron\0"
+"rcedilla\0"
+"Serbian_JE\0"
+"Hangul_J_Rieul\0"
+"Cyrillic_lje\0"
+"KP_7\0"
+"upstile\0"
+"Alt_L\0"
+"kana_a\0"
+"3270_FieldMark\0"
+"kana_switch\0"
+"Thai_lu\0"
+"Arabic_jeem\0"
+"dead_semivoiced_sound\0"
+"ccaron\0"
+"x\0"
+"FFrancSign\0"
+"Arabic_beh\0"
+"Armenian_RA\0"
+"Eacute\0"
+"PreviousCandidate\0"
+"Arabic_thal\0"
+"R9\0"
+"filledtribulletup\0"
+"Ubelowdot\0"
+"KP_Multiply\0"
+"Greek_mu\0"
+"Thai_nonen\0"
+"twothirds\0"
+"Georgian_hoe\0"
+"vt\0"
+"Serbian_NJE\0"
+"Pointer_DfltBtnNext\0"
+"Korean_Won\0"
+"Cyrillic_I\0"
+"ssharp\0"
+"Armenian_GHAT\0"
+"ff\0"
+"racute\0"
+"Wgrave\0"
+"Ecircumflexacute\0"
+"kana_A\0"
+"Armenian_tso\0"
+"Arabic_shadda\0"
+"AE\0"
+"abovedot\0"
+"Greek_THETA\0"
+"dead_abovering\0"
+"Thai_nonu\0"
+"emfilledcircle\0"
+"R15\0"
+"hebrew_kaph\0"
+"F3\0"
+"eth\0"
+"Serbian_je\0"
+"Gabovedot\0"
+"Armenian_PYUR\0"
+"asciitilde\0"
+"Hangul_YeorinHieuh\0"
+"F2\0"
+"ISO_Level2_Latch\0"
+"Pointer_DblClick_Dflt\0"
+"Pointer_Right\0"
+"Armenian_question\0"
+"Hangul_J_NieunHieuh\0"
+"jot\0"
+"obelowdot\0"
+"Uacute\0"
+"dead_grave\0"
+"R1\0"
+"Thai_honokhuk\0"
+"Arabic_dad\0"
+"Ocaron\0"
+"exclam\0"
+"kana_MA\0"
+"OE\0"
+"implies\0"
+"KP_Add\0"
+"hebrew_kuf\0"
+"Hangul_Hanja\0"
+"Thai_thophuthao\0"
+"Arabic_khah\0"
+"phonographcopyright\0"
+"hebrew_beth\0"
+"F9\0"
+"Acircumflexacute\0"
+"Thai_yoyak\0"
+"quoteleft\0"
+"Greek_OMEGAaccent\0"
+"includedin\0"
+"Georgian_xan\0"
+"r\0"
+"Hangul\0"
+"Ibelowdot\0"
+"botrightsqbracket\0"
+"Cyrillic_che_vertstroke\0"
+"fiveeighths\0"
+"Tcedilla\0"
+"3270_Copy\0"
+"Ncaron\0"
+"Armenian_parenright\0"
+"Ygrave\0"
+"fivesixths\0"
+"Greek_iotaaccent\0"
+"Armenian_ZA\0"
+"Greek_PHI\0"
+"Georgian_hie\0"
+"multiply\0"
+"Acircumflexhook\0"
+"Cyrillic_U_macron\0"
+"Thai_phophan\0"
+"Clear\0"
+"Ecircumflexhook\0"
+"Ukrainian_GHE_WITH_UPTURN\0"
+"Cyrillic_ka_vertstroke\0"
+"leftradical\0"
+"Armenian_VO\0"
+"schwa\0"
+"Cyrillic_A\0"
+"Yacute\0"
+"Cyrillic_u_straight_bar\0"
+"Super_R\0"
+"idotless\0"
+"digitspace\0"
+"eogonek\0"
+"Pointer_Drag5\0"
+"mu\0"
+"underbar\0"
+"KP_Page_Up\0"
+"Arabic_5\0"
+"Greek_gamma\0"
+"Arabic_sheen\0"
+"n\0"
+"Armenian_VYUN\0"
+"etilde\0"
+"Farsi_4\0"
+"onequarter\0"
+"Armenian_ra\0"
+"Armenian_ke\0"
+"ohornhook\0"
+"openstar\0"
+"odiaeresis\0"
+"ETH\0"
+"equal\0"
+"y\0"
+"ENG\0"
+"KP_Home\0"
+"ISO_First_Group_Lock\0"
+"lstroke\0"
+"Armenian_tche\0"
+"Thai_dodek\0"
+"thorn\0"
+"ISO_Emphasize\0"
+"vertconnector\0"
+"variation\0"
+"Mabovedot\0"
+"Hangul_J_RieulPhieuf\0"
+"ecircumflexhook\0"
+"upcaret\0"
+"Thai_khokhwai\0"
+"BackSpace\0"
+"Hangul_E\0"
+"kana_fullstop\0"
+"Hangul_J_Ieung\0"
+"Cyrillic_o_bar\0"
+"tabovedot\0"
+"Armenian_O\0"
+"Meta_R\0"
+"acircumflexgrave\0"
+"Macedonia_GJE\0"
+"udoubleacute\0"
+"hebrew_taw\0"
+"Ediaeresis\0"
+"acircumflex\0"
+"ograve\0"
+"rightcaret\0"
+"utilde\0"
+"hebrew_aleph\0"
+"dead_caron\0"
+"Arabic_8\0"
+"numerosign\0"
+"Etilde\0"
+"comma\0"
+"Greek_ALPHAaccent\0"
+"Abelowdot\0"
+"Greek_omicronaccent\0"
+"topleftparens\0"
+"kana_WO\0"
+"intersection\0"
+"KP_5\0"
+"Acircumflexbelowdot\0"
+"telephone\0"
+"Cyrillic_DE\0"
+"kana_openingbracket\0"
+"quotedbl\0"
+"kana_YA\0"
+"Cyrillic_em\0"
+"hebrew_qoph\0"
+"topleftradical\0"
+"Hangul_J_RieulMieum\0"
+"3270_EraseEOF\0"
+"Cyrillic_ZHE_descender\0"
+"R14\0"
+"Arabic_gaf\0"
+"Return\0"
+"L9\0"
+"Cyrillic_ZE\0"
+"Greek_iota\0"
+"Ugrave\0"
+"Armenian_gim\0"
+"Cyrillic_SOFTSIGN\0"
+"Cyrillic_KA_descender\0"
+"Hangul_SsangSios\0"
+"Hangul_Pieub\0"
+"imacron\0"
+"ncaron\0"
+"union\0"
+"amacron\0"
+"Hangul_OE\0"
+"slash\0"
+"lacute\0"
+"ellipsis\0"
+"Ecircumflextilde\0"
+"First_Virtual_Screen\0"
+"Hangul_J_Phieuf\0"
+"copyright\0"
+"caron\0"
+"atilde\0"
+"Scroll_Lock\0"
+"ISO_Group_Lock\0"
+"Ccedilla\0"
+"Cancel\0"
+"Arabic_0\0"
+"hebrew_waw\0"
+"kana_FU\0"
+"botintegral\0"
+"Pointer_UpRight\0"
+"Thai_sarauee\0"
+"bott\0"
+"Armenian_CHA\0"
+"Yhook\0"
+"toprightparens\0"
+"Home\0"
+"Greek_horizbar\0"
+"Hangul_MultipleCandidate\0"
+"kana_SU\0"
+"Thai_saraaimaimalai\0"
+"Arabic_hamzaonyeh\0"
+"approximate\0"
+"R13\0"
+"Armenian_TCHE\0"
+"uhornhook\0"
+"Greek_psi\0"
+"horizlinescan1\0"
+"hcircumflex\0"
+"Georgian_we\0"
+"Armenian_separation_mark\0"
+"Cyrillic_JE\0"
+"F13\0"
+"kana_o\0"
+"ColonSign\0"
+"xabovedot\0"
+"Hangul_RieulPhieuf\0"
+"topleftsummation\0"
+"kana_conjunctive\0"
+"Arabic_sukun\0"
+"Pointer_DblClick1\0"
+"Thai_sarae\0"
+"Greek_XI\0"
+"Eogonek\0"
+"partialderivative\0"
+"downstile\0"
+"3270_Play\0"
+"ISO_Level3_Latch\0"
+"greaterthanequal\0"
+"Greek_lambda\0"
+"soliddiamond\0"
+"Otilde\0"
+"Hangul_Start\0"
+"F23\0"
+"em4space\0"
+"upleftcorner\0"
+"horizlinescan5\0"
+"semivoicedsound\0"
+"Hangul_WE\0"
+"kana_SO\0"
+"hebrew_het\0"
+"Arabic_feh\0"
+"Pointer_DownLeft\0"
+"zstroke\0"
+"Cyrillic_YA\0"
+"Cyrillic_EN\0"
+"cedilla\0"
+"F12\0"
+"Arabic_hamzaunderalef\0"
+"Odoubleacute\0"
+"KP_Insert\0"
+"femalesymbol\0"
+"Iacute\0"
+"UO\0"
+"Hangul_Khieuq\0"
+"ncedilla\0"
+"Arabic_ghain\0"
+"Thai_moma\0"
+"Greek_UPSILON\0"
+"Arabic_fatha\0"
+"percent\0"
+"Greek_chi\0"
+"Aogonek\0"
+"Kanji_Bangou\0"
+"Armenian_tsa\0"
+"Greek_UPSILONdieresis\0"
+"Cyrillic_el\0"
+"Ucircumflex\0"
+"Arabic_farsi_yeh\0"
+"Codeinput\0"
+"Thai_saraae\0"
+"Hangul_YAE\0"
+"Arabic_heh_doachashmee\0"
+"oneeighth\0"
+"nacute\0"
+"Ukranian_I\0"
+"horizlinescan3\0"
+"Cyrillic_shha\0"
+"hairspace\0"
+"signifblank\0"
+"Hangul_J_SsangKiyeog\0"
+"Hyper_R\0"
+"R2\0"
+"scedilla\0"
+"R6\0"
+"Greek_IOTAaccent\0"
+"kana_KA\0"
+"L6\0"
+"Ccircumflex\0"
+"Greek_BETA\0"
+"Arabic_rreh\0"
+"Adiaeresis\0"
+"Pointer_Drag2\0"
+"Gtilde\0"
+"Greek_iotadieresis\0"
+"kana_O\0"
+"Fabovedot\0"
+"Thai_choching\0"
+"Arabic_damma\0"
+"telephonerecorder\0"
+"hebrew_samech\0"
+"hebrew_finalzadi\0"
+"Hangul_J_RieulPieub\0"
+"7\0"
+"Thai_sorusi\0"
+"Farsi_8\0"
+"Thai_lekchet\0"
+"tcedilla\0"
+"gbreve\0"
+"Cyrillic_EM\0"
+"bracketleft\0"
+"Farsi_5\0"
+"aring\0"
+"idiaeresis\0"
+"leftopentriangle\0"
+"Thai_phinthu\0"
+"Armenian_o\0"
+"Thai_nikhahit\0"
+"Rcaron\0"
+"Georgian_jil\0"
+"plusminus\0"
+"Hangul_SsangPieub\0"
+"z\0"
+"Armenian_VEV\0"
+"AccessX_Feedback_Enable\0"
+"Ehook\0"
+"hebrew_bet\0"
+"ecircumflexacute\0"
+"Agrave\0"
+"Armenian_GIM\0"
+"lcaron\0"
+"Greek_alpha\0"
+"Hangul_YE\0"
+"kana_tsu\0"
+"nl\0"
+"F20\0"
+"lf\0"
+"topintegral\0"
+"Hangul_Phieuf\0"
+"Armenian_BEN\0"
+"Georgian_fi\0"
+"C\0"
+"ycircumflex\0"
+"3270_PrintScreen\0"
+"Armenian_ZHE\0"
+"Hangul_PreviousCandidate\0"
+"Hangul_Cieuc\0"
+"Katakana\0"
+"Armenian_da\0"
+"3270_Record\0"
+"Hangul_WA\0"
+"Ohorngrave\0"
+"prolongedsound\0"
+"Cyrillic_BE\0"
+"Ihook\0"
+"section\0"
+"Ccaron\0"
+"Control_L\0"
+"Ytilde\0"
+"Serbian_LJE\0"
+"AudibleBell_Enable\0"
+"logicalor\0"
+"wdiaeresis\0"
+"Hangul_RieulTieut\0"
+"Cyrillic_ka\0"
+"Cyrillic_IE\0"
+"ooblique\0"
+"Arabic_peh\0"
+"voicedsound\0"
+"Thai_maihanakat\0"
+"Pointer_DownRight\0"
+"Greek_ZETA\0"
+"Hankaku\0"
+"Armenian_FE\0"
+"u\0"
+"Cyrillic_U_straight_bar\0"
+"latincross\0"
+"Armenian_ken\0"
+"Arabic_7\0"
+"Cyrillic_HA_descender\0"
+"Armenian_parenleft\0"
+"Arabic_veh\0"
+"a\0"
+"Ahook\0"
+"Greek_GAMMA\0"
+"ISO_Prev_Group\0"
+"Hangul_Banja\0"
+"Farsi_3\0"
+"Hangul_J_Mieum\0"
+"Armenian_E\0"
+"Terminate_Server\0"
+"Arabic_semicolon\0"
+"adiaeresis\0"
+"Thai_baht\0"
+"Udoubleacute\0"
+"Cyrillic_O_bar\0"
+"Thai_sosua\0"
+"Ukrainian_yi\0"
+"Hangul_RieulPieub\0"
+"Thai_bobaimai\0"
+"Page_Down\0"
+"Greek_upsilonaccent\0"
+"Greek_theta\0"
+"hebrew_pe\0"
+"Armenian_to\0"
+"Prior\0"
+"Zenkaku_Hankaku\0"
+"KP_Enter\0"
+"Georgian_phar\0"
+"Cyrillic_YU\0"
+"Armenian_HO\0"
+"Cyrillic_HA\0"
+"kana_middledot\0"
+"Thai_thothan\0"
+"3270_KeyClick\0"
+"Cyrillic_ya\0"
+"KP_Begin\0"
+"Hangul_J_SsangSios\0"
+"Arabic_jeh\0"
+"Greek_UPSILONaccent\0"
+"Armenian_sha\0"
+"dead_iota\0"
+"Hangul_YEO\0"
+"AccessX_Enable\0"
+"Armenian_vev\0"
+"Odiaeresis\0"
+"openrectbullet\0"
+"Tcaron\0"
+"Cyrillic_ef\0"
+"Thai_lekhok\0"
+"onehalf\0"
+"Q\0"
+"Thai_lekkao\0"
+"Arabic_comma\0"
+"Henkan\0"
+"currency\0"
+"Pointer_Button3\0"
+"Thai_thothung\0"
+"heart\0"
+"Hangul_RieulKiyeog\0"
+"Armenian_guillemotleft\0"
+"Zen_Koho\0"
+"Ycircumflex\0"
+"Cacute\0"
+"Ooblique\0"
+"kana_u\0"
+"Greek_tau\0"
+"Cyrillic_ka_descender\0"
+"underscore\0"
+"Muhenkan\0"
+"ifonlyif\0"
+"Acircumflex\0"
+"Select\0"
+"lefttack\0"
+"WonSign\0"
+"KP_Tab\0"
+"Greek_OMICRON\0"
+"F27\0"
+"ebelowdot\0"
+"checkmark\0"
+"Insert\0"
+"Thai_saraue\0"
+"ohorngrave\0"
+"hebrew_chet\0"
+"3270_ExSelect\0"
+"Ebelowdot\0"
+"Hangul_YO\0"
+"Pointer_DfltBtnPrev\0"
+"Armenian_pe\0"
+"dead_macron\0"
+"Ecircumflex\0"
+"Greek_accentdieresis\0"
+"Serbian_lje\0"
+"Hangul_Tieut\0"
+"Lstrokebelowdot\0"
+"emacron\0"
+"topt\0"
+"Rcedilla\0"
+"Lcaron\0"
+"Hangul_J_Khieuq\0"
+"hyphen\0"
+"kana_TA\0"
+"Cyrillic_nje\0"
+"lowrightcorner\0"
+"Ybelowdot\0"
+"T\0"
+"twofifths\0"
+"Armenian_nu\0"
+"F14\0"
+"Thai_sarauu\0"
+"End\0"
+"wacute\0"
+"ygrave\0"
+"overbar\0"
+"Qabovedot\0"
+"Cyrillic_GHE_bar\0"
+"ydiaeresis\0"
+"SingleCandidate\0"
+"Thai_maiek\0"
+"Arabic_hamzaonwaw\0"
+"Hangul_Special\0"
+"eng\0"
+"kana_tu\0"
+"nobreakspace\0"
+"Cyrillic_zhe_descender\0"
+"Armenian_PE\0"
+"Arabic_lam\0"
+"Hangul_Jieuj\0"
+"3270_Test\0"
+"Lbelowdot\0"
+"Ohornbelowdot\0"
+"R10\0"
+"uhook\0"
+"ISO_Partial_Line_Down\0"
+"ISO_Fast_Cursor_Left\0"
+"Zacute\0"
+"Georgian_tan\0"
+"L7\0"
+"Armenian_AYB\0"
+"Cyrillic_SHORTI\0"
+"Armenian_LYUN\0"
+"careof\0"
+"Ohorntilde\0"
+"Thai_popla\0"
+"hebrew_dalet\0"
+"sterling\0"
+"Cyrillic_es\0"
+"Pointer_Accelerate\0"
+"Amacron\0"
+"Armenian_vyun\0"
+"Arabic_ddal\0"
+"Cyrillic_LJE\0"
+"Cyrillic_I_macron\0"
+"Hangul_I\0"
+"L8\0"
+"Greek_epsilonaccent\0"
+"Armenian_lyun\0"
+"Greek_RHO\0"
+"Dcaron\0"
+"agrave\0"
+"Pointer_Button2\0"
+"Cyrillic_io\0"
+"R3\0"
+"F19\0"
+"Cyrillic_o\0"
+"enfilledcircbullet\0"
+"f\0"
+"ugrave\0"
+"Hangul_YI\0"
+"Undo\0"
+"ccedilla\0"
+"KP_Right\0"
+"H\0"
+"Gcaron\0"
+"botvertsummationconnector\0"
+"Cyrillic_ve\0"
+"ubelowdot\0"
+"kana_ya\0"
+"apostrophe\0"
+"kana_HO\0"
+"Jcircumflex\0"
+"Ukranian_i\0"
+"Arabic_percent\0"
+"Cyrillic_KA_vertstroke\0"
+"kana_NU\0"
+"botleftparens\0"
+"Macedonia_DSE\0"
+"Thai_thonangmontho\0"
+"threefifths\0"
+"hebrew_resh\0"
+"j\0"
+"Greek_LAMDA\0"
+"doubledagger\0"
+"iogonek\0"
+"Abreve\0"
+"gcaron\0"
+"singlelowquotemark\0"
+"KP_End\0"
+"F24\0"
+"Greek_omicron\0"
+"itilde\0"
+"Idiaeresis\0"
+"F8\0"
+"F33\0"
+"Meta_L\0"
+"kana_WA\0"
+"Hangul_J_Hieuh\0"
+"cr\0"
+"Armenian_verjaket\0"
+"semicolon\0"
+"Pointer_Up\0"
+"Armenian_SHA\0"
+"Cyrillic_sha\0"
+"Cyrillic_en\0"
+"aogonek\0"
+"Arabic_tah\0"
+"Armenian_e\0"
+"hebrew_zayin\0"
+"Uhorngrave\0"
+"hexagram\0"
+"kappa\0"
+"paragraph\0"
+"at\0"
+"combining_grave\0"
+"icircumflex\0"
+"Hangul_PostHanja\0"
+"kana_NE\0"
+"Eisu_toggle\0"
+"dead_doubleacute\0"
+"Udiaeresis\0"
+"Pointer_Button5\0"
+"Omacron\0"
+"Arabic_tcheh\0"
+"kana_SHI\0"
+"Abrevegrave\0"
+"dead_breve\0"
+"Georgian_ban\0"
+"Armenian_men\0"
+"kana_yo\0"
+"Hangul_SingleCandidate\0"
+"F34\0"
+"combining_acute\0"
+"Arabic_question_mark\0"
+"thinspace\0"
+"KP_Page_Down\0"
+"ISO_Release_Margin_Left\0"
+"signaturemark\0"
+"dead_horn\0"
+"3270_CursorBlink\0"
+"enopensquarebullet\0"
+"sacute\0"
+"kana_KO\0"
+"Greek_eta\0"
+"backslash\0"
+"uprightcorner\0"
+"ocaron\0"
+"toprightsqbracket\0"
+"Armenian_but\0"
+"Georgian_khar\0"
+"ocircumflex\0"
+"Thai_sarao\0"
+"3270_Ident\0"
+"Egrave\0"
+"Cyrillic_U\0"
+"parenright\0"
+"Hangul_J_KkogjiDalrinIeung\0"
+"Armenian_accent\0"
+"Page_Up\0"
+"ybelowdot\0"
+"Greek_kappa\0"
+"Uhorn\0"
+"macron\0"
+"Georgian_kan\0"
+"Iogonek\0"
+"abreve\0"
+"Hangul_KiyeogSios\0"
+"rcaron\0"
+"Armenian_INI\0"
+"3270_CursorSelect\0"
+"emopenrectangle\0"
+"Arabic_meem\0"
+"onefifth\0"
+"cacute\0"
+"uhorntilde\0"
+"Greek_alphaaccent\0"
+"Cyrillic_softsign\0"
+"radical\0"
+"kana_e\0"
+"kana_HI\0"
+"Emacron\0"
+"F1\0"
+"PesetaSign\0"
+"3270_PA1\0"
+"Ohornhook\0"
+"ISO_Group_Latch\0"
+"kana_CHI\0"
+"Georgian_vin\0"
+"6\0"
+"b\0"
+"Armenian_exclam\0"
+"ISO_Partial_Line_Up\0"
+"twosuperior\0"
+"wcircumflex\0"
+"ohornbelowdot\0"
+"Next\0"
+"Cyrillic_KA\0"
+"Gcedilla\0"
+"ISO_Release_Both_Margins\0"
+"F18\0"
+"Ukrainian_ie\0"
+"KP_Prior\0"
+"cursor\0"
+"Armenian_tyun\0"
+"Georgian_rae\0"
+"Armenian_RE\0"
+"Arabic_yeh_baree\0"
+"abrevegrave\0"
+"L5\0"
+"Itilde\0"
+"Romaji\0"
+"kana_RE\0"
+"Hangul_O\0"
+"kana_RI\0"
+"ecircumflextilde\0"
+"Pointer_Drag1\0"
+"Arabic_ha\0"
+"leftpointer\0"
+"combining_tilde\0"
+"Lstroke\0"
+"kana_ME\0"
+"Arabic_2\0"
+"onethird\0"
+"Thai_maitri\0"
+"Pabovedot\0"
+"Farsi_6\0"
+"Cyrillic_CHE_vertstroke\0"
+"Pointer_DblClick2\0"
+"Arabic_heh_goal\0"
+"KP_2\0"
+"Thai_maichattawa\0"
+"Cyrillic_ghe_bar\0"
+"Georgian_ghan\0"
+"cent\0"
+"e\0"
+"breve\0"
+"braceleft\0"
+"Hyper_L\0"
+"Thai_rorua\0"
+"dcaron\0"
+"kana_RA\0"
+"R11\0"
+"k\0"
+"Greek_upsilonaccentdieresis\0"
+"minutes\0"
+"rightarrow\0"
+"Cyrillic_DZHE\0"
+"similarequal\0"
+"hebrew_samekh\0"
+"fourfifths\0"
+"emdash\0"
+"hebrew_daleth\0"
+"Hangul_J_Kiyeog\0"
+"ISO_Move_Line_Down\0"
+"Georgian_on\0"
+"Georgian_en\0"
+"Greek_ETA\0"
+"Eth\0"
+"F21\0"
+"h\0"
+"L\0"
+"Greek_phi\0"
+"cabovedot\0"
+"blank\0"
+"Cyrillic_SHA\0"
+"hebrew_taf\0"
+"Armenian_section_sign\0"
+"Arabic_tehmarbuta\0"
+"Cyrillic_TE\0"
+"Hangul_SsangDikeud\0"
+"Armenian_ben\0"
+"Serbian_tshe\0"
+"Multi_key\0"
+"Armenian_dza\0"
+"t\0"
+"U\0"
+"Georgian_chin\0"
+"KP_Space\0"
+"Scedilla\0"
+"Arabic_switch\0"
+"abrevebelowdot\0"
+"Arabic_maddaonalef\0"
+"Arabic_zah\0"
+"acircumflextilde\0"
+"Thai_ru\0"
+"downshoe\0"
+"Armenian_ayb\0"
+"Aacute\0"
+"enopencircbullet\0"
+"Thai_chochang\0"
+"Ccedillaabovedot\0"
+"F17\0"
+"Mode_switch\0"
+"Z\0"
+"Farsi_0\0"
+"Tslash\0"
+"Armenian_ho\0"
+"Hangul_J_Sios\0"
+"ocircumflexbelowdot\0"
+"Hiragana\0"
+"Hangul_U\0"
+"bracketright\0"
+"ocircumflexacute\0"
+"v\0"
+"Thorn\0"
+"Shift_Lock\0"
+"ISO_Partial_Space_Left\0"
+"yacute\0"
+"MouseKeys_Accel_Enable\0"
+"greater\0"
+"kana_RO\0"
+"s\0"
+"hebrew_he\0"
+"ISO_Move_Line_Up\0"
+"Greek_ALPHA\0"
+"Hangul_J_Dikeud\0"
+"R4\0"
+"Arabic_heh\0"
+"dead_abovedot\0"
+"J\0"
+"Georgian_san\0"
+"gcedilla\0"
+"Cyrillic_tse\0"
+"Georgian_don\0"
+"Thai_kokai\0"
+"rightopentriangle\0"
+"dead_tilde\0"
+"Caps_Lock\0"
+"Arabic_fathatan\0"
+"Thai_wowaen\0"
+"obarred\0"
+"Arabic_4\0"
+"dollar\0"
+"Cyrillic_YERU\0"
+"Greek_beta\0"
+"KP_Equal\0"
+"guillemotright\0"
+"Thai_lekpaet\0"
+"Cyrillic_HARDSIGN\0"
+"onesixth\0"
+"R12\0"
+"Arabic_hamzaonalef\0"
+"Hangul_J_RieulTieut\0"
+"Hangul_SsangKiyeog\0"
+"Hangul_Hieuh\0"
+"Ukranian_yi\0"
+"Greek_KAPPA\0"
+"Armenian_HI\0"
+"Cyrillic_je\0"
+"Arabic_tteh\0"
+"uparrow\0"
+"uacute\0"
+"lowleftcorner\0"
+"Serbian_DZE\0"
+"Cyrillic_ha\0"
+"Cyrillic_U_straight\0"
+"Y\0"
+"braceright\0"
+"ISO_Release_Margin_Right\0"
+"Armenian_ghat\0"
+"3270_Enter\0"
+"kana_KI\0"
+"Hangul_J_PanSios\0"
+"Thai_paiyannoi\0"
+"F15\0"
+"D\0"
+"Armenian_fe\0"
+"Greek_epsilon\0"
+"Arabic_9\0"
+"Greek_OMEGA\0"
+"ISO_Fast_Cursor_Down\0"
+"Pointer_DblClick3\0"
+"Armenian_KHE\0"
+"Armenian_paruyk\0"
+"Mae_Koho\0"
+"filledlefttribullet\0"
+"NewSheqelSign\0"
+"Greek_omegaaccent\0"
+"Uhornbelowdot\0"
+"Georgian_tar\0"
+"Thai_thothong\0"
+"ie\0"
+"Armenian_ligature_ew\0"
+"emfilledrect\0"
+"Kanji\0"
+"kana_TO\0"
+"division\0"
+"Ograve\0"
+"MultipleCandidate\0"
+"Ohook\0"
+"leftt\0"
+"F10\0"
+"Arabic_alefmaksura\0"
+"quoteright\0"
+"Cyrillic_u_macron\0"
+"Armenian_YECH\0"
+"kana_i\0"
+"Thai_saraam\0"
+"R8\0"
+"ISO_Set_Margin_Left\0"
+"g\0"
+"ISO_Left_Tab\0"
+"guillemotleft\0"
+"Thai_khokhai\0"
+"VoidSymbol\0"
+"W\0"
+"N\0"
+"kcedilla\0"
+"Cyrillic_i\0"
+"Igrave\0"
+"ISO_Fast_Cursor_Up\0"
+"Arabic_kasra\0"
+"Hangul_J_Cieuc\0"
+"gtilde\0"
+"KP_Divide\0"
+"Armenian_dot\0"
+"zcaron\0"
+"R5\0"
+"3270_Attn\0"
+"upshoe\0"
+"umacron\0"
+"IE\0"
+"Babovedot\0"
+"Cyrillic_SHCHA\0"
+"lessthanequal\0"
+"Greek_NU\0"
+"lstrokebelowdot\0"
+"doublelowquotemark\0"
+"Cyrillic_e\0"
+"Greek_omega\0"
+"F\0"
+"Thai_dochada\0"
+"Thai_phophung\0"
+"Pointer_EnableKeys\0"
+"Cyrillic_hardsign\0"
+"Acircumflextilde\0"
+"dabovedot\0"
+"Armenian_at\0"
+"gabovedot\0"
+"Pointer_Down\0"
+"KP_Delete\0"
+"DongSign\0"
+"Thai_hohip\0"
+"B\0"
+"ubreve\0"
+"Greek_PSI\0"
+"Lcedilla\0"
+"leftcaret\0"
+"script_switch\0"
+"Touroku\0"
+"Kana_Shift\0"
+"Arabic_yeh\0"
+"topleftsqbracket\0"
+"Greek_nu\0"
+"odoubleacute\0"
+"doubbaselinedot\0"
+"igrave\0"
+"yen\0"
+"Ukranian_YI\0"
+"ocircumflextilde\0"
+"3270_Left2\0"
+"kana_YU\0"
+"Georgian_hae\0"
+"onesuperior\0"
+"ISO_First_Group\0"
+"Ecircumflexbelowdot\0"
+"kana_MU\0"
+"3270_DeleteWord\0"
+"Ukrainian_IE\0"
+"Pointer_Left\0"
+"Armenian_je\0"
+"L4\0"
+"Armenian_cha\0"
+"musicalsharp\0"
+"Macedonia_gje\0"
+"Greek_OMICRONaccent\0"
+"gcircumflex\0"
+"Arabic_6\0"
+"Greek_zeta\0"
+"Cyrillic_SHHA\0"
+"Kana_Lock\0"
+"Wacute\0"
+"kana_TSU\0"
+"F4\0"
+"Thai_saraaimaimuan\0"
+"F7\0"
+"Atilde\0"
+"Armenian_yentamna\0"
+"dead_cedilla\0"
+"O\0"
+"Cyrillic_TSE\0"
+"Umacron\0"
+"Hangul_AraeAE\0"
+"hebrew_yod\0"
+"Abreveacute\0"
+"Ocircumflexgrave\0"
+"ISO_Group_Shift\0"
+"diamond\0"
+"Armenian_guillemotright\0"
+"scircumflex\0"
+"Hangul_YU\0"
+"lcedilla\0"
+"Cyrillic_en_descender\0"
+"Redo\0"
+"question\0"
+"R7\0"
+"Begin\0"
+"Arabic_dal\0"
+"Pointer_UpLeft\0"
+"acute\0"
+"Hangul_RieulHieuh\0"
+"kana_TE\0"
+"Zstroke\0"
+"Cyrillic_che_descender\0"
+"Cyrillic_E\0"
+"Georgian_can\0"
+"Thai_fofan\0"
+"F22\0"
+"integral\0"
+"Left\0"
+"Hangul_Kiyeog\0"
+"Ukrainian_YI\0"
+"ecircumflex\0"
+"Menu\0"
+"KP_Next\0"
+"Arabic_ain\0"
+"Pointer_DblClick4\0"
+"kra\0"
+"Georgian_shin\0"
+"KP_9\0"
+"uogonek\0"
+"seconds\0"
+"Arabic_kasratan\0"
+"Georgian_in\0"
+"Hangul_Rieul\0"
+"P\0"
+"F35\0"
+"Armenian_TYUN\0"
+"Armenian_shesht\0"
+"Hangul_YA\0"
+"Arabic_superscript_alef\0"
+"Thai_maihanakat_maitho\0"
+"L2\0"
+"5\0"
+"ISO_Enter\0"
+"m\0"
+"acircumflexhook\0"
+"Cyrillic_VE\0"
+"periodcentered\0"
+"Hangul_RieulYeorinHieuh\0"
+"Hangul_J_Jieuj\0"
+"Uhornhook\0"
+"Cyrillic_ES\0"
+"Macedonia_KJE\0"
+"Pointer_Button4\0"
+"Ocircumflex\0"
+"Iabovedot\0"
+"Armenian_TO\0"
+"Byelorussian_shortu\0"
+"q\0"
+"8\0"
+"Cyrillic_EL\0"
+"Armenian_se\0"
+"Armenian_JE\0"
+"enfilledsqbullet\0"
+"Hangul_End\0"
+"hstroke\0"
+"Thai_lekha\0"
+"Greek_switch\0"
+"F30\0"
+"oacute\0"
+"abrevetilde\0"
+"Ohornacute\0"
+"F25\0"
+"babovedot\0"
+"ISO_Last_Group\0"
+"Last_Virtual_Screen\0"
+"combining_belowdot\0"
+"Gbreve\0"
+"uring\0"
+"Serbian_TSHE\0"
+"topvertsummationconnector\0"
+"Thai_leksun\0"
+"E\0"
+"tcaron\0"
+"Hangul_J_Pieub\0"
+"Sys_Req\0"
+"function\0"
+"Escape\0"
+"botrightparens\0"
+"Prev_Virtual_Screen\0"
+"Georgian_nar\0"
+"Hstroke\0"
+"Scircumflex\0"
+"oslash\0"
+"Thai_sarau\0"
+"Greek_upsilon\0"
+"Arabic_hah\0"
+"Hangul_J_RieulKiyeog\0"
+"therefore\0"
+"Armenian_NU\0"
+"Thai_phosamphao\0"
+"dead_diaeresis\0"
+"hebrew_finalpe\0"
+"Thai_loling\0"
+"ecircumflexbelowdot\0"
+"Thai_sosala\0"
+"KP_F4\0"
+"KP_3\0"
+"enspace\0"
+"Arabic_alef\0"
+"em3space\0"
+"Ocircumflexacute\0"
+"Abrevetilde\0"
+"Xabovedot\0"
+"kana_MI\0"
+"Ncedilla\0"
+"circle\0"
+"Racute\0"
+"G\0"
+"Thai_oang\0"
+"3\0"
+"period\0"
+"hebrew_teth\0"
+"Cabovedot\0"
+"righttack\0"
+"Hangul_SunkyeongeumPieub\0"
+"Arabic_teh\0"
+"hebrew_mem\0"
+"checkerboard\0"
+"Cyrillic_ha_descender\0"
+"exclamdown\0"
+"Ukrainian_I\0"
+"3270_Setup\0"
+"dead_hook\0"
+"ahook\0"
+"Pointer_Drag4\0"
+"KP_Decimal\0"
+"Thai_chochoe\0"
+"ocircumflexhook\0"
+"less\0"
+"Georgian_man\0"
+"diaeresis\0"
+"questiondown\0"
+"Armenian_ellipsis\0"
+"2\0"
+"4\0"
+"hebrew_shin\0"
+"seveneighths\0"
+"kana_U\0"
+"Hangul_NieunJieuj\0"
+"Greek_IOTA\0"
+"Massyo\0"
+"quad\0"
+"L1\0"
+"3270_Jump\0"
+"Cyrillic_GHE\0"
+"F32\0"
+"1\0"
+"Thai_khorakhang\0"
+"Uhorntilde\0"
+"Oacute\0"
+"Arabic_noon_ghunna\0"
+"Armenian_zhe\0"
+"Oslash\0"
+"Cyrillic_che\0"
+"Armenian_vo\0"
+"Cyrillic_yeru\0"
+"Pointer_Drag3\0"
+"Tabovedot\0"
+"dstroke\0"
+"Thai_chochan\0"
+"KP_Down\0"
+"brokenbar\0"
+"Ecircumflexgrave\0"
+"Armenian_AT\0"
+"logicaland\0"
+"Armenian_za\0"
+"Zcaron\0"
+"Ukrainian_i\0"
+"Arabic_hamza\0"
+"toprightsummation\0"
+"F11\0"
+"Aring\0"
+"Greek_SIGMA\0"
+"emopencircle\0"
+"zabovedot\0"
+"ISO_Next_Group\0"
+"L3\0"
+"Thai_maitho\0"
+"Ocircumflexbelowdot\0"
+"Hangul_WAE\0"
+"zacute\0"
+"3270_PA3\0"
+"horizlinescan7\0"
+"KP_6\0"
+"qabovedot\0"
+"abelowdot\0"
+"Cyrillic_te\0"
+"leftshoe\0"
+"Arabic_3\0"
+"Armenian_pyur\0"
+"hebrew_gimmel\0"
+"hebrew_finalzade\0"
+"musicalflat\0"
+"Hangul_Mieum\0"
+"L10\0"
+"notequal\0"
+"bar\0"
+"hebrew_zain\0"
+"leftdoublequotemark\0"
+"Arabic_dammatan\0"
+"SCHWA\0"
+"Execute\0"
+"Hangul_PreHanja\0"
+"KP_1\0"
+"ocircumflexgrave\0"
+"ihook\0"
+"R\0"
+"Utilde\0"
+"d\0"
+"kana_SE\0"
+"Armenian_hyphen\0"
+"Hangul_switch\0"
+"F31\0"
+"Serbian_DJE\0"
+"trademark\0"
+"Greek_MU\0"
+"asciicircum\0"
+"THORN\0"
+"Thai_leksong\0"
+"RepeatKeys_Enable\0"
+"Hangul_J_RieulSios\0"
+"Control_R\0"
+"Help\0"
+"Arabic_theh\0"
+"A\0"
+"NairaSign\0"
+"Arabic_zain\0"
+"filledrighttribullet\0"
+"F29\0"
+"Thai_ngongu\0"
+"3270_EraseInput\0"
+"Thai_lakkhangyao\0"
+"figdash\0"
+"omacron\0"
+"Nacute\0"
+"Farsi_1\0"
+"Cyrillic_SCHWA\0"
+"ytilde\0"
+"kana_HA\0"
+"Armenian_comma\0"
+"ordfeminine\0"
+"Hebrew_switch\0"
+"Lacute\0"
+"Farsi_2\0"
+"V\0"
+"KP_4\0"
+"dead_belowdot\0"
+"ohook\0"
+"p\0"
+"Macedonia_dse\0"
+"Super_L\0"
+"EuroSign\0"
+"RupeeSign\0"
+"trademarkincircle\0"
+"3270_AltCursor\0"
+"Gcircumflex\0"
+"hebrew_finalmem\0"
+"Thai_thanthakhat\0"
+"Arabic_keheh\0"
+"ecaron\0"
+"Tab\0"
+"ccircumflex\0"
+"MillSign\0"
+"botrightsummation\0"
+"Hiragana_Katakana\0"
+"Ntilde\0"
+"mabovedot\0"
+"Armenian_TSA\0"
+"ISO_Level3_Shift\0"
+"3270_Reset\0"
+"EcuSign\0"
+"Hangul_Ieung\0"
+"threequarters\0"
+"3270_Duplicate\0"
+"Thai_leksi\0"
+"Cyrillic_a\0"
+"Up\0"
+"Cyrillic_i_macron\0"
+"egrave\0"
+"Macedonia_kje\0"
+"eabovedot\0"
+"identical\0"
+"StickyKeys_Enable\0"
+"caret\0"
+"kana_KE\0"
+"Uring\0"
+"Num_Lock\0"
+"dead_circumflex\0"
+"ISO_Last_Group_Lock\0"
+"BounceKeys_Enable\0"
+"ogonek\0"
+"Georgian_he\0"
+"pabovedot\0"
+"fabovedot\0"
+"Armenian_full_stop\0"
+"Hangul_WEO\0"
+"Hangul_AE\0"
+"3270_Rule\0"
+"LiraSign\0"
+"3270_ChangeScreen\0"
+"Uogonek\0"
+"Armenian_amanak\0"
+"Thai_fofa\0"
+"KP_0\0"
+"3270_BackTab\0"
+"Greek_EPSILONaccent\0"
+"ibreve\0"
+"Ubreve\0"
+"decimalpoint\0"
+"Ydiaeresis\0"
+"Cyrillic_be\0"
+"Arabic_1\0"
+"ohorn\0"
+"rightmiddlesummation\0"
+"Greek_pi\0"
+"Thai_yoying\0"
+"ISO_Partial_Space_Right\0"
+"Ukranian_je\0"
+"Hangul_AraeA\0"
+"Greek_rho\0"
+"dead_ogonek\0"
+"Zabovedot\0"
+"KP_Left\0"
+"Cyrillic_ER\0"
+"Eabovedot\0"
+"Greek_CHI\0"
+"abrevehook\0"
+"Eisu_Shift\0"
+"Zenkaku\0"
+"Down\0"
+"KP_F1\0"
+"Arabic_hamza_above\0"
+"kana_YO\0"
+"space\0"
+"ISO_Lock\0"
+"hebrew_finalkaph\0"
+"MouseKeys_Enable\0"
+"Greek_etaaccent\0"
+"leftarrow\0"
+"malesymbol\0"
+"Sacute\0"
+"eacute\0"
+"hebrew_nun\0"
+"kana_NO\0"
+"registered\0"
+"uo\0"
+"Cyrillic_u\0"
+"downtack\0"
+"Cyrillic_pe\0"
+"Cyrillic_O\0"
+"kana_SA\0"
+"F6\0"
+"Pointer_Button1\0"
+"Hangul_Jeonja\0"
+"Hangul_SunkyeongeumMieum\0"
+"Hangul_J_RieulHieuh\0"
+"udiaeresis\0"
+"Farsi_yeh\0"
+"Next_Virtual_Screen\0"
+"Georgian_qar\0"
+"Arabic_waw\0"
+"iacute\0"
+"jcircumflex\0"
+"Obelowdot\0"
+"rightmiddlecurlybrace\0"
+"doubleacute\0"
+"hebrew_gimel\0"
+"Thai_khokhuat\0"
+"Greek_LAMBDA\0"
+"overline\0"
+"KP_F2\0"
+"o\0"
+"uhorngrave\0"
+"Hangul_EU\0"
+"F16\0"
+"Thai_maiyamok\0"
+"Arabic_seen\0"
+"Hangul_KkogjiDalrinIeung\0"
+"dead_voiced_sound\0"
+"Acircumflexgrave\0"
+"Byelorussian_SHORTU\0"
+"rightsinglequotemark\0"
+"Pointer_Button_Dflt\0"
+"endash\0"
+"Ukrainian_ghe_with_upturn\0"
+"lbelowdot\0"
+"Arabic_noon\0"
+"Arabic_ra\0"
+"Thai_totao\0"
+"Armenian_re\0"
+"kana_HU\0"
+"vertbar\0"
+"kana_KU\0"
+"ISO_Discontinuous_Underline\0"
+"Greek_PI\0"
+"kana_TI\0"
+"Armenian_yech\0"
+"Cyrillic_dzhe\0"
+"kana_NA\0"
+"notsign\0"
+"Right\0"
+"abreveacute\0"
+"ohornacute\0"
+"Ocircumflexhook\0"
+"uptack\0"
+"Farsi_7\0"
+"filledrectbullet\0"
+"Arabic_sad\0"
+"Thai_lochula\0"
+"rightshoe\0"
+"Armenian_em_dash\0"
+"Cyrillic_CHE\0"
+"Sabovedot\0"
+"Serbian_dje\0"
+"Serbian_nje\0"
+"leftmiddlecurlybrace\0"
+"filledtribulletdown\0"
+"Shift_L\0"
+"Georgian_jhan\0"
+"kana_TU\0"
+"Pointer_Drag_Dflt\0"
+"K\0"
+"threesuperior\0"
+"Greek_IOTAdiaeresis\0"
+"Hangul_J_Nieun\0"
+"Dabovedot\0";
+
+static const unsigned short ks_name_offsets[KSNAMES] = {
+0x0000, 0x000d, 0x0018, 0x001a, 0x002c, 0x0045, 0x004d, 0x0061,
+0x0067, 0x006a, 0x007e, 0x0090, 0x009c, 0x00a4, 0x00b5, 0x00bd,
+0x00c8, 0x00d5, 0x00e0, 0x00e2, 0x00ec, 0x00fc, 0x0107, 0x0114,
+0x0128, 0x0137, 0x0147, 0x0153, 0x0165, 0x0171, 0x017d, 0x0189,
+0x0192, 0x01a8, 0x01aa, 0x01b7, 0x01c3, 0x01cb, 0x01d8, 0x01e5,
+0x01fa, 0x0207, 0x0213, 0x0219, 0x0226, 0x023c, 0x0243, 0x0247,
+0x0253, 0x025a, 0x0261, 0x0268, 0x0275, 0x0283, 0x0291, 0x029d,
+0x02a9, 0x02af, 0x02b1, 0x02c4, 0x02cd, 0x02d8, 0x02ea, 0x02f7,
+0x02ff, 0x0302, 0x0308, 0x0313, 0x0324, 0x0330, 0x0336, 0x0347,
+0x0352, 0x035e, 0x036e, 0x0385, 0x0392, 0x039e, 0x03a9, 0x03b0,
+0x03b7, 0x03c3, 0x03ca, 0x03d6, 0x03d8, 0x03dc, 0x03e9, 0x03fb,
+0x0402, 0x0404, 0x0415, 0x0427, 0x042e, 0x043a, 0x043f, 0x044e,
+0x045a, 0x046e, 0x0473, 0x047e, 0x0484, 0x0494, 0x04a0, 0x04ad,
+0x04bb, 0x04ca, 0x04d6, 0x04e5, 0x04f2, 0x04fe, 0x050e, 0x051b,
+0x052c, 0x053a, 0x0548, 0x0550, 0x055f, 0x0562, 0x056c, 0x0580,
+0x058c, 0x059d, 0x05af, 0x05bb, 0x05cc, 0x05d9, 0x05eb, 0x0600,
+0x0614, 0x061b, 0x0627, 0x0633, 0x063e, 0x0648, 0x064f, 0x0659,
+0x0669, 0x0675, 0x0683, 0x0690, 0x0697, 0x06a1, 0x06ad, 0x06bc,
+0x06c9, 0x06cb, 0x06d8, 0x06ed, 0x06f9, 0x0701, 0x0712, 0x0723,
+0x0730, 0x073b, 0x0742, 0x074c, 0x075c, 0x0776, 0x0786, 0x0792,
+0x07a8, 0x07b1, 0x07c5, 0x07d4, 0x07e4, 0x07ee, 0x07fc, 0x0802,
+0x080e, 0x081d, 0x0822, 0x0836, 0x083f, 0x084c, 0x0852, 0x085d,
+0x0867, 0x0876, 0x0880, 0x0888, 0x0894, 0x089c, 0x08a8, 0x08b1,
+0x08c4, 0x08d1, 0x08de, 0x08ef, 0x08f5, 0x0902, 0x090c, 0x0918,
+0x091f, 0x0929, 0x0938, 0x093e, 0x094a, 0x094c, 0x0952, 0x095e,
+0x0977, 0x097d, 0x097f, 0x0985, 0x098e, 0x0990, 0x09a3, 0x09b6,
+0x09cc, 0x09d5, 0x09e2, 0x09ea, 0x09fe, 0x0a08, 0x0a1d, 0x0a2a,
+0x0a35, 0x0a3e, 0x0a4f, 0x0a5b, 0x0a6c, 0x0a79, 0x0a84, 0x0a8b,
+0x0a97, 0x0aa6, 0x0ab1, 0x0ab4, 0x0abc, 0x0ac2, 0x0ac8, 0x0acd,
+0x0ad4, 0x0adb, 0x0ae4, 0x0aef, 0x0afe, 0x0b0b, 0x0b10, 0x0b18,
+0x0b1e, 0x0b25, 0x0b34, 0x0b40, 0x0b48, 0x0b54, 0x0b6a, 0x0b71,
+0x0b73, 0x0b7e, 0x0b89, 0x0b95, 0x0b9c, 0x0bae, 0x0bba, 0x0bbd,
+0x0bcf, 0x0bd9, 0x0be5, 0x0bee, 0x0bf9, 0x0c03, 0x0c10, 0x0c13,
+0x0c1f, 0x0c33, 0x0c3e, 0x0c49, 0x0c50, 0x0c5e, 0x0c61, 0x0c68,
+0x0c6f, 0x0c80, 0x0c87, 0x0c94, 0x0ca2, 0x0ca5, 0x0cae, 0x0cba,
+0x0cc9, 0x0cd3, 0x0ce2, 0x0ce6, 0x0cf2, 0x0cf5, 0x0cf9, 0x0d04,
+0x0d0e, 0x0d1c, 0x0d27, 0x0d3a, 0x0d3d, 0x0d4e, 0x0d64, 0x0d72,
+0x0d84, 0x0d98, 0x0d9c, 0x0da6, 0x0dad, 0x0db8, 0x0dbb, 0x0dc9,
+0x0dd4, 0x0ddb, 0x0de2, 0x0dea, 0x0ded, 0x0df5, 0x0dfc, 0x0e07,
+0x0e14, 0x0e24, 0x0e30, 0x0e44, 0x0e50, 0x0e53, 0x0e64, 0x0e6f,
+0x0e79, 0x0e8b, 0x0e96, 0x0ea3, 0x0ea5, 0x0eac, 0x0eb6, 0x0ec8,
+0x0ee0, 0x0eec, 0x0ef5, 0x0eff, 0x0f06, 0x0f1a, 0x0f21, 0x0f2c,
+0x0f3d, 0x0f49, 0x0f53, 0x0f60, 0x0f69, 0x0f79, 0x0f8b, 0x0f98,
+0x0f9e, 0x0fae, 0x0fc8, 0x0fdf, 0x0feb, 0x0ff7, 0x0ffd, 0x1008,
+0x100f, 0x1027, 0x102f, 0x1038, 0x1043, 0x104b, 0x1059, 0x105c,
+0x1065, 0x1070, 0x1079, 0x1085, 0x1092, 0x1094, 0x10a2, 0x10a9,
+0x10b1, 0x10bc, 0x10c8, 0x10d4, 0x10de, 0x10e7, 0x10f2, 0x10f6,
+0x10fc, 0x10fe, 0x1102, 0x110a, 0x111f, 0x1127, 0x1135, 0x1140,
+0x1146, 0x1154, 0x1162, 0x116c, 0x1176, 0x118b, 0x119b, 0x11a3,
+0x11b1, 0x11bb, 0x11c4, 0x11d2, 0x11e1, 0x11f0, 0x11fa, 0x1205,
+0x120c, 0x121d, 0x122b, 0x1238, 0x1243, 0x124e, 0x125a, 0x1261,
+0x126c, 0x1273, 0x1280, 0x128b, 0x1294, 0x129f, 0x12a6, 0x12ac,
+0x12be, 0x12c8, 0x12dc, 0x12ea, 0x12f2, 0x12ff, 0x1304, 0x1318,
+0x1322, 0x132e, 0x1342, 0x134b, 0x1353, 0x135f, 0x136b, 0x137a,
+0x138e, 0x139c, 0x13b3, 0x13b7, 0x13c2, 0x13c9, 0x13cc, 0x13d8,
+0x13e3, 0x13ea, 0x13f7, 0x1409, 0x141f, 0x1430, 0x143d, 0x1445,
+0x144c, 0x1452, 0x145a, 0x1464, 0x146a, 0x1471, 0x147a, 0x148b,
+0x14a0, 0x14b0, 0x14ba, 0x14c0, 0x14c7, 0x14d3, 0x14e2, 0x14eb,
+0x14f2, 0x14fb, 0x1506, 0x150e, 0x151a, 0x152a, 0x1537, 0x153c,
+0x1549, 0x154f, 0x155e, 0x1563, 0x1572, 0x158b, 0x1593, 0x15a7,
+0x15b9, 0x15c5, 0x15c9, 0x15d7, 0x15e1, 0x15eb, 0x15fa, 0x1606,
+0x1612, 0x162b, 0x1637, 0x163b, 0x1642, 0x164c, 0x1656, 0x1669,
+0x167a, 0x168b, 0x1698, 0x16aa, 0x16b5, 0x16be, 0x16c6, 0x16d8,
+0x16e2, 0x16ec, 0x16fd, 0x170e, 0x171b, 0x1728, 0x172f, 0x173c,
+0x1740, 0x1749, 0x1756, 0x1765, 0x1775, 0x177f, 0x1787, 0x1792,
+0x179d, 0x17ae, 0x17b6, 0x17c2, 0x17ce, 0x17d6, 0x17da, 0x17f0,
+0x17fd, 0x1807, 0x1814, 0x181b, 0x181e, 0x182c, 0x1835, 0x1842,
+0x184c, 0x185a, 0x1867, 0x186f, 0x1879, 0x1881, 0x188e, 0x189b,
+0x18b1, 0x18bd, 0x18c9, 0x18da, 0x18e4, 0x18f0, 0x18fb, 0x1912,
+0x191c, 0x1923, 0x192e, 0x193d, 0x194b, 0x1955, 0x1961, 0x1976,
+0x197e, 0x1981, 0x198a, 0x198d, 0x199e, 0x19a6, 0x19a9, 0x19b5,
+0x19c0, 0x19cc, 0x19d7, 0x19e5, 0x19ec, 0x19ff, 0x1a06, 0x1a10,
+0x1a1e, 0x1a2b, 0x1a3d, 0x1a4b, 0x1a5c, 0x1a70, 0x1a72, 0x1a7e,
+0x1a86, 0x1a93, 0x1a9c, 0x1aa3, 0x1aaf, 0x1abb, 0x1ac3, 0x1ac9,
+0x1ad4, 0x1ae5, 0x1af2, 0x1afd, 0x1b0b, 0x1b12, 0x1b1f, 0x1b29,
+0x1b3b, 0x1b3d, 0x1b4a, 0x1b62, 0x1b68, 0x1b73, 0x1b84, 0x1b8b,
+0x1b98, 0x1b9f, 0x1bab, 0x1bb5, 0x1bbe, 0x1bc1, 0x1bc5, 0x1bc8,
+0x1bd4, 0x1be2, 0x1bef, 0x1bfb, 0x1bfd, 0x1c09, 0x1c1a, 0x1c27,
+0x1c40, 0x1c4d, 0x1c56, 0x1c62, 0x1c6e, 0x1c78, 0x1c83, 0x1c92,
+0x1c9e, 0x1ca4, 0x1cac, 0x1cb3, 0x1cbd, 0x1cc4, 0x1cd0, 0x1ce3,
+0x1ced, 0x1cf8, 0x1d0a, 0x1d16, 0x1d22, 0x1d2b, 0x1d36, 0x1d42,
+0x1d52, 0x1d64, 0x1d6f, 0x1d77, 0x1d83, 0x1d85, 0x1d9d, 0x1da8,
+0x1db5, 0x1dbe, 0x1dd4, 0x1de7, 0x1df2, 0x1df4, 0x1dfa, 0x1e06,
+0x1e15, 0x1e22, 0x1e2a, 0x1e39, 0x1e44, 0x1e55, 0x1e66, 0x1e71,
+0x1e7b, 0x1e88, 0x1e97, 0x1ea2, 0x1eaf, 0x1ec1, 0x1ecf, 0x1ed9,
+0x1eed, 0x1ef9, 0x1f03, 0x1f0f, 0x1f15, 0x1f25, 0x1f2e, 0x1f3c,
+0x1f48, 0x1f54, 0x1f60, 0x1f6f, 0x1f7c, 0x1f8a, 0x1f96, 0x1f9f,
+0x1fb2, 0x1fbd, 0x1fd1, 0x1fde, 0x1fe8, 0x1ff3, 0x2002, 0x200f,
+0x201a, 0x2029, 0x2030, 0x203c, 0x2048, 0x2050, 0x2052, 0x205e,
+0x206b, 0x2072, 0x207b, 0x208b, 0x2099, 0x209f, 0x20b2, 0x20c9,
+0x20d2, 0x20de, 0x20e5, 0x20ee, 0x20f5, 0x20ff, 0x2115, 0x2120,
+0x2129, 0x2132, 0x213e, 0x2145, 0x214e, 0x2156, 0x215d, 0x216b,
+0x216f, 0x2179, 0x2183, 0x218a, 0x2196, 0x21a1, 0x21ad, 0x21bb,
+0x21c5, 0x21cf, 0x21e3, 0x21ef, 0x21fb, 0x2207, 0x221c, 0x2228,
+0x2235, 0x2245, 0x224d, 0x2252, 0x225b, 0x2262, 0x2272, 0x2279,
+0x2281, 0x228e, 0x229d, 0x22a7, 0x22a9, 0x22b3, 0x22bf, 0x22c3,
+0x22cf, 0x22d3, 0x22da, 0x22e1, 0x22e9, 0x22f3, 0x2304, 0x230f,
+0x231f, 0x232a, 0x233c, 0x234b, 0x234f, 0x2357, 0x2364, 0x237b,
+0x2387, 0x2392, 0x239f, 0x23a9, 0x23b3, 0x23c1, 0x23c5, 0x23cb,
+0x23e1, 0x23f6, 0x23fd, 0x240a, 0x240d, 0x241a, 0x242a, 0x2438,
+0x243f, 0x244a, 0x2455, 0x2462, 0x246b, 0x2477, 0x248a, 0x2492,
+0x24a0, 0x24ac, 0x24b9, 0x24cb, 0x24d4, 0x24d7, 0x24eb, 0x24f9,
+0x2503, 0x250a, 0x2511, 0x2521, 0x252d, 0x2530, 0x2534, 0x253f,
+0x2552, 0x2554, 0x255b, 0x2565, 0x256a, 0x2573, 0x257c, 0x257e,
+0x2585, 0x259f, 0x25ab, 0x25b5, 0x25bd, 0x25c8, 0x25d0, 0x25dc,
+0x25e7, 0x25f6, 0x260d, 0x2615, 0x2623, 0x2631, 0x2644, 0x2650,
+0x265c, 0x265e, 0x266a, 0x2677, 0x267f, 0x2686, 0x268d, 0x26a0,
+0x26a7, 0x26ab, 0x26b9, 0x26c0, 0x26cb, 0x26ce, 0x26d2, 0x26d9,
+0x26e1, 0x26f0, 0x26f3, 0x2705, 0x270f, 0x271a, 0x2727, 0x2734,
+0x2740, 0x2748, 0x2753, 0x275e, 0x276b, 0x2776, 0x277f, 0x2785,
+0x278f, 0x2792, 0x27a2, 0x27ae, 0x27bf, 0x27c7, 0x27d3, 0x27e4,
+0x27ef, 0x27ff, 0x2807, 0x2814, 0x281d, 0x2829, 0x2834, 0x2841,
+0x284e, 0x2856, 0x286d, 0x2871, 0x2881, 0x2896, 0x28a0, 0x28ad,
+0x28c5, 0x28d3, 0x28dd, 0x28ee, 0x2901, 0x2908, 0x2910, 0x291a,
+0x2924, 0x2932, 0x2939, 0x294b, 0x2958, 0x2966, 0x2972, 0x297d,
+0x2988, 0x298f, 0x299a, 0x29a5, 0x29c0, 0x29d0, 0x29d8, 0x29e2,
+0x29ee, 0x29f4, 0x29fb, 0x2a08, 0x2a10, 0x2a17, 0x2a29, 0x2a30,
+0x2a3d, 0x2a4f, 0x2a5f, 0x2a6b, 0x2a74, 0x2a7b, 0x2a86, 0x2a98,
+0x2aaa, 0x2ab2, 0x2ab9, 0x2ac1, 0x2ac9, 0x2acc, 0x2ad7, 0x2ae0,
+0x2aea, 0x2afa, 0x2b03, 0x2b10, 0x2b12, 0x2b14, 0x2b24, 0x2b38,
+0x2b44, 0x2b50, 0x2b5e, 0x2b63, 0x2b6f, 0x2b78, 0x2b91, 0x2b95,
+0x2ba2, 0x2bab, 0x2bb2, 0x2bc0, 0x2bcd, 0x2bd9, 0x2bea, 0x2bf6,
+0x2bf9, 0x2c00, 0x2c07, 0x2c0f, 0x2c18, 0x2c20, 0x2c31, 0x2c3f,
+0x2c49, 0x2c55, 0x2c65, 0x2c6d, 0x2c75, 0x2c7e, 0x2c87, 0x2c93,
+0x2c9d, 0x2ca5, 0x2cbd, 0x2ccf, 0x2cdf, 0x2ce4, 0x2cf5, 0x2d06,
+0x2d14, 0x2d19, 0x2d1b, 0x2d21, 0x2d2b, 0x2d33, 0x2d3e, 0x2d45,
+0x2d4d, 0x2d51, 0x2d53, 0x2d6f, 0x2d77, 0x2d82, 0x2d90, 0x2d9d,
+0x2dab, 0x2db6, 0x2dbd, 0x2dcb, 0x2ddb, 0x2dee, 0x2dfa, 0x2e06,
+0x2e10, 0x2e14, 0x2e18, 0x2e1a, 0x2e1c, 0x2e26, 0x2e30, 0x2e36,
+0x2e43, 0x2e4e, 0x2e64, 0x2e76, 0x2e82, 0x2e95, 0x2ea2, 0x2eaf,
+0x2eb9, 0x2ec6, 0x2ec8, 0x2eca, 0x2ed8, 0x2ee1, 0x2eea, 0x2ef8,
+0x2f07, 0x2f1a, 0x2f25, 0x2f36, 0x2f3e, 0x2f47, 0x2f54, 0x2f5b,
+0x2f6c, 0x2f7a, 0x2f8b, 0x2f8f, 0x2f9b, 0x2f9d, 0x2fa5, 0x2fac,
+0x2fb8, 0x2fc6, 0x2fda, 0x2fe3, 0x2fec, 0x2ff9, 0x300a, 0x300c,
+0x3012, 0x301d, 0x3034, 0x303b, 0x3052, 0x305a, 0x3062, 0x3064,
+0x306e, 0x307f, 0x308b, 0x309b, 0x309e, 0x30a9, 0x30b7, 0x30b9,
+0x30c6, 0x30cf, 0x30dc, 0x30e9, 0x30f4, 0x3106, 0x3111, 0x311b,
+0x312b, 0x3137, 0x313f, 0x3148, 0x314f, 0x315d, 0x3168, 0x3171,
+0x3180, 0x318d, 0x319f, 0x31a8, 0x31ac, 0x31bf, 0x31d3, 0x31e6,
+0x31f3, 0x31ff, 0x320b, 0x3217, 0x3223, 0x322f, 0x3237, 0x323e,
+0x324c, 0x3258, 0x3264, 0x3278, 0x327a, 0x3285, 0x329e, 0x32ac,
+0x32b7, 0x32bf, 0x32d0, 0x32df, 0x32e3, 0x32e5, 0x32f1, 0x32ff,
+0x3308, 0x3314, 0x3329, 0x333b, 0x3348, 0x3358, 0x3361, 0x3375,
+0x3383, 0x3395, 0x33a3, 0x33b0, 0x33be, 0x33c1, 0x33d6, 0x33e3,
+0x33e9, 0x33f1, 0x33fa, 0x3401, 0x3413, 0x3419, 0x341f, 0x3423,
+0x3436, 0x3441, 0x3453, 0x3461, 0x3468, 0x3474, 0x3477, 0x348b,
+0x348d, 0x349a, 0x34a8, 0x34b5, 0x34c0, 0x34c2, 0x34c4, 0x34cd,
+0x34d8, 0x34df, 0x34f2, 0x34ff, 0x350e, 0x3515, 0x351f, 0x352c,
+0x3533, 0x3536, 0x3540, 0x3547, 0x354f, 0x3552, 0x355c, 0x356b,
+0x3579, 0x3582, 0x3592, 0x35a5, 0x35b0, 0x35bc, 0x35be, 0x35cb,
+0x35d9, 0x35ec, 0x35fe, 0x360f, 0x3619, 0x3625, 0x362f, 0x363c,
+0x3646, 0x364f, 0x365a, 0x365c, 0x3663, 0x366d, 0x3676, 0x3680,
+0x368e, 0x3696, 0x36a1, 0x36ac, 0x36bd, 0x36c6, 0x36d3, 0x36e3,
+0x36ea, 0x36ee, 0x36fa, 0x370b, 0x3716, 0x371e, 0x372b, 0x3737,
+0x3747, 0x375b, 0x3763, 0x3773, 0x3780, 0x378d, 0x3799, 0x379c,
+0x37a9, 0x37b6, 0x37c4, 0x37d8, 0x37e4, 0x37ed, 0x37f8, 0x3806,
+0x3810, 0x3817, 0x3820, 0x3823, 0x3836, 0x3839, 0x3840, 0x3852,
+0x385f, 0x3861, 0x386e, 0x3876, 0x3884, 0x388f, 0x389b, 0x38ac,
+0x38bc, 0x38c4, 0x38dc, 0x38e8, 0x38f2, 0x38fb, 0x3911, 0x3916,
+0x391f, 0x3922, 0x3928, 0x3933, 0x3942, 0x3948, 0x395a, 0x3962,
+0x396a, 0x3981, 0x398c, 0x3999, 0x39a4, 0x39a8, 0x39b1, 0x39b6,
+0x39c4, 0x39d1, 0x39dd, 0x39e2, 0x39ea, 0x39f5, 0x3a07, 0x3a0b,
+0x3a19, 0x3a1e, 0x3a26, 0x3a2e, 0x3a3e, 0x3a4a, 0x3a57, 0x3a59,
+0x3a5d, 0x3a6b, 0x3a7b, 0x3a85, 0x3a9d, 0x3ab4, 0x3ab7, 0x3ab9,
+0x3ac3, 0x3ac5, 0x3ad5, 0x3ae1, 0x3af0, 0x3b08, 0x3b17, 0x3b21,
+0x3b2d, 0x3b3b, 0x3b4b, 0x3b57, 0x3b61, 0x3b6d, 0x3b81, 0x3b83,
+0x3b85, 0x3b91, 0x3b9d, 0x3ba9, 0x3bba, 0x3bc5, 0x3bcd, 0x3bd8,
+0x3be5, 0x3be9, 0x3bf0, 0x3bfc, 0x3c07, 0x3c0b, 0x3c15, 0x3c24,
+0x3c38, 0x3c4b, 0x3c52, 0x3c58, 0x3c65, 0x3c7f, 0x3c8b, 0x3c8d,
+0x3c94, 0x3ca3, 0x3cab, 0x3cb4, 0x3cbb, 0x3cca, 0x3cde, 0x3ceb,
+0x3cf3, 0x3cff, 0x3d06, 0x3d11, 0x3d1f, 0x3d2a, 0x3d3f, 0x3d49,
+0x3d55, 0x3d65, 0x3d74, 0x3d83, 0x3d8f, 0x3da3, 0x3daf, 0x3db5,
+0x3dba, 0x3dc2, 0x3dce, 0x3dd7, 0x3de8, 0x3df4, 0x3dfe, 0x3e06,
+0x3e0f, 0x3e16, 0x3e1d, 0x3e1f, 0x3e29, 0x3e2b, 0x3e32, 0x3e3e,
+0x3e48, 0x3e52, 0x3e6b, 0x3e76, 0x3e81, 0x3e8e, 0x3ea4, 0x3eaf,
+0x3ebb, 0x3ec6, 0x3ed0, 0x3ed6, 0x3ee4, 0x3eef, 0x3efc, 0x3f0c,
+0x3f11, 0x3f1e, 0x3f28, 0x3f35, 0x3f47, 0x3f49, 0x3f4b, 0x3f57,
+0x3f64, 0x3f6b, 0x3f7d, 0x3f88, 0x3f8f, 0x3f94, 0x3f97, 0x3fa1,
+0x3fae, 0x3fb2, 0x3fb4, 0x3fc4, 0x3fcf, 0x3fd6, 0x3fe9, 0x3ff6,
+0x3ffd, 0x400a, 0x4016, 0x4024, 0x4032, 0x403c, 0x4044, 0x4051,
+0x4059, 0x4063, 0x4074, 0x4080, 0x408b, 0x4097, 0x409e, 0x40aa,
+0x40b7, 0x40c9, 0x40cd, 0x40d3, 0x40df, 0x40ec, 0x40f6, 0x4105,
+0x4108, 0x4114, 0x4128, 0x4133, 0x413a, 0x4143, 0x4152, 0x4157,
+0x4161, 0x416b, 0x4177, 0x4180, 0x4189, 0x4197, 0x41a5, 0x41b6,
+0x41c2, 0x41cf, 0x41d3, 0x41dc, 0x41e0, 0x41ec, 0x4200, 0x4210,
+0x4216, 0x421e, 0x422e, 0x4233, 0x4244, 0x424a, 0x424c, 0x4253,
+0x4255, 0x425d, 0x426d, 0x427b, 0x427f, 0x428b, 0x4295, 0x429e,
+0x42aa, 0x42b0, 0x42bd, 0x42cf, 0x42e2, 0x42ec, 0x42f1, 0x42fd,
+0x42ff, 0x4309, 0x4315, 0x432a, 0x432e, 0x433a, 0x434a, 0x435b,
+0x4363, 0x436b, 0x4372, 0x437a, 0x4389, 0x4390, 0x4398, 0x43a7,
+0x43b3, 0x43c1, 0x43c8, 0x43d0, 0x43d2, 0x43d7, 0x43e5, 0x43eb,
+0x43ed, 0x43fb, 0x4403, 0x440c, 0x4416, 0x4428, 0x4437, 0x4443,
+0x4453, 0x4464, 0x4471, 0x4478, 0x447c, 0x4488, 0x4491, 0x44a3,
+0x44b5, 0x44bc, 0x44c6, 0x44d3, 0x44e4, 0x44ef, 0x44f7, 0x4504,
+0x4512, 0x4521, 0x452c, 0x4537, 0x453a, 0x454c, 0x4553, 0x4561,
+0x456b, 0x4575, 0x4587, 0x458d, 0x4595, 0x459b, 0x45a4, 0x45b4,
+0x45c8, 0x45da, 0x45e1, 0x45ed, 0x45f7, 0x4601, 0x4614, 0x461f,
+0x4629, 0x4633, 0x463c, 0x464e, 0x4656, 0x4666, 0x4670, 0x4675,
+0x4682, 0x4696, 0x469d, 0x46a4, 0x46b1, 0x46bc, 0x46c8, 0x46d1,
+0x46d7, 0x46ec, 0x46f5, 0x4701, 0x4719, 0x4725, 0x4732, 0x473c,
+0x4748, 0x4752, 0x475a, 0x4766, 0x4770, 0x477a, 0x4785, 0x4790,
+0x4798, 0x479d, 0x47a3, 0x47b6, 0x47be, 0x47c4, 0x47cd, 0x47de,
+0x47ef, 0x47ff, 0x4809, 0x4814, 0x481b, 0x4822, 0x482d, 0x4835,
+0x4840, 0x4843, 0x484e, 0x4857, 0x4863, 0x486e, 0x4876, 0x4879,
+0x4889, 0x4897, 0x48b0, 0x48c4, 0x48cf, 0x48d9, 0x48ed, 0x48fa,
+0x4905, 0x490c, 0x4918, 0x4922, 0x4938, 0x4944, 0x4951, 0x495f,
+0x496c, 0x4975, 0x497b, 0x497d, 0x4988, 0x4992, 0x4996, 0x49a4,
+0x49b0, 0x49c9, 0x49db, 0x49ec, 0x4a00, 0x4a15, 0x4a29, 0x4a30,
+0x4a4a, 0x4a54, 0x4a60, 0x4a6a, 0x4a75, 0x4a81, 0x4a89, 0x4a91,
+0x4a99, 0x4ab5, 0x4abe, 0x4ac6, 0x4ad4, 0x4ae2, 0x4aea, 0x4af2,
+0x4af8, 0x4b04, 0x4b0f, 0x4b1f, 0x4b26, 0x4b2e, 0x4b3f, 0x4b4a,
+0x4b57, 0x4b61, 0x4b72, 0x4b7f, 0x4b89, 0x4b95, 0x4ba1, 0x4bb6,
+0x4bca, 0x4bd2, 0x4be0, 0x4be8, 0x4bfa, 0x4bfc, 0x4c0a, 0x4c1e,
+0x4c2d
+};
+
+static const unsigned int ks_name_values[KSNAMES] = {
+0x0015de, 0x0005e3, 0x000063, 0x0014a1, 0x0007b6, 0x0016af, 0x001ead, 0x0008c5,
+0x00ffc2, 0x000ed8, 0x000abe, 0x00ffad, 0x0004ad, 0x000eb4, 0x0001d0, 0x0004a4,
+0x0014cb, 0x001eb2, 0x000049, 0x0007d4, 0x00fe73, 0x000dd0, 0x000df1, 0x0004a3,
+0x00069c, 0x00fe78, 0x0015d0, 0x000eb9, 0x000cf2, 0x0000fb, 0x000af4, 0x00fd0b,
+0x00fe2d, 0x000053, 0x000daf, 0x000cf6, 0x0004cd, 0x000af0, 0x0014d2, 0x000ad3,
+0x0006ba, 0x0007e4, 0x00ff97, 0x0014c7, 0x0007f3, 0x0016a6, 0x00ffd9, 0x0006c4,
+0x0000f1, 0x0003bc, 0x0001a9, 0x000aeb, 0x0015df, 0x0009ee, 0x00fd03, 0x0006c0,
+0x00ff13, 0x000069, 0x0005f3, 0x0008c2, 0x000aa6, 0x00fe33, 0x0006f6, 0x0004d9,
+0x0000e6, 0x000060, 0x001ee8, 0x000ead, 0x0014f8, 0x00ff93, 0x001ed6, 0x000dd4,
+0x0006b3, 0x0007a3, 0x000688, 0x0015ec, 0x000df3, 0x0005e2, 0x000abf, 0x0000f5,
+0x000cf6, 0x00ffff, 0x000dd5, 0x000039, 0x00ffd7, 0x000cec, 0x000ae4, 0x0004dd,
+0x000030, 0x001ea5, 0x000ea6, 0x0000b0, 0x0014db, 0x000aec, 0x000ef2, 0x0007c4,
+0x0014fe, 0x00ffb8, 0x000ce8, 0x001ef7, 0x000ae3, 0x0012d0, 0x0014f2, 0x0007c5,
+0x0009f3, 0x0007f2, 0x001eb6, 0x000ac4, 0x0015e3, 0x0006ca, 0x0006c7, 0x00ff37,
+0x0015ed, 0x001ef1, 0x0004d3, 0x000eec, 0x0009e2, 0x00fd09, 0x00fe0b, 0x0006d2,
+0x001ec1, 0x000eab, 0x00ff35, 0x0008b2, 0x0015d2, 0x00fef3, 0x000efa, 0x000ed6,
+0x0000e1, 0x0014ea, 0x0007eb, 0x001ee1, 0x000028, 0x0009f5, 0x0012bf, 0x00fe05,
+0x000dd2, 0x00ff36, 0x000da5, 0x0004b4, 0x000ba8, 0x00ff23, 0x000de7, 0x0015da,
+0x00006c, 0x000ad4, 0x00fe28, 0x0000ce, 0x000aa1, 0x000abc, 0x0014a9, 0x000ea4,
+0x001ee9, 0x0004b2, 0x000ecf, 0x0005ae, 0x000ef4, 0x000cef, 0x0006da, 0x0007b9,
+0x00ff0a, 0x000ad0, 0x0005e0, 0x00fe79, 0x0008fe, 0x000ea7, 0x001efd, 0x0006af,
+0x0008a3, 0x00ff68, 0x000695, 0x00002a, 0x0014d8, 0x00ff6b, 0x0012bd, 0x000dab,
+0x001efe, 0x0000ba, 0x00ffe2, 0x000eb5, 0x0003cf, 0x0002a6, 0x0007ee, 0x000ee5,
+0x0015f4, 0x0020a2, 0x0014ac, 0x001efa, 0x0014ce, 0x000ec3, 0x0006e6, 0x0001cc,
+0x001ecb, 0x000db7, 0x001ee6, 0x0006c5, 0x000077, 0x00ff61, 0x0006f0, 0x00fe30,
+0x00ffea, 0x00004d, 0x00002d, 0x0008db, 0x000058, 0x0007a5, 0x0005f5, 0x000684,
+0x000ebf, 0x0006d6, 0x0004c6, 0x00fe09, 0x000026, 0x000cdf, 0x0015d6, 0x00fe51,
+0x0003d3, 0x0008a8, 0x0006b4, 0x0016b2, 0x00ffac, 0x000023, 0x0012b8, 0x0014b8,
+0x0006dd, 0x0000eb, 0x0013bd, 0x000599, 0x00003a, 0x001ebb, 0x00002b, 0x000af1,
+0x0001b9, 0x0003b3, 0x0006b8, 0x000edb, 0x0006a9, 0x00ffb7, 0x000bd3, 0x00ffe9,
+0x0004a7, 0x00fd02, 0x00ff7e, 0x000dc6, 0x0005cc, 0x00fe5f, 0x0001e8, 0x000078,
+0x0020a3, 0x0005c8, 0x0014e8, 0x0000c9, 0x00ff3e, 0x0005d0, 0x00ffda, 0x000ae8,
+0x001ee4, 0x00ffaa, 0x0007ec, 0x000db3, 0x000ab1, 0x0015f5, 0x0009e9, 0x0006ba,
+0x00fefb, 0x000eff, 0x0006e9, 0x0000df, 0x0014d4, 0x0009e3, 0x0001e0, 0x0012a8,
+0x001ebe, 0x0004b1, 0x0014f3, 0x0005f1, 0x0000c6, 0x0001ff, 0x0007c8, 0x00fe58,
+0x000db9, 0x000ade, 0x00ffe0, 0x000ceb, 0x00ffc0, 0x0000f0, 0x0006a8, 0x0002d5,
+0x0014f6, 0x00007e, 0x000ef5, 0x00ffbf, 0x00fe02, 0x00feee, 0x00fee1, 0x0014b1,
+0x000ed9, 0x000bca, 0x001ecd, 0x0000da, 0x00fe50, 0x00ffd2, 0x000dce, 0x0005d6,
+0x0016b4, 0x000021, 0x0004cf, 0x0013bc, 0x0008ce, 0x00ffab, 0x000cf7, 0x00ff34,
+0x000db2, 0x0005ce, 0x000afb, 0x000ce1, 0x00ffc6, 0x001ea4, 0x000dc2, 0x000060,
+0x0007ab, 0x0008da, 0x0015ee, 0x000072, 0x00ff31, 0x001eca, 0x0008aa, 0x000699,
+0x000ac5, 0x0001de, 0x00fd15, 0x0001d2, 0x0014a4, 0x0012ac, 0x000ab7, 0x0007b4,
+0x0014bc, 0x0007d6, 0x0015f2, 0x0000d7, 0x001ea8, 0x00068f, 0x000dbe, 0x00ff0b,
+0x001ec2, 0x0006bd, 0x000693, 0x0008a1, 0x0014e0, 0x0016f6, 0x0006e1, 0x0000dd,
+0x000696, 0x00ffec, 0x0002b9, 0x000aa5, 0x0001ea, 0x00fefd, 0x0000b5, 0x000bc6,
+0x00ff9a, 0x0005b5, 0x0007e3, 0x0005d4, 0x00006e, 0x0014f4, 0x001ebd, 0x000594,
+0x0000bc, 0x0014e9, 0x0014f9, 0x001edf, 0x000ae5, 0x0000f6, 0x0000d0, 0x00003d,
+0x000079, 0x0003bd, 0x00ff95, 0x00fe0d, 0x0001b3, 0x0014d7, 0x000db4, 0x0000fe,
+0x00fe32, 0x0008a6, 0x0008c1, 0x0012b4, 0x000ee1, 0x001ec3, 0x000ba9, 0x000da4,
+0x00ff08, 0x000ec4, 0x0004a1, 0x000ee8, 0x00069e, 0x0012f7, 0x0014fa, 0x00ffe8,
+0x001ea7, 0x0006b2, 0x0001fb, 0x000cfa, 0x0000cb, 0x0000e2, 0x0000f2, 0x000ba6,
+0x0003fd, 0x000ce0, 0x00fe5a, 0x0005b8, 0x0006b0, 0x001ebc, 0x00002c, 0x0007a1,
+0x001ea0, 0x0007b7, 0x0008ab, 0x0004a6, 0x0008dc, 0x00ffb5, 0x001eac, 0x000af9,
+0x0006e4, 0x0004a2, 0x000022, 0x0004d4, 0x0006cd, 0x000cf7, 0x0008a2, 0x000edd,
+0x00fd06, 0x000681, 0x00ffdf, 0x0005f9, 0x00ff0d, 0x00ffd0, 0x0006fa, 0x0007e9,
+0x0000d9, 0x0014b7, 0x0006f8, 0x000682, 0x000eb6, 0x000eb2, 0x0003ef, 0x0001f2,
+0x0008dd, 0x0003e0, 0x000eca, 0x00002f, 0x0001e5, 0x000aae, 0x001ec4, 0x00fed0,
+0x000eed, 0x0000a9, 0x0001b7, 0x0000e3, 0x00ff14, 0x00fe07, 0x0000c7, 0x00ff69,
+0x0005b0, 0x000ce5, 0x0004cc, 0x0008a5, 0x00fee5, 0x000dd7, 0x0009f6, 0x0014e2,
+0x001ef6, 0x0008ad, 0x00ff50, 0x0007af, 0x00ff3d, 0x0004bd, 0x000de4, 0x0005c6,
+0x0008c8, 0x00ffde, 0x0014d6, 0x001eed, 0x0007f8, 0x0009ef, 0x0002b6, 0x0015f3,
+0x0014aa, 0x0006b8, 0x00ffca, 0x0004ab, 0x0020a1, 0x0016b3, 0x000eaf, 0x0008b1,
+0x0004a5, 0x0005f2, 0x00feef, 0x000de0, 0x0007ce, 0x0001ca, 0x0008ef, 0x000bc4,
+0x00fd16, 0x00fe04, 0x0008be, 0x0007eb, 0x0009e0, 0x0000d5, 0x00ff32, 0x00ffd4,
+0x000aa4, 0x0009ec, 0x0009f1, 0x0004df, 0x000ece, 0x0004bf, 0x000ce7, 0x0005e1,
+0x00fee6, 0x0016b9, 0x0006f1, 0x0006ee, 0x0000b8, 0x00ffc9, 0x0005c5, 0x0001d5,
+0x00ff9e, 0x000af8, 0x0000cd, 0x0016a8, 0x000ebb, 0x0003f1, 0x0005da, 0x000dc1,
+0x0007d5, 0x0005ee, 0x000025, 0x0007f7, 0x0001a1, 0x00ff37, 0x0014cd, 0x0007a9,
+0x0006cc, 0x0000db, 0x0005fc, 0x00ff37, 0x000de1, 0x000ec2, 0x0005fb, 0x000ac3,
+0x0001f1, 0x0006b6, 0x0009f0, 0x00069a, 0x000aa8, 0x000aac, 0x000ed5, 0x00ffee,
+0x00ffd3, 0x0001ba, 0x00ffd7, 0x0007a4, 0x0004b6, 0x00ffcd, 0x0002c6, 0x0007c2,
+0x0005ab, 0x0000c4, 0x00fef6, 0x0016d3, 0x0007b5, 0x0004b5, 0x0012b0, 0x000da9,
+0x0005ef, 0x000afa, 0x000cf1, 0x000cf5, 0x000ede, 0x000037, 0x000dc9, 0x000598,
+0x000df7, 0x0001fe, 0x0002bb, 0x0006ed, 0x00005b, 0x000595, 0x0000e5, 0x0000ef,
+0x000acc, 0x000dda, 0x0014fb, 0x000ded, 0x0001d8, 0x0015eb, 0x0000b1, 0x000eb3,
+0x00007a, 0x0014ec, 0x00fe71, 0x001eba, 0x000ce1, 0x001ebf, 0x0000c0, 0x0014b6,
+0x0001b5, 0x0007e1, 0x000ec6, 0x0004af, 0x0009e8, 0x00ffd1, 0x0009e5, 0x0008a4,
+0x000ebd, 0x0014b4, 0x0015f6, 0x000043, 0x0012fe, 0x00fd1d, 0x0014c4, 0x00ff3e,
+0x000eba, 0x00ff26, 0x0014b9, 0x00fd18, 0x000ec8, 0x001edc, 0x0004b0, 0x0006e2,
+0x001ec8, 0x0000a7, 0x0001c8, 0x00ffe3, 0x001ef8, 0x0006b9, 0x00fe7a, 0x0008df,
+0x0012be, 0x000eae, 0x0006cb, 0x0006e5, 0x0000f8, 0x0005a8, 0x0004de, 0x000dd1,
+0x00fee7, 0x0007c6, 0x00ff29, 0x0014fc, 0x000075, 0x000686, 0x000ad9, 0x0014cf,
+0x0005b7, 0x000687, 0x0014a5, 0x0005f7, 0x000061, 0x001ea2, 0x0007c3, 0x00fe0a,
+0x00ff39, 0x000593, 0x000ee3, 0x0014be, 0x00fed5, 0x0005bb, 0x0000e4, 0x000ddf,
+0x0001db, 0x00068e, 0x000dca, 0x0006a7, 0x000eac, 0x000dba, 0x00ff56, 0x0007b8,
+0x0007e8, 0x000cf4, 0x0014c3, 0x00ff55, 0x00ff2a, 0x00ff8d, 0x0015e4, 0x0006e0,
+0x0014d0, 0x0006e8, 0x0004a5, 0x000db0, 0x00fd11, 0x0006d1, 0x00ff9d, 0x000ee7,
+0x0005f6, 0x0007a8, 0x0014df, 0x00fe5d, 0x000ec5, 0x00fe70, 0x0014ed, 0x0000d6,
+0x000ae2, 0x0001ab, 0x0006c6, 0x000df6, 0x0000bd, 0x000051, 0x000df9, 0x0005ac,
+0x00ff23, 0x0000a4, 0x00feeb, 0x000db6, 0x000aee, 0x000eaa, 0x0014a7, 0x00ff3d,
+0x0012de, 0x0001c6, 0x0000d8, 0x0004a9, 0x0007f4, 0x000692, 0x00005f, 0x00ff22,
+0x0008cd, 0x0000c2, 0x00ff60, 0x000bdc, 0x0020a9, 0x00ff89, 0x0007cf, 0x00ffd8,
+0x001eb9, 0x000af3, 0x00ff63, 0x000dd6, 0x001edd, 0x000ce7, 0x00fd1b, 0x001eb8,
+0x000ecb, 0x00fefc, 0x0014e5, 0x00fe54, 0x0000ca, 0x0007ae, 0x0006a9, 0x000ebc,
+0x0016d2, 0x0003ba, 0x0009f7, 0x0003a3, 0x0001a5, 0x000eeb, 0x0000ad, 0x0004c0,
+0x0006aa, 0x0009ea, 0x001ef4, 0x000054, 0x000ab3, 0x0014dd, 0x00ffcb, 0x000dd9,
+0x00ff57, 0x0012ba, 0x0012bc, 0x000bc0, 0x0016a5, 0x000680, 0x0000ff, 0x00ff3c,
+0x000de8, 0x0005c4, 0x00ff3f, 0x0003bf, 0x0004af, 0x0000a0, 0x000691, 0x0014e4,
+0x0005e4, 0x000eb8, 0x00fd0d, 0x0016d1, 0x001ee2, 0x00ffdb, 0x001ee7, 0x00fe24,
+0x00fe2c, 0x0001ac, 0x0015d7, 0x00ffce, 0x0014b2, 0x0006ea, 0x0014c8, 0x000ab8,
+0x001ee0, 0x000dbb, 0x000ce3, 0x0000a3, 0x0006d3, 0x00fefa, 0x0003c0, 0x0014f5,
+0x0005aa, 0x0006b9, 0x00068d, 0x000ed3, 0x00ffcf, 0x0007b2, 0x0014c9, 0x0007d1,
+0x0001cf, 0x0000e0, 0x00feea, 0x0006a3, 0x00ffd4, 0x00ffd0, 0x0006cf, 0x000ae6,
+0x000066, 0x0000f9, 0x000ed2, 0x00ff65, 0x0000e7, 0x00ff98, 0x000048, 0x0016aa,
+0x0008b4, 0x0006d7, 0x001ee5, 0x0004ac, 0x000027, 0x0004ce, 0x0002ac, 0x0006a6,
+0x0005a5, 0x000683, 0x0004c7, 0x0008ac, 0x0006b5, 0x000db1, 0x000ab4, 0x000cf8,
+0x00006a, 0x0007cb, 0x000af2, 0x0003e7, 0x0001c3, 0x0016ba, 0x000afd, 0x00ff9c,
+0x00ffd5, 0x0007ef, 0x0003b5, 0x0000cf, 0x00ffc5, 0x00ffde, 0x00ffe7, 0x0004dc,
+0x000eee, 0x0009e4, 0x0014a3, 0x00003b, 0x00fee2, 0x0014de, 0x0006db, 0x0006ce,
+0x0001b1, 0x0005d7, 0x0014bf, 0x000ce6, 0x001eea, 0x000ada, 0x0003a2, 0x0000b6,
+0x000040, 0x001ef2, 0x0000ee, 0x00ff3b, 0x0004c8, 0x00ff30, 0x00fe59, 0x0000dc,
+0x00feed, 0x0003d2, 0x0005a9, 0x0004bc, 0x001eb0, 0x00fe55, 0x0015d1, 0x0014d9,
+0x0004ae, 0x00ff3c, 0x00ffdf, 0x001ef3, 0x0005bf, 0x000aa7, 0x00ff9b, 0x00fe29,
+0x000aca, 0x00fe62, 0x00fd0f, 0x000ae1, 0x0001b6, 0x0004ba, 0x0007e7, 0x00005c,
+0x0009eb, 0x0016bd, 0x0008a9, 0x0014aa, 0x0015e5, 0x0000f4, 0x000de2, 0x00fd13,
+0x0000c8, 0x0006f5, 0x000029, 0x000ef9, 0x0014b0, 0x00ff55, 0x001ef5, 0x0007ea,
+0x001efc, 0x0000af, 0x0015d9, 0x0003c7, 0x0001e3, 0x000ea3, 0x0001f8, 0x0014c6,
+0x00fd1c, 0x000acf, 0x0005e5, 0x000ab2, 0x0001e6, 0x001eef, 0x0007b1, 0x0006d8,
+0x0008d6, 0x0004aa, 0x0004cb, 0x0003aa, 0x00ffbe, 0x0020a7, 0x00fd0a, 0x001ede,
+0x00fe06, 0x0004c1, 0x0015d5, 0x000036, 0x000062, 0x0014af, 0x00fe23, 0x0000b2,
+0x0012f0, 0x001ee3, 0x00ff56, 0x0006eb, 0x0003ab, 0x00fe2b, 0x00ffcf, 0x0006a4,
+0x00ff9a, 0x000aff, 0x0014ef, 0x0015e0, 0x0014f0, 0x0005fd, 0x001eb1, 0x00ffcc,
+0x0003a5, 0x00ff24, 0x0004da, 0x000ec7, 0x0004d8, 0x001ec5, 0x00fef5, 0x0005e7,
+0x000aea, 0x001e9f, 0x0001a3, 0x0004d2, 0x0005b2, 0x000ab0, 0x000dea, 0x0012b7,
+0x000596, 0x000689, 0x00fef0, 0x0005fe, 0x00ffb2, 0x000deb, 0x000690, 0x0015e6,
+0x0000a2, 0x000065, 0x0001a2, 0x00007b, 0x00ffed, 0x000dc3, 0x0001ef, 0x0004d7,
+0x00ffdc, 0x00006b, 0x0007ba, 0x000ad6, 0x0008fd, 0x0006bf, 0x0008c9, 0x000cf1,
+0x000ab5, 0x000aa9, 0x000ce3, 0x000ed4, 0x00fe22, 0x0015dd, 0x0015d4, 0x0007c7,
+0x0000d0, 0x00ffd2, 0x000068, 0x00004c, 0x0007f6, 0x0002e5, 0x0009df, 0x0006fb,
+0x000cfa, 0x0014ff, 0x0005c9, 0x0006f4, 0x000ea8, 0x0014b5, 0x0006ab, 0x00ff20,
+0x0014d3, 0x000074, 0x000055, 0x0015e9, 0x00ff80, 0x0001aa, 0x00ff7e, 0x001eb7,
+0x0005c2, 0x0005d8, 0x001eab, 0x000dc4, 0x000bd6, 0x0014b3, 0x0000c1, 0x000ae0,
+0x000daa, 0x0016a2, 0x00ffce, 0x00ff7e, 0x00005a, 0x000590, 0x0003ac, 0x0014d1,
+0x000ee6, 0x001ed9, 0x00ff25, 0x000ecc, 0x00005d, 0x001ed1, 0x000076, 0x0000de,
+0x00ffe6, 0x00fe25, 0x0000fd, 0x00fe77, 0x00003e, 0x0004db, 0x000073, 0x000ce4,
+0x00fe21, 0x0007c1, 0x000eda, 0x00ffd5, 0x0005e7, 0x00fe56, 0x00004a, 0x0015e1,
+0x0003bb, 0x0006c3, 0x0015d3, 0x000da1, 0x000acd, 0x00fe53, 0x00ffe5, 0x0005eb,
+0x000dc7, 0x0016bf, 0x0005b4, 0x000024, 0x0006f9, 0x0007e2, 0x00ffbd, 0x0000bb,
+0x000df8, 0x0006ff, 0x000ab6, 0x00ffdd, 0x0005c3, 0x000ee0, 0x000ea2, 0x000ebe,
+0x0006a7, 0x0007ca, 0x0014da, 0x0006a8, 0x0005a7, 0x0008fc, 0x0000fa, 0x0009ed,
+0x0006bf, 0x0006c8, 0x000685, 0x000059, 0x00007d, 0x00fe2a, 0x0014d5, 0x00fd1e,
+0x0004b7, 0x000ef8, 0x000dcf, 0x00ffcc, 0x000044, 0x0014fd, 0x0007e5, 0x0005b9,
+0x0007d9, 0x00fe2f, 0x00fef1, 0x0014ca, 0x0014b1, 0x00ff3e, 0x000adc, 0x0020aa,
+0x0007bb, 0x001ef0, 0x0015e2, 0x000db8, 0x0016b7, 0x0014a2, 0x000adf, 0x00ff21,
+0x0004c4, 0x0000f7, 0x0000d2, 0x00ff3d, 0x001ece, 0x0009f4, 0x00ffc7, 0x0005e9,
+0x000027, 0x00069f, 0x0014ba, 0x0004a8, 0x000dd3, 0x00ffd9, 0x00fe27, 0x000067,
+0x00fe20, 0x0000ab, 0x000da2, 0xffffff, 0x000057, 0x00004e, 0x0003f3, 0x0006c9,
+0x0000cc, 0x00fe2e, 0x0005f0, 0x000eea, 0x0016e3, 0x00ffaf, 0x0014a9, 0x0001be,
+0x00ffd6, 0x00fd0e, 0x000bc3, 0x0003fe, 0x0016a7, 0x0012a1, 0x0006fd, 0x0008bc,
+0x0007cd, 0x0016e2, 0x000afe, 0x0006dc, 0x0007f9, 0x000046, 0x000dae, 0x000dbc,
+0x00fef9, 0x0006df, 0x001eaa, 0x0012ab, 0x0014c1, 0x0002f5, 0x00fee3, 0x00ff9f,
+0x0020ab, 0x000dcb, 0x000042, 0x0002fd, 0x0007d8, 0x0003a6, 0x000ba3, 0x00ff7e,
+0x00ff2b, 0x00ff2e, 0x0005ea, 0x0008a7, 0x0007ed, 0x0001f5, 0x000aaf, 0x0000ec,
+0x0000a5, 0x0006b7, 0x001ed7, 0x00fd04, 0x0004d5, 0x0015f0, 0x0000b9, 0x00fe0c,
+0x001ec6, 0x0004d1, 0x00fd1a, 0x0006b4, 0x00fee0, 0x0014e7, 0x00ffcb, 0x0014e3,
+0x000af5, 0x0006a2, 0x0007a7, 0x0002f8, 0x0005b6, 0x0007e6, 0x00068a, 0x00ff2d,
+0x0012aa, 0x0004c2, 0x00ffc1, 0x000de3, 0x00ffc4, 0x0000c3, 0x0014ad, 0x00fe5b,
+0x00004f, 0x0006e3, 0x0003de, 0x000ef7, 0x000ce9, 0x001eae, 0x001ed2, 0x00ff7e,
+0x000aed, 0x0014a6, 0x0002fe, 0x000ed0, 0x0003b6, 0x000694, 0x00ff66, 0x00003f,
+0x00ffd8, 0x00ff58, 0x0005cf, 0x00fee4, 0x0000b4, 0x000eb0, 0x0004c3, 0x0016a9,
+0x000698, 0x0006fc, 0x0015ea, 0x000dbf, 0x00ffd3, 0x0008bf, 0x00ff51, 0x000ea1,
+0x0006b7, 0x0000ea, 0x00ff67, 0x00ff9b, 0x0005d9, 0x00fef2, 0x0003a2, 0x0015e8,
+0x00ffb9, 0x0003f9, 0x000ad7, 0x0005ed, 0x0015d8, 0x000ea9, 0x000050, 0x00ffe0,
+0x0014ee, 0x0014b0, 0x000ec1, 0x0005a6, 0x000dde, 0x00ffc9, 0x000035, 0x00fe34,
+0x00006d, 0x001ea9, 0x0006f7, 0x0000b7, 0x000eef, 0x000ee9, 0x001eec, 0x0006f3,
+0x0006bc, 0x00feec, 0x0000d4, 0x0002a9, 0x0014c2, 0x0006ae, 0x000071, 0x000038,
+0x0006ec, 0x0014eb, 0x0014e6, 0x000ae7, 0x00ff33, 0x0002b1, 0x000df5, 0x00ff7e,
+0x00ffdb, 0x0000f3, 0x001eb5, 0x001eda, 0x00ffd6, 0x0012a2, 0x00fe0e, 0x00fed4,
+0x001eff, 0x0002ab, 0x0001f9, 0x0006bb, 0x0008b3, 0x000df0, 0x000045, 0x0001bb,
+0x000ee4, 0x00ff15, 0x0008f6, 0x00ff1b, 0x0008ae, 0x00fed1, 0x0015dc, 0x0002a1,
+0x0002de, 0x0000f8, 0x000dd8, 0x0007f5, 0x0005cd, 0x000edc, 0x0008c0, 0x0014dc,
+0x000dc0, 0x00fe57, 0x000cf3, 0x000dc5, 0x001ec7, 0x000dc8, 0x00ff94, 0x00ffb3,
+0x000aa2, 0x0005c7, 0x000aa3, 0x001ed0, 0x001eb4, 0x0016a3, 0x0004d0, 0x0003d1,
+0x000bcf, 0x0001c0, 0x000047, 0x000dcd, 0x000033, 0x00002e, 0x000ce8, 0x0002c5,
+0x000bfc, 0x000ef1, 0x0005ca, 0x000cee, 0x0009e1, 0x000697, 0x0000a1, 0x0006b6,
+0x00fd17, 0x00fe61, 0x001ea3, 0x00fef8, 0x00ffae, 0x000dac, 0x001ed5, 0x00003c,
+0x0015db, 0x0000a8, 0x0000bf, 0x0014ae, 0x000032, 0x000034, 0x000cf9, 0x000ac6,
+0x0004b3, 0x000ea5, 0x0007c9, 0x00ff2c, 0x000bcc, 0x00ffc8, 0x00fd12, 0x0006e7,
+0x00ffdd, 0x000031, 0x000da6, 0x001eee, 0x0000d3, 0x0005fa, 0x0014c5, 0x0000d8,
+0x0006de, 0x0014e1, 0x0006d9, 0x00fef7, 0x0012d7, 0x0001f0, 0x000da8, 0x00ff99,
+0x0000a6, 0x001ec0, 0x0014c0, 0x0008de, 0x0014bd, 0x0001ae, 0x0006a6, 0x0005c1,
+0x0008b5, 0x00ffc8, 0x0000c5, 0x0007d2, 0x000ace, 0x0001bf, 0x00fe08, 0x00ffca,
+0x000de9, 0x001ed8, 0x000ec9, 0x0001bc, 0x00fd0c, 0x0009f2, 0x00ffb6, 0x0016b5,
+0x001ea1, 0x0006d4, 0x000bda, 0x0005b3, 0x0014f7, 0x000ce2, 0x000cf5, 0x000af6,
+0x000eb1, 0x00ffd1, 0x0008bd, 0x00007c, 0x000ce6, 0x000ad2, 0x0005ec, 0x0016c6,
+0x00ff62, 0x00ff3a, 0x00ffb1, 0x001ed3, 0x001ec9, 0x000052, 0x0003dd, 0x000064,
+0x0004be, 0x0014ad, 0x00ff7e, 0x00ffdc, 0x0006b1, 0x000ac9, 0x0007cc, 0x00005e,
+0x0000de, 0x000df2, 0x00fe72, 0x000edf, 0x00ffe4, 0x00ff6a, 0x0005cb, 0x000041,
+0x0020a6, 0x0005d2, 0x000add, 0x00ffda, 0x000da7, 0x00fd07, 0x000de5, 0x000abb,
+0x0003f2, 0x0001d1, 0x000591, 0x00068c, 0x001ef9, 0x0004ca, 0x0014ab, 0x0000aa,
+0x00ff7e, 0x0001c5, 0x000592, 0x000056, 0x00ffb4, 0x00fe60, 0x001ecf, 0x000070,
+0x0006a5, 0x00ffeb, 0x0020ac, 0x0020a8, 0x000acb, 0x00fd10, 0x0002d8, 0x000ced,
+0x000dec, 0x0005f8, 0x0001ec, 0x00ff09, 0x0002e6, 0x0020a5, 0x0008b6, 0x00ff27,
+0x0000d1, 0x0012b5, 0x0014cc, 0x00fe03, 0x00fd08, 0x0020a0, 0x000eb7, 0x0000be,
+0x00fd01, 0x000df4, 0x0006c1, 0x00ff52, 0x00069d, 0x0000e8, 0x0006ac, 0x0003ec,
+0x0008cf, 0x00fe75, 0x000afc, 0x0004b9, 0x0001d9, 0x00ff7f, 0x00fe52, 0x00fe0f,
+0x00fe74, 0x0001b2, 0x0015f1, 0x0012b9, 0x0012b1, 0x0014a3, 0x000ecd, 0x000ec0,
+0x00fd14, 0x0020a4, 0x00fd19, 0x0003d9, 0x0014af, 0x000dbd, 0x00ffb0, 0x00fd05,
+0x0007a2, 0x0016b6, 0x0002dd, 0x000abd, 0x0013be, 0x0006c2, 0x0005b1, 0x001efb,
+0x0008b7, 0x0007f0, 0x000dad, 0x00fe26, 0x0006a4, 0x000ef6, 0x0007f1, 0x00fe5c,
+0x0001af, 0x00ff96, 0x0006f2, 0x0003cc, 0x0007d7, 0x001eb3, 0x00ff2f, 0x00ff28,
+0x00ff54, 0x00ff91, 0x0005f4, 0x0004d6, 0x000020, 0x00fe01, 0x000cea, 0x00fe76,
+0x0007b3, 0x0008fb, 0x000af7, 0x0001a6, 0x0000e9, 0x000cf0, 0x0004c9, 0x0000ae,
+0x0016b8, 0x0006d5, 0x000bc2, 0x0006d0, 0x0006ef, 0x0004bb, 0x00ffc3, 0x00fee9,
+0x00ff38, 0x000ef0, 0x000ee2, 0x0000fc, 0x0005fc, 0x00fed2, 0x0015e7, 0x0005e8,
+0x0000ed, 0x0002bc, 0x001ecc, 0x0008b0, 0x0001bd, 0x000ce2, 0x000da3, 0x0007cb,
+0x00047e, 0x00ff92, 0x00006f, 0x001eeb, 0x000ed1, 0x00ffcd, 0x000de6, 0x0005d3,
+0x000ef3, 0x00fe5e, 0x001ea6, 0x0006be, 0x000ad1, 0x00fee8, 0x000aaa, 0x0006ad,
+0x0016e1, 0x0005e6, 0x0005d1, 0x000db5, 0x0014f1, 0x0004cc, 0x0009f8, 0x0004b8,
+0x00fe31, 0x0007d0, 0x0004c1, 0x0014bb, 0x0006af, 0x0004c5, 0x0000ac, 0x00ff53,
+0x001eaf, 0x001edb, 0x001ed4, 0x000bce, 0x000597, 0x000adb, 0x0005d5, 0x000dcc,
+0x000bd8, 0x0014a8, 0x0006fe, 0x0012bb, 0x0006a1, 0x0006aa, 0x0008af, 0x000ae9,
+0x00ffe1, 0x0015ef, 0x0004c2, 0x00fef4, 0x00004b, 0x0000b3, 0x0007a5, 0x000ed7,
+0x0012a6
 };
 
-#define KTABLESIZE 2909
-#define KMAXHASH 10
+static const unsigned char ks_name_checks[KSNAMES] = {
+0xad, 0xcc, 0xe1, 0x87, 0x55, 0xd6, 0xe4, 0x24,
+0x63, 0x2c, 0xd4, 0x64, 0xe7, 0xed, 0x4f, 0xa5,
+0x99, 0x64, 0xfe, 0x55, 0xbf, 0x99, 0x2d, 0x80,
+0xc7, 0x61, 0x58, 0xcd, 0xda, 0xb0, 0x00, 0x91,
+0x3e, 0xb8, 0x27, 0x42, 0xc4, 0x22, 0xe4, 0x9d,
+0x09, 0x9b, 0x1c, 0xe1, 0x75, 0x2d, 0x11, 0xa1,
+0xd4, 0x57, 0x97, 0x8b, 0x72, 0xf5, 0x14, 0x72,
+0x28, 0xa9, 0xd3, 0x5d, 0x5d, 0xaa, 0xa2, 0x3b,
+0x0b, 0x6a, 0x69, 0xb5, 0x2f, 0x73, 0x7a, 0x06,
+0xbd, 0x5f, 0xd9, 0x91, 0xe6, 0xb6, 0x97, 0xac,
+0xb1, 0x29, 0x1d, 0xeb, 0x71, 0x02, 0x6e, 0x7e,
+0x3e, 0x97, 0x2a, 0x95, 0x64, 0x10, 0x76, 0xca,
+0x61, 0xbe, 0x38, 0x52, 0x18, 0xec, 0x75, 0x28,
+0x32, 0x80, 0xbe, 0x9b, 0x5f, 0x98, 0x2d, 0x6f,
+0x66, 0xf2, 0x5a, 0x3d, 0x2d, 0x5a, 0x89, 0x51,
+0xfb, 0xcb, 0xe3, 0xc1, 0x71, 0xbf, 0x96, 0xfb,
+0xb4, 0xac, 0xfd, 0x5a, 0x67, 0xe1, 0xf2, 0xea,
+0xff, 0x41, 0x1c, 0xf5, 0xe9, 0x33, 0x80, 0x1c,
+0xc2, 0x3f, 0x0d, 0xa3, 0xf2, 0xbd, 0xa7, 0x31,
+0x13, 0x1f, 0x7f, 0x04, 0xa5, 0xd3, 0x87, 0xaa,
+0xc6, 0x47, 0x43, 0x03, 0xa0, 0xb8, 0x7a, 0x30,
+0x0e, 0x0b, 0x0a, 0x54, 0x9a, 0xd5, 0x81, 0x8e,
+0x2e, 0x3e, 0xaf, 0x32, 0xd5, 0xae, 0x7d, 0x1b,
+0xf7, 0x0d, 0x17, 0x75, 0x09, 0xf4, 0xeb, 0x37,
+0x1f, 0x4d, 0xd2, 0x36, 0x9f, 0xaa, 0x11, 0xd3,
+0xe0, 0x2a, 0x13, 0x64, 0x9f, 0x38, 0x00, 0x30,
+0xd2, 0xb5, 0xbe, 0xe3, 0xeb, 0x98, 0x04, 0x11,
+0x0b, 0xe9, 0xab, 0x07, 0x33, 0xcd, 0xd6, 0xd5,
+0x0e, 0x07, 0x12, 0x48, 0xa5, 0x14, 0x76, 0x17,
+0x0b, 0x5c, 0xea, 0x52, 0xaf, 0x52, 0xf2, 0xd4,
+0x12, 0xea, 0x08, 0xa5, 0xc3, 0xb8, 0x54, 0x08,
+0xa2, 0x09, 0xce, 0x2a, 0x08, 0x24, 0x05, 0xb1,
+0x71, 0x61, 0xa8, 0xde, 0x28, 0x6b, 0xe6, 0x0a,
+0x46, 0xe6, 0x51, 0x59, 0xe7, 0x1c, 0x96, 0xc3,
+0xd8, 0xde, 0x13, 0x80, 0x8e, 0x07, 0xf2, 0xbf,
+0x4a, 0x5e, 0x5b, 0xbc, 0x93, 0x62, 0x56, 0x94,
+0x20, 0xca, 0x88, 0x04, 0x25, 0x6f, 0x43, 0x86,
+0xc8, 0xf5, 0x38, 0x99, 0xf5, 0xc7, 0x8c, 0x5a,
+0xc6, 0x28, 0xb5, 0xdf, 0xbb, 0xe6, 0x9d, 0xfa,
+0x97, 0x46, 0x4a, 0x94, 0x53, 0x75, 0xb6, 0x6f,
+0xc4, 0x6f, 0x4c, 0x87, 0x7d, 0xae, 0x04, 0x9f,
+0x45, 0x6b, 0x3c, 0xb1, 0x81, 0x9f, 0xd0, 0x06,
+0x5d, 0x8d, 0x4f, 0x81, 0x7c, 0x78, 0xc5, 0x43,
+0x5a, 0x5a, 0x8b, 0x56, 0xb3, 0xf5, 0x23, 0x1d,
+0xcd, 0x90, 0x0b, 0x69, 0xb1, 0x53, 0xca, 0xce,
+0xcd, 0x6e, 0xc3, 0x59, 0x8d, 0x79, 0xe0, 0x45,
+0xef, 0xbf, 0x9b, 0xe2, 0xc8, 0x74, 0x84, 0xdb,
+0x8e, 0x42, 0xc2, 0xd7, 0x9d, 0xbc, 0x23, 0xa0,
+0xa1, 0xfb, 0x42, 0x24, 0x89, 0x7c, 0x9d, 0x33,
+0x9b, 0xb5, 0x45, 0x39, 0x38, 0xf9, 0xbb, 0x46,
+0xb5, 0x1c, 0x61, 0x3b, 0x1c, 0x81, 0xf1, 0xd8,
+0x32, 0x7f, 0x3b, 0x12, 0x34, 0xc2, 0xda, 0x65,
+0xf4, 0x78, 0xf5, 0x65, 0x2e, 0x9c, 0xfd, 0x0e,
+0x24, 0x8e, 0x23, 0x21, 0x5f, 0x5e, 0x98, 0x82,
+0x2c, 0x38, 0xd2, 0xf7, 0xe8, 0xe6, 0xba, 0x46,
+0x64, 0xb3, 0xa6, 0x50, 0xf6, 0x09, 0x91, 0xd9,
+0x64, 0x10, 0xfd, 0x69, 0x9d, 0xe5, 0x54, 0x2a,
+0x22, 0xc4, 0xfd, 0xf0, 0x97, 0x49, 0xb5, 0x3e,
+0x12, 0x1a, 0x38, 0xb7, 0xff, 0xdd, 0xe6, 0x17,
+0xb8, 0x68, 0xe4, 0xb0, 0x96, 0xc2, 0xde, 0x69,
+0xa1, 0x83, 0x85, 0x0b, 0xac, 0xa1, 0x11, 0x8d,
+0x20, 0xb7, 0xc7, 0xea, 0xb0, 0x00, 0x6b, 0xda,
+0x3f, 0xfd, 0x1d, 0xe0, 0xce, 0x52, 0x0c, 0x61,
+0xca, 0x35, 0xc0, 0x2f, 0x03, 0x25, 0x86, 0x30,
+0x45, 0x4c, 0x4e, 0xc5, 0xb3, 0xc4, 0x1e, 0x04,
+0x8c, 0x2c, 0xe9, 0xcf, 0x8a, 0x7a, 0x09, 0x74,
+0x87, 0xa5, 0xdf, 0x5a, 0x6f, 0xb2, 0xb1, 0x4a,
+0x6b, 0x9a, 0x68, 0xb0, 0xb1, 0x3e, 0x8f, 0x71,
+0x3f, 0x21, 0xb0, 0x46, 0x35, 0x26, 0x01, 0x67,
+0xea, 0xdf, 0xb6, 0x16, 0x89, 0xeb, 0x84, 0x38,
+0xc0, 0xb1, 0x25, 0x5f, 0xb4, 0xa0, 0x6c, 0x9b,
+0xca, 0x49, 0xe4, 0xe1, 0xf3, 0x92, 0xbb, 0x8a,
+0xf6, 0x37, 0xe4, 0x22, 0x0a, 0x38, 0x22, 0x77,
+0x55, 0x3e, 0x4a, 0xeb, 0x7e, 0xf8, 0x26, 0x3a,
+0x88, 0xb1, 0x78, 0x39, 0xb1, 0xb2, 0x42, 0x8a,
+0x96, 0x8b, 0xba, 0xdc, 0x13, 0x28, 0x9c, 0x4e,
+0x93, 0x58, 0x3c, 0x22, 0x5e, 0xff, 0xc0, 0x62,
+0x93, 0xa6, 0x1a, 0x29, 0x44, 0x77, 0x1a, 0xa7,
+0xc5, 0xb3, 0x05, 0xc8, 0x34, 0xc7, 0x02, 0x73,
+0x5e, 0xfe, 0x24, 0xd3, 0xd5, 0xe5, 0x73, 0xbd,
+0x37, 0x95, 0xa4, 0x1e, 0x29, 0x09, 0xa0, 0x9b,
+0xd5, 0x0f, 0x90, 0xfc, 0x3b, 0x13, 0x95, 0xea,
+0xdd, 0x75, 0x20, 0x0b, 0x57, 0x07, 0x90, 0xc9,
+0xc1, 0x71, 0x37, 0x3b, 0xe0, 0xe4, 0xf0, 0x8a,
+0x3d, 0x18, 0x0d, 0x13, 0x1c, 0x5b, 0x4c, 0x99,
+0xa2, 0xd1, 0xad, 0xf9, 0x44, 0xb3, 0x4e, 0xb7,
+0x99, 0x86, 0xce, 0xb1, 0xc7, 0x3e, 0x1c, 0x3e,
+0xe3, 0x89, 0x06, 0x29, 0xd4, 0x0e, 0x54, 0xbe,
+0xc5, 0xe5, 0xfc, 0x0c, 0xb4, 0xf6, 0xa7, 0xd7,
+0x5f, 0x04, 0xea, 0xb4, 0x10, 0x26, 0xb7, 0x6e,
+0x9b, 0xd8, 0x06, 0x4f, 0xde, 0xc7, 0x1c, 0x67,
+0xcc, 0xc0, 0x48, 0xfa, 0xa9, 0xb0, 0xa1, 0x78,
+0x21, 0x0a, 0x40, 0xd5, 0x87, 0xef, 0x4c, 0xb7,
+0x42, 0xef, 0x21, 0xd5, 0x9a, 0x95, 0x79, 0x3f,
+0x89, 0x10, 0xdf, 0xe8, 0x2b, 0x71, 0x45, 0x49,
+0x0d, 0xa0, 0x55, 0x7c, 0xa0, 0x24, 0x4f, 0xec,
+0x07, 0x59, 0x2c, 0x76, 0x99, 0x18, 0x9c, 0xa0,
+0x73, 0x5d, 0xcd, 0x3b, 0xfc, 0xcf, 0x1c, 0x74,
+0xd6, 0x23, 0xab, 0x35, 0x6a, 0xe4, 0x58, 0xa3,
+0x00, 0x65, 0x05, 0xc8, 0x97, 0x69, 0x39, 0x75,
+0x08, 0x60, 0xe2, 0x52, 0x2c, 0x48, 0xc5, 0x82,
+0xd7, 0xfc, 0x66, 0xf6, 0x82, 0x83, 0x10, 0xe3,
+0x33, 0xe8, 0x64, 0x30, 0xbb, 0x78, 0xc1, 0x51,
+0x75, 0xe7, 0x57, 0xc1, 0x87, 0xf6, 0xbc, 0x74,
+0x61, 0x37, 0x2b, 0xdc, 0x7e, 0x5f, 0x0c, 0x1f,
+0x45, 0xcc, 0xb0, 0x53, 0x4a, 0x4b, 0xeb, 0xf2,
+0xd8, 0x4d, 0xa2, 0x9e, 0x0e, 0x84, 0xff, 0x2f,
+0xb8, 0xdd, 0x00, 0xc2, 0x0c, 0xfc, 0x62, 0xcc,
+0x8f, 0x57, 0x56, 0x0b, 0x37, 0xa4, 0x0b, 0x5a,
+0xcc, 0x56, 0xed, 0x55, 0x63, 0xc5, 0x37, 0x42,
+0x8f, 0x40, 0x14, 0xe1, 0x6e, 0x46, 0x4e, 0x73,
+0xcd, 0x66, 0x10, 0x55, 0x45, 0xe7, 0xc1, 0xfb,
+0x27, 0xfc, 0xd4, 0x8d, 0x7d, 0x61, 0x42, 0x4e,
+0x8e, 0xfc, 0x82, 0x84, 0xcc, 0x88, 0xf2, 0xb8,
+0x49, 0x33, 0x2f, 0x8c, 0x25, 0xf7, 0x67, 0x42,
+0x5f, 0x8e, 0x27, 0xb4, 0xf6, 0x5f, 0xe4, 0xe5,
+0xda, 0xf8, 0x95, 0x21, 0x6c, 0xae, 0x58, 0xa1,
+0x2b, 0xab, 0xb8, 0x8d, 0x61, 0x57, 0x3b, 0x17,
+0xfe, 0xfd, 0xb4, 0xee, 0x09, 0x21, 0x41, 0x5d,
+0x40, 0x32, 0x18, 0x00, 0x55, 0x71, 0xc8, 0x10,
+0xc1, 0x32, 0x98, 0x5c, 0x32, 0x8c, 0xca, 0xb3,
+0x66, 0x97, 0x23, 0x11, 0x15, 0x4c, 0xf1, 0x97,
+0xd4, 0x84, 0x51, 0xc6, 0x7e, 0x4a, 0xf5, 0x12,
+0x20, 0xc9, 0x98, 0x3d, 0x05, 0x04, 0xd8, 0x7b,
+0x4c, 0x92, 0x0e, 0x38, 0xa1, 0x64, 0x00, 0xcf,
+0x67, 0x8d, 0x6d, 0x92, 0x70, 0xa1, 0xc3, 0x16,
+0x9a, 0xd9, 0x4a, 0x5d, 0xc2, 0xc3, 0x59, 0xc1,
+0x1e, 0x4b, 0xd5, 0x00, 0xa6, 0x1d, 0x9d, 0x21,
+0xf3, 0x42, 0x5d, 0x42, 0x7d, 0x62, 0xc5, 0xc3,
+0xb6, 0x88, 0x43, 0x3e, 0xca, 0xba, 0xc8, 0xd4,
+0x06, 0x58, 0x4c, 0x98, 0x8e, 0x6a, 0xc3, 0x04,
+0xd2, 0x02, 0x81, 0x85, 0x02, 0x87, 0x7e, 0x59,
+0xb3, 0x81, 0xfd, 0x76, 0x61, 0x1d, 0x1e, 0xde,
+0x19, 0xc3, 0x23, 0xb0, 0x88, 0x1b, 0xb5, 0x03,
+0x4a, 0x67, 0x37, 0xe6, 0x12, 0xa0, 0x57, 0x3b,
+0x47, 0x31, 0xb9, 0xb8, 0xb4, 0x18, 0xb5, 0x72,
+0x2d, 0x99, 0xea, 0xf4, 0xd4, 0x47, 0xad, 0xfa,
+0xe7, 0xfd, 0x61, 0xc2, 0x77, 0x1e, 0x2c, 0xea,
+0x47, 0x77, 0x10, 0xc7, 0xe6, 0x8c, 0x74, 0x7a,
+0x11, 0xf9, 0xac, 0xc6, 0x01, 0xb2, 0xc9, 0xa8,
+0x11, 0x0e, 0xb9, 0x7d, 0xda, 0xdf, 0x41, 0xd1,
+0x00, 0x1b, 0xcf, 0x3c, 0x74, 0x68, 0x40, 0x43,
+0x7a, 0x67, 0x58, 0x9d, 0x42, 0xc9, 0x0f, 0xcd,
+0x15, 0x34, 0xb3, 0x52, 0x5b, 0xfc, 0xb2, 0x2b,
+0x34, 0xbd, 0x2c, 0x0e, 0x46, 0x95, 0xd3, 0x15,
+0x3f, 0x6b, 0x61, 0x35, 0x01, 0x40, 0x82, 0x46,
+0x55, 0xe4, 0x37, 0xf4, 0x88, 0x6f, 0x70, 0xcb,
+0x62, 0x1d, 0xb3, 0x0c, 0xa3, 0x72, 0x60, 0x85,
+0x0c, 0xb4, 0xc2, 0x6a, 0x45, 0x77, 0x35, 0x17,
+0x79, 0x7b, 0x4d, 0xfb, 0x33, 0xc0, 0xc5, 0x93,
+0x50, 0x10, 0x89, 0x04, 0x02, 0x78, 0xe5, 0xc6,
+0xdf, 0xb9, 0xdc, 0x0a, 0x55, 0xf2, 0x03, 0xde,
+0x7b, 0xe6, 0xc3, 0x7f, 0x57, 0xc4, 0xb0, 0x7f,
+0x16, 0xc0, 0x36, 0x5b, 0xd4, 0xf4, 0x89, 0x52,
+0xec, 0x35, 0xa5, 0x99, 0xca, 0xb0, 0x32, 0x2b,
+0x33, 0x45, 0xfd, 0x7c, 0x88, 0xb7, 0x4a, 0xad,
+0x25, 0x85, 0x3d, 0x3e, 0x58, 0x95, 0xde, 0x55,
+0xed, 0x82, 0xfd, 0xf8, 0x02, 0x19, 0x65, 0x3e,
+0xd2, 0x1c, 0x5b, 0xe0, 0x26, 0xe0, 0xad, 0x4c,
+0xce, 0xb8, 0xdc, 0x0f, 0x47, 0x8a, 0xaa, 0x33,
+0xe2, 0x00, 0x0a, 0xb2, 0x5a, 0x19, 0xa9, 0x11,
+0xf9, 0x8e, 0x66, 0xe0, 0x71, 0x45, 0x5b, 0x51,
+0x7e, 0xdf, 0x62, 0xf7, 0xd1, 0x77, 0x23, 0x70,
+0x52, 0xac, 0x40, 0xf9, 0x72, 0x38, 0x06, 0x92,
+0x3b, 0x90, 0x16, 0xf4, 0x35, 0xb6, 0x22, 0x9a,
+0x1f, 0xf1, 0x99, 0xb7, 0xd9, 0xa7, 0x23, 0xef,
+0x67, 0x65, 0xb5, 0x9e, 0xe6, 0x56, 0xff, 0xec,
+0xcb, 0x90, 0x6a, 0xa7, 0x2c, 0xb2, 0xae, 0xaa,
+0xb4, 0x2e, 0xb2, 0x3a, 0xf4, 0x65, 0xb8, 0x90,
+0x76, 0x5a, 0x11, 0xc5, 0x54, 0x69, 0x94, 0x7b,
+0xd1, 0x83, 0xdf, 0x57, 0x08, 0x75, 0x2d, 0x04,
+0xde, 0x9c, 0x0a, 0x41, 0xb2, 0x72, 0xc7, 0x62,
+0xe1, 0x93, 0xbc, 0x03, 0x2a, 0x7f, 0x93, 0xc6,
+0xf3, 0x46, 0x2c, 0x83, 0xc2, 0x2a, 0xb9, 0x7b,
+0x2a, 0xf1, 0xd2, 0x5d, 0x7b, 0xbb, 0x25, 0xd1,
+0x31, 0x48, 0x3a, 0x40, 0x46, 0xa4, 0xc7, 0xb0,
+0x5e, 0xb7, 0xd8, 0x30, 0x5d, 0x12, 0x92, 0xa8,
+0x4c, 0xd4, 0x6d, 0x79, 0x46, 0xa2, 0x74, 0x0e,
+0x96, 0x6c, 0xc7, 0x20, 0xfe, 0xeb, 0x5e, 0xd3,
+0x95, 0xf8, 0x17, 0x93, 0x9e, 0xeb, 0x98, 0x8e,
+0xf9, 0xeb, 0x13, 0xe7, 0x7b, 0xcd, 0xeb, 0x8a,
+0xe2, 0xdb, 0x06, 0x77, 0x7c, 0xbe, 0xe9, 0x38,
+0xe8, 0x3d, 0x7e, 0x61, 0x69, 0x1f, 0xb0, 0x38,
+0x0d, 0xea, 0xc6, 0x2a, 0x08, 0xc9, 0x18, 0x63,
+0x92, 0x0a, 0xbe, 0xf4, 0xb9, 0xe7, 0xcd, 0x87,
+0xd6, 0x8f, 0x99, 0xe4, 0x00, 0x79, 0x12, 0x6c,
+0x92, 0x47, 0xbf, 0xb0, 0x48, 0x64, 0x33, 0x59,
+0xbc, 0x11, 0xc6, 0xb2, 0x9d, 0xfe, 0x9e, 0x4b,
+0x86, 0x59, 0x02, 0xb5, 0x49, 0x74, 0x80, 0x53,
+0xff, 0xf1, 0xb6, 0xf7, 0x72, 0x2d, 0xdd, 0x91,
+0x59, 0xa3, 0x6e, 0x0b, 0x76, 0x57, 0x9e, 0xfc,
+0x1e, 0xcd, 0x65, 0x99, 0x26, 0x6c, 0x21, 0xa7,
+0x3b, 0xb3, 0xdc, 0xe6, 0xf9, 0x5b, 0xc7, 0x96,
+0x3b, 0xc2, 0x52, 0x1f, 0x53, 0x86, 0x35, 0xcc,
+0x3c, 0x94, 0x08, 0x08, 0xa6, 0x0d, 0x53, 0x77,
+0x55, 0x2e, 0xe3, 0x64, 0x98, 0x7d, 0x2e, 0x13,
+0x50, 0xf7, 0x3e, 0x8d, 0x5d, 0xae, 0x9c, 0xa3,
+0x6f, 0x64, 0xb7, 0x41, 0xe3, 0x72, 0x71, 0x0c,
+0xd2, 0x1a, 0x90, 0xcb, 0x81, 0xaf, 0x00, 0x64,
+0x8f, 0x7d, 0xb8, 0xcc, 0x1a, 0x12, 0xff, 0xf8,
+0x98, 0x34, 0xdb, 0x1b, 0xc7, 0xc0, 0x98, 0x91,
+0x76, 0x5e, 0xed, 0x2c, 0xd3, 0xec, 0x0d, 0xb9,
+0x5c, 0xda, 0x5b, 0x12, 0xa1, 0x90, 0xe7, 0x67,
+0xd7, 0x06, 0xae, 0xed, 0x56, 0xf6, 0x1a, 0x3c,
+0xbd, 0x60, 0xe6, 0xcc, 0x01, 0x7a, 0x5d, 0x20,
+0x5c, 0x01, 0x33, 0xb7, 0xe1, 0x49, 0x94, 0xc4,
+0x08, 0xd0, 0xa2, 0x4c, 0x60, 0xd2, 0x6b, 0x63,
+0xd5, 0x43, 0x8e, 0xca, 0x21, 0xe2, 0xca, 0x8a,
+0x0d, 0x8e, 0x2a, 0xd5, 0xea, 0x0c, 0x48, 0x0c,
+0x6e, 0xbb, 0xc9, 0x96, 0x2d, 0xfe, 0xd0, 0xfd,
+0x54, 0x8e, 0x4b, 0xde, 0x59, 0x51, 0x15, 0xc8,
+0x9f, 0x99, 0x6e, 0x07, 0x1f, 0x2e, 0xd0, 0x82,
+0x8b, 0x96, 0xb1, 0x3a, 0x67, 0xcc, 0xa6, 0xd5,
+0x9f
+};
 
-static const unsigned short hashString[KTABLESIZE] = {
-0x0000, 0x0000, 0x21eb, 0x0000, 0x0000, 0x2356, 0x2302, 0x0000,
-0x4090, 0x0000, 0x0000, 0x0000, 0x0000, 0x2c60, 0x220f, 0x522c,
-0x666b, 0x3d02, 0x19d9, 0x0000, 0x1487, 0x0000, 0x2362, 0x0000,
-0x0000, 0x622d, 0x21f7, 0x0000, 0x5717, 0x230e, 0x239e, 0x0000,
-0x43da, 0x6164, 0x23ce, 0x534a, 0x0262, 0x5601, 0x22c6, 0x0223,
-0x1e57, 0x48bb, 0x23c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x17a9,
-0x124c, 0x1252, 0x1258, 0x125e, 0x1264, 0x126a, 0x1270, 0x1276,
-0x127c, 0x1282, 0x6547, 0x5283, 0x0000, 0x426d, 0x2115, 0x0000,
-0x0000, 0x12d3, 0x12d9, 0x12df, 0x12e5, 0x12eb, 0x12f1, 0x12f7,
-0x12fd, 0x1303, 0x1309, 0x130f, 0x1315, 0x131b, 0x1321, 0x026d,
-0x132d, 0x1333, 0x0bea, 0x133f, 0x1345, 0x134b, 0x1351, 0x1357,
-0x135d, 0x1363, 0x1369, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x13d5, 0x13db, 0x13e1, 0x13e7, 0x13ed, 0x13f3, 0x13f9,
-0x13ff, 0x1405, 0x140b, 0x1411, 0x1417, 0x141d, 0x1423, 0x1429,
-0x142f, 0x1435, 0x143b, 0x1441, 0x1447, 0x144d, 0x1453, 0x1459,
-0x145f, 0x1465, 0x146b, 0x1cf2, 0x3371, 0x07d2, 0x0000, 0x405a,
-0x0000, 0x0000, 0x3c6a, 0x6566, 0x0000, 0x0000, 0x28a4, 0x0842,
-0x2eed, 0x4f73, 0x0000, 0x176a, 0x0000, 0x0000, 0x227d, 0x4f3c,
-0x391a, 0x0000, 0x3ede, 0x0000, 0x0000, 0x17e8, 0x1a14, 0x0000,
-0x4e1c, 0x3f7a, 0x0000, 0x6378, 0x003d, 0x0000, 0x4111, 0x0112,
-0x0000, 0x0317, 0x3489, 0x2264, 0x0000, 0x1339, 0x070c, 0x0000,
-0x0000, 0x5e0c, 0x645e, 0x6326, 0x0718, 0x4937, 0x5cf7, 0x03f4,
-0x0db8, 0x01ad, 0x0000, 0x1c2d, 0x0000, 0x0000, 0x4af6, 0x33ba,
-0x0000, 0x491b, 0x0000, 0x03e6, 0x0000, 0x04b4, 0x04bb, 0x04c2,
-0x04c9, 0x04d0, 0x04d7, 0x04de, 0x04e5, 0x04ec, 0x0000, 0x16ab,
-0x0000, 0x0503, 0x0512, 0x0521, 0x0530, 0x053f, 0x054e, 0x055d,
-0x056c, 0x057b, 0x19ef, 0x19cc, 0x0000, 0x059a, 0x05a9, 0x05b8,
-0x05c7, 0x05d6, 0x05e5, 0x05f4, 0x0603, 0x0612, 0x0000, 0x1f43,
-0x2a8c, 0x30cd, 0x0c1a, 0x2072, 0x0000, 0x0000, 0x0679, 0x312c,
-0x0000, 0x1b54, 0x0000, 0x0000, 0x0685, 0x270c, 0x3c87, 0x1327,
-0x0000, 0x6528, 0x0a7f, 0x0000, 0x6642, 0x0b1d, 0x0000, 0x0000,
-0x5fd2, 0x5e91, 0x0000, 0x1f38, 0x0000, 0x3eb2, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x4073, 0x0000, 0x0000, 0x0000,
-0x0000, 0x489b, 0x0000, 0x0000, 0x1ede, 0x5bb7, 0x0000, 0x0b08,
-0x0000, 0x0000, 0x11c4, 0x0000, 0x0000, 0x62d2, 0x0000, 0x5deb,
-0x275a, 0x0000, 0x0209, 0x0000, 0x267a, 0x036e, 0x0000, 0x0000,
-0x26ed, 0x0000, 0x31d8, 0x0000, 0x0000, 0x0000, 0x2787, 0x1847,
-0x1db4, 0x0000, 0x183d, 0x2054, 0x136f, 0x5c3d, 0x0000, 0x0000,
-0x0000, 0x64d9, 0x3cba, 0x0000, 0x02ff, 0x0000, 0x12cc, 0x5f02,
-0x1995, 0x4f01, 0x1223, 0x044c, 0x09fd, 0x2e49, 0x0ac1, 0x0000,
-0x1b39, 0x27e7, 0x0000, 0x0052, 0x3cb3, 0x5c91, 0x28c6, 0x1288,
-0x3ccf, 0x3f99, 0x30ad, 0x1e7c, 0x3b7b, 0x0000, 0x043d, 0x15be,
-0x0000, 0x0000, 0x0000, 0x0d23, 0x24d0, 0x0000, 0x0000, 0x0d55,
-0x0000, 0x0387, 0x0000, 0x0000, 0x1d6c, 0x0000, 0x1536, 0x17d3,
-0x3cd6, 0x0000, 0x25b7, 0x087e, 0x269f, 0x0000, 0x0000, 0x31fe,
-0x2e68, 0x0000, 0x651a, 0x0000, 0x294e, 0x6143, 0x217c, 0x44b8,
-0x4e33, 0x4b8c, 0x38e0, 0x5dda, 0x2778, 0x0000, 0x5d94, 0x179e,
-0x13bd, 0x4da0, 0x1fd1, 0x38a6, 0x3981, 0x12a9, 0x041c, 0x3d96,
-0x5e1c, 0x0000, 0x0000, 0x32e2, 0x0000, 0x0000, 0x0000, 0x1d1b,
-0x5be9, 0x0000, 0x15d3, 0x2816, 0x1dd7, 0x0000, 0x197a, 0x3341,
-0x00a0, 0x5c5e, 0x5d83, 0x2c00, 0x0000, 0x0000, 0x0000, 0x0000,
-0x5c80, 0x0000, 0x0000, 0x5cc4, 0x0000, 0x3ca2, 0x0000, 0x19e4,
-0x36b5, 0x3a20, 0x0000, 0x2227, 0x5d3d, 0x0000, 0x0000, 0x2fe9,
-0x1e87, 0x0000, 0x04f3, 0x04fb, 0x050a, 0x0519, 0x0528, 0x0537,
-0x0546, 0x0555, 0x0564, 0x0573, 0x05fb, 0x060a, 0x0000, 0x306a,
-0x0000, 0x0000, 0x32b2, 0x323e, 0x1fea, 0x2efd, 0x4d4c, 0x0000,
-0x3311, 0x3321, 0x058a, 0x42fa, 0x40cd, 0x2e7a, 0x0000, 0x3b11,
-0x0000, 0x32f1, 0x0000, 0x653c, 0x5c1b, 0x0000, 0x47bb, 0x0000,
-0x122d, 0x3331, 0x0000, 0x1918, 0x0000, 0x3361, 0x163e, 0x3301,
-0x62c8, 0x15b4, 0x0621, 0x0631, 0x0641, 0x0651, 0x0661, 0x0671,
-0x0000, 0x655c, 0x0000, 0x01cc, 0x0000, 0x40fe, 0x4243, 0x0000,
-0x5d19, 0x6472, 0x0000, 0x31ee, 0x45f3, 0x0000, 0x0000, 0x1b82,
-0x0000, 0x64e8, 0x1b8d, 0x0000, 0x4483, 0x0000, 0x0000, 0x1e08,
-0x0000, 0x429e, 0x0000, 0x1b6c, 0x2044, 0x39e9, 0x0000, 0x5405,
-0x0000, 0x0000, 0x117c, 0x0000, 0x1729, 0x1242, 0x0000, 0x0000,
-0x0000, 0x0000, 0x3c50, 0x0000, 0x4cc8, 0x2ff8, 0x0aa2, 0x0000,
-0x0000, 0x3019, 0x1baf, 0x6442, 0x3039, 0x1bdc, 0x5fdc, 0x0000,
-0x0000, 0x25cc, 0x309d, 0x1739, 0x30bd, 0x2d6d, 0x3eed, 0x609a,
-0x30fc, 0x310c, 0x394e, 0x0000, 0x0401, 0x175a, 0x0f43, 0x0000,
-0x0000, 0x30dc, 0x1106, 0x0000, 0x273a, 0x0000, 0x03d8, 0x1866,
-0x4edf, 0x1496, 0x1ba4, 0x327f, 0x0000, 0x02f2, 0x5779, 0x30ec,
-0x6468, 0x0000, 0x40ab, 0x17fd, 0x59f7, 0x1925, 0x24c0, 0x0000,
-0x0000, 0x6218, 0x0000, 0x0000, 0x0000, 0x1579, 0x0000, 0x0000,
-0x5b56, 0x1dbf, 0x0000, 0x2fd9, 0x0000, 0x296e, 0x3774, 0x4228,
-0x120d, 0x0000, 0x545c, 0x3c06, 0x0250, 0x0000, 0x09cd, 0x0000,
-0x17b4, 0x26ce, 0x0000, 0x0000, 0x5a9d, 0x0000, 0x6030, 0x0000,
-0x5a37, 0x0000, 0x0000, 0x6450, 0x0dd0, 0x0de4, 0x0df8, 0x0e0c,
-0x0e20, 0x2824, 0x1c09, 0x0829, 0x0000, 0x27d8, 0x5f27, 0x0000,
-0x3049, 0x3cc1, 0x5f1c, 0x0000, 0x001e, 0x0000, 0x0000, 0x1f5c,
-0x6532, 0x293f, 0x2026, 0x0000, 0x0000, 0x3cc8, 0x0000, 0x0000,
-0x0000, 0x1e70, 0x0e34, 0x63a8, 0x56d5, 0x0000, 0x50dc, 0x1cd4,
-0x0000, 0x0000, 0x42ad, 0x0000, 0x1ec5, 0x41c4, 0x58a7, 0x43cf,
-0x0000, 0x0ed2, 0x0ee4, 0x0ef6, 0x0f08, 0x0f1a, 0x0000, 0x0000,
-0x3758, 0x4042, 0x0000, 0x0000, 0x0000, 0x1292, 0x0000, 0x0000,
-0x0000, 0x55c2, 0x24f0, 0x3fd6, 0x0000, 0x0000, 0x5973, 0x0000,
-0x1c8e, 0x21a8, 0x0000, 0x0000, 0x266a, 0x21c9, 0x53a0, 0x189b,
-0x155f, 0x21b3, 0x0000, 0x014d, 0x3fab, 0x39fb, 0x23da, 0x21d4,
-0x3bbf, 0x2769, 0x0000, 0x185b, 0x147f, 0x21be, 0x0000, 0x4442,
-0x5843, 0x5a57, 0x0000, 0x0f8a, 0x0000, 0x0000, 0x57b9, 0x2c9c,
-0x0000, 0x2121, 0x5bfa, 0x0092, 0x0000, 0x18a6, 0x5abd, 0x1a41,
-0x4a88, 0x212c, 0x5fa1, 0x0000, 0x0f72, 0x0000, 0x6130, 0x1c49,
-0x0000, 0x0000, 0x3618, 0x0000, 0x414e, 0x2137, 0x431b, 0x26be,
-0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x5f74, 0x06f4, 0x3bd9,
-0x5f32, 0x0000, 0x0000, 0x0000, 0x0700, 0x0000, 0x441b, 0x2833,
-0x0000, 0x1d64, 0x0000, 0x427d, 0x0000, 0x0000, 0x50ea, 0x27f6,
-0x0000, 0x0d46, 0x11ad, 0x139e, 0x5a07, 0x0a70, 0x0000, 0x4606,
-0x5b37, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5dfb,
-0x0000, 0x0000, 0x0000, 0x0000, 0x5fac, 0x0000, 0x0000, 0x1b77,
-0x0000, 0x5c4d, 0x1a2b, 0x0000, 0x43f3, 0x4472, 0x0000, 0x0062,
-0x0000, 0x65c9, 0x0000, 0x0000, 0x14e8, 0x4568, 0x0000, 0x3ea4,
-0x0000, 0x5c6f, 0x156e, 0x0000, 0x0000, 0x26dd, 0x5854, 0x0000,
-0x272a, 0x1ce2, 0x0000, 0x0000, 0x50f8, 0x0000, 0x0ab1, 0x0000,
-0x1692, 0x485a, 0x26fc, 0x54ca, 0x2fc9, 0x0000, 0x26ae, 0x14b6,
-0x138d, 0x0000, 0x3686, 0x1890, 0x2806, 0x1bed, 0x0000, 0x0770,
-0x0000, 0x5ca1, 0x0000, 0x62fc, 0x4d8e, 0x4011, 0x59c6, 0x3e89,
-0x0000, 0x4835, 0x0000, 0x6191, 0x2f4e, 0x0000, 0x2500, 0x1bc6,
-0x3be8, 0x38ce, 0x1bd1, 0x0179, 0x0000, 0x0000, 0x3d70, 0x0000,
-0x271a, 0x0582, 0x0000, 0x0592, 0x5ebb, 0x05a1, 0x55af, 0x05b0,
-0x4d2f, 0x05bf, 0x0000, 0x05ce, 0x409c, 0x05dd, 0x1956, 0x05ec,
-0x3993, 0x2689, 0x5832, 0x326f, 0x46ac, 0x5876, 0x3f40, 0x18e3,
-0x466e, 0x0000, 0x5018, 0x0000, 0x0000, 0x5922, 0x42be, 0x32a2,
-0x0137, 0x32d2, 0x0000, 0x4ab1, 0x507a, 0x469d, 0x464e, 0x0000,
-0x0ebc, 0x3a33, 0x4515, 0x35b8, 0x287c, 0x0000, 0x0d34, 0x0000,
-0x3445, 0x44c6, 0x58ff, 0x29af, 0x4ffb, 0x0000, 0x08dc, 0x0000,
-0x4380, 0x601b, 0x0000, 0x3d13, 0x0893, 0x0000, 0x0000, 0x0000,
-0x0000, 0x48ad, 0x3659, 0x15f2, 0x1610, 0x53d0, 0x4817, 0x0000,
-0x1158, 0x5a68, 0x0394, 0x3a4c, 0x45bf, 0x18b6, 0x57ca, 0x0000,
-0x0000, 0x33dc, 0x617c, 0x3e27, 0x5d07, 0x5f10, 0x5ace, 0x0000,
-0x0000, 0x0c88, 0x0000, 0x0000, 0x0000, 0x5f48, 0x1066, 0x2af6,
-0x0000, 0x325e, 0x0000, 0x0fcf, 0x0000, 0x0000, 0x0000, 0x49a2,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16b2, 0x1677,
-0x0000, 0x1a56, 0x46dc, 0x1dcc, 0x1c62, 0x0000, 0x0000, 0x1b61,
-0x5d4e, 0x2f1c, 0x1bfe, 0x5e3e, 0x0000, 0x0000, 0x393b, 0x5119,
-0x0000, 0x042d, 0x263a, 0x0000, 0x0a3a, 0x47cc, 0x3e68, 0x15a2,
-0x4dde, 0x0000, 0x4f62, 0x0000, 0x48cc, 0x33a9, 0x0000, 0x0000,
-0x2e8a, 0x0000, 0x0190, 0x0000, 0x27c9, 0x0000, 0x552b, 0x1a36,
-0x0000, 0x3c10, 0x1a4b, 0x3802, 0x0000, 0x0000, 0x4d69, 0x0000,
-0x0000, 0x0000, 0x14db, 0x03af, 0x5cb2, 0x486c, 0x0a8e, 0x0000,
-0x634e, 0x0000, 0x0000, 0x107b, 0x0000, 0x3350, 0x0000, 0x0b3d,
-0x0000, 0x4db7, 0x2f3d, 0x2624, 0x1237, 0x5f09, 0x0000, 0x0000,
-0x0000, 0x0000, 0x14f0, 0x18ee, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x4c23, 0x0000, 0x2195, 0x0000,
-0x0000, 0x0000, 0x48ef, 0x0d79, 0x1fb8, 0x20c6, 0x0000, 0x47dd,
-0x0000, 0x477b, 0x0000, 0x305a, 0x0000, 0x0000, 0x1554, 0x193b,
-0x0000, 0x0000, 0x0000, 0x0000, 0x41da, 0x3af8, 0x0000, 0x3029,
-0x0000, 0x4579, 0x5d72, 0x63b7, 0x0000, 0x2bad, 0x0000, 0x44e5,
-0x5475, 0x4808, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x1909, 0x0000, 0x3da0, 0x2cea, 0x25f6, 0x0000, 0x3b23, 0x0c5e,
-0x0000, 0x0000, 0x3e4b, 0x0913, 0x0000, 0x63e4, 0x43c4, 0x0000,
-0x4982, 0x47f4, 0x0000, 0x01dd, 0x649f, 0x15e6, 0x459c, 0x0000,
-0x0000, 0x0000, 0x0000, 0x1970, 0x428e, 0x3e7c, 0x487a, 0x0000,
-0x0000, 0x0000, 0x2859, 0x18cd, 0x2d4c, 0x0000, 0x0000, 0x1fc6,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0b2c, 0x0000, 0x0000,
-0x0000, 0x53ee, 0x60b2, 0x1d49, 0x0000, 0x63f2, 0x0000, 0x0000,
-0x0000, 0x0000, 0x3647, 0x6570, 0x0000, 0x0000, 0x045a, 0x0463,
-0x046c, 0x0475, 0x047e, 0x0487, 0x0490, 0x0499, 0x04a2, 0x04ab,
-0x0000, 0x0000, 0x0000, 0x23e5, 0x4f2c, 0x0000, 0x0000, 0x0000,
-0x10cb, 0x1058, 0x0000, 0x3d25, 0x0000, 0x0000, 0x0000, 0x4614,
-0x5af1, 0x4f9a, 0x0000, 0x3c91, 0x0000, 0x5f52, 0x0000, 0x0000,
-0x1e93, 0x28d7, 0x4b57, 0x4e9c, 0x0000, 0x62b0, 0x4dcd, 0x1965,
-0x0000, 0x2d8c, 0x60e2, 0x27ba, 0x4c13, 0x0000, 0x0000, 0x0000,
-0x41f2, 0x2dad, 0x3794, 0x0c9e, 0x0000, 0x0000, 0x0000, 0x0000,
-0x1f91, 0x0000, 0x0000, 0x6082, 0x0000, 0x3194, 0x4769, 0x63d5,
-0x0000, 0x1731, 0x0000, 0x0000, 0x2a72, 0x59b5, 0x51cd, 0x1a6e,
-0x0000, 0x0000, 0x1650, 0x56b3, 0x658e, 0x137f, 0x10d9, 0x0000,
-0x0000, 0x10a0, 0x55eb, 0x0000, 0x38c0, 0x3f4b, 0x6481, 0x0000,
-0x0000, 0x0000, 0x0000, 0x3008, 0x1813, 0x313b, 0x4757, 0x0000,
-0x0000, 0x0010, 0x4cda, 0x0798, 0x0000, 0x0000, 0x17f2, 0x4bb3,
-0x0000, 0x0000, 0x4175, 0x3a7b, 0x0000, 0x0000, 0x65a2, 0x0000,
-0x0000, 0x104a, 0x4202, 0x1fad, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x5546, 0x0000, 0x0000, 0x35f2, 0x6006,
-0x0000, 0x320d, 0x0000, 0x0000, 0x0619, 0x1015, 0x5245, 0x0629,
-0x33c9, 0x4e87, 0x0639, 0x0000, 0x02a9, 0x0649, 0x02d0, 0x54b3,
-0x0659, 0x529a, 0x2c24, 0x0669, 0x02bd, 0x1f1c, 0x29d2, 0x0000,
-0x421c, 0x4bc3, 0x2491, 0x0000, 0x0000, 0x57db, 0x0000, 0x0000,
-0x1dfd, 0x0000, 0x2df1, 0x5911, 0x0000, 0x0000, 0x65fa, 0x0000,
-0x0000, 0x0000, 0x0000, 0x32c2, 0x0200, 0x0000, 0x5db7, 0x440e,
-0x021a, 0x28fa, 0x39bd, 0x01f7, 0x0000, 0x0000, 0x0000, 0x0000,
-0x58c9, 0x0000, 0x6294, 0x0000, 0x5e7f, 0x65ec, 0x4736, 0x0000,
-0x62a2, 0x0000, 0x49f8, 0x1ef7, 0x0000, 0x02a0, 0x4ac0, 0x0000,
-0x0000, 0x3e35, 0x0000, 0x274b, 0x0000, 0x0000, 0x4a08, 0x640f,
-0x64ca, 0x1946, 0x4927, 0x0297, 0x0000, 0x39d3, 0x0000, 0x0000,
-0x425f, 0x438d, 0x4a27, 0x0855, 0x61f0, 0x0000, 0x0000, 0x0000,
-0x0239, 0x0000, 0x08c2, 0x20ed, 0x0000, 0x650c, 0x0000, 0x2f81,
-0x434b, 0x3e40, 0x2c89, 0x0000, 0x3e0a, 0x0000, 0x4a37, 0x1c9b,
-0x2542, 0x0784, 0x255c, 0x2569, 0x2576, 0x2583, 0x2590, 0x259d,
-0x25aa, 0x1a08, 0x458d, 0x0000, 0x0000, 0x0000, 0x4a67, 0x6430,
-0x51e5, 0x0000, 0x0bd2, 0x0000, 0x1c13, 0x4122, 0x3ef8, 0x35d2,
-0x55d7, 0x0000, 0x0000, 0x58ed, 0x0000, 0x0000, 0x3e5b, 0x028e,
-0x19fa, 0x3399, 0x0000, 0x2142, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x22ea, 0x0000, 0x20de, 0x0000, 0x231a, 0x0000, 0x21df,
-0x1de4, 0x22f6, 0x4c80, 0x2203, 0x0000, 0x22ae, 0x61c6, 0x1e10,
-0x0000, 0x22d2, 0x2326, 0x233e, 0x0000, 0x1cfd, 0x0b5b, 0x221b,
-0x0000, 0x2258, 0x44a6, 0x0a1a, 0x2080, 0x2296, 0x0000, 0x234a,
-0x6044, 0x2271, 0x4cb3, 0x236e, 0x22ba, 0x224c, 0x1da7, 0x22a2,
-0x0000, 0x23aa, 0x0000, 0x2234, 0x0000, 0x0358, 0x57fd, 0x0b71,
-0x23b6, 0x037b, 0x0000, 0x2392, 0x034c, 0x2be4, 0x2240, 0x237a,
-0x0000, 0x0000, 0x5214, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x2b5e, 0x0000, 0x28b5, 0x4d7c, 0x0000, 0x0000, 0x0000, 0x31a5,
-0x0000, 0x0000, 0x36ed, 0x3e97, 0x2dbe, 0x5789, 0x0000, 0x3ba6,
-0x2b92, 0x22de, 0x5b03, 0x0000, 0x0000, 0x43b3, 0x0000, 0x5ef7,
-0x3403, 0x0000, 0x5175, 0x0000, 0x14c5, 0x3419, 0x0000, 0x5dc8,
-0x392b, 0x03a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0c74, 0x0000,
-0x0a4c, 0x4e0a, 0x4e71, 0x0000, 0x1b1d, 0x0000, 0x5a79, 0x0000,
-0x6490, 0x0000, 0x657a, 0x3f04, 0x4213, 0x0000, 0x0000, 0x0000,
-0x2386, 0x25e5, 0x2f9f, 0x3608, 0x4adf, 0x1d0d, 0x5adf, 0x2510,
-0x0000, 0x3627, 0x209c, 0x2158, 0x4543, 0x0000, 0x0000, 0x1592,
-0x3dab, 0x5a27, 0x1d39, 0x0000, 0x0000, 0x2189, 0x315c, 0x3dfb,
-0x0000, 0x2170, 0x295d, 0x563f, 0x433d, 0x0000, 0x0000, 0x2164,
-0x0000, 0x4fe0, 0x0000, 0x01bc, 0x4847, 0x0000, 0x1623, 0x53b3,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x625a,
-0x0b9d, 0x0000, 0x0000, 0x228a, 0x2425, 0x12a0, 0x0000, 0x0000,
-0x0b4d, 0x0bab, 0x43a6, 0x2079, 0x0000, 0x0000, 0x641e, 0x0000,
-0x0000, 0x5963, 0x0000, 0x0000, 0x0000, 0x0000, 0x1518, 0x36a5,
-0x1989, 0x5ff1, 0x0f9d, 0x1a94, 0x3f8b, 0x0000, 0x0000, 0x2c76,
-0x2eab, 0x4b23, 0x0731, 0x562b, 0x0000, 0x0000, 0x0000, 0x5821,
-0x0000, 0x57a9, 0x2f6f, 0x3695, 0x4b0e, 0x4453, 0x0000, 0x3cdd,
-0x0000, 0x0000, 0x0ce4, 0x0000, 0x0000, 0x0000, 0x575b, 0x07fd,
-0x0000, 0x1b98, 0x43bb, 0x0000, 0x5865, 0x0000, 0x16d5, 0x0000,
-0x0000, 0x5da5, 0x4e44, 0x0000, 0x3dbd, 0x121a, 0x63c6, 0x633a,
-0x0000, 0x0000, 0x5b47, 0x56c4, 0x0000, 0x311c, 0x0000, 0x3de1,
-0x0000, 0x2796, 0x2f5e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x314c, 0x0000, 0x5cd5, 0x0000, 0x418b, 0x4963, 0x5f60,
-0x1eb9, 0x0000, 0x075b, 0x0000, 0x0000, 0x4029, 0x37c3, 0x0000,
-0x3db4, 0x4aa3, 0x24df, 0x33ed, 0x435a, 0x0000, 0x0000, 0x2cb2,
-0x0000, 0x3184, 0x0000, 0x1186, 0x56f7, 0x0000, 0x0000, 0x1808,
-0x2c4a, 0x4fed, 0x0000, 0x56a2, 0x0e4e, 0x0e64, 0x0e7a, 0x0e90,
-0x0ea6, 0x56e6, 0x0000, 0x3dc9, 0x5933, 0x1ca6, 0x5b27, 0x1791,
-0x0000, 0x0000, 0x5887, 0x324e, 0x0000, 0x08aa, 0x3a90, 0x1f83,
-0x59d7, 0x6311, 0x0000, 0x0000, 0x4462, 0x58b8, 0x44f6, 0x559e,
-0x0000, 0x0000, 0x0000, 0x0000, 0x5953, 0x57ec, 0x1584, 0x4943,
-0x3821, 0x0000, 0x5799, 0x3dd5, 0x0000, 0x4401, 0x5995, 0x0000,
-0x12b3, 0x0bb9, 0x0000, 0x2aa7, 0x39a8, 0x0000, 0x3637, 0x0000,
-0x0f5a, 0x0f2c, 0x0cf8, 0x2034, 0x0000, 0x0000, 0x543d, 0x0000,
-0x0000, 0x3b6e, 0x1881, 0x3ed1, 0x34bb, 0x0000, 0x0000, 0x0000,
-0x0000, 0x371a, 0x5484, 0x3b95, 0x4558, 0x2b78, 0x0000, 0x0000,
-0x0000, 0x505d, 0x3668, 0x5667, 0x45e3, 0x0000, 0x0000, 0x3676,
-0x01ea, 0x50b2, 0x0000, 0x4304, 0x5707, 0x1f4e, 0x0000, 0x0000,
-0x58db, 0x5042, 0x3ec2, 0x0000, 0x5b75, 0x0000, 0x2a58, 0x4b77,
-0x0000, 0x1c39, 0x5366, 0x0000, 0x5943, 0x0000, 0x374a, 0x0000,
-0x0000, 0x0000, 0x5897, 0x3c79, 0x1f0e, 0x4534, 0x0000, 0x0000,
-0x0746, 0x6242, 0x0000, 0x0000, 0x370c, 0x0000, 0x5a47, 0x0000,
-0x5026, 0x50ce, 0x2cd8, 0x0000, 0x3766, 0x13ae, 0x0000, 0x0000,
-0x2d1b, 0x0000, 0x5050, 0x3961, 0x3f2a, 0x0000, 0x59a5, 0x5383,
-0x0d66, 0x0000, 0x2ddf, 0x3d37, 0x0000, 0x3d4a, 0x0000, 0x1023,
-0x1030, 0x103d, 0x467d, 0x3d83, 0x5bd8, 0x5009, 0x00ea, 0x0691,
-0x468d, 0x0000, 0x479a, 0x0000, 0x28e9, 0x069f, 0x0000, 0x50a3,
-0x1c20, 0x463e, 0x0000, 0x4fbd, 0x4524, 0x43e6, 0x3bcd, 0x5033,
-0x0000, 0x0000, 0x0000, 0x097d, 0x465e, 0x0000, 0x0000, 0x0000,
-0x10ae, 0x3971, 0x0000, 0x60c2, 0x44d5, 0x27a7, 0x0000, 0x0000,
-0x2ebd, 0x1e9f, 0x0000, 0x0000, 0x0000, 0x5691, 0x4c71, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x62e7, 0x0000, 0x665f, 0x0000,
-0x45d1, 0x34a1, 0x0000, 0x29e6, 0x3cf0, 0x0242, 0x5132, 0x5e8a,
-0x0000, 0x0000, 0x3079, 0x0000, 0x5729, 0x0000, 0x2e9b, 0x1d2b,
-0x2d2d, 0x0000, 0x0000, 0x0000, 0x4d14, 0x5617, 0x0000, 0x0084,
-0x0000, 0x0cc9, 0x07ea, 0x1602, 0x2e39, 0x3bb3, 0x580f, 0x6286,
-0x46ff, 0x4b48, 0x0000, 0x1bba, 0x4fac, 0x0000, 0x086d, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x16ca, 0x6101, 0x0000, 0x3aae,
-0x1687, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c04, 0x1e63, 0x0000,
-0x385c, 0x0000, 0x0000, 0x0000, 0x345a, 0x0000, 0x0000, 0x4bd4,
-0x0000, 0x0000, 0x5b15, 0x171a, 0x1661, 0x0d8d, 0x0000, 0x4ceb,
-0x0000, 0x2e0f, 0x38ee, 0x64fa, 0x0000, 0x667d, 0x4746, 0x3f59,
-0x0000, 0x0000, 0x0000, 0x4bf5, 0x0000, 0x0c42, 0x0000, 0x0000,
-0x2102, 0x0000, 0x0000, 0x0000, 0x0000, 0x2fb7, 0x5a8b, 0x0000,
-0x0000, 0x4789, 0x37e4, 0x0000, 0x4374, 0x34fd, 0x6390, 0x18d8,
-0x0000, 0x0000, 0x0000, 0x0000, 0x08f7, 0x4495, 0x2d0b, 0x46cd,
-0x0000, 0x0000, 0x4ec9, 0x0000, 0x0000, 0x1e18, 0x0000, 0x321d,
-0x0000, 0x0000, 0x3b60, 0x0000, 0x60f2, 0x0000, 0x07ac, 0x0000,
-0x4ca1, 0x0000, 0x0000, 0x5e63, 0x2890, 0x6634, 0x3a66, 0x0000,
-0x0000, 0x2654, 0x0000, 0x0000, 0x3888, 0x1eab, 0x3f6a, 0x0000,
-0x2d5d, 0x0000, 0x0000, 0x49d5, 0x38fc, 0x1a63, 0x0000, 0x2994,
-0x1ed2, 0x24a4, 0x0000, 0x0411, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x4ad0, 0x0000, 0x0000, 0x1cb6, 0x0000, 0x0000, 0x4a58,
-0x0000, 0x51fd, 0x0000, 0x0000, 0x0000, 0x3b52, 0x23f5, 0x0000,
-0x0000, 0x0000, 0x0000, 0x47aa, 0x0000, 0x3bf5, 0x1d8e, 0x14a5,
-0x11b8, 0x4c91, 0x65b6, 0x0000, 0x52ac, 0x0000, 0x0000, 0x03c0,
-0x2016, 0x65e0, 0x1f9f, 0x2b26, 0x0000, 0x46bb, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5bc7, 0x1632, 0x567d,
-0x5c2c, 0x34ea, 0x0000, 0x1823, 0x0000, 0x3387, 0x0000, 0x2842,
-0x0000, 0x184e, 0x0000, 0x0000, 0x49e4, 0x0000, 0x0000, 0x030c,
-0x0000, 0x488c, 0x0000, 0x29f8, 0x5ce6, 0x2409, 0x1775, 0x0000,
-0x0000, 0x322e, 0x0af5, 0x0000, 0x49b0, 0x0000, 0x0000, 0x0000,
-0x0000, 0x4084, 0x3738, 0x199f, 0x2e58, 0x0000, 0x0000, 0x214d,
-0x5d60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x019e, 0x0000,
-0x0000, 0x2cfa, 0x0000, 0x0000, 0x1784, 0x02e0, 0x3ffd, 0x6120,
-0x1b43, 0x260d, 0x37b3, 0x606d, 0x0000, 0x2a3d, 0x0000, 0x0000,
-0x0000, 0x3f19, 0x0000, 0x0000, 0x2f2d, 0x0000, 0x5653, 0x0000,
-0x0000, 0x0000, 0x0000, 0x490c, 0x14fe, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x4953, 0x1c72, 0x0da2, 0x0000, 0x1d54, 0x0000,
-0x0000, 0x4826, 0x0000, 0x29bd, 0x4fcf, 0x0000, 0x0000, 0x4973,
-0x208f, 0x0000, 0x0000, 0x0000, 0x5581, 0x0000, 0x0000, 0x5ed0,
-0x0000, 0x0000, 0x3dee, 0x0000, 0x2adc, 0x515d, 0x0000, 0x0000,
-0x41af, 0x0000, 0x0000, 0x2419, 0x1c57, 0x2431, 0x243d, 0x2449,
-0x2455, 0x2461, 0x246d, 0x2479, 0x2485, 0x4f51, 0x012a, 0x0000,
-0x0000, 0x0000, 0x0000, 0x2edc, 0x00ca, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x1ff9, 0x099a, 0x0d0c, 0x0000, 0x0ff2,
-0x31b4, 0x5b65, 0x0000, 0x0165, 0x1006, 0x0815, 0x54e0, 0x3c43,
-0x1c7e, 0x0000, 0x2c37, 0x10f6, 0x0000, 0x0000, 0x011d, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d9b, 0x0000, 0x0000,
-0x0000, 0x0000, 0x4137, 0x0000, 0x166c, 0x576a, 0x4eb2, 0x0000,
-0x0159, 0x0fb0, 0x52e9, 0x31c7, 0x0000, 0x0000, 0x0000, 0x18fe,
-0x0000, 0x17c4, 0x0000, 0x0000, 0x0000, 0x1f75, 0x4ba1, 0x0000,
-0x0000, 0x4629, 0x36ff, 0x0000, 0x0000, 0x0000, 0x0000, 0x48fd,
-0x36c6, 0x0000, 0x36d3, 0x0000, 0x0000, 0x5a17, 0x619c, 0x0000,
-0x0000, 0x0000, 0x36e0, 0x0a62, 0x1f2a, 0x297d, 0x4ef0, 0x0000,
-0x0000, 0x11d2, 0x0000, 0x2bc8, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x2a22, 0x02b2, 0x1e4a, 0x0000,
-0x0000, 0x0000, 0x54f8, 0x0000, 0x1ac3, 0x0000, 0x64ae, 0x1ace,
-0x0000, 0x4c45, 0x0000, 0x0000, 0x10e7, 0x0000, 0x5aad, 0x5f3e,
-0x1aad, 0x0000, 0x2ecd, 0x0000, 0x0000, 0x573b, 0x0000, 0x5e2d,
-0x49c2, 0x0000, 0x15c5, 0x556c, 0x2cc8, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0324, 0x032e, 0x0338, 0x0342, 0x0000, 0x0000, 0x1af0,
-0x0fc0, 0x4b67, 0x0000, 0x3b45, 0x1142, 0x0000, 0x4f17, 0x1930,
-0x0000, 0x424e, 0x2d3d, 0x0000, 0x0000, 0x0000, 0x3869, 0x0000,
-0x3831, 0x5e4e, 0x387b, 0x0000, 0x2d9d, 0x6400, 0x092b, 0x1871,
-0x3842, 0x46ed, 0x384f, 0x5b85, 0x150a, 0x4be5, 0x0000, 0x1ae5,
-0x52fc, 0x0000, 0x0ad0, 0x48db, 0x0000, 0x0000, 0x0000, 0x0000,
-0x00f7, 0x550f, 0x0000, 0x3b30, 0x0000, 0x0000, 0x661a, 0x0000,
-0x0000, 0x2b42, 0x116d, 0x0000, 0x1548, 0x1a89, 0x0000, 0x5f82,
-0x1f02, 0x518d, 0x40e5, 0x4e5b, 0x0000, 0x0001, 0x17de, 0x0000,
-0x0000, 0x3b85, 0x0000, 0x1a1f, 0x0079, 0x00b4, 0x0000, 0x0000,
-0x0000, 0x0000, 0x4c60, 0x3fc1, 0x0000, 0x0000, 0x0000, 0x0000,
-0x3588, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0364, 0x0000,
-0x0000, 0x0000, 0x0000, 0x09b3, 0x0000, 0x2e27, 0x6172, 0x5ea4,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2f0d, 0x0000, 0x11fe,
-0x4c34, 0x660b, 0x0000, 0x12bf, 0x0000, 0x0000, 0x1ad9, 0x0000,
-0x1130, 0x0000, 0x0000, 0x1cc4, 0x0000, 0x4398, 0x353f, 0x549a,
-0x3acc, 0x0000, 0x4991, 0x0000, 0x0ae2, 0x0000, 0x5428, 0x0000,
-0x0000, 0x0000, 0x0fe0, 0x0000, 0x6186, 0x4a18, 0x5b9d, 0x0000,
-0x4506, 0x2c12, 0x0000, 0x3784, 0x2062, 0x0000, 0x52c3, 0x0000,
-0x0000, 0x37a3, 0x2521, 0x0000, 0x0000, 0x1e3e, 0x0000, 0x06ad,
-0x50c0, 0x0000, 0x4368, 0x3ae2, 0x16ff, 0x60d2, 0x3c1f, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4c55, 0x352b, 0x0000,
-0x16bf, 0x10bd, 0x111c, 0x0000, 0x0000, 0x06bb, 0x0000, 0x0cb4,
-0x0c2f, 0x0000, 0x5d2b, 0x0000, 0x0258, 0x0000, 0x0000, 0x0000,
-0x09e4, 0x2868, 0x11f0, 0x3471, 0x0000, 0x37f2, 0x0000, 0x0724,
-0x0000, 0x0000, 0x108e, 0x0000, 0x1e30, 0x2d7d, 0x0000, 0x022d,
-0x0000, 0x0000, 0x4711, 0x5fba, 0x0000, 0x11e1, 0x0000, 0x0107,
-0x0000, 0x64bc, 0x14ce, 0x555b, 0x0000, 0x3172, 0x0000, 0x0000,
-0x0000, 0x0000, 0x06e0, 0x0000, 0x0000, 0x59e7, 0x627c, 0x0000,
-0x06ea, 0x0000, 0x0000, 0x3811, 0x006e, 0x5fc8, 0x0000, 0x0000,
-0x0033, 0x372a, 0x61b1, 0x0000, 0x4cff, 0x13c7, 0x668a, 0x182e,
-0x0000, 0x0000, 0x0000, 0x0000, 0x1a79, 0x0000, 0x0000, 0x5e98,
-0x0000, 0x1df0, 0x119e, 0x0000, 0x1ab8, 0x34d1, 0x0000, 0x19ab,
-0x61db, 0x02c6, 0x0000, 0x2911, 0x5f96, 0x0000, 0x42e2, 0x1fdf,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x574b, 0x0000, 0x5eaf,
-0x0000, 0x1eeb, 0x0000, 0x1191, 0x0c02, 0x0000, 0x0000, 0x16a1,
-0x514a, 0x3c5e, 0x3554, 0x308d, 0x5337, 0x0000, 0x45b0, 0x0000,
-0x0000, 0x0000, 0x0b8b, 0x0000, 0x5984, 0x5096, 0x0000, 0x0000,
-0x16f4, 0x0000, 0x5ee9, 0x35a0, 0x0000, 0x5c0a, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x42cc, 0x506b, 0x0000, 0x0000, 0x0000,
-0x3513, 0x0000, 0x3d5d, 0x0000, 0x1b07, 0x00e0, 0x52d6, 0x1b12,
-0x0000, 0x0000, 0x0277, 0x2928, 0x0000, 0x390a, 0x0000, 0x0026,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3a0d, 0x4232, 0x0000,
-0x2008, 0x06ca, 0x0000, 0x4198, 0x0000, 0x5416, 0x0000, 0x06d5,
-0x0000, 0x0000, 0x0000, 0x0000, 0x174f, 0x0000, 0x0000, 0x5ede,
-0x5088, 0x0000, 0x0000, 0x0000, 0x6651, 0x6272, 0x0000, 0x5e71,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4161, 0x1e24, 0x0000,
-0x6363, 0x525d, 0x3fec, 0x0000, 0x0000, 0x4f89, 0x2b0e, 0x3431,
-0x4332, 0x3896, 0x0000, 0x0944, 0x0000, 0x6627, 0x0000, 0x2535,
-0x5105, 0x3e19, 0x0283, 0x254f, 0x0000, 0x37d5, 0x170a, 0x1471,
-0x0000, 0x4722, 0x0000, 0x0000, 0x6204, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x6058, 0x3c2d, 0x51a1, 0x4429, 0x5270, 0x07bf,
-0x0000, 0x0000, 0x0000, 0x5323, 0x6156, 0x0000, 0x0000, 0x0000,
-0x1afb, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b35, 0x2a0d, 0x328e,
-0x0185, 0x4df4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2ac2, 0x0048,
-0x1d83, 0x1526, 0x0000, 0x0000, 0x1aa2, 0x6110, 0x0000, 0x1b2e,
-0x16e5, 0x2dce, 0x0000, 0x0000, 0x1f67, 0x62be, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x51b4, 0x0000, 0x0000, 0x6552, 0x20ae,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d76, 0x0000,
-0x0210, 0x0000, 0x40b8, 0x0000, 0x19b6, 0x0000, 0x356b, 0x19c1,
-0x0000, 0x4a47, 0x0000, 0x0000, 0x5310, 0x0000, 0x03cb, 0x2332,
-0x1744, 0x0960, 0x0000, 0x4a77, 0x0000
+static const unsigned int ks_displacements[KSBUCKETS] = {
+0x00000010, 0x0000003f, 0x00000064, 0x0000000a, 0x00000004, 0x00000000, 0x00000123, 0x00000001,
+0x00000003, 0x00000012, 0x00000000, 0x00000000, 0x00000000, 0x0000009c, 0x00000007, 0x00000000,
+0x00000004, 0x00000000, 0x00000023, 0x00000000, 0x00000000, 0x00000000, 0x0000014a, 0x00000080,
+0x00000007, 0x00000000, 0x0000003c, 0x00000016, 0x00000028, 0x00000006, 0x00000003, 0x00000000,
+0x00000000, 0x0000001d, 0x0000003b, 0x00000076, 0x00000009, 0x00000000, 0x0000008c, 0x00000002,
+0x0000000d, 0x00000031, 0x00000002, 0x00000017, 0x00000001, 0x00000011, 0x00000008, 0x000000b2,
+0x0000000b, 0x00000062, 0x00000015, 0x0000001b, 0x0000000a, 0x00000014, 0x00000004, 0x00000001,
+0x00000008, 0x00000009, 0x00000051, 0x00000013, 0x0000004f, 0x00000001, 0x0000001f, 0x0000002d,
+0x00000000, 0x0000000b, 0x00000000, 0x000000cc, 0x00000009, 0x00000040, 0x000000ba, 0x00000001,
+0x00000000, 0x00000007, 0x00000000, 0x00000000, 0x00000000, 0x00000003, 0x00000015, 0x00000034,
+0x00000107, 0x00000084, 0x00000047, 0x00000239, 0x0000002b, 0x00000002, 0x0000004b, 0x00000004,
+0x00000137, 0x00000003, 0x0000008a, 0x00000007, 0x0000000a, 0x00000002, 0x000000d2, 0x00000002,
+0x00000002, 0x00000001, 0x00000008, 0x00000005, 0x00000001, 0x0000001c, 0x00000074, 0x000000a8,
+0x00000005, 0x00000063, 0x0000009e, 0x00000039, 0x00000000, 0x0000000d, 0x00000011, 0x00000007,
+0x00000006, 0x0000001e, 0x00000000, 0x00000002, 0x00000004, 0x00000002, 0x00000009, 0x00000011,
+0x00000005, 0x00000018, 0x0000001d, 0x00000029, 0x00000013, 0x00000002, 0x00000001, 0x00000001,
+0x0000000b, 0x00000036, 0x0000003b, 0x00000010, 0x00000018, 0x00000003, 0x00000005, 0x00000001,
+0x00000290, 0x00000000, 0x00000021, 0x00000003, 0x0000001d, 0x00000037, 0x00000017, 0x0000002b,
+0x00000028, 0x000000a9, 0x000000e2, 0x00000000, 0x000000ab, 0x0000001b, 0x00000019, 0x00000034,
+0x000000f1, 0x00000049, 0x000000ad, 0x00000057, 0x00000018, 0x0000003a, 0x0000018a, 0x0000008e,
+0x0000001c, 0x00000001, 0x00000042, 0x00000012, 0x000001c1, 0x00000017, 0x00000000, 0x00000000,
+0x00000022, 0x00000043, 0x00000031, 0x000000ad, 0x0000000d, 0x00000156, 0x00000000, 0x00000046,
+0x00000028, 0x0000013d, 0x00000020, 0x00000001, 0x0000013f, 0x00000000, 0x00000173, 0x00000048,
+0x00000235, 0x00000108, 0x00000135, 0x00000012, 0x0000000e, 0x000001bc, 0x00000000, 0x00000000,
+0x000001fb, 0x00000036, 0x0000000b, 0x00000001, 0x00000016, 0x00000081, 0x0000004b, 0x00000033,
+0x00000000, 0x00000045, 0x00000064, 0x00000007, 0x0000001c, 0x0000001f, 0x0000000e, 0x00000019,
+0x00000043, 0x0000003b, 0x0000000b, 0x0000011a, 0x00000058, 0x00000005, 0x00000006, 0x00000000,
+0x0000001c, 0x00000022, 0x0000003a, 0x0000002a, 0x00000031, 0x00000211, 0x00000001, 0x0000002e,
+0x00000046, 0x00000003, 0x00000001, 0x000001f6, 0x0000001c, 0x00000009, 0x000001a3, 0x0000004c,
+0x00000038, 0x00000027, 0x0000001f, 0x00000000, 0x00000003, 0x000001e1, 0x00000004, 0x00000036,
+0x0000046a, 0x00000187, 0x000002a0, 0x00000435, 0x00000072, 0x0000024b, 0x00000007, 0x00000061,
+0x00000000, 0x00000003, 0x00000019, 0x000000b4, 0x00000001, 0x00000055, 0x00000001, 0x0000002c,
+0x00000049, 0x00000020, 0x0000006b, 0x00000007, 0x000000e1, 0x000000c2, 0x00000001, 0x00000305,
+0x00000028, 0x00000003, 0x00000024, 0x00000006, 0x00000002, 0x000005ee, 0x00000001, 0x0000007e,
+0x00000021, 0x00000000, 0x0000003f, 0x0000012c, 0x0000003d, 0x000000c3, 0x00000007, 0x00000074,
+0x000000ca, 0x000000ea, 0x00000000, 0x0000007f, 0x00000119, 0x000000d6, 0x00000001, 0x00000053,
+0x0000002e, 0x0000001e, 0x0000008d, 0x00000001, 0x000004ac, 0x0000005a, 0x00000009, 0x0000001b,
+0x000003e8, 0x00000018, 0x00000000, 0x00000097, 0x00000003, 0x00000168, 0x00000181, 0x00000007,
+0x00000005, 0x00000010, 0x00000001, 0x00000020, 0x0000003a, 0x00000183, 0x000000cd, 0x0000016a,
+0x00000000, 0x000000fe, 0x000001f2, 0x00000021, 0x0000002d, 0x00000097, 0x00000103, 0x00000003,
+0x00000168, 0x00000199, 0x000001c0, 0x00000000, 0x00000001, 0x0000004e, 0x0000005b, 0x00000019,
+0x0000000d, 0x00000109, 0x0000001d, 0x00000000, 0x0000000a, 0x00000c9b, 0x00000012, 0x0000003d,
+0x000000c2, 0x00000000, 0x00000004, 0x0000018d, 0x0000008a, 0x00000505, 0x000003ce, 0x000000b6,
+0x00000002, 0x00000034, 0x000000e3, 0x000005f3, 0x00000144, 0x00000168, 0x00000000, 0x0000035e,
+0x0000007c, 0x00000010, 0x000000f6, 0x00000001, 0x0000036b, 0x0000058c, 0x000000a3, 0x00000002,
+0x0000029f, 0x00000025, 0x00000035, 0x00000136, 0x0000003c, 0x00000022, 0x00000305, 0x0000002b,
+0x0000009c, 0x00000005, 0x00000439, 0x00000383, 0x0000002a, 0x0000000b, 0x00000053, 0x000000f2,
+0x000001a7, 0x00000075, 0x00000202, 0x0000005b, 0x000000a1, 0x000002be, 0x0000046b, 0x000001ef,
+0x0000004d, 0x00000290, 0x00000005, 0x0000002c, 0x0000033f, 0x00000af8, 0x000001aa, 0x00000020,
+0x000006a0, 0x000000e4, 0x000000b9, 0x000002f3, 0x0000000c, 0x00000089, 0x0000000f, 0x000003ae,
+0x00000003, 0x00000407, 0x00000078, 0x0000041c, 0x00000032, 0x00000002, 0x000008dd, 0x00000102,
+0x00000063, 0x00000489, 0x00000107, 0x0000021f, 0x00000001, 0x00000025, 0x00000000, 0x000002c6,
+0x0000007a, 0x00000443, 0x00000219, 0x00000ced, 0x0000074f, 0x00000024, 0x00000000, 0x0000000d,
+0x00000001, 0x00000059, 0x00000214
 };
+
 #endif /* NEEDKTABLE */
 
 #ifdef NEEDVTABLE
-#define VTABLESIZE 2341
-#define VMAXHASH 9
+/* The name table, ks_names, is in the NEEDKTABLE part.  */
+#define KS_NONAME	0xffff
+#define ks_value_names_PAGES	26
+
+static const unsigned char ks_value_names_pages[256] = {
+  1,   2,   3,   4,   5,   6,   7,   8,
+  9,  10,  11,  12,  13,  14,  15,   0,
+  0,   0,  16,  17,  18,  19,  20,   0,
+  0,   0,   0,   0,   0,   0,  21,   0,
+ 22,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,  23,  24,  25
+};
 
-static const unsigned short hashKeysym[VTABLESIZE] = {
-0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x5f76, 0x0000, 0x5f84, 0x0000, 0x5fa3, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x4df6, 0x0000, 0x0000, 0x0000, 0x4939, 0x0000,
-0x117e, 0x1188, 0x1193, 0x11a0, 0x11af, 0x11ba, 0x11c6, 0x11d4,
-0x11f2, 0x1200, 0x120f, 0x121c, 0x1225, 0x122f, 0x1239, 0x1244,
-0x124e, 0x1254, 0x125a, 0x1260, 0x1266, 0x126c, 0x1272, 0x1278,
-0x127e, 0x1284, 0x128a, 0x1294, 0x12a2, 0x12ab, 0x12b5, 0x12c1,
-0x12ce, 0x12d5, 0x12db, 0x12e1, 0x12e7, 0x12ed, 0x12f3, 0x12f9,
-0x12ff, 0x1305, 0x130b, 0x1311, 0x1317, 0x131d, 0x1323, 0x1329,
-0x132f, 0x1335, 0x133b, 0x1341, 0x1347, 0x134d, 0x1353, 0x1359,
-0x135f, 0x1365, 0x136b, 0x1371, 0x1381, 0x138f, 0x13a0, 0x13b0,
-0x13bf, 0x13d7, 0x13dd, 0x13e3, 0x13e9, 0x13ef, 0x13f5, 0x13fb,
-0x1401, 0x1407, 0x140d, 0x1413, 0x1419, 0x141f, 0x1425, 0x142b,
-0x1431, 0x1437, 0x143d, 0x1443, 0x1449, 0x144f, 0x1455, 0x145b,
-0x1461, 0x1467, 0x146d, 0x1473, 0x1481, 0x1489, 0x1498, 0x0000,
-0x4c25, 0x4a49, 0x4c36, 0x0000, 0x4c47, 0x0000, 0x2018, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2028, 0x56d7, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x2036, 0x0000, 0x56f9, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x14a7, 0x14b8, 0x14c7, 0x14d0, 0x14dd, 0x14ea, 0x14f2, 0x1500,
-0x150c, 0x151a, 0x1528, 0x1538, 0x154a, 0x1556, 0x1561, 0x1570,
-0x157b, 0x1586, 0x1594, 0x15a4, 0x15b6, 0x15c0, 0x15c7, 0x15d5,
-0x15e8, 0x15f4, 0x1604, 0x1612, 0x1625, 0x1634, 0x1640, 0x1652,
-0x1663, 0x166e, 0x1679, 0x1689, 0x1694, 0x16a3, 0x16ad, 0x16b4,
-0x16c1, 0x16cc, 0x16d7, 0x16e7, 0x16f6, 0x1701, 0x170c, 0x171c,
-0x172b, 0x173b, 0x1746, 0x1751, 0x175c, 0x176c, 0x1777, 0x1786,
-0x1793, 0x17a0, 0x17ab, 0x17b6, 0x17c6, 0x17d5, 0x17e0, 0x17f4,
-0x17ff, 0x180a, 0x1815, 0x1825, 0x1830, 0x183f, 0x1849, 0x1850,
-0x185d, 0x1868, 0x1873, 0x1883, 0x1892, 0x189d, 0x18a8, 0x18b8,
-0x18c7, 0x18cf, 0x18da, 0x18e5, 0x18f0, 0x1900, 0x190b, 0x191a,
-0x1927, 0x1932, 0x193d, 0x1948, 0x1958, 0x1967, 0x1972, 0x197c,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62fe, 0x1f10,
-0x6572, 0x0000, 0x1f1e, 0x0000, 0x6328, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1f2c, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x1f3a, 0x0000, 0x63aa, 0x0000,
-0x0000, 0x0000, 0x1f45, 0x0000, 0x63c8, 0x1f50, 0x0000, 0x63d7,
-0x1f5e, 0x0000, 0x63e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x1f69, 0x0000, 0x6420, 0x1f77,
-0x0000, 0x0000, 0x0000, 0x0000, 0x6444, 0x0000, 0x0000, 0x0000,
-0x1f85, 0x0000, 0x6460, 0x1f93, 0x0000, 0x0000, 0x661c, 0x0000,
-0x6474, 0x1fa1, 0x6636, 0x0000, 0x1faf, 0x2046, 0x6492, 0x1fba,
-0x0000, 0x0000, 0x1fc8, 0x0000, 0x64b0, 0x1fd3, 0x668c, 0x0000,
-0x1fe1, 0x0000, 0x64cc, 0x1fec, 0x0000, 0x0000, 0x1ffb, 0x0000,
-0x0000, 0x200a, 0x5a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x2064, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x2074, 0x207b, 0x2082, 0x3c89, 0x5a9f, 0x3c93,
-0x0000, 0x3ca4, 0x0000, 0x3cb5, 0x3dcb, 0x3cbc, 0x3de3, 0x3cc3,
-0x3dfd, 0x3cca, 0x3e1b, 0x3e29, 0x3e37, 0x3e42, 0x0000, 0x3cd1,
-0x0000, 0x3cd8, 0x3e6a, 0x3cdf, 0x3e8b, 0x3cf2, 0x3ea6, 0x3d04,
-0x3ec4, 0x3d15, 0x3ee0, 0x3d27, 0x0000, 0x3d39, 0x3efa, 0x3d4c,
-0x3f1b, 0x3d5f, 0x3f42, 0x3d72, 0x0000, 0x3d85, 0x3f4d, 0x3d98,
-0x3f6c, 0x198b, 0x1997, 0x19a1, 0x3f8d, 0x19ad, 0x19b8, 0x3dbf,
-0x3fd8, 0x19c3, 0x19ce, 0x19db, 0x19e6, 0x4044, 0x19f1, 0x19fc,
-0x0000, 0x1a0a, 0x1a16, 0x1a21, 0x409e, 0x1a2d, 0x1a38, 0x1a43,
-0x40e7, 0x1a4d, 0x1a58, 0x1a65, 0x1a70, 0x1a7b, 0x1a8b, 0x1a96,
-0x1aa4, 0x419a, 0x41b1, 0x1aaf, 0x41dc, 0x1aba, 0x1ac5, 0x4215,
-0x1ad0, 0x422a, 0x1adb, 0x4234, 0x1ae7, 0x4250, 0x4261, 0x1af2,
-0x1afd, 0x1b09, 0x1b14, 0x42af, 0x42c0, 0x1b1f, 0x42e4, 0x42fc,
-0x1b30, 0x1b3b, 0x4334, 0x1b45, 0x0000, 0x0000, 0x1b56, 0x0000,
-0x1b63, 0x0000, 0x0000, 0x1b6e, 0x0000, 0x1b79, 0x1b84, 0x0000,
-0x1b8f, 0x0000, 0x1b9a, 0x0000, 0x1ba6, 0x0000, 0x0000, 0x1bb1,
-0x1bbc, 0x1bc8, 0x1bd3, 0x0000, 0x0000, 0x1bde, 0x4ef2, 0x0000,
-0x1c00, 0x1c0b, 0x0000, 0x1bef, 0x4f2e, 0x0000, 0x1c15, 0x1c22,
-0x4f53, 0x0000, 0x4f64, 0x0000, 0x4f75, 0x0000, 0x4f8b, 0x0000,
-0x4f9c, 0x2056, 0x4fae, 0x442b, 0x4fbf, 0x0000, 0x4444, 0x0000,
-0x0000, 0x4455, 0x0000, 0x0000, 0x4474, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x505f, 0x0000, 0x0000, 0x0000, 0x507c, 0x0000,
-0x508a, 0x0000, 0x5098, 0x0000, 0x50a5, 0x0000, 0x50b4, 0x0000,
-0x50c2, 0x0000, 0x456a, 0x0000, 0x50de, 0x0000, 0x0000, 0x0000,
-0x50fa, 0x0000, 0x0000, 0x0000, 0x511b, 0x0000, 0x5134, 0x0000,
-0x514c, 0x0000, 0x515f, 0x0000, 0x5177, 0x0000, 0x518f, 0x0000,
-0x51a3, 0x0000, 0x51b6, 0x0000, 0x51cf, 0x0000, 0x51e7, 0x0000,
-0x4640, 0x0000, 0x5216, 0x4660, 0x522e, 0x0000, 0x467f, 0x5486,
-0x549c, 0x54b5, 0x5272, 0x54fa, 0x5511, 0x552d, 0x529c, 0x555d,
-0x52ae, 0x55b1, 0x52c5, 0x55d9, 0x52d8, 0x5619, 0x52eb, 0x5669,
-0x52fe, 0x4f3e, 0x5312, 0x56c6, 0x5325, 0x56e8, 0x5339, 0x5709,
-0x534c, 0x572b, 0x3da2, 0x574d, 0x5385, 0x3dad, 0x53a2, 0x578b,
-0x3db6, 0x57ab, 0x53d2, 0x57cc, 0x53f0, 0x57ee, 0x433f, 0x5811,
-0x5418, 0x434d, 0x542a, 0x435c, 0x436a, 0x5878, 0x545e, 0x5899,
-0x58a9, 0x58ba, 0x58cb, 0x58dd, 0x58ef, 0x5901, 0x5913, 0x5924,
-0x5477, 0x5945, 0x5955, 0x5965, 0x5975, 0x5986, 0x5997, 0x59a7,
-0x59b7, 0x59c8, 0x59d9, 0x4376, 0x59f9, 0x4382, 0x438f, 0x439a,
-0x5a39, 0x1c2f, 0x5a59, 0x5a6a, 0x5a7b, 0x43b5, 0x1c3b, 0x43bd,
-0x5abf, 0x1c4b, 0x43d1, 0x1c59, 0x1c64, 0x5b17, 0x43dc, 0x5b39,
-0x5b49, 0x1c74, 0x5b67, 0x43f5, 0x5b87, 0x4403, 0x1c80, 0x4410,
-0x0000, 0x1c90, 0x0000, 0x1c9d, 0x1ca8, 0x0000, 0x0000, 0x5583,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cb8, 0x1cc6, 0x0000,
-0x0000, 0x55c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cd6, 0x0000, 0x441d,
-0x1ce4, 0x0000, 0x0000, 0x0000, 0x0000, 0x1cf4, 0x1cff, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1d0f, 0x1d1d, 0x5693,
-0x0000, 0x0000, 0x0000, 0x0000, 0x56a4, 0x0000, 0x0000, 0x0000,
-0x0000, 0x56b5, 0x0000, 0x0000, 0x0000, 0x1d2d, 0x0000, 0x0000,
-0x1d3b, 0x0000, 0x0000, 0x3dd7, 0x0000, 0x1d4b, 0x1d56, 0x3df0,
-0x0000, 0x0000, 0x0000, 0x3e0c, 0x0000, 0x5ad0, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x5548, 0x0000, 0x0000, 0x3e4d,
-0x0000, 0x0000, 0x0000, 0x3e5d, 0x0000, 0x65b8, 0x0000, 0x3e7e,
-0x0000, 0x573d, 0x0000, 0x3e99, 0x0000, 0x0000, 0x0000, 0x3eb4,
-0x0000, 0x0000, 0x0000, 0x3ed3, 0x0000, 0x0000, 0x0000, 0x3eef,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x577b, 0x0000, 0x3f06,
-0x657c, 0x5fae, 0x5fbc, 0x3f2c, 0x5fd4, 0x5fde, 0x5ff3, 0x579b,
-0x601d, 0x6032, 0x6046, 0x605a, 0x606f, 0x6084, 0x609c, 0x3f5b,
-0x60c4, 0x60d4, 0x60e4, 0x3f7c, 0x6103, 0x6112, 0x6122, 0x6132,
-0x6145, 0x6158, 0x6166, 0x3f9b, 0x617e, 0x3fad, 0x6193, 0x3fc3,
-0x61b3, 0x61c8, 0x61dd, 0x3fee, 0x6206, 0x3fff, 0x622f, 0x4013,
-0x625c, 0x402b, 0x627e, 0x6288, 0x6296, 0x405c, 0x62b2, 0x4075,
-0x62ca, 0x62d4, 0x62e9, 0x4086, 0x6313, 0x4092, 0x633c, 0x6350,
-0x6365, 0x637a, 0x6392, 0x40ad, 0x63b9, 0x40ba, 0x5856, 0x40cf,
-0x63f4, 0x6402, 0x6411, 0x4100, 0x6432, 0x4113, 0x6452, 0x4124,
-0x646a, 0x4139, 0x6483, 0x4150, 0x64a1, 0x4163, 0x64be, 0x4177,
-0x64db, 0x418d, 0x64fc, 0x6590, 0x65a4, 0x650e, 0x5bb9, 0x41c6,
-0x5bda, 0x5beb, 0x5bfc, 0x41f4, 0x5c1d, 0x4204, 0x5c3f, 0x5c4f,
-0x5c60, 0x421e, 0x5c82, 0x5c93, 0x5ca3, 0x5cb4, 0x5cc6, 0x5cd7,
-0x5ce8, 0x4245, 0x5d09, 0x5d1b, 0x5d2d, 0x5d3f, 0x5d50, 0x426f,
-0x5d74, 0x427f, 0x1d66, 0x1d78, 0x5db9, 0x1d85, 0x1d90, 0x5ded,
-0x5dfd, 0x5e0e, 0x1d9d, 0x1da9, 0x1db6, 0x0000, 0x0000, 0x0000,
-0x0000, 0x4306, 0x0000, 0x1dc1, 0x0000, 0x1dce, 0x1dd9, 0x0000,
-0x0000, 0x0000, 0x1de6, 0x1df2, 0x1dff, 0x1e0a, 0x4497, 0x1e12,
-0x1e1a, 0x44d7, 0x44f8, 0x4517, 0x4536, 0x4545, 0x455a, 0x1e26,
-0x457b, 0x458f, 0x459e, 0x45b2, 0x1e32, 0x45e5, 0x45f5, 0x1e40,
-0x4616, 0x1e4c, 0x1e59, 0x1e65, 0x468f, 0x469f, 0x0000, 0x0000,
-0x0000, 0x1e72, 0x0000, 0x0000, 0x0000, 0x1e7e, 0x1e89, 0x0000,
-0x1e95, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1ea1,
-0x0000, 0x0000, 0x60f4, 0x0000, 0x1ead, 0x0000, 0x0000, 0x1ebb,
-0x0000, 0x1ec7, 0x1ed4, 0x1ee0, 0x0000, 0x0000, 0x0000, 0x0000,
-0x666d, 0x1eed, 0x0000, 0x0000, 0x0000, 0x1ef9, 0x1f04, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x6174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x57dd, 0x0000, 0x0000, 0x4fd1, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x61f2, 0x0000, 0x57ff, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x621a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x6244, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x6274, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x5f40, 0x62a4, 0x0000, 0x5b58, 0x0000, 0x0000, 0x46ef,
-0x5e50, 0x5e65, 0x62c0, 0x5e73, 0x5e81, 0x5e8c, 0x5e93, 0x5e9a,
-0x5ea6, 0x0000, 0x0000, 0x0000, 0x0000, 0x5eb1, 0x0000, 0x0000,
-0x5ebd, 0x5ed2, 0x5ee0, 0x5eeb, 0x5ef9, 0x5f04, 0x5f0b, 0x5f12,
-0x5f1e, 0x0000, 0x0000, 0x5f29, 0x0000, 0x5f34, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x46cf, 0x46de, 0x2091, 0x4701,
-0x4713, 0x4724, 0x4738, 0x4748, 0x4759, 0x476b, 0x477d, 0x478b,
-0x479c, 0x47ac, 0x47bd, 0x47ce, 0x47df, 0x47f6, 0x480a, 0x4819,
-0x4828, 0x4837, 0x4849, 0x485c, 0x486e, 0x487c, 0x488e, 0x489d,
-0x48af, 0x48bd, 0x48ce, 0x48dd, 0x48f1, 0x48ff, 0x490e, 0x491d,
-0x4929, 0x209e, 0x20b0, 0x20c8, 0x20e0, 0x20ef, 0x2117, 0x2123,
-0x212e, 0x2139, 0x2144, 0x214f, 0x215a, 0x2166, 0x2172, 0x217e,
-0x2197, 0x21aa, 0x21b5, 0x21c0, 0x21cb, 0x21d6, 0x21e1, 0x21ed,
-0x21f9, 0x2205, 0x2211, 0x221d, 0x2229, 0x2236, 0x2242, 0x224e,
-0x225a, 0x2266, 0x227f, 0x2298, 0x22a4, 0x22b0, 0x22bc, 0x22c8,
-0x22d4, 0x22e0, 0x22ec, 0x22f8, 0x2304, 0x231c, 0x2328, 0x2334,
-0x2340, 0x234c, 0x2358, 0x2364, 0x2370, 0x237c, 0x2388, 0x2394,
-0x23a0, 0x23ac, 0x23b8, 0x23c4, 0x23d0, 0x23dc, 0x23e7, 0x23f7,
-0x0000, 0x49e6, 0x0000, 0x0000, 0x4945, 0x5368, 0x0000, 0x4a0a,
-0x0000, 0x4955, 0x4a1a, 0x576c, 0x0000, 0x4a29, 0x4965, 0x0000,
-0x4a39, 0x53b5, 0x0000, 0x4975, 0x0000, 0x57bb, 0x4a5a, 0x0000,
-0x4984, 0x4a69, 0x652a, 0x0000, 0x4a79, 0x4993, 0x0000, 0x0000,
-0x0000, 0x5823, 0x49a4, 0x5834, 0x0000, 0x5845, 0x0000, 0x49b2,
-0x4a8a, 0x5867, 0x6554, 0x4aa5, 0x49c4, 0x5889, 0x4ab3, 0x0000,
-0x0000, 0x49d7, 0x5c2e, 0x0000, 0x4ad2, 0x0000, 0x5f4a, 0x4ae1,
-0x0000, 0x0000, 0x4af8, 0x49fa, 0x0000, 0x4b10, 0x65cb, 0x0000,
-0x4b25, 0x5935, 0x5c71, 0x4b37, 0x0000, 0x0000, 0x4b4a, 0x0000,
-0x0000, 0x4b59, 0x0000, 0x0000, 0x4b69, 0x0000, 0x0000, 0x4b79,
-0x0000, 0x65e2, 0x4b8e, 0x65fc, 0x660d, 0x4ba3, 0x6629, 0x59e9,
-0x6644, 0x6653, 0x6661, 0x5a09, 0x667f, 0x5a19, 0x4bb5, 0x5a29,
-0x0000, 0x4bc5, 0x0000, 0x43a8, 0x4bd6, 0x0000, 0x0000, 0x4be7,
-0x0000, 0x0000, 0x4bf7, 0x5a8d, 0x0000, 0x4c06, 0x0000, 0x5aaf,
-0x4c15, 0x0000, 0x0000, 0x43c6, 0x0000, 0x5ae1, 0x0000, 0x5af3,
-0x0000, 0x5b05, 0x5d62, 0x0000, 0x0000, 0x5b29, 0x0000, 0x0000,
-0x0000, 0x0000, 0x5d85, 0x43e8, 0x0000, 0x0000, 0x4ac2, 0x5b77,
-0x0000, 0x0000, 0x5da7, 0x5b9f, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x5dca, 0x3804, 0x0000, 0x4290, 0x3813, 0x0000,
-0x42a0, 0x3823, 0x0000, 0x0000, 0x4d90, 0x4da2, 0x4db9, 0x3851,
-0x4de0, 0x42ce, 0x385e, 0x4e1e, 0x4e35, 0x4e46, 0x4e5d, 0x4e73,
-0x4e89, 0x4e9e, 0x4eb4, 0x4ecb, 0x4ee1, 0x431d, 0x4f03, 0x4f19,
-0x241b, 0x2427, 0x2433, 0x243f, 0x244b, 0x2457, 0x2463, 0x246f,
-0x247b, 0x2487, 0x4fe2, 0x4fef, 0x4ffd, 0x500b, 0x501a, 0x5028,
-0x5035, 0x5044, 0x5052, 0x390c, 0x506d, 0x2493, 0x24a6, 0x24c2,
-0x24d2, 0x24e1, 0x24f2, 0x2502, 0x2512, 0x50ec, 0x2523, 0x5107,
-0x2537, 0x2544, 0x2551, 0x255e, 0x256b, 0x2578, 0x2585, 0x2592,
-0x259f, 0x25ac, 0x51ff, 0x25b9, 0x4c57, 0x5247, 0x525f, 0x25ce,
-0x5285, 0x25e7, 0x25f8, 0x260f, 0x2626, 0x263c, 0x2656, 0x266c,
-0x267c, 0x268b, 0x26a1, 0x26b0, 0x26c0, 0x26d0, 0x26df, 0x26ef,
-0x26fe, 0x270e, 0x271c, 0x272c, 0x273c, 0x274d, 0x275c, 0x276b,
-0x277a, 0x2789, 0x2798, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x27a9, 0x27bc, 0x27cb, 0x27da, 0x27e9, 0x27f8, 0x2808, 0x2818,
-0x2835, 0x2844, 0x285b, 0x286a, 0x287e, 0x2892, 0x28a6, 0x28b7,
-0x28c8, 0x28d9, 0x28eb, 0x28fc, 0x2913, 0x292a, 0x2941, 0x2950,
-0x295f, 0x2970, 0x297f, 0x2996, 0x29b1, 0x29bf, 0x29d4, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0f8c, 0x0f9f, 0x0fb2, 0x0fc2, 0x0fd1, 0x0fe2,
-0x0ff4, 0x1008, 0x1017, 0x1025, 0x1032, 0x103f, 0x104c, 0x105a,
-0x1068, 0x107d, 0x1090, 0x10a2, 0x10b0, 0x10bf, 0x10cd, 0x10db,
-0x10e9, 0x10f8, 0x1108, 0x111e, 0x1132, 0x1144, 0x115a, 0x116f,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5fca,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6008,
-0x0000, 0x0000, 0x0000, 0x65ee, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x60b4,
-0x29fa, 0x2a24, 0x2a5a, 0x2a8e, 0x2ac4, 0x2af8, 0x2b28, 0x2b60,
-0x2b94, 0x2bca, 0x2c02, 0x0000, 0x2c26, 0x2c4c, 0x2c78, 0x2c9e,
-0x2a0f, 0x2a3f, 0x2a74, 0x2aa9, 0x2ade, 0x2b10, 0x2b44, 0x2b7a,
-0x2baf, 0x2be6, 0x2c14, 0x6188, 0x2c39, 0x2c62, 0x2c8b, 0x2cb4,
-0x3b87, 0x2cca, 0x2cda, 0x2cec, 0x2cfc, 0x2d1d, 0x2d2f, 0x2d4e,
-0x2d6f, 0x2d8e, 0x2daf, 0x2dd0, 0x2de1, 0x2df3, 0x2e11, 0x2e29,
-0x2e4b, 0x2e5a, 0x2e6a, 0x2e7c, 0x2e8c, 0x2ead, 0x2ebf, 0x2ede,
-0x2eff, 0x2f1e, 0x2f3f, 0x2f60, 0x2f71, 0x2f83, 0x2fa1, 0x2fb9,
-0x2fdb, 0x2feb, 0x2ffa, 0x300a, 0x301b, 0x302b, 0x303b, 0x304b,
-0x305c, 0x306c, 0x307b, 0x308f, 0x309f, 0x30af, 0x30bf, 0x30cf,
-0x30de, 0x30ee, 0x30fe, 0x310e, 0x311e, 0x312e, 0x313d, 0x314e,
-0x315e, 0x3174, 0x3186, 0x3196, 0x31a7, 0x31b6, 0x31c9, 0x31da,
-0x31f0, 0x3200, 0x320f, 0x321f, 0x3230, 0x3240, 0x3250, 0x3260,
-0x3271, 0x3281, 0x3290, 0x32a4, 0x32b4, 0x32c4, 0x32d4, 0x32e4,
-0x32f3, 0x3303, 0x3313, 0x3323, 0x3333, 0x3343, 0x3352, 0x3363,
-0x3373, 0x3389, 0x339b, 0x33ab, 0x33bc, 0x33cb, 0x33de, 0x33ef,
-0x0000, 0x0000, 0x0000, 0x64ea, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x651c, 0x0000, 0x5bc9,
-0x54e2, 0x6534, 0x0000, 0x653e, 0x0000, 0x6549, 0x0000, 0x5c0c,
-0x0000, 0x655e, 0x0726, 0x0733, 0x0748, 0x075d, 0x0772, 0x079a,
-0x07ae, 0x07c1, 0x07d4, 0x07ec, 0x07ff, 0x0817, 0x082b, 0x0844,
-0x0857, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5603, 0x0000,
-0x0000, 0x0000, 0x0000, 0x5cf9, 0x5641, 0x0000, 0x0000, 0x0000,
-0x0000, 0x086f, 0x0880, 0x0895, 0x08ac, 0x08c4, 0x08de, 0x08f9,
-0x0915, 0x092d, 0x0946, 0x0962, 0x097f, 0x099c, 0x09b5, 0x09cf,
-0x09e6, 0x09ff, 0x0a1c, 0x0a3c, 0x0a4e, 0x0a64, 0x0000, 0x0000,
-0x3a35, 0x0000, 0x5719, 0x0000, 0x3a4e, 0x5e1e, 0x0000, 0x5e2f,
-0x3a68, 0x5e40, 0x4dcf, 0x0000, 0x3a7d, 0x3b97, 0x575d, 0x0000,
-0x3a92, 0x0000, 0x0000, 0x4e0c, 0x3ab0, 0x0000, 0x0000, 0x0000,
-0x3ace, 0x0a72, 0x0a81, 0x0a90, 0x0aa4, 0x0ab3, 0x0ac3, 0x0ad2,
-0x0ae4, 0x0af7, 0x0b0a, 0x0b1f, 0x0b2e, 0x0b3f, 0x0b4f, 0x0b5d,
-0x0b73, 0x0b8d, 0x0b9f, 0x0bad, 0x5407, 0x0000, 0x0000, 0x44ba,
-0x4cdc, 0x44c8, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c45, 0x0000,
-0x0000, 0x0c31, 0x0c44, 0x0c60, 0x0c76, 0x0c8a, 0x0ca0, 0x0cb6,
-0x0ccb, 0x0ce6, 0x0cfa, 0x0d0e, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x45c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4608,
-0x0000, 0x3405, 0x341b, 0x3433, 0x3447, 0x345c, 0x0000, 0x3473,
-0x348b, 0x34a3, 0x0000, 0x34bd, 0x0000, 0x0000, 0x34d3, 0x34ec,
-0x0000, 0x34ff, 0x3515, 0x352d, 0x3541, 0x3556, 0x356d, 0x358a,
-0x35a2, 0x35ba, 0x35d4, 0x35f4, 0x39fd, 0x0000, 0x0000, 0x0000,
-0x0000, 0x360a, 0x361a, 0x3629, 0x3639, 0x3649, 0x365b, 0x366a,
-0x3678, 0x3688, 0x3697, 0x36a7, 0x36c8, 0x36d5, 0x36e2, 0x36ef,
-0x3701, 0x370e, 0x371c, 0x0000, 0x372c, 0x373a, 0x374c, 0x375a,
-0x3768, 0x3776, 0x3ae4, 0x0000, 0x3c52, 0x0000, 0x50d0, 0x0000,
-0x0000, 0x3786, 0x3796, 0x37a5, 0x37b5, 0x37c5, 0x37d7, 0x37e6,
-0x37f4, 0x0bbb, 0x0bd4, 0x0bec, 0x3844, 0x0c04, 0x0c1c, 0x386b,
-0x387d, 0x388a, 0x3898, 0x38a8, 0x38c2, 0x38d0, 0x38e2, 0x38f0,
-0x38fe, 0x0d25, 0x0d36, 0x0d48, 0x0d57, 0x0d68, 0x0d7b, 0x0d8f,
-0x0da4, 0x0dba, 0x0dd2, 0x0de6, 0x0dfa, 0x0e0e, 0x0e22, 0x0e36,
-0x0e50, 0x0e66, 0x0e7c, 0x0e92, 0x0ea8, 0x0ebe, 0x0ed4, 0x0ee6,
-0x0ef8, 0x0f0a, 0x0f2e, 0x0f45, 0x0f5c, 0x0f74, 0x0f1c, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x393d, 0x0012, 0x0020, 0x0028, 0x0035, 0x3bc1, 0x003f, 0x0000,
-0x3983, 0x0000, 0x0000, 0x0000, 0x004a, 0x0054, 0x0064, 0x0000,
-0x39d5, 0x0000, 0x39eb, 0x0000, 0x0070, 0x619e, 0x3a0f, 0x0000,
-0x3a22, 0x0086, 0x00e2, 0x00ec, 0x00f9, 0x0114, 0x011f, 0x012c,
-0x0139, 0x014f, 0x015b, 0x0167, 0x017b, 0x0187, 0x0192, 0x01a0,
-0x01af, 0x01be, 0x3afa, 0x4c62, 0x4c73, 0x4c82, 0x4c93, 0x4ca3,
-0x0094, 0x4cca, 0x3c12, 0x4ced, 0x4d01, 0x00a2, 0x00b6, 0x00cc,
-0x4d6b, 0x543f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x0000, 0x3c6c, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b7d, 0x0000,
-0x0000, 0x01f9, 0x0202, 0x020b, 0x0212, 0x021c, 0x0225, 0x023b,
-0x0252, 0x025a, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ba8, 0x0000,
-0x3bb5, 0x0264, 0x026f, 0x0279, 0x0285, 0x0000, 0x0290, 0x0299,
-0x02a2, 0x02ab, 0x02b4, 0x02bf, 0x02c8, 0x0000, 0x0000, 0x0000,
-0x3bcf, 0x0000, 0x0000, 0x0000, 0x3c7b, 0x0000, 0x0000, 0x0000,
-0x3bdb, 0x0000, 0x3bea, 0x0000, 0x3bf7, 0x0000, 0x3c08, 0x02d2,
-0x02f4, 0x0301, 0x3c21, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-0x6568, 0x392d, 0x030e, 0x3950, 0x3963, 0x3973, 0x0319, 0x3995,
-0x39aa, 0x39bf, 0x0326, 0x0330, 0x033a, 0x0344, 0x034e, 0x035a,
-0x0366, 0x0370, 0x037d, 0x0389, 0x03a5, 0x03c2, 0x03cd, 0x03da,
-0x03e8, 0x0000, 0x3c2f, 0x0000, 0x3b13, 0x3b25, 0x3b32, 0x3b47,
-0x3b54, 0x3b62, 0x3b70, 0x0403, 0x0413, 0x041e, 0x042f, 0x043f,
-0x044e, 0x045c, 0x0465, 0x046e, 0x0477, 0x0480, 0x0489, 0x0492,
-0x049b, 0x04a4, 0x04ad, 0x0000, 0x3c60, 0x0000, 0x03f6, 0x04b6,
-0x04bd, 0x04c4, 0x04cb, 0x04d2, 0x04d9, 0x04e0, 0x04e7, 0x04ee,
-0x04f5, 0x04fd, 0x050c, 0x051b, 0x052a, 0x0539, 0x0548, 0x0557,
-0x0566, 0x0575, 0x0584, 0x0594, 0x05a3, 0x05b2, 0x05c1, 0x05d0,
-0x05df, 0x05ee, 0x05fd, 0x060c, 0x061b, 0x062b, 0x063b, 0x064b,
-0x065b, 0x066b, 0x067b, 0x0687, 0x0693, 0x06a1, 0x06af, 0x06bd,
-0x06cc, 0x06d7, 0x06e2, 0x06ec, 0x06f6, 0x0702, 0x070e, 0x071a,
-0x0000, 0x5d96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5f54,
-0x0000, 0x5f62, 0x0000, 0x5f98, 0x0000, 0x0000, 0x0000, 0x0000,
-0x007b, 0x0000, 0x0000, 0x0000, 0x0000, 0x5ddc, 0x0000, 0x0000,
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+static const unsigned short ks_value_names[26][256] = {
+/* Page 0.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 1, keysyms 0x0000-0x00ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x47be, 0x0ddb, 0x1342, 0x0a79, 0x3148, 0x1867, 0x09fe, 0x25bd,
+0x063e, 0x299a, 0x0836, 0x0ac8, 0x12a6, 0x097f, 0x3e2b, 0x1464,
+0x0402, 0x3fb2, 0x3f47, 0x3e29, 0x3f49, 0x3ab7, 0x2b10, 0x1a70,
+0x3b83, 0x03d6, 0x0abc, 0x2705, 0x3f0c, 0x10f6, 0x3052, 0x3916,
+0x278f, 0x42fd, 0x365a, 0x1bfb, 0x32e3, 0x3c8b, 0x35bc, 0x3e1d,
+0x257c, 0x00e0, 0x30b7, 0x4bfa, 0x2e1a, 0x097d, 0x34c2, 0x385f,
+0x3a57, 0x2050, 0x424a, 0x01a8, 0x22a7, 0x2ec8, 0x43d0, 0x34c0,
+0x098e, 0x3278, 0x2f9b, 0x1aaf, 0x291a, 0x2fec, 0x429e, 0x2115,
+0x0302, 0x1df2, 0x2b12, 0x0018, 0x4253, 0x2d19, 0x2552, 0x348b,
+0x2e18, 0x02af, 0x265c, 0x2d51, 0x06c9, 0x3ac3, 0x1092, 0x497b,
+0x43eb, 0x3b81, 0x0ea3, 0x3062, 0x2ec6, 0x1d83, 0x300a, 0x094a,
+0x0b71, 0x10fc, 0x1b3b, 0x2d21, 0x41dc, 0x327a, 0x0d1c, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x2357, 0x3ea4, 0x2d14, 0x2462, 0x2072, 0x36ea, 0x4059, 0x1ca4,
+0x3f1e, 0x14b0, 0x43a7, 0x349a, 0x4aea, 0x2272, 0x4835, 0x29f4,
+0x0427, 0x1b1f, 0x2b38, 0x4bfc, 0x3942, 0x1059, 0x2785, 0x3ae1,
+0x17ce, 0x372b, 0x0876, 0x3171, 0x10b1, 0x2048, 0x4504, 0x3f28,
+0x1b84, 0x2f54, 0x2132, 0x3839, 0x19cc, 0x40cd, 0x0ca2, 0x14e2,
+0x2988, 0x0b95, 0x21fb, 0x1243, 0x34d8, 0x1814, 0x06ed, 0x26c0,
+0x10f2, 0x44b5, 0x33fa, 0x3fcf, 0x3b4b, 0x1728, 0x200f, 0x0f60,
+0x20e5, 0x13e3, 0x0da6, 0x18bd, 0x27e4, 0x1008, 0x42aa, 0x0c49,
+0x250a, 0x0614, 0x124e, 0x14c0, 0x1e66, 0x1ac3, 0x02ff, 0x256a,
+0x454c, 0x481b, 0x39d1, 0x0aa6, 0x36e3, 0x4905, 0x27a2, 0x1ac9,
+0x0cf5, 0x0253, 0x125a, 0x3be9, 0x2966, 0x03b0, 0x10e7, 0x33f1,
+0x3cff, 0x2554, 0x3237, 0x0171, 0x48c4, 0x3034, 0x1140, 0x2304
+},
+/* Page 2, keysyms 0x0100-0x01ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x1879, 0x2d1b, 0x2c65, 0xffff, 0x225b, 0x4814, 0xffff,
+0xffff, 0x0261, 0x2ee1, 0x2029, 0x23f6, 0xffff, 0x4097, 0x4748,
+0xffff, 0x2740, 0x45da, 0x111f, 0xffff, 0x1b98, 0x2901, 0x14ba,
+0xffff, 0x0ad4, 0x1981, 0x3c8d, 0x4133, 0x4938, 0x352c, 0x40ec,
+0x3e16, 0xffff, 0xffff, 0x267f, 0xffff, 0x43c1, 0x20de, 0xffff,
+0x1cac, 0xffff, 0x16be, 0xffff, 0x0918, 0xffff, 0xffff, 0x2503,
+0x00b5, 0x436b, 0x0eff, 0xffff, 0xffff, 0x17f0, 0xffff, 0xffff,
+0x1b0b, 0x4595, 0xffff, 0x1e7b, 0xffff, 0xffff, 0x0eec, 0xffff,
+0x0c61, 0xffff, 0xffff, 0x2a10, 0xffff, 0x146a, 0x2a74, 0xffff,
+0x0b6a, 0xffff, 0x1043, 0xffff, 0x4471, 0xffff, 0xffff, 0x2d3e,
+0x403c, 0x191c, 0x1445, 0xffff, 0xffff, 0x36c6, 0xffff, 0xffff,
+0x2a29, 0x3c52, 0xffff, 0x122b, 0xffff, 0xffff, 0x1a93, 0x0ca5
+},
+/* Page 3, keysyms 0x0200-0x02ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x3ceb, 0xffff, 0xffff, 0xffff, 0xffff, 0x089c, 0xffff,
+0xffff, 0x3b57, 0xffff, 0x3c4b, 0x25d0, 0xffff, 0xffff, 0xffff,
+0xffff, 0x3bc5, 0xffff, 0xffff, 0xffff, 0xffff, 0x15fa, 0xffff,
+0xffff, 0x102f, 0xffff, 0x1a9c, 0x490c, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3e3e, 0x19a9, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0d04, 0xffff, 0xffff,
+0x4437, 0xffff, 0xffff, 0xffff, 0xffff, 0x469d, 0x3cf3, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2e26, 0x447c, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3625, 0xffff, 0xffff,
+0x37d8, 0xffff, 0xffff, 0xffff, 0xffff, 0x365c, 0x38dc, 0xffff
+},
+/* Page 4, keysyms 0x0300-0x03ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0x3a07, 0x2252, 0xffff, 0x2bf9, 0x366d, 0xffff,
+0xffff, 0xffff, 0x2ac1, 0x2b6f, 0x2fa5, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0x0adb, 0xffff, 0x26b9, 0x38f2, 0xffff,
+0xffff, 0xffff, 0x2245, 0x30c6, 0x025a, 0x10fe, 0xffff, 0x234b,
+0x248a, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2a08,
+0xffff, 0xffff, 0xffff, 0xffff, 0x4766, 0xffff, 0xffff, 0x0894,
+0xffff, 0x3e06, 0x27ff, 0x0a35, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x464e, 0xffff, 0xffff, 0xffff, 0x424c, 0x386e, 0xffff,
+0x1452, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2677,
+0xffff, 0xffff, 0xffff, 0xffff, 0x4561, 0xffff, 0xffff, 0x143d,
+0xffff, 0x182c, 0x4363, 0x34c4, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x3a1e, 0xffff, 0xffff, 0xffff, 0x126c, 0x3547, 0xffff
+},
+/* Page 5, keysyms 0x0400-0x04ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x496c, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x11c4, 0x132e, 0x0114, 0x00bd, 0x167a, 0x12ea, 0x0b1e,
+0x3461, 0x20ee, 0x2ab2, 0x163b, 0x25b5, 0x009c, 0x284e, 0x1bb5,
+0x1c83, 0x0c80, 0x073b, 0x3f64, 0x0690, 0x19ff, 0x199e, 0x32b7,
+0x4a91, 0x458d, 0x2908, 0x486e, 0x2814, 0x158b, 0x4255, 0x177f,
+0x2279, 0x2afa, 0x3817, 0x395a, 0x33e9, 0x4ae2, 0x09e2, 0x260d,
+0x27bf, 0x482d, 0x4390, 0x2ab9, 0x1506, 0x01c3, 0x25c8, 0x0de2,
+0x3dfe, 0x375b, 0x2c6d, 0x0548, 0x134b, 0x3716, 0x47b6, 0x2d45,
+0x2c18, 0x02f7, 0x2c07, 0x305a, 0x26d9, 0x03fb, 0x1d36, 0x1765,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 6, keysyms 0x0500-0x05ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x2f9d, 0x4372, 0x43c8, 0x1e22, 0x10a9, 0x1abb, 0x2c9d, 0x4b26,
+0x1a7e, 0x0ab4, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x25e7, 0x3a85, 0x3223,
+0x1d2b, 0x2807, 0x24a0, 0x19c0, 0x205e, 0xffff, 0x074c, 0xffff,
+0x14f2, 0x46c8, 0x2c75, 0x4180, 0x313f, 0x1070, 0x37e4, 0x1db5,
+0x128b, 0x32ff, 0xffff, 0x1e55, 0xffff, 0xffff, 0xffff, 0x2881,
+0xffff, 0x40aa, 0x2f07, 0x31ac, 0x232a, 0x17da, 0x15a7, 0x3dc2,
+0x0b7e, 0x2e64, 0x3e6b, 0x42f1, 0x0b48, 0x3d1f, 0x0e24, 0x3928,
+0x0bae, 0x4a60, 0x4309, 0x49a4, 0x1085, 0x4b3f, 0x0dc9, 0x2748,
+0x2f1a, 0x39ea, 0x1835, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x07c5, 0x1792, 0x039e, 0x000d, 0x2387, 0x2a5f, 0x4a54, 0x2c3f,
+0x48fa, 0x3423, 0x36a1, 0x311b, 0x4200, 0x3a2e, 0x185a, 0x1a1e,
+0x34f2, 0x0c94, 0x168b, 0x02b1, 0x47a3, 0x09a3, 0x1fb2, 0x1de7,
+0x4464, 0x13b7, 0x3fd6, 0x18fb, 0x48cf, 0x2bd9, 0x2ccf, 0xffff
+},
+/* Page 7, keysyms 0x0600-0x06ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x22f3, 0x139c, 0x1409, 0x25f6, 0x09b6, 0x3264, 0x1d85, 0x1dbe,
+0x036e, 0x2ca5, 0x37f8, 0xffff, 0x437a, 0x24b9, 0x1e88, 0x0f79,
+0x2cf5, 0x2364, 0x20ff, 0x0fc8, 0x38fb, 0x0822, 0x100f, 0x3e8e,
+0x396a, 0x0ec8, 0x193d, 0xffff, 0x0128, 0x453a, 0x11e1, 0x3441,
+0xffff, 0x4b89, 0x37b6, 0x2521, 0x2b95, 0x43ed, 0x409e, 0x1ea2,
+0x3217, 0x0afe, 0x2281, 0x2ea2, 0x4553, 0x4a30, 0x3b6d, 0x4ad4,
+0x1294, 0x427f, 0x121d, 0x0352, 0x3773, 0x2623, 0x3eaf, 0x39c4,
+0x162b, 0x24ac, 0x01fa, 0x3c58, 0x3b2d, 0x0fae, 0x49ec, 0x2d82,
+0x029d, 0x452c, 0x46bc, 0x30cf, 0x0247, 0x093e, 0x2030, 0x050e,
+0x3258, 0x34cd, 0x04fe, 0x1d0a, 0x18b1, 0x1353, 0x2734, 0x2534,
+0x4857, 0x1f8a, 0x0580, 0x246b, 0x416b, 0x4843, 0x09d5, 0x259f,
+0x2a98, 0x4016, 0x0786, 0x2727, 0x35a5, 0x0a97, 0x3ffd, 0x35ec,
+0x1f3c, 0x0ffd, 0x1c92, 0x3861, 0x1322, 0x1d16, 0x090c, 0x3fa1,
+0x1f54, 0x0c3e, 0x241a, 0x2b63, 0x3b85, 0x1aa3, 0x17c2, 0x4863,
+0x0952, 0x17b6, 0x475a, 0x3b21, 0x2e76, 0x298f, 0x02ea, 0x3ad5,
+0x13f7, 0x314f, 0x13cc, 0x2e36, 0x3981, 0x355c, 0x4b72, 0x318d
+},
+/* Page 8, keysyms 0x0700-0x07ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x12ac, 0x4682, 0x035e, 0x198d, 0x0990, 0xffff, 0x37c4,
+0x1fbd, 0x189b, 0xffff, 0x0e79, 0xffff, 0xffff, 0x2207, 0x1563,
+0xffff, 0x2a86, 0x24d7, 0x47ef, 0x0f2c, 0x19ec, 0x002c, 0x12c8,
+0x1ed9, 0x0792, 0x2d53, 0x3383, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x307f, 0x19b5, 0x1dfa, 0x044e, 0x04ad, 0x1d64, 0x2e06,
+0x0cae, 0x3f7d, 0x31ff, 0x265e, 0x4295, 0x3579, 0x16b5, 0x215d,
+0x4ab5, 0x24f9, 0x40d3, 0xffff, 0x00e2, 0x184c, 0x0f49, 0x4770,
+0x3663, 0x3308, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x1b9f, 0x315d, 0x1079, 0x0207, 0x32f1, 0x37ed, 0x2910,
+0x1eed, 0x13d8, 0x29e2, 0x0627, 0x0be5, 0x36bd, 0x08a8, 0x26ab,
+0x46ec, 0x4732, 0x04ca, 0x0226, 0x20f5, 0x3d11, 0x2e1c, 0x186f,
+0x15e1, 0x35b0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 9, keysyms 0x0800-0x08ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x0fdf, 0x136b, 0x080e, 0x1bc8, 0x150e, 0x1154, 0x36ac,
+0x0a3e, 0x2939, 0x0eb6, 0x12dc, 0x2615, 0x154f, 0x3cbb, 0x4ba1,
+0x4922, 0x1669, 0x05bb, 0x3c65, 0x2585, 0x40b7, 0x4491, 0x46d7,
+0xffff, 0xffff, 0xffff, 0xffff, 0x356b, 0x41d3, 0x16fd, 0x39a8,
+0x3d3f, 0x1162, 0x02c4, 0xffff, 0xffff, 0x0061, 0xffff, 0xffff,
+0x15b9, 0x2d90, 0xffff, 0xffff, 0xffff, 0x2129, 0x0ded, 0x456b,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2aaa, 0xffff,
+0xffff, 0xffff, 0x0e8b, 0x0985, 0x12f2, 0x144c, 0x4080, 0x1ce3,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x16c6,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3cab, 0xffff,
+0xffff, 0xffff, 0xffff, 0x47ff, 0x322f, 0x2d77, 0x07e4, 0xffff
+},
+/* Page 10, keysyms 0x0900-0x09ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2e30,
+0x171b, 0x3e81, 0x055f, 0x0c5e, 0x26f0, 0x1bc5, 0xffff, 0xffff,
+0x1bbe, 0x0c10, 0x228e, 0x2924, 0x1749, 0x323e, 0x0283, 0x15eb,
+0x192e, 0x1756, 0x4143, 0x04bb, 0x3419, 0x0648, 0x1537, 0x224d,
+0x4a89, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 11, keysyms 0x0a00-0x0aff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x06f9, 0x3dba, 0x3dce, 0x1740, 0x1038, 0x02cd, 0x2896,
+0x194b, 0x2db6, 0x4a29, 0xffff, 0x1955, 0xffff, 0x1471, 0x36d3,
+0x2c7e, 0x0bf9, 0x2a6b, 0x22a9, 0x2644, 0x2dab, 0x319f, 0x0f21,
+0x2438, 0xffff, 0xffff, 0x435b, 0x0701, 0x46a4, 0x007e, 0x03a9,
+0xffff, 0xffff, 0xffff, 0x1912, 0x04e5, 0x0ee0, 0x3f57, 0xffff,
+0xffff, 0x428b, 0x28c5, 0x4416, 0x1ad4, 0x30f4, 0x40df, 0x2a4f,
+0x07b1, 0x4a00, 0x41ec, 0x01e5, 0x06cb, 0xffff, 0x2d6f, 0x3a26,
+0xffff, 0x1d9d, 0x2776, 0x4b2e, 0x3361, 0x4315, 0x0cd3, 0x33d6,
+0x2f5b, 0x28ee, 0x201a, 0x0484, 0x03e9, 0x10de, 0x253f, 0x3ba9,
+0x0bbd, 0x4bb6, 0x2c49, 0x0268, 0x043a, 0x38bc, 0x2099, 0xffff,
+0x01cb, 0x0acd, 0x266a, 0x2179, 0x017d, 0x37a9, 0x41b6, 0x4809,
+0x1807, 0x1318, 0x1a2b, 0x0e30, 0x4587, 0x268d, 0x3592, 0x2bab
+},
+/* Page 12, keysyms 0x0b00-0x0bff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0x3676, 0xffff, 0xffff, 0x1261, 0xffff,
+0x0697, 0x119b, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x22e1, 0xffff, 0x484e, 0x3540, 0x16d8, 0xffff, 0x105c, 0xffff,
+0xffff, 0xffff, 0x0d98, 0xffff, 0x3f8f, 0xffff, 0x4b1f, 0x3e0f,
+0xffff, 0xffff, 0xffff, 0x0b10, 0xffff, 0xffff, 0x2f3e, 0xffff,
+0x4b57, 0xffff, 0x4177, 0xffff, 0x2145, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0x3e48, 0xffff, 0xffff, 0xffff
+},
+/* Page 13, keysyms 0x0c00-0x0cff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0a08,
+0x1273, 0x1b68, 0x4944, 0x2455, 0x3064, 0x14fb, 0x41e0, 0x21a1,
+0x0473, 0x3884, 0x47cd, 0x0ce6, 0x03dc, 0x4443, 0x3e76, 0x0776,
+0x4822, 0x1a3d, 0x0165, 0x3d74, 0x1ef9, 0x41a5, 0x03b7, 0x135f,
+0x2650, 0x3f4b, 0x1238, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 14, keysyms 0x0d00-0x0dff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x30e9, 0x34a8, 0x4951, 0x11a3, 0x0683, 0x3fb4, 0x432e,
+0x4044, 0x1a10, 0x2f6c, 0x085d, 0x3eef, 0x46f5, 0x35be, 0x01aa,
+0x1f6f, 0x2631, 0x0e14, 0x0bee, 0x1135, 0x4a6a, 0x208b, 0x0929,
+0x33b0, 0x0cc9, 0x1ec1, 0x244a, 0x35cb, 0x4666, 0x0f8b, 0x3999,
+0x3d55, 0x1842, 0x0e64, 0x2d33, 0x2f36, 0x3d83, 0x0b40, 0x312b,
+0x3da3, 0x1a72, 0x1e97, 0x364f, 0x4b4a, 0x3e1f, 0x0dbb, 0x32d0,
+0x00fc, 0x1d42, 0x0669, 0x3468, 0x0347, 0x03ca, 0x218a, 0x152a,
+0x3d06, 0x22c3, 0x1ae5, 0xffff, 0xffff, 0xffff, 0x3a9d, 0x1e71,
+0x16aa, 0x18e4, 0x2972, 0x3823, 0x1593, 0x434a, 0x4996, 0x06ad,
+0x231f, 0x4108, 0x2c87, 0x2ce4, 0x4453, 0x1afd, 0xffff, 0xffff,
+0x3c7f, 0x0107, 0x42b0, 0x0392, 0x4521, 0x3bcd, 0x203c, 0x1a86,
+0x3180, 0x2052, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 15, keysyms 0x0e00-0x0eff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x39b6, 0x31d3, 0x2a17, 0x0723, 0x3f6b, 0x0415, 0x07ee,
+0x2e82, 0x3a4a, 0x209f, 0x059d, 0x1eaf, 0x0313, 0x1cf8, 0x1656,
+0x3948, 0x41c2, 0x1430, 0x1b29, 0x00a4, 0x0888, 0x141f, 0x44f7,
+0x2392, 0x0153, 0x1c40, 0x181e, 0x2228, 0x1bd4, 0x31e6, 0x09cc,
+0x461f, 0x3a7b, 0x18f0, 0x0902, 0x11bb, 0x1fe8, 0x1bab, 0x2c0f,
+0x1c6e, 0x4128, 0x145a, 0x21c5, 0x2fe3, 0x4614, 0x1775, 0x0742,
+0x38e8, 0x4988, 0x255b, 0x24cb, 0x2dcb, 0x1961, 0x0600, 0x4c1e,
+0x006a, 0x0d84, 0x308b, 0x0aef, 0x3d2a, 0x137a, 0x1a5c, 0x42cf,
+0x31bf, 0x1176, 0x48b0, 0x1e2a, 0x3c94, 0x08b1, 0x2fb8, 0x1f9f,
+0x11d2, 0x3b08, 0x34ff, 0x2262, 0x0550, 0x14a0, 0x26e1, 0x3af0,
+0x4897, 0x3e52, 0x043f, 0x49b0, 0x075c, 0x0d27, 0x4725, 0x3876,
+0x32bf, 0x29a5, 0x05eb, 0xffff, 0xffff, 0xffff, 0xffff, 0x0c33
+},
+/* Page 16, keysyms 0x1200-0x12ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x3552, 0x3c0b, 0xffff, 0xffff, 0xffff, 0x4c2d, 0xffff,
+0x0c68, 0xffff, 0x3810, 0x360f, 0x0f1a, 0xffff, 0xffff, 0xffff,
+0x1a06, 0x45f7, 0xffff, 0xffff, 0x116c, 0x44bc, 0xffff, 0x2c93,
+0x0a84, 0x45ed, 0x22d3, 0x4b7f, 0x22da, 0x0852, 0x1ced, 0x064f,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x0494, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4032,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x20d2, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x2b44, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x11f0,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1bfd, 0xffff
+},
+/* Page 17, keysyms 0x1300-0x13ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0x0dea, 0x0ab1, 0x46b1, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 18, keysyms 0x1400-0x14ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x001a, 0x33c1, 0x4601, 0x0f06, 0x1dd4, 0x38c4, 0x20b2,
+0x4b61, 0x351f, 0x1612, 0x4398, 0x08de, 0x425d, 0x3f35, 0x2b14,
+0x29c0, 0x0d72, 0x240d, 0x2f47, 0x1be2, 0x2e95, 0x1b8b, 0x13ea,
+0x0a8b, 0x1c56, 0x3453, 0x4ac6, 0x0f3d, 0x408b, 0x1e39, 0x2753,
+0x4074, 0x3619, 0x3b61, 0x1f03, 0x1c1a, 0x3fe9, 0x2a30, 0x0219,
+0x242a, 0x24eb, 0x333b, 0x00c8, 0x44c6, 0x188e, 0x08f5, 0x1da8,
+0x1f48, 0x2fac, 0x01d8, 0x2eb9, 0x0c50, 0x329e, 0x15c9, 0x1127,
+0x083f, 0x2841, 0x320b, 0x042e, 0x3d49, 0x22b3, 0x271a, 0x1fd1,
+0x0feb, 0x400a, 0x153c, 0x379c, 0x237b, 0x21e3, 0x3b9d, 0x378d,
+0x0b89, 0x10bc, 0x061b, 0x3b91, 0x1b3d, 0x2002, 0x3a5d, 0x2bb2,
+0x2bcd, 0x4a75, 0x04a0, 0x0c87, 0x1094, 0x2492, 0x0d0e, 0x4189,
+0x0324, 0x10c8, 0x11fa, 0x1af2, 0x1d77, 0x32e5, 0x045a, 0x2e4e
+},
+/* Page 19, keysyms 0x1500-0x15ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x0147, 0x2834, 0x05cc, 0x30dc, 0x2dfa, 0x2b03, 0x0a1d, 0x23fd,
+0x3a3e, 0x29fb, 0x06bc, 0x3f11, 0x3cde, 0x2dee, 0x0000, 0x0275,
+0x2bc0, 0x30b9, 0x33a3, 0x04f2, 0x1f2e, 0x2958, 0x2d06, 0x48ed,
+0x3a0b, 0x2eca, 0x398c, 0x1b12, 0x0385, 0x052c, 0x0e96, 0x4bd2,
+0x371e, 0x45e1, 0x0f53, 0x1606, 0x08c4, 0x0c03, 0x1bef, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 20, keysyms 0x1600-0x16ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0x2f7a, 0x3df4, 0xffff, 0x22e9, 0x023c, 0x354f,
+0x181b, 0x3962, 0x257e, 0xffff, 0xffff, 0xffff, 0xffff, 0x0045,
+0xffff, 0xffff, 0x0a5b, 0x164c, 0x0dd4, 0x4157, 0x4696, 0x33be,
+0x4840, 0x17ae, 0x2686, 0xffff, 0xffff, 0x2932, 0xffff, 0x3137,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4210, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x23a9, 0x2235, 0x19e5, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x4a4a, 0x3582, 0x350e, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0ff7, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 21, keysyms 0x1e00-0x1eff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2c55,
+0x12be, 0x4161, 0x1df4, 0x3ed0, 0x0e53, 0x0404, 0x49db, 0x120c,
+0x0f69, 0x3ac5, 0x35fe, 0x2f25, 0x1304, 0x004d, 0x388f, 0x4af8,
+0x281d, 0x2bea, 0x00d5, 0x477a, 0x3de8, 0x3bf0, 0x04d6, 0x2ef8,
+0x21bb, 0x216f, 0x1b62, 0x0ac2, 0x129f, 0x10a2, 0x0c6f, 0x1b73,
+0x4063, 0x058c, 0x0f9e, 0x118b, 0x147a, 0x2c20, 0x3747, 0x3d8f,
+0x1c9e, 0x4244, 0x0eac, 0x091f, 0x4918, 0x0d9c, 0x3413, 0x43e5,
+0x3dd7, 0x2ff9, 0x389b, 0x4233, 0x4b0f, 0x3efc, 0x0336, 0x36fa,
+0x4114, 0x2fc6, 0x3bfc, 0x4b04, 0x1c78, 0x2196, 0x2ae0, 0x10d4,
+0x243f, 0x0633, 0x23b3, 0x2b50, 0x0bcf, 0x25ab, 0x0938, 0x23c5,
+0x0308, 0x0730, 0x276b, 0x497d, 0x3b17, 0x15d7, 0x3fc4, 0x2a7b,
+0x3395, 0x053a, 0x2792, 0x2871, 0x229d, 0x29d8, 0x1549, 0x047e,
+0x1cbd, 0x4389, 0x08ef, 0x46d1, 0x29ee, 0x07fc, 0x0867, 0x3c38
+},
+/* Page 22, keysyms 0x2000-0x20ff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x44ef, 0x1642, 0x08d1, 0x0b73, 0x4633, 0x4488, 0x42ff, 0x2acc,
+0x440c, 0x214e, 0x3375, 0x3646, 0x4403, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 23, keysyms 0xfd00-0xfdff.  */
+{
+0xffff, 0x4512, 0x0b25, 0x0291, 0x370b, 0x4675, 0x138e, 0x433a,
+0x44e4, 0x0562, 0x2ad7, 0x0189, 0x413a, 0x239f, 0x3536, 0x28dd,
+0x4428, 0x1f7c, 0x3f97, 0x297d, 0x4629, 0x0ef5, 0x16e2, 0x3ebb,
+0x1c62, 0x463c, 0x3763, 0x21ad, 0x2a3d, 0x1c09, 0x32ac, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff
+},
+/* Page 24, keysyms 0xfe00-0xfeff.  */
+{
+0xffff, 0x47c4, 0x0d3d, 0x44d3, 0x16ec, 0x0659, 0x2aea, 0x14d3,
+0x40f6, 0x09ea, 0x1e06, 0x056c, 0x3737, 0x110a, 0x3c15, 0x45b4,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x348d, 0x306e, 0x2ddb, 0x2b24, 0x23cb, 0x301d, 0x4701, 0x3477,
+0x06d8, 0x28ad, 0x3285, 0x2b78, 0x23e1, 0x0192, 0x34df, 0x3314,
+0x095e, 0x4a99, 0x1146, 0x02d8, 0x3ab9, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x0dad, 0x0a2a, 0x45a4, 0x3106, 0x21ef, 0x2829, 0x30a9, 0x3d65,
+0x0cba, 0x27d3, 0x1280, 0x3852, 0x473c, 0x1fde, 0x49c9, 0x0b54,
+0x43d7, 0x3ec6, 0x28d3, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x1ff3, 0x1b4a, 0x42bd, 0x00ec, 0x45c8, 0x4575, 0x47de, 0x303b,
+0x0137, 0x07d4, 0x1cd0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x148b, 0x3cca, 0x48d9, 0xffff, 0x3c24, 0x1e44, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x3780, 0x0d64, 0x270f, 0x362f, 0x3933, 0x151a, 0x179d, 0x1d52,
+0x4a15, 0x4879, 0x2511, 0x207b, 0x3b3b, 0x27ef, 0x0d4e, 0x1698,
+0x2cbd, 0x3329, 0x39f5, 0x05d9, 0x4be8, 0x2c31, 0x19d7, 0x4024,
+0x3ed6, 0x35d9, 0x2477, 0x0c1f, 0x21cf, 0x104b, 0xffff, 0xffff
+},
+/* Page 25, keysyms 0xff00-0xffff.  */
+{
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x11b1, 0x4478, 0x07a8, 0x0f98, 0xffff, 0x13c2, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0x02a9, 0x14c7, 0x3ca3, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0x3cb4, 0xffff, 0xffff, 0xffff, 0xffff,
+0x2eaf, 0x33e3, 0x2120, 0x06a1, 0x2c00, 0x2fda, 0x1c4d, 0x44a3,
+0x4790, 0x1d6f, 0x1f15, 0x368e, 0x3f88, 0x3806, 0x3696, 0x4785,
+0x27c7, 0x0ea5, 0x172f, 0x3bba, 0x0e07, 0x05af, 0x0675, 0x18da,
+0x4889, 0x1e15, 0x421e, 0x27ae, 0x230f, 0x3401, 0x0b9c, 0x233c,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x155e, 0x39b1, 0x4537, 0x4af2, 0x4798, 0x1f0f, 0x2b5e, 0x22cf,
+0x3922, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0x213e, 0x094c, 0x4216, 0x2183, 0xffff, 0x2565, 0x3911, 0x39dd,
+0x081d, 0x14eb, 0x42ec, 0x084c, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2f8f, 0x459b,
+0x2ed8, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0x2156, 0xffff, 0xffff, 0xffff, 0x1f25, 0xffff, 0xffff,
+0xffff, 0x479d, 0x4975, 0x0330, 0x3daf, 0x1102, 0x4752, 0x0213,
+0x2573, 0x4051, 0x2ba2, 0x39e2, 0x26a0, 0x1f96, 0x17fd, 0x363c,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0x0bd9, 0x0df5, 0x0a6c, 0x0090, 0x3ee4, 0x3515,
+0x4670, 0x422e, 0x2cdf, 0x3db5, 0x43d2, 0x12ff, 0x4152, 0x0b0b,
+0x046e, 0x3a19, 0xffff, 0xffff, 0xffff, 0x3168, 0x2ac9, 0x0d3a,
+0x0cf2, 0x3820, 0x0067, 0x4876, 0x3836, 0x26cb, 0x0e50, 0x341f,
+0x40c9, 0x17d6, 0x1637, 0x22bf, 0x32df, 0x4992, 0x2f8b, 0x2b91,
+0x2530, 0x1bc1, 0x2e14, 0x39a4, 0x173c, 0x26a7, 0x3c07, 0x03d8,
+0x216b, 0x0243, 0x432a, 0x3be5, 0x427b, 0x3fae, 0x26ce, 0x286d,
+0x3a59, 0x4bca, 0x0880, 0x1cb3, 0x42e2, 0x3111, 0x3012, 0x26d2,
+0x1205, 0x0b18, 0x0977, 0x43fb, 0x1027, 0x2d2b, 0x1976, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x03c3
+}
 };
+
 #endif /* NEEDVTABLE */
+
+#ifdef NEEDUCSTABLE
+#define ks_ucs_PAGES	22
+
+static const unsigned char ks_ucs_pages[256] = {
+  1,   2,   3,   4,   5,   6,   7,   8,
+  9,  10,  11,   0,  12,  13,  14,   0,
+  0,   0,  15,  16,  17,  18,  19,   0,
+  0,   0,   0,   0,   0,   0,  20,   0,
+ 21,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const unsigned short ks_ucs[22][256] = {
+/* Page 0.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 1, keysyms 0x0000-0x00ff.  */
+{
+0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff
+},
+/* Page 2, keysyms 0x0100-0x01ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0104, 0x02d8, 0x0141, 0x0000, 0x013d, 0x015a, 0x0000,
+0x0000, 0x0160, 0x015e, 0x0164, 0x0179, 0x0000, 0x017d, 0x017b,
+0x0000, 0x0105, 0x02db, 0x0142, 0x0000, 0x013e, 0x015b, 0x02c7,
+0x0000, 0x0161, 0x015f, 0x0165, 0x017a, 0x02dd, 0x017e, 0x017c,
+0x0154, 0x0000, 0x0000, 0x0102, 0x0000, 0x0139, 0x0106, 0x0000,
+0x010c, 0x0000, 0x0118, 0x0000, 0x011a, 0x0000, 0x0000, 0x010e,
+0x0110, 0x0143, 0x0147, 0x0000, 0x0000, 0x0150, 0x0000, 0x0000,
+0x0158, 0x016e, 0x0000, 0x0170, 0x0000, 0x0000, 0x0162, 0x0000,
+0x0155, 0x0000, 0x0000, 0x0103, 0x0000, 0x013a, 0x0107, 0x0000,
+0x010d, 0x0000, 0x0119, 0x0000, 0x011b, 0x0000, 0x0000, 0x010f,
+0x0111, 0x0144, 0x0148, 0x0000, 0x0000, 0x0151, 0x0000, 0x0000,
+0x0159, 0x016f, 0x0000, 0x0171, 0x0000, 0x0000, 0x0163, 0x02d9
+},
+/* Page 3, keysyms 0x0200-0x02ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0126, 0x0000, 0x0000, 0x0000, 0x0000, 0x0124, 0x0000,
+0x0000, 0x0130, 0x0000, 0x011e, 0x0134, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0127, 0x0000, 0x0000, 0x0000, 0x0000, 0x0125, 0x0000,
+0x0000, 0x0131, 0x0000, 0x011f, 0x0135, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x010a, 0x0108, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0000, 0x0000,
+0x011c, 0x0000, 0x0000, 0x0000, 0x0000, 0x016c, 0x015c, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x010b, 0x0109, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0121, 0x0000, 0x0000,
+0x011d, 0x0000, 0x0000, 0x0000, 0x0000, 0x016d, 0x015d, 0x0000
+},
+/* Page 4, keysyms 0x0300-0x03ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0138, 0x0156, 0x0000, 0x0128, 0x013b, 0x0000,
+0x0000, 0x0000, 0x0112, 0x0122, 0x0166, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0157, 0x0000, 0x0129, 0x013c, 0x0000,
+0x0000, 0x0000, 0x0113, 0x0123, 0x0167, 0x014a, 0x0000, 0x014b,
+0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x012e,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0116, 0x0000, 0x0000, 0x012a,
+0x0000, 0x0145, 0x014c, 0x0136, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0172, 0x0000, 0x0000, 0x0000, 0x0168, 0x016a, 0x0000,
+0x0101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x012f,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0117, 0x0000, 0x0000, 0x012b,
+0x0000, 0x0146, 0x014d, 0x0137, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0173, 0x0000, 0x0000, 0x0000, 0x0169, 0x016b, 0x0000
+},
+/* Page 5, keysyms 0x0400-0x04ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x3002, 0x3008, 0x3009, 0x3001, 0x30fb, 0x30f2, 0x30a1,
+0x30a3, 0x30a5, 0x30a7, 0x30a9, 0x30e3, 0x30e5, 0x30e7, 0x30c3,
+0x30fc, 0x30a2, 0x30a4, 0x30a6, 0x30a8, 0x30aa, 0x30ab, 0x30ad,
+0x30af, 0x30b1, 0x30b3, 0x30b5, 0x30b7, 0x30b9, 0x30bb, 0x30bd,
+0x30bf, 0x30c1, 0x30c4, 0x30c6, 0x30c8, 0x30ca, 0x30cb, 0x30cc,
+0x30cd, 0x30ce, 0x30cf, 0x30d2, 0x30d5, 0x30d8, 0x30db, 0x30de,
+0x30df, 0x30e0, 0x30e1, 0x30e2, 0x30e4, 0x30e6, 0x30e8, 0x30e9,
+0x30ea, 0x30eb, 0x30ec, 0x30ed, 0x30ef, 0x30f3, 0x309b, 0x309c,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 6, keysyms 0x0500-0x05ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0417, 0x0428, 0x042d, 0x0429, 0x0427, 0x042a,
+0x06f0, 0x06f1, 0x06f2, 0x06f3, 0x06f4, 0x06f5, 0x06f6, 0x06f7,
+0x06f8, 0x06f9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x066a, 0x0670, 0x0679,
+0x067e, 0x0686, 0x0688, 0x0691, 0x060c, 0x0000, 0x06d4, 0x0000,
+0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665, 0x0666, 0x0667,
+0x0668, 0x0669, 0x0000, 0x061b, 0x0000, 0x0000, 0x0000, 0x061f,
+0x0000, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627,
+0x0628, 0x0629, 0x062a, 0x062b, 0x062c, 0x062d, 0x062e, 0x062f,
+0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637,
+0x0638, 0x0639, 0x063a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647,
+0x0648, 0x0649, 0x064a, 0x064b, 0x064c, 0x064d, 0x064e, 0x064f,
+0x0650, 0x0651, 0x0652, 0x0653, 0x0654, 0x0655, 0x0698, 0x06a4,
+0x06a9, 0x06af, 0x06ba, 0x06be, 0x06cc, 0x06d2, 0x06c1, 0x0000
+},
+/* Page 7, keysyms 0x0600-0x06ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0492, 0x0496, 0x049a, 0x049c, 0x04a2, 0x04ae, 0x04b0, 0x04b2,
+0x04b6, 0x04b8, 0x04ba, 0x0000, 0x04d8, 0x04e2, 0x04e8, 0x04ee,
+0x0493, 0x0497, 0x049b, 0x049d, 0x04a3, 0x04af, 0x04b1, 0x04b3,
+0x04b7, 0x04b9, 0x04bb, 0x0000, 0x04d9, 0x04e3, 0x04e9, 0x04ef,
+0x0000, 0x0452, 0x0453, 0x0451, 0x0454, 0x0455, 0x0456, 0x0457,
+0x0458, 0x0459, 0x045a, 0x045b, 0x045c, 0x0491, 0x045e, 0x045f,
+0x2116, 0x0402, 0x0403, 0x0401, 0x0404, 0x0405, 0x0406, 0x0407,
+0x0408, 0x0409, 0x040a, 0x040b, 0x040c, 0x0490, 0x040e, 0x040f,
+0x044e, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433,
+0x0445, 0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e,
+0x043f, 0x044f, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432,
+0x044c, 0x044b, 0x0437, 0x0448, 0x044d, 0x0449, 0x0447, 0x044a,
+0x042e, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413,
+0x0425, 0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d, 0x041e,
+0x041f, 0x042f, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412,
+0x042c, 0x042b, 0x0417, 0x0428, 0x042d, 0x0429, 0x0427, 0x042a
+},
+/* Page 8, keysyms 0x0700-0x07ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0386, 0x0388, 0x0389, 0x038a, 0x03aa, 0x0000, 0x038c,
+0x038e, 0x03ab, 0x0000, 0x038f, 0x0000, 0x0000, 0x0385, 0x2015,
+0x0000, 0x03ac, 0x03ad, 0x03ae, 0x03af, 0x03ca, 0x0390, 0x03cc,
+0x03cd, 0x03cb, 0x03b0, 0x03ce, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f,
+0x03a0, 0x03a1, 0x03a3, 0x0000, 0x03a4, 0x03a5, 0x03a6, 0x03a7,
+0x03a8, 0x03a9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7,
+0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf,
+0x03c0, 0x03c1, 0x03c3, 0x03c2, 0x03c4, 0x03c5, 0x03c6, 0x03c7,
+0x03c8, 0x03c9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 9, keysyms 0x0800-0x08ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x2320, 0x2321, 0x0000, 0x231c,
+0x231d, 0x231e, 0x231f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x2264, 0x2260, 0x2265, 0x222b,
+0x2234, 0x0000, 0x221e, 0x0000, 0x0000, 0x2207, 0x0000, 0x0000,
+0x2245, 0x2246, 0x0000, 0x0000, 0x0000, 0x0000, 0x22a2, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x221a, 0x0000,
+0x0000, 0x0000, 0x2282, 0x2283, 0x2229, 0x222a, 0x2227, 0x2228,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0192, 0x0000,
+0x0000, 0x0000, 0x0000, 0x2190, 0x2191, 0x2192, 0x2193, 0x0000
+},
+/* Page 10, keysyms 0x0900-0x09ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2422,
+0x2666, 0x25a6, 0x2409, 0x240c, 0x240d, 0x240a, 0x0000, 0x0000,
+0x240a, 0x240b, 0x2518, 0x2510, 0x250c, 0x2514, 0x253c, 0x2500,
+0x0000, 0x0000, 0x0000, 0x0000, 0x251c, 0x2524, 0x2534, 0x252c,
+0x2502, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 11, keysyms 0x0a00-0x0aff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x2003, 0x2002, 0x2004, 0x2005, 0x2007, 0x2008, 0x2009,
+0x200a, 0x2014, 0x2013, 0x0000, 0x0000, 0x0000, 0x2026, 0x2025,
+0x2153, 0x2154, 0x2155, 0x2156, 0x2157, 0x2158, 0x2159, 0x215a,
+0x2105, 0x0000, 0x0000, 0x2012, 0x2039, 0x2024, 0x203a, 0x0000,
+0x0000, 0x0000, 0x0000, 0x215b, 0x215c, 0x215d, 0x215e, 0x0000,
+0x0000, 0x2122, 0x2120, 0x0000, 0x25c1, 0x25b7, 0x25cb, 0x25ad,
+0x2018, 0x2019, 0x201c, 0x201d, 0x211e, 0x0000, 0x2032, 0x2033,
+0x0000, 0x271d, 0x0000, 0x220e, 0x25c2, 0x2023, 0x25cf, 0x25ac,
+0x25e6, 0x25ab, 0x25ae, 0x25b5, 0x25bf, 0x2606, 0x2022, 0x25aa,
+0x25b4, 0x25be, 0x261a, 0x261b, 0x2663, 0x2666, 0x2665, 0x0000,
+0x2720, 0x2020, 0x2021, 0x2713, 0x2612, 0x266f, 0x266d, 0x2642,
+0x2640, 0x2121, 0x2315, 0x2117, 0x2038, 0x201a, 0x201e, 0x0000
+},
+/* Page 12, keysyms 0x0c00-0x0cff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2017,
+0x05d0, 0x05d1, 0x05d2, 0x05d3, 0x05d4, 0x05d5, 0x05d6, 0x05d7,
+0x05d8, 0x05d9, 0x05da, 0x05db, 0x05dc, 0x05dd, 0x05de, 0x05df,
+0x05e0, 0x05e1, 0x05e2, 0x05e3, 0x05e4, 0x05e5, 0x05e6, 0x05e7,
+0x05e8, 0x05e9, 0x05ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 13, keysyms 0x0d00-0x0dff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0e01, 0x0e02, 0x0e03, 0x0e04, 0x0e05, 0x0e06, 0x0e07,
+0x0e08, 0x0e09, 0x0e0a, 0x0e0b, 0x0e0c, 0x0e0d, 0x0e0e, 0x0e0f,
+0x0e10, 0x0e11, 0x0e12, 0x0e13, 0x0e14, 0x0e15, 0x0e16, 0x0e17,
+0x0e18, 0x0e19, 0x0e1a, 0x0e1b, 0x0e1c, 0x0e1d, 0x0e1e, 0x0e1f,
+0x0e20, 0x0e21, 0x0e22, 0x0e23, 0x0e24, 0x0e25, 0x0e26, 0x0e27,
+0x0e28, 0x0e29, 0x0e2a, 0x0e2b, 0x0e2c, 0x0e2d, 0x0e2e, 0x0e2f,
+0x0e30, 0x0e31, 0x0e32, 0x0e33, 0x0e34, 0x0e35, 0x0e36, 0x0e37,
+0x0e38, 0x0e39, 0x0e3a, 0x0000, 0x0000, 0x0000, 0x0e3e, 0x0e3f,
+0x0e40, 0x0e41, 0x0e42, 0x0e43, 0x0e44, 0x0e45, 0x0e46, 0x0e47,
+0x0e48, 0x0e49, 0x0e4a, 0x0e4b, 0x0e4c, 0x0e4d, 0x0000, 0x0000,
+0x0e50, 0x0e51, 0x0e52, 0x0e53, 0x0e54, 0x0e55, 0x0e56, 0x0e57,
+0x0e58, 0x0e59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 14, keysyms 0x0e00-0x0eff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x1101, 0x1101, 0x11aa, 0x1102, 0x11ac, 0x11ad, 0x1103,
+0x1104, 0x1105, 0x11b0, 0x11b1, 0x11b2, 0x11b3, 0x11b4, 0x11b5,
+0x11b6, 0x1106, 0x1107, 0x1108, 0x11b9, 0x1109, 0x110a, 0x110b,
+0x110c, 0x110d, 0x110e, 0x110f, 0x1110, 0x1111, 0x1112, 0x1161,
+0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169,
+0x116a, 0x116b, 0x116c, 0x116d, 0x116e, 0x116f, 0x1170, 0x1171,
+0x1172, 0x1173, 0x1174, 0x1175, 0x11a8, 0x11a9, 0x11aa, 0x11ab,
+0x11ac, 0x11ad, 0x11ae, 0x11af, 0x11b0, 0x11b1, 0x11b2, 0x11b3,
+0x11b4, 0x11b5, 0x11b6, 0x11b7, 0x11b8, 0x11b9, 0x11ba, 0x11bb,
+0x11bc, 0x11bd, 0x11be, 0x11bf, 0x11c0, 0x11c1, 0x11c2, 0x0000,
+0x0000, 0x0000, 0x1140, 0x0000, 0x0000, 0x1159, 0x119e, 0x0000,
+0x11eb, 0x0000, 0x11f9, 0x0000, 0x0000, 0x0000, 0x0000, 0x20a9
+},
+/* Page 15, keysyms 0x1200-0x12ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x1e02, 0x1e03, 0x0000, 0x0000, 0x0000, 0x1e0a, 0x0000,
+0x1e80, 0x0000, 0x1e82, 0x1e0b, 0x1ef2, 0x0000, 0x0000, 0x0000,
+0x1e1e, 0x1e1f, 0x0000, 0x0000, 0x1e40, 0x1e41, 0x0000, 0x1e56,
+0x1e81, 0x1e57, 0x1e83, 0x1e60, 0x1ef3, 0x1e84, 0x1e85, 0x1e61,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0174, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e6a,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0176, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0175, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1e6b,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0177, 0x0000
+},
+/* Page 16, keysyms 0x1300-0x13ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0152, 0x0153, 0x0178, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 17, keysyms 0x1400-0x14ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x2741, 0x00a7, 0x0589, 0x0029, 0x0028, 0x00bb, 0x00ab,
+0x2014, 0x002e, 0x055d, 0x002c, 0x2013, 0x058a, 0x2026, 0x055c,
+0x055b, 0x055e, 0x0531, 0x0561, 0x0532, 0x0562, 0x0533, 0x0563,
+0x0534, 0x0564, 0x0535, 0x0565, 0x0536, 0x0566, 0x0537, 0x0567,
+0x0538, 0x0568, 0x0539, 0x0569, 0x053a, 0x056a, 0x053b, 0x056b,
+0x053c, 0x056c, 0x053d, 0x056d, 0x053e, 0x056e, 0x053f, 0x056f,
+0x0540, 0x0570, 0x0541, 0x0571, 0x0542, 0x0572, 0x0543, 0x0573,
+0x0544, 0x0574, 0x0545, 0x0575, 0x0546, 0x0576, 0x0547, 0x0577,
+0x0548, 0x0578, 0x0549, 0x0579, 0x054a, 0x057a, 0x054b, 0x057b,
+0x054c, 0x057c, 0x054d, 0x057d, 0x054e, 0x057e, 0x054f, 0x057f,
+0x0550, 0x0580, 0x0551, 0x0581, 0x0552, 0x0582, 0x0553, 0x0583,
+0x0554, 0x0584, 0x0555, 0x0585, 0x0556, 0x0586, 0x2019, 0x0027
+},
+/* Page 18, keysyms 0x1500-0x15ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x10d0, 0x10d1, 0x10d2, 0x10d3, 0x10d4, 0x10d5, 0x10d6, 0x10d7,
+0x10d8, 0x10d9, 0x10da, 0x10db, 0x10dc, 0x10dd, 0x10de, 0x10df,
+0x10e0, 0x10e1, 0x10e2, 0x10e3, 0x10e4, 0x10e5, 0x10e6, 0x10e7,
+0x10e8, 0x10e9, 0x10ea, 0x10eb, 0x10ec, 0x10ed, 0x10ee, 0x10ef,
+0x10f0, 0x10f1, 0x10f2, 0x10f3, 0x10f4, 0x10f5, 0x10f6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 19, keysyms 0x1600-0x16ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0xf0a2, 0x1e8a, 0x0000, 0xf0a5, 0x012c, 0xf0a7,
+0xf0a8, 0x01b5, 0x01e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x019f,
+0x0000, 0x0000, 0xf0b2, 0x1e8b, 0x01d1, 0xf0b5, 0x012d, 0xf0b7,
+0xf0b8, 0x01b6, 0x01e7, 0x0000, 0x0000, 0x01d2, 0x0000, 0x0275,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x018f, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x1e36, 0xf0d2, 0xf0d3, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x1e37, 0xf0e2, 0xf0e3, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0259, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 20, keysyms 0x1e00-0x1eff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0303,
+0x1ea0, 0x1ea1, 0x1ea2, 0x1ea3, 0x1ea4, 0x1ea5, 0x1ea6, 0x1ea7,
+0x1ea8, 0x1ea9, 0x1eaa, 0x1eab, 0x1eac, 0x1ead, 0x1eae, 0x1eaf,
+0x1eb0, 0x1eb1, 0x1eb2, 0x1eb3, 0x1eb4, 0x1eb5, 0x1eb6, 0x1eb7,
+0x1eb8, 0x1eb9, 0x1eba, 0x1ebb, 0x1ebc, 0x1ebd, 0x1ebe, 0x1ebf,
+0x1ec0, 0x1ec1, 0x1ec2, 0x1ec3, 0x1ec4, 0x1ec5, 0x1ec6, 0x1ec7,
+0x1ec8, 0x1ec9, 0x1eca, 0x1ecb, 0x1ecc, 0x1ecd, 0x1ece, 0x1ecf,
+0x1ed0, 0x1ed1, 0x1ed2, 0x1ed3, 0x1ed4, 0x1ed5, 0x1ed6, 0x1ed7,
+0x1ed8, 0x1ed9, 0x1eda, 0x1edb, 0x1edc, 0x1edd, 0x1ede, 0x1edf,
+0x1ee0, 0x1ee1, 0x1ee2, 0x1ee3, 0x1ee4, 0x1ee5, 0x1ee6, 0x1ee7,
+0x1ee8, 0x1ee9, 0x1eea, 0x1eeb, 0x1eec, 0x1eed, 0x1eee, 0x1eef,
+0x1ef0, 0x1ef1, 0x0300, 0x0301, 0x1ef4, 0x1ef5, 0x1ef6, 0x1ef7,
+0x1ef8, 0x1ef9, 0x01a0, 0x01a1, 0x01af, 0x01b0, 0x0309, 0x0323
+},
+/* Page 21, keysyms 0x2000-0x20ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x20a0, 0x20a1, 0x20a2, 0x20a3, 0x20a4, 0x20a5, 0x20a6, 0x20a7,
+0x20a8, 0x20a9, 0x20aa, 0x20ab, 0x20ac, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+}
+};
+
+#define ks_from_ucs_PAGES	22
+
+static const unsigned char ks_from_ucs_pages[256] = {
+  1,   2,   3,   4,   5,   6,   7,   0,
+  0,   0,   0,   0,   0,   0,   8,   0,
+  9,  10,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,  11,   0,
+ 12,  13,  14,  15,  16,  17,  18,  19,
+  0,   0,   0,   0,   0,   0,   0,   0,
+ 20,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+ 21,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const unsigned short ks_from_ucs[22][256] = {
+/* Page 0.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 1, keysyms 0x0000-0x00ff.  */
+{
+0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
+0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff
+},
+/* Page 2, keysyms 0x0100-0x01ff.  */
+{
+0x03c0, 0x03e0, 0x01c3, 0x01e3, 0x01a1, 0x01b1, 0x01c6, 0x01e6,
+0x02c6, 0x02e6, 0x02c5, 0x02e5, 0x01c8, 0x01e8, 0x01cf, 0x01ef,
+0x01d0, 0x01f0, 0x03aa, 0x03ba, 0x0000, 0x0000, 0x03cc, 0x03ec,
+0x01ca, 0x01ea, 0x01cc, 0x01ec, 0x02d8, 0x02f8, 0x02ab, 0x02bb,
+0x02d5, 0x02f5, 0x03ab, 0x03bb, 0x02a6, 0x02b6, 0x02a1, 0x02b1,
+0x03a5, 0x03b5, 0x03cf, 0x03ef, 0x16a6, 0x16b6, 0x03c7, 0x03e7,
+0x02a9, 0x02b9, 0x0000, 0x0000, 0x02ac, 0x02bc, 0x03d3, 0x03f3,
+0x03a2, 0x01c5, 0x01e5, 0x03a6, 0x03b6, 0x01a5, 0x01b5, 0x0000,
+0x0000, 0x01a3, 0x01b3, 0x01d1, 0x01f1, 0x03d1, 0x03f1, 0x01d2,
+0x01f2, 0x0000, 0x03bd, 0x03bf, 0x03d2, 0x03f2, 0x0000, 0x0000,
+0x01d5, 0x01f5, 0x13bc, 0x13bd, 0x01c0, 0x01e0, 0x03a3, 0x03b3,
+0x01d8, 0x01f8, 0x01a6, 0x01b6, 0x02de, 0x02fe, 0x01aa, 0x01ba,
+0x01a9, 0x01b9, 0x01de, 0x01fe, 0x01ab, 0x01bb, 0x03ac, 0x03bc,
+0x03dd, 0x03fd, 0x03de, 0x03fe, 0x02dd, 0x02fd, 0x01d9, 0x01f9,
+0x01db, 0x01fb, 0x03d9, 0x03f9, 0x12d0, 0x12f0, 0x12de, 0x12fe,
+0x13be, 0x01ac, 0x01bc, 0x01af, 0x01bf, 0x01ae, 0x01be, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16c6,
+0x0000, 0x0000, 0x08f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16af,
+0x1efa, 0x1efb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1efc,
+0x1efd, 0x0000, 0x0000, 0x0000, 0x0000, 0x16a9, 0x16b9, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x16b4, 0x16bd, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16aa, 0x16ba,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 3, keysyms 0x0200-0x02ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x16f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16bf, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01b7,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x01a2, 0x01ff, 0x0000, 0x01b2, 0x0000, 0x01bd, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 4, keysyms 0x0300-0x03ff.  */
+{
+0x1ef2, 0x1ef3, 0x0000, 0x1e9f, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x1efe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x1eff, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07ae, 0x07a1, 0x0000,
+0x07a2, 0x07a3, 0x07a4, 0x0000, 0x07a7, 0x0000, 0x07a8, 0x07ab,
+0x07b6, 0x07c1, 0x07c2, 0x07c3, 0x07c4, 0x07c5, 0x07c6, 0x07c7,
+0x07c8, 0x07c9, 0x07ca, 0x07cb, 0x07cc, 0x07cd, 0x07ce, 0x07cf,
+0x07d0, 0x07d1, 0x0000, 0x07d2, 0x07d4, 0x07d5, 0x07d6, 0x07d7,
+0x07d8, 0x07d9, 0x07a5, 0x07a9, 0x07b1, 0x07b2, 0x07b3, 0x07b4,
+0x07ba, 0x07e1, 0x07e2, 0x07e3, 0x07e4, 0x07e5, 0x07e6, 0x07e7,
+0x07e8, 0x07e9, 0x07ea, 0x07eb, 0x07ec, 0x07ed, 0x07ee, 0x07ef,
+0x07f0, 0x07f1, 0x07f3, 0x07f2, 0x07f4, 0x07f5, 0x07f6, 0x07f7,
+0x07f8, 0x07f9, 0x07b5, 0x07b9, 0x07b7, 0x07b8, 0x07bb, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 5, keysyms 0x0400-0x04ff.  */
+{
+0x0000, 0x06b3, 0x06b1, 0x06b2, 0x06b4, 0x06b5, 0x06b6, 0x06b7,
+0x06b8, 0x06b9, 0x06ba, 0x06bb, 0x06bc, 0x0000, 0x06be, 0x06bf,
+0x06e1, 0x06e2, 0x06f7, 0x06e7, 0x06e4, 0x06e5, 0x06f6, 0x058a,
+0x06e9, 0x06ea, 0x06eb, 0x06ec, 0x06ed, 0x06ee, 0x06ef, 0x06f0,
+0x06f2, 0x06f3, 0x06f4, 0x06f5, 0x06e6, 0x06e8, 0x06e3, 0x058e,
+0x058b, 0x058d, 0x058f, 0x06f9, 0x06f8, 0x058c, 0x06e0, 0x06f1,
+0x06c1, 0x06c2, 0x06d7, 0x06c7, 0x06c4, 0x06c5, 0x06d6, 0x06da,
+0x06c9, 0x06ca, 0x06cb, 0x06cc, 0x06cd, 0x06ce, 0x06cf, 0x06d0,
+0x06d2, 0x06d3, 0x06d4, 0x06d5, 0x06c6, 0x06c8, 0x06c3, 0x06de,
+0x06db, 0x06dd, 0x06df, 0x06d9, 0x06d8, 0x06dc, 0x06c0, 0x06d1,
+0x0000, 0x06a3, 0x06a1, 0x06a2, 0x06a4, 0x06a5, 0x06a6, 0x06a7,
+0x06a8, 0x06a9, 0x06aa, 0x06ab, 0x06ac, 0x0000, 0x06ae, 0x06af,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x06bd, 0x06ad, 0x0680, 0x0690, 0x0000, 0x0000, 0x0681, 0x0691,
+0x0000, 0x0000, 0x0682, 0x0692, 0x0683, 0x0693, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0684, 0x0694, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0685, 0x0695,
+0x0686, 0x0696, 0x0687, 0x0697, 0x0000, 0x0000, 0x0688, 0x0698,
+0x0689, 0x0699, 0x068a, 0x069a, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x068c, 0x069c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x068d, 0x069d, 0x0000, 0x0000, 0x0000, 0x0000,
+0x068e, 0x069e, 0x0000, 0x0000, 0x0000, 0x0000, 0x068f, 0x069f,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 6, keysyms 0x0500-0x05ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x14b2, 0x14b4, 0x14b6, 0x14b8, 0x14ba, 0x14bc, 0x14be,
+0x14c0, 0x14c2, 0x14c4, 0x14c6, 0x14c8, 0x14ca, 0x14cc, 0x14ce,
+0x14d0, 0x14d2, 0x14d4, 0x14d6, 0x14d8, 0x14da, 0x14dc, 0x14de,
+0x14e0, 0x14e2, 0x14e4, 0x14e6, 0x14e8, 0x14ea, 0x14ec, 0x14ee,
+0x14f0, 0x14f2, 0x14f4, 0x14f6, 0x14f8, 0x14fa, 0x14fc, 0x0000,
+0x0000, 0x0000, 0x0000, 0x14b0, 0x14af, 0x14aa, 0x14b1, 0x0000,
+0x0000, 0x14b3, 0x14b5, 0x14b7, 0x14b9, 0x14bb, 0x14bd, 0x14bf,
+0x14c1, 0x14c3, 0x14c5, 0x14c7, 0x14c9, 0x14cb, 0x14cd, 0x14cf,
+0x14d1, 0x14d3, 0x14d5, 0x14d7, 0x14d9, 0x14db, 0x14dd, 0x14df,
+0x14e1, 0x14e3, 0x14e5, 0x14e7, 0x14e9, 0x14eb, 0x14ed, 0x14ef,
+0x14f1, 0x14f3, 0x14f5, 0x14f7, 0x14f9, 0x14fb, 0x14fd, 0x0000,
+0x0000, 0x14a3, 0x14ad, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0ce0, 0x0ce1, 0x0ce2, 0x0ce3, 0x0ce4, 0x0ce5, 0x0ce6, 0x0ce7,
+0x0ce8, 0x0ce9, 0x0cea, 0x0ceb, 0x0cec, 0x0ced, 0x0cee, 0x0cef,
+0x0cf0, 0x0cf1, 0x0cf2, 0x0cf3, 0x0cf4, 0x0cf5, 0x0cf6, 0x0cf7,
+0x0cf8, 0x0cf9, 0x0cfa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 7, keysyms 0x0600-0x06ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x05ac, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x05bb, 0x0000, 0x0000, 0x0000, 0x05bf,
+0x0000, 0x05c1, 0x05c2, 0x05c3, 0x05c4, 0x05c5, 0x05c6, 0x05c7,
+0x05c8, 0x05c9, 0x05ca, 0x05cb, 0x05cc, 0x05cd, 0x05ce, 0x05cf,
+0x05d0, 0x05d1, 0x05d2, 0x05d3, 0x05d4, 0x05d5, 0x05d6, 0x05d7,
+0x05d8, 0x05d9, 0x05da, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x05e0, 0x05e1, 0x05e2, 0x05e3, 0x05e4, 0x05e5, 0x05e6, 0x05e7,
+0x05e8, 0x05e9, 0x05ea, 0x05eb, 0x05ec, 0x05ed, 0x05ee, 0x05ef,
+0x05f0, 0x05f1, 0x05f2, 0x05f3, 0x05f4, 0x05f5, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x05b0, 0x05b1, 0x05b2, 0x05b3, 0x05b4, 0x05b5, 0x05b6, 0x05b7,
+0x05b8, 0x05b9, 0x05a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x05a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x05a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x05a8, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05a9, 0x0000,
+0x05aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x05ab, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x05f6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x05f7, 0x0000, 0x0000, 0x0000,
+0x0000, 0x05f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05f9,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x05fa, 0x0000, 0x0000, 0x0000, 0x05fb, 0x0000,
+0x0000, 0x05fe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x05fc, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x05fd, 0x0000, 0x05ae, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0590, 0x0591, 0x0592, 0x0593, 0x0594, 0x0595, 0x0596, 0x0597,
+0x0598, 0x0599, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 8, keysyms 0x0e00-0x0eff.  */
+{
+0x0000, 0x0da1, 0x0da2, 0x0da3, 0x0da4, 0x0da5, 0x0da6, 0x0da7,
+0x0da8, 0x0da9, 0x0daa, 0x0dab, 0x0dac, 0x0dad, 0x0dae, 0x0daf,
+0x0db0, 0x0db1, 0x0db2, 0x0db3, 0x0db4, 0x0db5, 0x0db6, 0x0db7,
+0x0db8, 0x0db9, 0x0dba, 0x0dbb, 0x0dbc, 0x0dbd, 0x0dbe, 0x0dbf,
+0x0dc0, 0x0dc1, 0x0dc2, 0x0dc3, 0x0dc4, 0x0dc5, 0x0dc6, 0x0dc7,
+0x0dc8, 0x0dc9, 0x0dca, 0x0dcb, 0x0dcc, 0x0dcd, 0x0dce, 0x0dcf,
+0x0dd0, 0x0dd1, 0x0dd2, 0x0dd3, 0x0dd4, 0x0dd5, 0x0dd6, 0x0dd7,
+0x0dd8, 0x0dd9, 0x0dda, 0x0000, 0x0000, 0x0000, 0x0dde, 0x0ddf,
+0x0de0, 0x0de1, 0x0de2, 0x0de3, 0x0de4, 0x0de5, 0x0de6, 0x0de7,
+0x0de8, 0x0de9, 0x0dea, 0x0deb, 0x0dec, 0x0ded, 0x0000, 0x0000,
+0x0df0, 0x0df1, 0x0df2, 0x0df3, 0x0df4, 0x0df5, 0x0df6, 0x0df7,
+0x0df8, 0x0df9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 9, keysyms 0x1000-0x10ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x15d0, 0x15d1, 0x15d2, 0x15d3, 0x15d4, 0x15d5, 0x15d6, 0x15d7,
+0x15d8, 0x15d9, 0x15da, 0x15db, 0x15dc, 0x15dd, 0x15de, 0x15df,
+0x15e0, 0x15e1, 0x15e2, 0x15e3, 0x15e4, 0x15e5, 0x15e6, 0x15e7,
+0x15e8, 0x15e9, 0x15ea, 0x15eb, 0x15ec, 0x15ed, 0x15ee, 0x15ef,
+0x15f0, 0x15f1, 0x15f2, 0x15f3, 0x15f4, 0x15f5, 0x15f6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 10, keysyms 0x1100-0x11ff.  */
+{
+0x0000, 0x0ea1, 0x0ea4, 0x0ea7, 0x0ea8, 0x0ea9, 0x0eb1, 0x0eb2,
+0x0eb3, 0x0eb5, 0x0eb6, 0x0eb7, 0x0eb8, 0x0eb9, 0x0eba, 0x0ebb,
+0x0ebc, 0x0ebd, 0x0ebe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0ef2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0ef5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0ebf, 0x0ec0, 0x0ec1, 0x0ec2, 0x0ec3, 0x0ec4, 0x0ec5,
+0x0ec6, 0x0ec7, 0x0ec8, 0x0ec9, 0x0eca, 0x0ecb, 0x0ecc, 0x0ecd,
+0x0ece, 0x0ecf, 0x0ed0, 0x0ed1, 0x0ed2, 0x0ed3, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ef6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0ed4, 0x0ed5, 0x0ea3, 0x0ed7, 0x0ea5, 0x0ea6, 0x0eda, 0x0edb,
+0x0eaa, 0x0eab, 0x0eac, 0x0ead, 0x0eae, 0x0eaf, 0x0eb0, 0x0ee3,
+0x0ee4, 0x0eb4, 0x0ee6, 0x0ee7, 0x0ee8, 0x0ee9, 0x0eea, 0x0eeb,
+0x0eec, 0x0eed, 0x0eee, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0ef8, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0efa, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 11, keysyms 0x1e00-0x1eff.  */
+{
+0x0000, 0x0000, 0x12a1, 0x12a2, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x12a6, 0x12ab, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12b0, 0x12b1,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16d1, 0x16e1,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x12b4, 0x12b5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12b7, 0x12b9,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x12bb, 0x12bf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x12d7, 0x12f7, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x12a8, 0x12b8, 0x12aa, 0x12ba, 0x12bd, 0x12be, 0x0000, 0x0000,
+0x0000, 0x0000, 0x16a3, 0x16b3, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x1ea0, 0x1ea1, 0x1ea2, 0x1ea3, 0x1ea4, 0x1ea5, 0x1ea6, 0x1ea7,
+0x1ea8, 0x1ea9, 0x1eaa, 0x1eab, 0x1eac, 0x1ead, 0x1eae, 0x1eaf,
+0x1eb0, 0x1eb1, 0x1eb2, 0x1eb3, 0x1eb4, 0x1eb5, 0x1eb6, 0x1eb7,
+0x1eb8, 0x1eb9, 0x1eba, 0x1ebb, 0x1ebc, 0x1ebd, 0x1ebe, 0x1ebf,
+0x1ec0, 0x1ec1, 0x1ec2, 0x1ec3, 0x1ec4, 0x1ec5, 0x1ec6, 0x1ec7,
+0x1ec8, 0x1ec9, 0x1eca, 0x1ecb, 0x1ecc, 0x1ecd, 0x1ece, 0x1ecf,
+0x1ed0, 0x1ed1, 0x1ed2, 0x1ed3, 0x1ed4, 0x1ed5, 0x1ed6, 0x1ed7,
+0x1ed8, 0x1ed9, 0x1eda, 0x1edb, 0x1edc, 0x1edd, 0x1ede, 0x1edf,
+0x1ee0, 0x1ee1, 0x1ee2, 0x1ee3, 0x1ee4, 0x1ee5, 0x1ee6, 0x1ee7,
+0x1ee8, 0x1ee9, 0x1eea, 0x1eeb, 0x1eec, 0x1eed, 0x1eee, 0x1eef,
+0x1ef0, 0x1ef1, 0x12ac, 0x12bc, 0x1ef4, 0x1ef5, 0x1ef6, 0x1ef7,
+0x1ef8, 0x1ef9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 12, keysyms 0x2000-0x20ff.  */
+{
+0x0000, 0x0000, 0x0aa2, 0x0aa1, 0x0aa3, 0x0aa4, 0x0000, 0x0aa5,
+0x0aa6, 0x0aa7, 0x0aa8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0abb, 0x0aaa, 0x0aa9, 0x07af, 0x0000, 0x0cdf,
+0x0ad0, 0x0ad1, 0x0afd, 0x0000, 0x0ad2, 0x0ad3, 0x0afe, 0x0000,
+0x0af1, 0x0af2, 0x0ae6, 0x0add, 0x0abd, 0x0aaf, 0x0aae, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0ad6, 0x0ad7, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0afc, 0x0abc, 0x0abe, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x20a0, 0x20a1, 0x20a2, 0x20a3, 0x20a4, 0x20a5, 0x20a6, 0x20a7,
+0x20a8, 0x0eff, 0x20aa, 0x20ab, 0x20ac, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 13, keysyms 0x2100-0x21ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ab8, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06b0, 0x0afb,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ad4, 0x0000,
+0x0aca, 0x0af9, 0x0ac9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0ab0, 0x0ab1, 0x0ab2, 0x0ab3, 0x0ab4,
+0x0ab5, 0x0ab6, 0x0ab7, 0x0ac3, 0x0ac4, 0x0ac5, 0x0ac6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x08fb, 0x08fc, 0x08fd, 0x08fe, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 14, keysyms 0x2200-0x22ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08c5,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0adb, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x08d6, 0x0000, 0x0000, 0x0000, 0x08c2, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08de,
+0x08df, 0x08dc, 0x08dd, 0x08bf, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x08c0, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08c8, 0x08c9, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x08bd, 0x0000, 0x0000, 0x0000, 0x08bc, 0x08be, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x08da, 0x08db, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x08ce, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 15, keysyms 0x2300-0x23ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0afa, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x08a7, 0x08a8, 0x08a9, 0x08aa,
+0x08a4, 0x08a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 16, keysyms 0x2400-0x24ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x09e2, 0x09e5, 0x09e9, 0x09e3, 0x09e4, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x09df, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 17, keysyms 0x2500-0x25ff.  */
+{
+0x09ef, 0x0000, 0x09f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x09ec, 0x0000, 0x0000, 0x0000,
+0x09eb, 0x0000, 0x0000, 0x0000, 0x09ed, 0x0000, 0x0000, 0x0000,
+0x09ea, 0x0000, 0x0000, 0x0000, 0x09f4, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x09f5, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x09f7, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x09f6, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x09ee, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09e1, 0x0000,
+0x0000, 0x0000, 0x0ae7, 0x0ae1, 0x0adf, 0x0acf, 0x0ae2, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0ae8, 0x0ae3, 0x0000, 0x0acd,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ae9, 0x0ae4,
+0x0000, 0x0acc, 0x0adc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0ace, 0x0000, 0x0000, 0x0000, 0x0ade,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ae0, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 18, keysyms 0x2600-0x26ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ae5, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0af4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0aea, 0x0aeb, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0af8, 0x0000, 0x0af7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0aec, 0x0000, 0x0aee, 0x09e0, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0af6, 0x0000, 0x0af5,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 19, keysyms 0x2700-0x27ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0af3, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ad9, 0x0000, 0x0000,
+0x0af0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x14a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 20, keysyms 0x3000-0x30ff.  */
+{
+0x0000, 0x04a4, 0x04a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x04a2, 0x04a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x04de, 0x04df, 0x0000, 0x0000, 0x0000,
+0x0000, 0x04a7, 0x04b1, 0x04a8, 0x04b2, 0x04a9, 0x04b3, 0x04aa,
+0x04b4, 0x04ab, 0x04b5, 0x04b6, 0x0000, 0x04b7, 0x0000, 0x04b8,
+0x0000, 0x04b9, 0x0000, 0x04ba, 0x0000, 0x04bb, 0x0000, 0x04bc,
+0x0000, 0x04bd, 0x0000, 0x04be, 0x0000, 0x04bf, 0x0000, 0x04c0,
+0x0000, 0x04c1, 0x0000, 0x04af, 0x04c2, 0x0000, 0x04c3, 0x0000,
+0x04c4, 0x0000, 0x04c5, 0x04c6, 0x04c7, 0x04c8, 0x04c9, 0x04ca,
+0x0000, 0x0000, 0x04cb, 0x0000, 0x0000, 0x04cc, 0x0000, 0x0000,
+0x04cd, 0x0000, 0x0000, 0x04ce, 0x0000, 0x0000, 0x04cf, 0x04d0,
+0x04d1, 0x04d2, 0x04d3, 0x04ac, 0x04d4, 0x04ad, 0x04d5, 0x04ae,
+0x04d6, 0x04d7, 0x04d8, 0x04d9, 0x04da, 0x04db, 0x0000, 0x04dc,
+0x0000, 0x0000, 0x04a6, 0x04dd, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x04a5, 0x04b0, 0x0000, 0x0000, 0x0000
+},
+/* Page 21, keysyms 0xf000-0xf0ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x16a2, 0x0000, 0x0000, 0x16a5, 0x0000, 0x16a7,
+0x16a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x16b2, 0x0000, 0x0000, 0x16b5, 0x0000, 0x16b7,
+0x16b8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x16d2, 0x16d3, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x16e2, 0x16e3, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+}
+};
+
+#endif /* NEEDUCSTABLE */
+
+#ifdef NEEDCASETABLE
+#define ks_lower_PAGES	13
+
+static const unsigned char ks_lower_pages[256] = {
+  1,   2,   3,   4,   0,   5,   6,   7,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   8,   9,  10,   0,  11,   0,
+  0,   0,   0,   0,   0,   0,  12,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const unsigned short ks_lower[13][256] = {
+/* Page 0.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 1, keysyms 0x0000-0x00ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+0x0078, 0x0079, 0x007a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+0x0078, 0x0079, 0x007a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x0000,
+0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x0000,
+0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x0000,
+0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff
+},
+/* Page 2, keysyms 0x0100-0x01ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x01b1, 0x0000, 0x01b3, 0x0000, 0x01b5, 0x01b6, 0x0000,
+0x0000, 0x01b9, 0x01ba, 0x01bb, 0x01bc, 0x0000, 0x01be, 0x01bf,
+0x0000, 0x01b1, 0x0000, 0x01b3, 0x0000, 0x01b5, 0x01b6, 0x0000,
+0x0000, 0x01b9, 0x01ba, 0x01bb, 0x01bc, 0x0000, 0x01be, 0x01bf,
+0x01e0, 0x0000, 0x0000, 0x01e3, 0x0000, 0x01e5, 0x01e6, 0x0000,
+0x01e8, 0x0000, 0x01ea, 0x0000, 0x01ec, 0x0000, 0x0000, 0x01ef,
+0x01f0, 0x01f1, 0x01f2, 0x0000, 0x0000, 0x01f5, 0x0000, 0x0000,
+0x01f8, 0x01f9, 0x0000, 0x01fb, 0x0000, 0x0000, 0x01fe, 0x0000,
+0x01e0, 0x0000, 0x0000, 0x01e3, 0x0000, 0x01e5, 0x01e6, 0x0000,
+0x01e8, 0x0000, 0x01ea, 0x0000, 0x01ec, 0x0000, 0x0000, 0x01ef,
+0x01f0, 0x01f1, 0x01f2, 0x0000, 0x0000, 0x01f5, 0x0000, 0x0000,
+0x01f8, 0x01f9, 0x0000, 0x01fb, 0x0000, 0x0000, 0x01fe, 0x0000
+},
+/* Page 3, keysyms 0x0200-0x02ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x02b1, 0x0000, 0x0000, 0x0000, 0x0000, 0x02b6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x02bb, 0x02bc, 0x0000, 0x0000, 0x0000,
+0x0000, 0x02b1, 0x0000, 0x0000, 0x0000, 0x0000, 0x02b6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x02bb, 0x02bc, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02e5, 0x02e6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f5, 0x0000, 0x0000,
+0x02f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x02fd, 0x02fe, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02e5, 0x02e6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f5, 0x0000, 0x0000,
+0x02f8, 0x0000, 0x0000, 0x0000, 0x0000, 0x02fd, 0x02fe, 0x0000
+},
+/* Page 4, keysyms 0x0300-0x03ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x03b3, 0x0000, 0x03b5, 0x03b6, 0x0000,
+0x0000, 0x0000, 0x03ba, 0x03bb, 0x03bc, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x03b3, 0x0000, 0x03b5, 0x03b6, 0x0000,
+0x0000, 0x0000, 0x03ba, 0x03bb, 0x03bc, 0x03bf, 0x0000, 0x03bf,
+0x03e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03e7,
+0x0000, 0x0000, 0x0000, 0x0000, 0x03ec, 0x0000, 0x0000, 0x03ef,
+0x0000, 0x03f1, 0x03f2, 0x03f3, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x03f9, 0x0000, 0x0000, 0x0000, 0x03fd, 0x03fe, 0x0000,
+0x03e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03e7,
+0x0000, 0x0000, 0x0000, 0x0000, 0x03ec, 0x0000, 0x0000, 0x03ef,
+0x0000, 0x03f1, 0x03f2, 0x03f3, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x03f9, 0x0000, 0x0000, 0x0000, 0x03fd, 0x03fe, 0x0000
+},
+/* Page 5, keysyms 0x0500-0x05ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x06da, 0x06db, 0x06dc, 0x06dd, 0x06de, 0x06df,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 6, keysyms 0x0600-0x06ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0690, 0x0691, 0x0692, 0x0693, 0x0694, 0x0695, 0x0696, 0x0697,
+0x0698, 0x0699, 0x069a, 0x0000, 0x069c, 0x069d, 0x069e, 0x069f,
+0x0690, 0x0691, 0x0692, 0x0693, 0x0694, 0x0695, 0x0696, 0x0697,
+0x0698, 0x0699, 0x069a, 0x0000, 0x069c, 0x069d, 0x069e, 0x069f,
+0x0000, 0x06a1, 0x06a2, 0x06a3, 0x06a4, 0x06a5, 0x06a6, 0x06a7,
+0x06a8, 0x06a9, 0x06aa, 0x06ab, 0x06ac, 0x06ad, 0x06ae, 0x06af,
+0x0000, 0x06a1, 0x06a2, 0x06a3, 0x06a4, 0x06a5, 0x06a6, 0x06a7,
+0x06a8, 0x06a9, 0x06aa, 0x06ab, 0x06ac, 0x06ad, 0x06ae, 0x06af,
+0x06c0, 0x06c1, 0x06c2, 0x06c3, 0x06c4, 0x06c5, 0x06c6, 0x06c7,
+0x06c8, 0x06c9, 0x06ca, 0x06cb, 0x06cc, 0x06cd, 0x06ce, 0x06cf,
+0x06d0, 0x06d1, 0x06d2, 0x06d3, 0x06d4, 0x06d5, 0x06d6, 0x06d7,
+0x06d8, 0x06d9, 0x06da, 0x06db, 0x06dc, 0x06dd, 0x06de, 0x06df,
+0x06c0, 0x06c1, 0x06c2, 0x06c3, 0x06c4, 0x06c5, 0x06c6, 0x06c7,
+0x06c8, 0x06c9, 0x06ca, 0x06cb, 0x06cc, 0x06cd, 0x06ce, 0x06cf,
+0x06d0, 0x06d1, 0x06d2, 0x06d3, 0x06d4, 0x06d5, 0x06d6, 0x06d7,
+0x06d8, 0x06d9, 0x06da, 0x06db, 0x06dc, 0x06dd, 0x06de, 0x06df
+},
+/* Page 7, keysyms 0x0700-0x07ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x07b1, 0x07b2, 0x07b3, 0x07b4, 0x07b5, 0x0000, 0x07b7,
+0x07b8, 0x07b9, 0x0000, 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x07b1, 0x07b2, 0x07b3, 0x07b4, 0x07b5, 0x0000, 0x07b7,
+0x07b8, 0x07b9, 0x0000, 0x07bb, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x07e1, 0x07e2, 0x07e3, 0x07e4, 0x07e5, 0x07e6, 0x07e7,
+0x07e8, 0x07e9, 0x07ea, 0x07eb, 0x07ec, 0x07ed, 0x07ee, 0x07ef,
+0x07f0, 0x07f1, 0x07f2, 0x0000, 0x07f4, 0x07f5, 0x07f6, 0x07f7,
+0x07f8, 0x07f9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x07e1, 0x07e2, 0x07e3, 0x07e4, 0x07e5, 0x07e6, 0x07e7,
+0x07e8, 0x07e9, 0x07ea, 0x07eb, 0x07ec, 0x07ed, 0x07ee, 0x07ef,
+0x07f0, 0x07f1, 0x07f2, 0x0000, 0x07f4, 0x07f5, 0x07f6, 0x07f7,
+0x07f8, 0x07f9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 8, keysyms 0x1200-0x12ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x12a2, 0x12a2, 0x0000, 0x0000, 0x0000, 0x12ab, 0x0000,
+0x12b8, 0x0000, 0x12ba, 0x12ab, 0x12bc, 0x0000, 0x0000, 0x0000,
+0x12b1, 0x12b1, 0x0000, 0x0000, 0x12b5, 0x12b5, 0x0000, 0x12b9,
+0x12b8, 0x12b9, 0x12ba, 0x12bf, 0x12bc, 0x12be, 0x12be, 0x12bf,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x12f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12f7,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12fe, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x12f0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12f7,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12fe, 0x0000
+},
+/* Page 9, keysyms 0x1300-0x13ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x13bd, 0x13bd, 0x00ff, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 10, keysyms 0x1400-0x14ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x14b3, 0x14b3, 0x14b5, 0x14b5, 0x14b7, 0x14b7,
+0x14b9, 0x14b9, 0x14bb, 0x14bb, 0x14bd, 0x14bd, 0x14bf, 0x14bf,
+0x14c1, 0x14c1, 0x14c3, 0x14c3, 0x14c5, 0x14c5, 0x14c7, 0x14c7,
+0x14c9, 0x14c9, 0x14cb, 0x14cb, 0x14cd, 0x14cd, 0x14cf, 0x14cf,
+0x14d1, 0x14d1, 0x14d3, 0x14d3, 0x14d5, 0x14d5, 0x14d7, 0x14d7,
+0x14d9, 0x14d9, 0x14db, 0x14db, 0x14dd, 0x14dd, 0x14df, 0x14df,
+0x14e1, 0x14e1, 0x14e3, 0x14e3, 0x14e5, 0x14e5, 0x14e7, 0x14e7,
+0x14e9, 0x14e9, 0x14eb, 0x14eb, 0x14ed, 0x14ed, 0x14ef, 0x14ef,
+0x14f1, 0x14f1, 0x14f3, 0x14f3, 0x14f5, 0x14f5, 0x14f7, 0x14f7,
+0x14f9, 0x14f9, 0x14fb, 0x14fb, 0x14fd, 0x14fd, 0x0000, 0x0000
+},
+/* Page 11, keysyms 0x1600-0x16ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x16b3, 0x0000, 0x0000, 0x16b6, 0x0000,
+0x0000, 0x16b9, 0x16ba, 0x0000, 0x0000, 0x0000, 0x0000, 0x16bf,
+0x0000, 0x0000, 0x0000, 0x16b3, 0x16bd, 0x0000, 0x16b6, 0x0000,
+0x0000, 0x16b9, 0x16ba, 0x0000, 0x0000, 0x16bd, 0x0000, 0x16bf,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16f6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x16e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x16e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16f6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 12, keysyms 0x1e00-0x1eff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x1ea1, 0x1ea1, 0x1ea3, 0x1ea3, 0x1ea5, 0x1ea5, 0x1ea7, 0x1ea7,
+0x1ea9, 0x1ea9, 0x1eab, 0x1eab, 0x1ead, 0x1ead, 0x1eaf, 0x1eaf,
+0x1eb1, 0x1eb1, 0x1eb3, 0x1eb3, 0x1eb5, 0x1eb5, 0x1eb7, 0x1eb7,
+0x1eb9, 0x1eb9, 0x1ebb, 0x1ebb, 0x1ebd, 0x1ebd, 0x1ebf, 0x1ebf,
+0x1ec1, 0x1ec1, 0x1ec3, 0x1ec3, 0x1ec5, 0x1ec5, 0x1ec7, 0x1ec7,
+0x1ec9, 0x1ec9, 0x1ecb, 0x1ecb, 0x1ecd, 0x1ecd, 0x1ecf, 0x1ecf,
+0x1ed1, 0x1ed1, 0x1ed3, 0x1ed3, 0x1ed5, 0x1ed5, 0x1ed7, 0x1ed7,
+0x1ed9, 0x1ed9, 0x1edb, 0x1edb, 0x1edd, 0x1edd, 0x1edf, 0x1edf,
+0x1ee1, 0x1ee1, 0x1ee3, 0x1ee3, 0x1ee5, 0x1ee5, 0x1ee7, 0x1ee7,
+0x1ee9, 0x1ee9, 0x1eeb, 0x1eeb, 0x1eed, 0x1eed, 0x1eef, 0x1eef,
+0x1ef1, 0x1ef1, 0x0000, 0x0000, 0x1ef5, 0x1ef5, 0x1ef7, 0x1ef7,
+0x1ef9, 0x1ef9, 0x1efb, 0x1efb, 0x1efd, 0x1efd, 0x0000, 0x0000
+}
+};
+
+#define ks_upper_PAGES	13
+
+static const unsigned char ks_upper_pages[256] = {
+  1,   2,   3,   4,   0,   5,   6,   7,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   8,   9,  10,   0,  11,   0,
+  0,   0,   0,   0,   0,   0,  12,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const unsigned short ks_upper[13][256] = {
+/* Page 0.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 1, keysyms 0x0000-0x00ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+0x0058, 0x0059, 0x005a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+0x0058, 0x0059, 0x005a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x0000,
+0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x0000,
+0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x0000,
+0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x13be
+},
+/* Page 2, keysyms 0x0100-0x01ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x01a1, 0x0000, 0x01a3, 0x0000, 0x01a5, 0x01a6, 0x0000,
+0x0000, 0x01a9, 0x01aa, 0x01ab, 0x01ac, 0x0000, 0x01ae, 0x01af,
+0x0000, 0x01a1, 0x0000, 0x01a3, 0x0000, 0x01a5, 0x01a6, 0x0000,
+0x0000, 0x01a9, 0x01aa, 0x01ab, 0x01ac, 0x0000, 0x01ae, 0x01af,
+0x01c0, 0x0000, 0x0000, 0x01c3, 0x0000, 0x01c5, 0x01c6, 0x0000,
+0x01c8, 0x0000, 0x01ca, 0x0000, 0x01cc, 0x0000, 0x0000, 0x01cf,
+0x01d0, 0x01d1, 0x01d2, 0x0000, 0x0000, 0x01d5, 0x0000, 0x0000,
+0x01d8, 0x01d9, 0x0000, 0x01db, 0x0000, 0x0000, 0x01de, 0x0000,
+0x01c0, 0x0000, 0x0000, 0x01c3, 0x0000, 0x01c5, 0x01c6, 0x0000,
+0x01c8, 0x0000, 0x01ca, 0x0000, 0x01cc, 0x0000, 0x0000, 0x01cf,
+0x01d0, 0x01d1, 0x01d2, 0x0000, 0x0000, 0x01d5, 0x0000, 0x0000,
+0x01d8, 0x01d9, 0x0000, 0x01db, 0x0000, 0x0000, 0x01de, 0x0000
+},
+/* Page 3, keysyms 0x0200-0x02ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x02a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x02a6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x02ab, 0x02ac, 0x0000, 0x0000, 0x0000,
+0x0000, 0x02a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x02a6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x02ab, 0x02ac, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c5, 0x02c6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02d5, 0x0000, 0x0000,
+0x02d8, 0x0000, 0x0000, 0x0000, 0x0000, 0x02dd, 0x02de, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02c5, 0x02c6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02d5, 0x0000, 0x0000,
+0x02d8, 0x0000, 0x0000, 0x0000, 0x0000, 0x02dd, 0x02de, 0x0000
+},
+/* Page 4, keysyms 0x0300-0x03ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x03a3, 0x0000, 0x03a5, 0x03a6, 0x0000,
+0x0000, 0x0000, 0x03aa, 0x03ab, 0x03ac, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x03a3, 0x0000, 0x03a5, 0x03a6, 0x0000,
+0x0000, 0x0000, 0x03aa, 0x03ab, 0x03ac, 0x03bd, 0x0000, 0x03bd,
+0x03c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03c7,
+0x0000, 0x0000, 0x0000, 0x0000, 0x03cc, 0x0000, 0x0000, 0x03cf,
+0x0000, 0x03d1, 0x03d2, 0x03d3, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x03d9, 0x0000, 0x0000, 0x0000, 0x03dd, 0x03de, 0x0000,
+0x03c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03c7,
+0x0000, 0x0000, 0x0000, 0x0000, 0x03cc, 0x0000, 0x0000, 0x03cf,
+0x0000, 0x03d1, 0x03d2, 0x03d3, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x03d9, 0x0000, 0x0000, 0x0000, 0x03dd, 0x03de, 0x0000
+},
+/* Page 5, keysyms 0x0500-0x05ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x058a, 0x058b, 0x058c, 0x058d, 0x058e, 0x058f,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 6, keysyms 0x0600-0x06ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0680, 0x0681, 0x0682, 0x0683, 0x0684, 0x0685, 0x0686, 0x0687,
+0x0688, 0x0689, 0x068a, 0x0000, 0x068c, 0x068d, 0x068e, 0x068f,
+0x0680, 0x0681, 0x0682, 0x0683, 0x0684, 0x0685, 0x0686, 0x0687,
+0x0688, 0x0689, 0x068a, 0x0000, 0x068c, 0x068d, 0x068e, 0x068f,
+0x0000, 0x06b1, 0x06b2, 0x06b3, 0x06b4, 0x06b5, 0x06b6, 0x06b7,
+0x06b8, 0x06b9, 0x06ba, 0x06bb, 0x06bc, 0x06bd, 0x06be, 0x06bf,
+0x0000, 0x06b1, 0x06b2, 0x06b3, 0x06b4, 0x06b5, 0x06b6, 0x06b7,
+0x06b8, 0x06b9, 0x06ba, 0x06bb, 0x06bc, 0x06bd, 0x06be, 0x06bf,
+0x06e0, 0x06e1, 0x06e2, 0x06e3, 0x06e4, 0x06e5, 0x06e6, 0x06e7,
+0x06e8, 0x06e9, 0x06ea, 0x06eb, 0x06ec, 0x06ed, 0x06ee, 0x06ef,
+0x06f0, 0x06f1, 0x06f2, 0x06f3, 0x06f4, 0x06f5, 0x06f6, 0x06f7,
+0x06f8, 0x06f9, 0x058a, 0x058b, 0x058c, 0x058d, 0x058e, 0x058f,
+0x06e0, 0x06e1, 0x06e2, 0x06e3, 0x06e4, 0x06e5, 0x06e6, 0x06e7,
+0x06e8, 0x06e9, 0x06ea, 0x06eb, 0x06ec, 0x06ed, 0x06ee, 0x06ef,
+0x06f0, 0x06f1, 0x06f2, 0x06f3, 0x06f4, 0x06f5, 0x06f6, 0x06f7,
+0x06f8, 0x06f9, 0x06fa, 0x06fb, 0x06fc, 0x06fd, 0x06fe, 0x06ff
+},
+/* Page 7, keysyms 0x0700-0x07ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x07a1, 0x07a2, 0x07a3, 0x07a4, 0x07a5, 0x0000, 0x07a7,
+0x07a8, 0x07a9, 0x0000, 0x07ab, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x07a1, 0x07a2, 0x07a3, 0x07a4, 0x07a5, 0x0000, 0x07a7,
+0x07a8, 0x07a9, 0x0000, 0x07ab, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x07c1, 0x07c2, 0x07c3, 0x07c4, 0x07c5, 0x07c6, 0x07c7,
+0x07c8, 0x07c9, 0x07ca, 0x07cb, 0x07cc, 0x07cd, 0x07ce, 0x07cf,
+0x07d0, 0x07d1, 0x07d2, 0x0000, 0x07d4, 0x07d5, 0x07d6, 0x07d7,
+0x07d8, 0x07d9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x07c1, 0x07c2, 0x07c3, 0x07c4, 0x07c5, 0x07c6, 0x07c7,
+0x07c8, 0x07c9, 0x07ca, 0x07cb, 0x07cc, 0x07cd, 0x07ce, 0x07cf,
+0x07d0, 0x07d1, 0x07d2, 0x0000, 0x07d4, 0x07d5, 0x07d6, 0x07d7,
+0x07d8, 0x07d9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 8, keysyms 0x1200-0x12ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x12a1, 0x12a1, 0x0000, 0x0000, 0x0000, 0x12a6, 0x0000,
+0x12a8, 0x0000, 0x12aa, 0x12a6, 0x12ac, 0x0000, 0x0000, 0x0000,
+0x12b0, 0x12b0, 0x0000, 0x0000, 0x12b4, 0x12b4, 0x0000, 0x12b7,
+0x12a8, 0x12b7, 0x12aa, 0x12bb, 0x12ac, 0x12bd, 0x12bd, 0x12bb,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x12d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12d7,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12de, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x12d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12d7,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12de, 0x0000
+},
+/* Page 9, keysyms 0x1300-0x13ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x13bc, 0x13bc, 0x13be, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 10, keysyms 0x1400-0x14ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x14b2, 0x14b2, 0x14b4, 0x14b4, 0x14b6, 0x14b6,
+0x14b8, 0x14b8, 0x14ba, 0x14ba, 0x14bc, 0x14bc, 0x14be, 0x14be,
+0x14c0, 0x14c0, 0x14c2, 0x14c2, 0x14c4, 0x14c4, 0x14c6, 0x14c6,
+0x14c8, 0x14c8, 0x14ca, 0x14ca, 0x14cc, 0x14cc, 0x14ce, 0x14ce,
+0x14d0, 0x14d0, 0x14d2, 0x14d2, 0x14d4, 0x14d4, 0x14d6, 0x14d6,
+0x14d8, 0x14d8, 0x14da, 0x14da, 0x14dc, 0x14dc, 0x14de, 0x14de,
+0x14e0, 0x14e0, 0x14e2, 0x14e2, 0x14e4, 0x14e4, 0x14e6, 0x14e6,
+0x14e8, 0x14e8, 0x14ea, 0x14ea, 0x14ec, 0x14ec, 0x14ee, 0x14ee,
+0x14f0, 0x14f0, 0x14f2, 0x14f2, 0x14f4, 0x14f4, 0x14f6, 0x14f6,
+0x14f8, 0x14f8, 0x14fa, 0x14fa, 0x14fc, 0x14fc, 0x0000, 0x0000
+},
+/* Page 11, keysyms 0x1600-0x16ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x16a3, 0x0000, 0x0000, 0x16a6, 0x0000,
+0x0000, 0x16a9, 0x16aa, 0x0000, 0x0000, 0x0000, 0x0000, 0x16af,
+0x0000, 0x0000, 0x0000, 0x16a3, 0x16b4, 0x0000, 0x16a6, 0x0000,
+0x0000, 0x16a9, 0x16aa, 0x0000, 0x0000, 0x16b4, 0x0000, 0x16af,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16c6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x16d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x16d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x16c6, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 12, keysyms 0x1e00-0x1eff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x1ea0, 0x1ea0, 0x1ea2, 0x1ea2, 0x1ea4, 0x1ea4, 0x1ea6, 0x1ea6,
+0x1ea8, 0x1ea8, 0x1eaa, 0x1eaa, 0x1eac, 0x1eac, 0x1eae, 0x1eae,
+0x1eb0, 0x1eb0, 0x1eb2, 0x1eb2, 0x1eb4, 0x1eb4, 0x1eb6, 0x1eb6,
+0x1eb8, 0x1eb8, 0x1eba, 0x1eba, 0x1ebc, 0x1ebc, 0x1ebe, 0x1ebe,
+0x1ec0, 0x1ec0, 0x1ec2, 0x1ec2, 0x1ec4, 0x1ec4, 0x1ec6, 0x1ec6,
+0x1ec8, 0x1ec8, 0x1eca, 0x1eca, 0x1ecc, 0x1ecc, 0x1ece, 0x1ece,
+0x1ed0, 0x1ed0, 0x1ed2, 0x1ed2, 0x1ed4, 0x1ed4, 0x1ed6, 0x1ed6,
+0x1ed8, 0x1ed8, 0x1eda, 0x1eda, 0x1edc, 0x1edc, 0x1ede, 0x1ede,
+0x1ee0, 0x1ee0, 0x1ee2, 0x1ee2, 0x1ee4, 0x1ee4, 0x1ee6, 0x1ee6,
+0x1ee8, 0x1ee8, 0x1eea, 0x1eea, 0x1eec, 0x1eec, 0x1eee, 0x1eee,
+0x1ef0, 0x1ef0, 0x0000, 0x0000, 0x1ef4, 0x1ef4, 0x1ef6, 0x1ef6,
+0x1ef8, 0x1ef8, 0x1efa, 0x1efa, 0x1efc, 0x1efc, 0x0000, 0x0000
+}
+};
+
+#endif /* NEEDCASETABLE */
+
+#ifdef NEEDCLASSTABLE
+#define ks_class_PAGES	24
+
+static const unsigned char ks_class_pages[256] = {
+  1,   2,   3,   4,   5,   6,   7,   8,
+  9,  10,  11,   0,  12,  13,  14,   0,
+  0,   0,  15,  16,  17,  18,  19,   0,
+  0,   0,   0,   0,   0,   0,  20,   0,
+ 21,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,  22,  23
+};
+
+static const unsigned short ks_class[24][256] = {
+/* Page 0.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 1, keysyms 0x0000-0x00ff.  */
+{
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020
+},
+/* Page 2, keysyms 0x0100-0x01ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000,
+0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000,
+0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000,
+0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000,
+0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000,
+0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020
+},
+/* Page 3, keysyms 0x0200-0x02ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000,
+0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000,
+0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000
+},
+/* Page 4, keysyms 0x0300-0x03ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020,
+0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000,
+0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000
+},
+/* Page 5, keysyms 0x0400-0x04ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 6, keysyms 0x0500-0x05ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000
+},
+/* Page 7, keysyms 0x0600-0x06ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020
+},
+/* Page 8, keysyms 0x0700-0x07ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020,
+0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 9, keysyms 0x0800-0x08ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000,
+0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000
+},
+/* Page 10, keysyms 0x0900-0x09ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 11, keysyms 0x0a00-0x0aff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020,
+0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000
+},
+/* Page 12, keysyms 0x0c00-0x0cff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 13, keysyms 0x0d00-0x0dff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 14, keysyms 0x0e00-0x0eff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000,
+0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020
+},
+/* Page 15, keysyms 0x1200-0x12ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000
+},
+/* Page 16, keysyms 0x1300-0x13ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 17, keysyms 0x1400-0x14ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020
+},
+/* Page 18, keysyms 0x1500-0x15ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 19, keysyms 0x1600-0x16ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 20, keysyms 0x1e00-0x1eff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020
+},
+/* Page 21, keysyms 0x2000-0x20ff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 22, keysyms 0xfe00-0xfeff.  */
+{
+0x0000, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x2100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+0x0010, 0x0010, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+},
+/* Page 23, keysyms 0xff00-0xffff.  */
+{
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0500, 0x2300, 0x0000, 0x0000, 0x0000, 0x2200, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x2400, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x1a08, 0x0308, 0x0108, 0x0408, 0x0208, 0x1e08, 0x1f08, 0x1d08,
+0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+0x0000, 0x0000, 0x0000, 0x1b00, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0002,
+0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+0x0001, 0x2301, 0x0001, 0x0001, 0x0001, 0x2221, 0x0001, 0x0001,
+0x0001, 0x0605, 0x0705, 0x0805, 0x0905, 0x1a09, 0x0309, 0x0109,
+0x0409, 0x0209, 0x1e09, 0x1f09, 0x1d09, 0x2009, 0x1b01, 0x1c01,
+0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+0x0001, 0x0001, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0604, 0x0704,
+0x0804, 0x0904, 0x0a04, 0x0b04, 0x0c04, 0x0d04, 0x0e04, 0x0f04,
+0x1004, 0x1104, 0x1204, 0x1304, 0x1404, 0x1504, 0x1604, 0x1704,
+0x1804, 0x1904, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+0x0004, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
+0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c00
+}
+};
+
+#endif /* NEEDCLASSTABLE */
+
+#ifdef NEEDDEADTABLE
+/* Every entry is a dead key, the keysym that follows it and the keysym
+   they make.  */
+#define KSDEAD		270
+
+static const unsigned short ks_dead[KSDEAD][3] = {
+{ 0xfe50, 0x0041, 0x00c0 },
+{ 0xfe51, 0x0041, 0x00c1 },
+{ 0xfe52, 0x0041, 0x00c2 },
+{ 0xfe53, 0x0041, 0x00c3 },
+{ 0xfe57, 0x0041, 0x00c4 },
+{ 0xfe58, 0x0041, 0x00c5 },
+{ 0xfe5b, 0x0043, 0x00c7 },
+{ 0xfe50, 0x0045, 0x00c8 },
+{ 0xfe51, 0x0045, 0x00c9 },
+{ 0xfe52, 0x0045, 0x00ca },
+{ 0xfe57, 0x0045, 0x00cb },
+{ 0xfe50, 0x0049, 0x00cc },
+{ 0xfe51, 0x0049, 0x00cd },
+{ 0xfe52, 0x0049, 0x00ce },
+{ 0xfe57, 0x0049, 0x00cf },
+{ 0xfe53, 0x004e, 0x00d1 },
+{ 0xfe50, 0x004f, 0x00d2 },
+{ 0xfe51, 0x004f, 0x00d3 },
+{ 0xfe52, 0x004f, 0x00d4 },
+{ 0xfe53, 0x004f, 0x00d5 },
+{ 0xfe57, 0x004f, 0x00d6 },
+{ 0xfe50, 0x0055, 0x00d9 },
+{ 0xfe51, 0x0055, 0x00da },
+{ 0xfe52, 0x0055, 0x00db },
+{ 0xfe57, 0x0055, 0x00dc },
+{ 0xfe51, 0x0059, 0x00dd },
+{ 0xfe62, 0x0054, 0x00de },
+{ 0xfe50, 0x0061, 0x00e0 },
+{ 0xfe51, 0x0061, 0x00e1 },
+{ 0xfe52, 0x0061, 0x00e2 },
+{ 0xfe53, 0x0061, 0x00e3 },
+{ 0xfe57, 0x0061, 0x00e4 },
+{ 0xfe58, 0x0061, 0x00e5 },
+{ 0xfe5b, 0x0063, 0x00e7 },
+{ 0xfe50, 0x0065, 0x00e8 },
+{ 0xfe51, 0x0065, 0x00e9 },
+{ 0xfe52, 0x0065, 0x00ea },
+{ 0xfe57, 0x0065, 0x00eb },
+{ 0xfe50, 0x0069, 0x00ec },
+{ 0xfe51, 0x0069, 0x00ed },
+{ 0xfe52, 0x0069, 0x00ee },
+{ 0xfe57, 0x0069, 0x00ef },
+{ 0xfe53, 0x006e, 0x00f1 },
+{ 0xfe50, 0x006f, 0x00f2 },
+{ 0xfe51, 0x006f, 0x00f3 },
+{ 0xfe52, 0x006f, 0x00f4 },
+{ 0xfe53, 0x006f, 0x00f5 },
+{ 0xfe57, 0x006f, 0x00f6 },
+{ 0xfe50, 0x0075, 0x00f9 },
+{ 0xfe51, 0x0075, 0x00fa },
+{ 0xfe52, 0x0075, 0x00fb },
+{ 0xfe57, 0x0075, 0x00fc },
+{ 0xfe51, 0x0079, 0x00fd },
+{ 0xfe57, 0x0079, 0x00ff },
+{ 0xfe5c, 0x0041, 0x01a1 },
+{ 0xfe5a, 0x004c, 0x01a5 },
+{ 0xfe51, 0x0053, 0x01a6 },
+{ 0xfe5a, 0x0053, 0x01a9 },
+{ 0xfe5b, 0x0053, 0x01aa },
+{ 0xfe5a, 0x0054, 0x01ab },
+{ 0xfe51, 0x005a, 0x01ac },
+{ 0xfe5a, 0x005a, 0x01ae },
+{ 0xfe56, 0x005a, 0x01af },
+{ 0xfe5c, 0x0061, 0x01b1 },
+{ 0xfe5a, 0x006c, 0x01b5 },
+{ 0xfe51, 0x0073, 0x01b6 },
+{ 0xfe5a, 0x0073, 0x01b9 },
+{ 0xfe5b, 0x0073, 0x01ba },
+{ 0xfe5a, 0x0074, 0x01bb },
+{ 0xfe51, 0x007a, 0x01bc },
+{ 0xfe5a, 0x007a, 0x01be },
+{ 0xfe56, 0x007a, 0x01bf },
+{ 0xfe51, 0x0052, 0x01c0 },
+{ 0xfe55, 0x0041, 0x01c3 },
+{ 0xfe51, 0x004c, 0x01c5 },
+{ 0xfe51, 0x0043, 0x01c6 },
+{ 0xfe5a, 0x0043, 0x01c8 },
+{ 0xfe5c, 0x0045, 0x01ca },
+{ 0xfe5a, 0x0045, 0x01cc },
+{ 0xfe5a, 0x0044, 0x01cf },
+{ 0xfe51, 0x004e, 0x01d1 },
+{ 0xfe5a, 0x004e, 0x01d2 },
+{ 0xfe59, 0x004f, 0x01d5 },
+{ 0xfe5a, 0x0052, 0x01d8 },
+{ 0xfe58, 0x0055, 0x01d9 },
+{ 0xfe59, 0x0055, 0x01db },
+{ 0xfe5b, 0x0054, 0x01de },
+{ 0xfe51, 0x0072, 0x01e0 },
+{ 0xfe55, 0x0061, 0x01e3 },
+{ 0xfe51, 0x006c, 0x01e5 },
+{ 0xfe51, 0x0063, 0x01e6 },
+{ 0xfe5a, 0x0063, 0x01e8 },
+{ 0xfe5c, 0x0065, 0x01ea },
+{ 0xfe5a, 0x0065, 0x01ec },
+{ 0xfe5a, 0x0064, 0x01ef },
+{ 0xfe51, 0x006e, 0x01f1 },
+{ 0xfe5a, 0x006e, 0x01f2 },
+{ 0xfe59, 0x006f, 0x01f5 },
+{ 0xfe59, 0x0075, 0x01fb },
+{ 0xfe5a, 0x0072, 0x01f8 },
+{ 0xfe58, 0x0075, 0x01f9 },
+{ 0xfe5b, 0x0074, 0x01fe },
+{ 0xfe52, 0x0048, 0x02a6 },
+{ 0xfe56, 0x0049, 0x02a9 },
+{ 0xfe55, 0x0047, 0x02ab },
+{ 0xfe52, 0x004a, 0x02ac },
+{ 0xfe52, 0x0068, 0x02b6 },
+{ 0xfe55, 0x0067, 0x02bb },
+{ 0xfe52, 0x006a, 0x02bc },
+{ 0xfe56, 0x0043, 0x02c5 },
+{ 0xfe52, 0x0043, 0x02c6 },
+{ 0xfe56, 0x0047, 0x02d5 },
+{ 0xfe52, 0x0047, 0x02d8 },
+{ 0xfe55, 0x0055, 0x02dd },
+{ 0xfe52, 0x0053, 0x02de },
+{ 0xfe56, 0x0063, 0x02e5 },
+{ 0xfe52, 0x0063, 0x02e6 },
+{ 0xfe56, 0x0067, 0x02f5 },
+{ 0xfe52, 0x0067, 0x02f8 },
+{ 0xfe55, 0x0075, 0x02fd },
+{ 0xfe52, 0x0073, 0x02fe },
+{ 0xfe5b, 0x0052, 0x03a3 },
+{ 0xfe53, 0x0049, 0x03a5 },
+{ 0xfe5b, 0x004c, 0x03a6 },
+{ 0xfe54, 0x0045, 0x03aa },
+{ 0xfe5b, 0x0047, 0x03ab },
+{ 0xfe5b, 0x0072, 0x03b3 },
+{ 0xfe53, 0x0069, 0x03b5 },
+{ 0xfe5b, 0x006c, 0x03b6 },
+{ 0xfe54, 0x0065, 0x03ba },
+{ 0xfe5b, 0x0067, 0x03bb },
+{ 0xfe54, 0x0041, 0x03c0 },
+{ 0xfe5c, 0x0049, 0x03c7 },
+{ 0xfe56, 0x0045, 0x03cc },
+{ 0xfe54, 0x0049, 0x03cf },
+{ 0xfe5b, 0x004e, 0x03d1 },
+{ 0xfe54, 0x004f, 0x03d2 },
+{ 0xfe5b, 0x004b, 0x03d3 },
+{ 0xfe5c, 0x0055, 0x03d9 },
+{ 0xfe53, 0x0055, 0x03dd },
+{ 0xfe54, 0x0055, 0x03de },
+{ 0xfe54, 0x0061, 0x03e0 },
+{ 0xfe5c, 0x0069, 0x03e7 },
+{ 0xfe56, 0x0065, 0x03ec },
+{ 0xfe54, 0x0069, 0x03ef },
+{ 0xfe5b, 0x006e, 0x03f1 },
+{ 0xfe54, 0x006f, 0x03f2 },
+{ 0xfe5b, 0x006b, 0x03f3 },
+{ 0xfe5c, 0x0075, 0x03f9 },
+{ 0xfe53, 0x0075, 0x03fd },
+{ 0xfe54, 0x0075, 0x03fe },
+{ 0xfe56, 0x0042, 0x12a1 },
+{ 0xfe56, 0x0062, 0x12a2 },
+{ 0xfe56, 0x0044, 0x12a6 },
+{ 0xfe50, 0x0057, 0x12a8 },
+{ 0xfe51, 0x0057, 0x12aa },
+{ 0xfe56, 0x0064, 0x12ab },
+{ 0xfe50, 0x0059, 0x12ac },
+{ 0xfe56, 0x0046, 0x12b0 },
+{ 0xfe56, 0x0066, 0x12b1 },
+{ 0xfe56, 0x004d, 0x12b4 },
+{ 0xfe56, 0x006d, 0x12b5 },
+{ 0xfe56, 0x0050, 0x12b7 },
+{ 0xfe50, 0x0077, 0x12b8 },
+{ 0xfe56, 0x0070, 0x12b9 },
+{ 0xfe51, 0x0077, 0x12ba },
+{ 0xfe56, 0x0053, 0x12bb },
+{ 0xfe50, 0x0079, 0x12bc },
+{ 0xfe57, 0x0057, 0x12bd },
+{ 0xfe57, 0x0077, 0x12be },
+{ 0xfe56, 0x0073, 0x12bf },
+{ 0xfe52, 0x0057, 0x12d0 },
+{ 0xfe56, 0x0054, 0x12d7 },
+{ 0xfe52, 0x0059, 0x12de },
+{ 0xfe52, 0x0077, 0x12f0 },
+{ 0xfe56, 0x0074, 0x12f7 },
+{ 0xfe52, 0x0079, 0x12fe },
+{ 0xfe57, 0x0059, 0x13be },
+{ 0xfe51, 0x07c1, 0x07a1 },
+{ 0xfe51, 0x07c5, 0x07a2 },
+{ 0xfe51, 0x07c7, 0x07a3 },
+{ 0xfe51, 0x07c9, 0x07a4 },
+{ 0xfe57, 0x07c9, 0x07a5 },
+{ 0xfe51, 0x07cf, 0x07a7 },
+{ 0xfe51, 0x07d5, 0x07a8 },
+{ 0xfe57, 0x07d5, 0x07a9 },
+{ 0xfe51, 0x07d9, 0x07ab },
+{ 0xfe51, 0x07e1, 0x07b1 },
+{ 0xfe51, 0x07e5, 0x07b2 },
+{ 0xfe51, 0x07e7, 0x07b3 },
+{ 0xfe51, 0x07e9, 0x07b4 },
+{ 0xfe57, 0x07e9, 0x07b5 },
+{ 0xfe51, 0x07ef, 0x07b7 },
+{ 0xfe51, 0x07f5, 0x07b8 },
+{ 0xfe57, 0x07f5, 0x07b9 },
+{ 0xfe51, 0x07f9, 0x07bb },
+{ 0xfe56, 0x0058, 0x16a3 },
+{ 0xfe56, 0x0051, 0x16a5 },
+{ 0xfe55, 0x0049, 0x16a6 },
+{ 0xfe5a, 0x0047, 0x16aa },
+{ 0xfe56, 0x0078, 0x16b3 },
+{ 0xfe5a, 0x004f, 0x16b4 },
+{ 0xfe56, 0x0071, 0x16b5 },
+{ 0xfe55, 0x0069, 0x16b6 },
+{ 0xfe5a, 0x0067, 0x16ba },
+{ 0xfe5a, 0x006f, 0x16bd },
+{ 0xfe60, 0x004c, 0x16d1 },
+{ 0xfe60, 0x01a3, 0x16d2 },
+{ 0xfe60, 0x006c, 0x16e1 },
+{ 0xfe60, 0x01b3, 0x16e2 },
+{ 0xfe53, 0x0047, 0x16d3 },
+{ 0xfe53, 0x0067, 0x16e3 },
+{ 0xfe60, 0x0041, 0x1ea0 },
+{ 0xfe60, 0x0061, 0x1ea1 },
+{ 0xfe61, 0x0041, 0x1ea2 },
+{ 0xfe61, 0x0061, 0x1ea3 },
+{ 0xfe60, 0x0045, 0x1eb8 },
+{ 0xfe60, 0x0065, 0x1eb9 },
+{ 0xfe61, 0x0045, 0x1eba },
+{ 0xfe61, 0x0065, 0x1ebb },
+{ 0xfe53, 0x0045, 0x1ebc },
+{ 0xfe53, 0x0065, 0x1ebd },
+{ 0xfe61, 0x0049, 0x1ec8 },
+{ 0xfe61, 0x0069, 0x1ec9 },
+{ 0xfe60, 0x0049, 0x1eca },
+{ 0xfe60, 0x0069, 0x1ecb },
+{ 0xfe60, 0x004f, 0x1ecc },
+{ 0xfe60, 0x006f, 0x1ecd },
+{ 0xfe61, 0x004f, 0x1ece },
+{ 0xfe61, 0x006f, 0x1ecf },
+{ 0xfe60, 0x0055, 0x1ee4 },
+{ 0xfe60, 0x0075, 0x1ee5 },
+{ 0xfe61, 0x0055, 0x1ee6 },
+{ 0xfe61, 0x0075, 0x1ee7 },
+{ 0xfe60, 0x0059, 0x1ef4 },
+{ 0xfe60, 0x0079, 0x1ef5 },
+{ 0xfe61, 0x0059, 0x1ef6 },
+{ 0xfe61, 0x0079, 0x1ef7 },
+{ 0xfe53, 0x0059, 0x1ef8 },
+{ 0xfe53, 0x0079, 0x1ef9 },
+{ 0xfe62, 0x004f, 0x1efa },
+{ 0xfe62, 0x006f, 0x1efb },
+{ 0xfe62, 0x0055, 0x1efc },
+{ 0xfe62, 0x0075, 0x1efd },
+{ 0xfe59, 0x0020, 0x01bd },
+{ 0xfe59, 0xfe59, 0x01bd },
+{ 0xfe50, 0x0020, 0x0060 },
+{ 0xfe50, 0xfe50, 0x0060 },
+{ 0xfe51, 0x0020, 0x00b4 },
+{ 0xfe51, 0xfe51, 0x00b4 },
+{ 0xfe52, 0x0020, 0x005e },
+{ 0xfe52, 0xfe52, 0x005e },
+{ 0xfe53, 0x0020, 0x007e },
+{ 0xfe53, 0xfe53, 0x007e },
+{ 0xfe54, 0x0020, 0x00af },
+{ 0xfe54, 0xfe54, 0x00af },
+{ 0xfe55, 0x0020, 0x01a2 },
+{ 0xfe55, 0xfe55, 0x01a2 },
+{ 0xfe56, 0x0020, 0x01ff },
+{ 0xfe56, 0xfe56, 0x01ff },
+{ 0xfe57, 0x0020, 0x00a8 },
+{ 0xfe57, 0xfe57, 0x00a8 },
+{ 0xfe58, 0x0020, 0x00b0 },
+{ 0xfe58, 0xfe58, 0x00b0 },
+{ 0xfe5a, 0x0020, 0x01b7 },
+{ 0xfe5a, 0xfe5a, 0x01b7 },
+{ 0xfe5b, 0x0020, 0x00b8 },
+{ 0xfe5b, 0xfe5b, 0x00b8 },
+{ 0xfe5c, 0x0020, 0x01b2 },
+{ 0xfe5c, 0xfe5c, 0x01b2 }
+};
+
+#endif /* NEEDDEADTABLE */
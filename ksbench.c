@@ -0,0 +1,405 @@
+/*  ksbench.c -- Benchmarks for the keysym tables.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* Compare the lookups in the tables generated by makekeys with the
+   algorithms they replaced.  Run "make bench".  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <wchar.h>
+#include <iconv.h>
+
+#define NEEDKTABLE
+#include "ks_tables.h"
+#include "ksucsdef.h"
+
+typedef unsigned long KeySym;
+
+KeySym XStringToKeysym (char *s);
+char *XKeysymToString (KeySym ks);
+unsigned int KeySymToUcs4 (int keysym);
+size_t ucs4_to_utf8 (const wchar_t *in, size_t n, char *out, size_t size,
+		     size_t *done);
+
+/* The amount of times every benchmark walks over its input.  */
+#define ROUNDS	2000
+
+/* Every benchmark is run this many times; the fastest run counts.  */
+#define RUNS	5
+
+/* Used to make sure the compiler can't drop the lookups.  */
+static volatile unsigned long sink;
+
+static double
+now (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Evaluate EXPR for I = 0...N-1, ROUNDS times, and store the fastest
+   of RUNS runs in RESULT.  */
+#define TIME(result, n, expr)					\
+  do								\
+    {								\
+      int run, round, i;					\
+								\
+      result = 1e9;						\
+      for (run = 0; run < RUNS; run++)				\
+	{							\
+	  double t0 = now ();					\
+								\
+	  for (round = 0; round < ROUNDS; round++)		\
+	    for (i = 0; i < (n); i++)				\
+	      sink += (expr);					\
+	  if (now () - t0 < result)				\
+	    result = now () - t0;				\
+	}							\
+    }								\
+  while (0)
+
+static void
+report (const char *what, double told, double tnew, long lookups)
+{
+  printf ("%-22s old: %7.1f ns  new: %7.1f ns  speedup: %.2fx\n", what,
+	  told * 1e9 / lookups, tnew * 1e9 / lookups, told / tnew);
+}
+
+
+/* XStringToKeysym before makekeys: the open addressing table of the X
+   makekeys, with a shift-add signature and a strcmp per probe.  The
+   table is rebuilt here from the names so both lookups use the same
+   set of names.  */
+
+#define LEGACY_KTABLESIZE	2909
+
+struct legacy_entry
+{
+  unsigned char sig1;
+  unsigned char sig2;
+  KeySym val;
+  const char *name;
+};
+
+static struct legacy_entry legacy_table[KSNAMES + 1];
+static unsigned short legacy_hash[LEGACY_KTABLESIZE];
+static int legacy_maxhash;
+
+static unsigned long
+legacy_signature (const char *s)
+{
+  unsigned long sig = 0;
+  int c;
+
+  while ((c = *s++))
+    sig = (sig << 1) + c;
+  return sig;
+}
+
+static void
+legacy_build (void)
+{
+  int i;
+
+  for (i = 0; i < KSNAMES; i++)
+    {
+      const char *name = &ks_names[ks_name_offsets[i]];
+      unsigned long sig = legacy_signature (name);
+      int first = sig % LEGACY_KTABLESIZE;
+      int j = first;
+      int num = 1;
+
+      while (legacy_hash[j])
+	{
+	  j += first + 1;
+	  if (j >= LEGACY_KTABLESIZE)
+	    j -= LEGACY_KTABLESIZE;
+	  num++;
+	}
+      if (num > legacy_maxhash)
+	legacy_maxhash = num;
+
+      legacy_table[i + 1].sig1 = (sig >> 8) & 0xff;
+      legacy_table[i + 1].sig2 = sig & 0xff;
+      legacy_table[i + 1].val = ks_name_values[i];
+      legacy_table[i + 1].name = name;
+      legacy_hash[j] = i + 1;
+    }
+}
+
+/* Not inlined, so it is called just like XStringToKeysym.  */
+static KeySym __attribute__ ((noinline))
+legacy_lookup (const char *s)
+{
+  unsigned long sig = legacy_signature (s);
+  int i = sig % LEGACY_KTABLESIZE;
+  int h = i + 1;
+  unsigned char sig1 = (sig >> 8) & 0xff;
+  unsigned char sig2 = sig & 0xff;
+  int n = legacy_maxhash;
+  int idx;
+
+  while ((idx = legacy_hash[i]))
+    {
+      struct legacy_entry *entry = &legacy_table[idx];
+
+      if (entry->sig1 == sig1 && entry->sig2 == sig2
+	  && !strcmp (s, entry->name))
+	return entry->val;
+      if (!--n)
+	break;
+      i += h;
+      if (i >= LEGACY_KTABLESIZE)
+	i -= LEGACY_KTABLESIZE;
+    }
+  return 0;
+}
+
+/* XKeysymToString of X before the reverse index: a walk over the whole
+   name table, the first entry with the keysym wins.  */
+static const char * __attribute__ ((noinline))
+legacy_reverse (KeySym ks)
+{
+  int i;
+
+  for (i = 1; i <= KSNAMES; i++)
+    if (legacy_table[i].val == ks)
+      return legacy_table[i].name;
+  return NULL;
+}
+
+/* Resolve every name in keysymdef.h.  */
+static void
+bench_names (void)
+{
+  char **names = malloc (KSNAMES * sizeof (char *));
+  unsigned int seed = 1;
+  double told, tnew;
+  int i;
+
+  legacy_build ();
+
+  /* Look the names up from copies, like the parser does, and in a
+     shuffled order so neither table is walked sequentially.  */
+  for (i = 0; i < KSNAMES; i++)
+    names[i] = strdup (&ks_names[ks_name_offsets[i]]);
+  for (i = KSNAMES - 1; i > 0; i--)
+    {
+      char *tmp = names[i];
+      int j;
+
+      seed = seed * 1103515245 + 12345;
+      j = (seed >> 8) % (i + 1);
+      names[i] = names[j];
+      names[j] = tmp;
+    }
+
+  for (i = 0; i < KSNAMES; i++)
+    if (XStringToKeysym (names[i]) != legacy_lookup (names[i]))
+      {
+	fprintf (stderr, "Mismatch for %s\n", names[i]);
+	exit (EXIT_FAILURE);
+      }
+
+  TIME (told, KSNAMES, legacy_lookup (names[i]));
+  TIME (tnew, KSNAMES, XStringToKeysym (names[i]));
+  report ("XStringToKeysym", told, tnew, (long) ROUNDS * KSNAMES);
+
+  /* Unknown names, like the U+ names of Compose files, have to walk
+     the whole probe sequence in the old table.  */
+  for (i = 0; i < KSNAMES; i++)
+    names[i][0] ^= 0x20;
+  TIME (told, KSNAMES, legacy_lookup (names[i]));
+  TIME (tnew, KSNAMES, XStringToKeysym (names[i]));
+  report ("XStringToKeysym miss", told, tnew, (long) ROUNDS * KSNAMES);
+
+  for (i = 0; i < KSNAMES; i++)
+    free (names[i]);
+  free (names);
+}
+
+/* Name every keysym in keysymdef.h.  */
+static void
+bench_values (void)
+{
+  KeySym *values = malloc (KSNAMES * sizeof (KeySym));
+  double told, tnew;
+  int i;
+
+  for (i = 0; i < KSNAMES; i++)
+    {
+      const char *name;
+
+      values[i] = ks_name_values[i];
+      name = XKeysymToString (values[i]);
+      if (!name || XStringToKeysym ((char *) name) != values[i])
+	{
+	  fprintf (stderr, "No name for 0x%lx\n", values[i]);
+	  exit (EXIT_FAILURE);
+	}
+    }
+
+  TIME (told, KSNAMES, (unsigned long) legacy_reverse (values[i]));
+  TIME (tnew, KSNAMES, (unsigned long) XKeysymToString (values[i]));
+  report ("XKeysymToString", told, tnew, (long) ROUNDS * KSNAMES);
+
+  free (values);
+}
+
+/* Not inlined, so it is called just like KeySymToUcs4.  */
+static unsigned int __attribute__ ((noinline))
+legacy_ucs4 (int keysym)
+{
+  if ((keysym & 0xff000000) == 0x01000000)
+    return keysym & 0x00ffffff;
+  return keysym_to_ucs4_ranges (keysym);
+}
+
+/* Convert every keysym in keysymdef.h to UCS-4.  */
+static void
+bench_ucs (void)
+{
+  int *values = malloc (KSNAMES * sizeof (int));
+  double told, tnew;
+  int i;
+
+  for (i = 0; i < 0x10000; i++)
+    if (KeySymToUcs4 (i) != legacy_ucs4 (i))
+      {
+	fprintf (stderr, "Mismatch for 0x%x\n", i);
+	exit (EXIT_FAILURE);
+      }
+
+  for (i = 0; i < KSNAMES; i++)
+    values[i] = ks_name_values[i];
+
+  TIME (told, KSNAMES, legacy_ucs4 (values[i]));
+  TIME (tnew, KSNAMES, KeySymToUcs4 (values[i]));
+  report ("KeySymToUcs4", told, tnew, (long) ROUNDS * KSNAMES);
+
+  free (values);
+}
+
+/* The length of the texts that are encoded.  */
+#define TEXTLEN	4096
+
+static iconv_t cd;
+static char utf8[TEXTLEN * 4];
+
+/* Encode TEXT one character at a time with iconv, like xkb_input did
+   before ucs4_to_utf8.  */
+static size_t __attribute__ ((noinline))
+legacy_encode (const wchar_t *text, size_t n)
+{
+  char *out = utf8;
+  size_t left = sizeof (utf8);
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      char *in = (char *) &text[i];
+      size_t inleft = sizeof (wchar_t);
+
+      iconv (cd, &in, &inleft, &out, &left);
+    }
+  return sizeof (utf8) - left;
+}
+
+static size_t __attribute__ ((noinline))
+batch_encode (const wchar_t *text, size_t n)
+{
+  size_t done;
+
+  return ucs4_to_utf8 (text, n, utf8, sizeof (utf8), &done);
+}
+
+/* Time the encoding of TEXT, after checking that both encoders agree
+   on it.  */
+static void
+bench_text (const char *what, const wchar_t *text)
+{
+  char expected[TEXTLEN * 4];
+  size_t len;
+  double told, tnew;
+
+  len = legacy_encode (text, TEXTLEN);
+  memcpy (expected, utf8, len);
+  if (batch_encode (text, TEXTLEN) != len || memcmp (expected, utf8, len))
+    {
+      fprintf (stderr, "Mismatch encoding %s\n", what);
+      exit (EXIT_FAILURE);
+    }
+
+  TIME (told, 1, legacy_encode (text, TEXTLEN));
+  TIME (tnew, 1, batch_encode (text, TEXTLEN));
+  report (what, told, tnew, (long) ROUNDS * TEXTLEN);
+}
+
+/* Encode ASCII and mixed text to UTF-8.  */
+static void
+bench_utf8 (void)
+{
+  static wchar_t text[TEXTLEN];
+  const char *ascii = "The quick brown fox jumps over the lazy dog.\n";
+  const wchar_t *mixed = L"Fran\u00e7ais, \u0440\u0443\u0441\u0441\u043a\u0438\u0439, "
+    L"\u03b5\u03bb\u03bb\u03b7\u03bd\u03b9\u03ba\u03ac \u20ac\n";
+  char expected[4];
+  size_t len;
+  wchar_t c;
+  int i;
+
+  cd = iconv_open ("UTF-8", "WCHAR_T");
+  if (cd == (iconv_t) -1)
+    {
+      perror ("iconv_open");
+      exit (EXIT_FAILURE);
+    }
+
+  /* Every character iconv can encode must be encoded the same.  */
+  for (c = 0; c < 0x110000; c++)
+    {
+      if (c >= 0xd800 && c <= 0xdfff)
+	continue;
+      text[0] = c;
+      len = legacy_encode (text, 1);
+      memcpy (expected, utf8, len);
+      if (batch_encode (text, 1) != len || memcmp (expected, utf8, len))
+	{
+	  fprintf (stderr, "Mismatch for U+%04x\n", (unsigned int) c);
+	  exit (EXIT_FAILURE);
+	}
+    }
+
+  for (i = 0; i < TEXTLEN; i++)
+    text[i] = ascii[i % strlen (ascii)];
+  bench_text ("UTF-8 ASCII", text);
+
+  for (i = 0; i < TEXTLEN; i++)
+    text[i] = mixed[i % wcslen (mixed)];
+  bench_text ("UTF-8 mixed", text);
+
+  iconv_close (cd);
+}
+
+int
+main (void)
+{
+  bench_names ();
+  bench_values ();
+  bench_ucs ();
+  bench_utf8 ();
+  return 0;
+}
@@ -0,0 +1,83 @@
+/*  ksclass.h -- Keysym classes.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* makekeys stores the class of every keysym in the ks_class table of
+   ks_tables.h.  The low byte of an entry holds the KS_* flags below,
+   the high byte the console key the keysym is sent as, see
+   ks_conskey.  keysym_class looks a keysym up.  */
+
+#ifndef _KSCLASS_H_
+#define _KSCLASS_H_ 1
+
+/* Keypad keysyms, XK_KP_Space...XK_KP_Equal.  */
+#define KS_KEYPAD	0x01
+/* Modifiers: shift, lock, control, alt, meta, super, hyper, the ISO
+   lock and group keysyms, Mode_switch and Num_Lock.  */
+#define KS_MODIFIER	0x02
+/* XK_F1...XK_F35 and XK_KP_F1...XK_KP_F4.  */
+#define KS_FUNCTION	0x04
+/* Cursor movement, XK_Home...XK_Begin, and their keypad versions.  */
+#define KS_CURSOR	0x08
+/* Dead keys for compose.  */
+#define KS_DEAD		0x10
+/* The keysym produces a character.  For keypad keysyms this means
+   their low seven bits are that character, see keypad_to_ascii.  */
+#define KS_TEXT		0x20
+
+/* The console key of the class C.  */
+#define KS_CONSKEY(c)	((c) >> 8)
+
+/* Keys the console gets as an escape sequence or a control character
+   instead of the character of the keysym.  */
+enum ks_conskey
+  {
+    KS_CONS_NONE = 0,
+    KS_CONS_UP,
+    KS_CONS_DOWN,
+    KS_CONS_LEFT,
+    KS_CONS_RIGHT,
+    KS_CONS_BACKSPACE,
+    KS_CONS_F1,
+    KS_CONS_F2,
+    KS_CONS_F3,
+    KS_CONS_F4,
+    KS_CONS_F5,
+    KS_CONS_F6,
+    KS_CONS_F7,
+    KS_CONS_F8,
+    KS_CONS_F9,
+    KS_CONS_F10,
+    KS_CONS_F11,
+    KS_CONS_F12,
+    KS_CONS_F13,
+    KS_CONS_F14,
+    KS_CONS_F15,
+    KS_CONS_F16,
+    KS_CONS_F17,
+    KS_CONS_F18,
+    KS_CONS_F19,
+    KS_CONS_F20,
+    KS_CONS_HOME,
+    KS_CONS_INSERT,
+    KS_CONS_DELETE,
+    KS_CONS_END,
+    KS_CONS_PAGE_UP,
+    KS_CONS_PAGE_DOWN,
+    KS_CONS_BEGIN,
+    KS_CONS_BACKTAB,
+    KS_CONS_RETURN,
+    KS_CONS_TAB,
+    KS_CONS_ESCAPE,
+    KS_CONS_MAX
+  };
+
+#endif /* _KSCLASS_H_ */
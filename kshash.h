@@ -0,0 +1,119 @@
+/*  kshash.h -- Hash function for keysym names.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* This hash is shared by makekeys, which builds the minimal perfect
+   hash over all keysym names in ks_tables.h, and by XStringToKeysym,
+   which looks names up in it.  Both must agree on every bit, so never
+   change one without regenerating ks_tables.h.  */
+
+#ifndef _KSHASH_H_
+#define _KSHASH_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Mix the lanes A and B of a hash, see ks_hash.  */
+static inline uint64_t
+ks_hash_mix (uint64_t a, uint64_t b)
+{
+  a ^= (b << 32) | (b >> 32);
+  a ^= a >> 33;
+  a *= 0xff51afd7ed558ccdULL;
+  a ^= a >> 33;
+  a *= 0xc4ceb9fe1a85ec53ULL;
+  a ^= a >> 33;
+  return a;
+}
+
+/* Hash the string S.  Two characters are folded in per iteration,
+   each into its own lane with a rotate and xor, so the loop is about
+   as cheap as the shift-add signature of the old X table.  The final
+   mixer of MurmurHash3 then spreads the lanes over all bits, so the
+   bucket and slot hashes taken from it are independent.  */
+static inline uint64_t
+ks_hash (const char *s)
+{
+  const unsigned char *p = (const unsigned char *) s;
+  uint64_t a = 0;
+  uint64_t b = 0;
+
+  while (p[0] && p[1])
+    {
+      a = ((a << 5) | (a >> 59)) ^ p[0];
+      b = ((b << 5) | (b >> 59)) ^ p[1];
+      p += 2;
+    }
+  /* Mark the last character of an odd length string, so it can't
+     hash like the first lane of a pair.  */
+  if (p[0])
+    a = ((a << 5) | (a >> 59)) ^ (p[0] | 0x100);
+
+  return ks_hash_mix (a, b);
+}
+
+/* Hash the LEN characters at S, which need not be terminated, exactly
+   like ks_hash hashes them.  */
+static inline uint64_t
+ks_hash_len (const char *s, size_t len)
+{
+  const unsigned char *p = (const unsigned char *) s;
+  uint64_t a = 0;
+  uint64_t b = 0;
+
+  for (; len >= 2; len -= 2)
+    {
+      a = ((a << 5) | (a >> 59)) ^ p[0];
+      b = ((b << 5) | (b >> 59)) ^ p[1];
+      p += 2;
+    }
+  if (len)
+    a = ((a << 5) | (a >> 59)) ^ (p[0] | 0x100);
+
+  return ks_hash_mix (a, b);
+}
+
+/* Map the 32 bits value X on the range 0...N-1 without a division.  */
+static inline uint32_t
+ks_hash_range (uint32_t x, uint32_t n)
+{
+  return (uint32_t) (((uint64_t) x * n) >> 32);
+}
+
+/* The bucket of the hash H when there are NBUCKETS buckets.  */
+static inline uint32_t
+ks_hash_bucket (uint64_t h, uint32_t nbuckets)
+{
+  return ks_hash_range ((uint32_t) (h >> 32), nbuckets);
+}
+
+/* The slot of the hash H in a table of N entries, using the
+   displacement DISP of its bucket.  This is the "hash and displace"
+   scheme: makekeys searches a DISP for every bucket so that no two
+   names end up in the same slot.  */
+static inline uint32_t
+ks_hash_slot (uint64_t h, uint32_t disp, uint32_t n)
+{
+  return ks_hash_range (((uint32_t) h ^ disp) * 0x9e3779b1U, n);
+}
+
+/* A byte of the hash H that is stored for every slot, so most names
+   that are not in the table are rejected without comparing them.  It
+   is the lowest byte of the half that ks_hash_bucket reads, which has
+   little effect on the bucket it picks; ks_hash_slot only reads the
+   other half.  */
+static inline uint8_t
+ks_hash_check (uint64_t h)
+{
+  return (uint8_t) (h >> 32);
+}
+
+#endif /* _KSHASH_H_ */
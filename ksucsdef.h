@@ -1,5 +1,15 @@
 /* $XFree86: xc/lib/X11/imKStoUCS.c,v 1.4 2003/04/29 11:29:18 pascal Exp $ */
 
+/* The keysym to UCS-4 mapping of X, in ranges.  This is the only copy
+   of this data: makekeys expands it into the two level table in
+   ks_tables.h, which is what KeySymToUcs4 uses, and ksbench times the
+   original chain of range checks against that table.  Unicode keysyms
+   (0x01000000 and up) are not covered here, KeySymToUcs4 handles them
+   before it looks in the table.  */
+
+#ifndef _KSUCSDEF_H_
+#define _KSUCSDEF_H_ 1
+
 static unsigned short const keysym_to_unicode_1a1_1ff[] = {
             0x0104, 0x02d8, 0x0141, 0x0000, 0x013d, 0x015a, 0x0000, /* 0x01a0-0x01a7 */
     0x0000, 0x0160, 0x015e, 0x0164, 0x0179, 0x0000, 0x017d, 0x017b, /* 0x01a8-0x01af */
@@ -263,14 +273,10 @@ static unsigned short const keysym_to_unicode_20a0_20ac[] = {
     0x20a8, 0x20a9, 0x20aa, 0x20ab, 0x20ac                          /* 0x20a8-0x20af */
 };
 
-unsigned int
-KeySymToUcs4(int keysym)
+static unsigned int
+keysym_to_ucs4_ranges(int keysym)
 
 {
-    /* 'Unicode keysym' */
-    if ((keysym & 0xff000000) == 0x01000000)
-        return (keysym & 0x00ffffff);
-
     if (keysym > 0 && keysym < 0x100)
 	return keysym;
     else if (keysym > 0x1a0 && keysym < 0x200)
@@ -316,3 +322,5 @@ KeySymToUcs4(int keysym)
     else 
 	return 0;
 }
+
+#endif /* _KSUCSDEF_H_ */
@@ -0,0 +1,318 @@
+/*  makekeymap.c -- Compile the default keymap into C tables.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* Compile the default keymap of xkbdefaults.c the way the driver
+   compiles a keymap file and write the result to stdout as
+   keymap_tables.c.  The tables are initialized with the pointers
+   between them, so the driver uses them as its key table as they are:
+   nothing is read, parsed, allocated or relocated at run time.
+
+   Only the keytypes the keys use are written.  Actions are written as
+   the raw words of their data, like in the keymap cache, so the
+   tables must be generated on the machine the driver is built for.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xkb.h"
+
+extern char *default_xkb_keymap;
+
+/* The default keymap.  */
+static struct keymap keymap;
+
+/* The keytypes the keys use, in the order they are written.  */
+static struct keytype **kts;
+static int nkts;
+
+/* The parser reports its progress with this.  */
+int
+debug_printf (const char *f, ...)
+{
+  return 0;
+}
+
+/* Return the index of the keytype KT in KTS, or NKTS.  */
+static int
+keytype_index (struct keytype *kt)
+{
+  int i;
+
+  for (i = 0; i < nkts; i++)
+    if (kts[i] == kt)
+      break;
+  return i;
+}
+
+/* Collect the keytypes the keys use in KTS.  */
+static void
+collect_keytypes (void)
+{
+  keycode_t kc;
+  group_t group;
+
+  for (kc = 0; kc < keymap.max_keys; kc++)
+    for (group = 0; group < 4; group++)
+      {
+	struct keytype *kt = keymap.keys[kc].groups[group].keytype;
+
+	if (!kt || keytype_index (kt) < nkts)
+	  continue;
+	if (!(nkts & (nkts - 1)))
+	  {
+	    kts = realloc (kts, (nkts ? nkts * 2 : 1) * sizeof (*kts));
+	    if (!kts)
+	      {
+		fprintf (stderr, "makekeymap: out of memory\n");
+		exit (EXIT_FAILURE);
+	      }
+	  }
+	kts[nkts++] = kt;
+      }
+}
+
+/* Print the separator before the element N of a table, PERLINE
+   elements per line.  */
+static void
+print_sep (int n, int perline)
+{
+  printf (n % perline ? " " : "\n  ");
+}
+
+/* Print the symbols of all keys.  */
+static void
+print_symbols (void)
+{
+  keycode_t kc;
+  group_t group;
+  int level;
+  int n = 0;
+
+  printf ("static const symbol keymap_symbols[] = {");
+  for (kc = 0; kc < keymap.max_keys; kc++)
+    for (group = 0; group < 4; group++)
+      {
+	struct keygroup *kg = &keymap.keys[kc].groups[group];
+
+	if (!kg->symbols)
+	  continue;
+	for (level = 0; level < kg->width; level++, n++)
+	  {
+	    print_sep (n, 8);
+	    printf ("0x%x,", (unsigned int) kg->symbols[level]);
+	  }
+      }
+  /* An empty initializer is not valid C.  */
+  if (!n)
+    printf ("\n  0");
+  printf ("\n};\n\n");
+}
+
+/* Print the actions of all keys and the action slots that point to
+   them.  */
+static void
+print_actions (void)
+{
+  keycode_t kc;
+  group_t group;
+  int level;
+  int i;
+  int n = 0;
+
+  printf ("static const struct xkb_action keymap_actions[] = {");
+  for (kc = 0; kc < keymap.max_keys; kc++)
+    for (group = 0; group < 4; group++)
+      {
+	struct keygroup *kg = &keymap.keys[kc].groups[group];
+
+	if (!kg->actions)
+	  continue;
+	for (level = 0; level < kg->actionwidth; level++)
+	  {
+	    struct xkb_action *action = kg->actions[level];
+
+	    if (!action)
+	      continue;
+	    printf ("\n  { %d, {", action->type);
+	    for (i = 0; i < 15; i++)
+	      printf (" %d%s", action->data[i], i < 14 ? "," : "");
+	    printf (" } },");
+	    n++;
+	  }
+      }
+  if (!n)
+    printf ("\n  { 0 }");
+  printf ("\n};\n\n");
+
+  n = 0;
+  i = 0;
+  printf ("static struct xkb_action *const keymap_slots[] = {");
+  for (kc = 0; kc < keymap.max_keys; kc++)
+    for (group = 0; group < 4; group++)
+      {
+	struct keygroup *kg = &keymap.keys[kc].groups[group];
+
+	if (!kg->actions)
+	  continue;
+	for (level = 0; level < kg->actionwidth; level++, n++)
+	  {
+	    print_sep (n, 2);
+	    if (kg->actions[level])
+	      printf ("(struct xkb_action *) &keymap_actions[%d],", i++);
+	    else
+	      printf ("NULL,");
+	  }
+      }
+  if (!n)
+    printf ("\n  NULL");
+  printf ("\n};\n\n");
+}
+
+/* Print the keytypes the keys use and their maps.  */
+static void
+print_keytypes (void)
+{
+  struct typemap *map;
+  int n = 0;
+  int i;
+
+  printf ("static const struct typemap keymap_maps[] = {");
+  for (i = 0; i < nkts; i++)
+    for (map = kts[i]->maps; map; map = map->next, n++)
+      {
+	printf ("\n  { %d, { 0x%x, 0x%x }, { 0x%x, 0x%x }, ", map->level,
+		map->mods.rmods, map->mods.vmods, map->preserve.rmods,
+		map->preserve.vmods);
+	if (map->next)
+	  printf ("(struct typemap *) &keymap_maps[%d] },", n + 1);
+	else
+	  printf ("NULL },");
+      }
+  if (!n)
+    printf ("\n  { 0 }");
+  printf ("\n};\n\n");
+
+  n = 0;
+  printf ("static const struct keytype keymap_keytypes[] = {");
+  for (i = 0; i < nkts; i++)
+    {
+      struct keytype *kt = kts[i];
+
+      printf ("\n  { { 0x%x, 0x%x }, %d, ", kt->modmask.rmods,
+	      kt->modmask.vmods, kt->levels);
+      if (kt->maps)
+	printf ("(struct typemap *) &keymap_maps[%d], ", n);
+      else
+	printf ("NULL, ");
+      /* Keytype names are identifiers, they need no quoting.  */
+      if (kt->name)
+	printf ("\"%s\", NULL, NULL },", kt->name);
+      else
+	printf ("NULL, NULL, NULL },");
+
+      for (map = kt->maps; map; map = map->next)
+	n++;
+    }
+  if (!nkts)
+    printf ("\n  { { 0 } }");
+  printf ("\n};\n\n");
+}
+
+/* Print the key table, which points into the other tables.  */
+static void
+print_keys (void)
+{
+  keycode_t kc;
+  group_t group;
+  int nsymbols = 0;
+  int nslots = 0;
+
+  printf ("const struct key default_keys[] = {");
+  for (kc = 0; kc < keymap.max_keys; kc++)
+    {
+      struct key *key = &keymap.keys[kc];
+
+      printf ("\n  /* %d */\n  { 0x%x, {", kc, key->flags);
+      for (group = 0; group < 4; group++)
+	{
+	  struct keygroup *kg = &key->groups[group];
+
+	  printf ("\n      { ");
+	  if (kg->symbols)
+	    {
+	      printf ("(symbol *) &keymap_symbols[%d], ", nsymbols);
+	      nsymbols += kg->width;
+	    }
+	  else
+	    printf ("NULL, ");
+	  if (kg->actions)
+	    {
+	      printf ("(struct xkb_action **) &keymap_slots[%d], ", nslots);
+	      nslots += kg->actionwidth;
+	    }
+	  else
+	    printf ("NULL, ");
+	  if (kg->keytype)
+	    printf ("(struct keytype *) &keymap_keytypes[%d], ",
+		    keytype_index (kg->keytype));
+	  else
+	    printf ("NULL, ");
+	  printf ("%d, %d }%s", kg->width, kg->actionwidth,
+		  group < 3 ? "," : "");
+	}
+      printf (" },\n    %d, { 0x%x, 0x%x } },", key->numgroups,
+	      key->mods.rmods, key->mods.vmods);
+    }
+  if (!keymap.max_keys)
+    printf ("\n  { 0 }");
+  printf ("\n};\n\n");
+
+  printf ("const int default_min_keys = %d;\n", keymap.min_keys);
+  printf ("const int default_max_keys = %d;\n", keymap.max_keys);
+}
+
+int
+main (int argc, char *argv[])
+{
+  error_t err;
+
+  err = keymap_init (&keymap);
+  if (err)
+    {
+      fprintf (stderr, "makekeymap: %s\n", strerror (err));
+      return EXIT_FAILURE;
+    }
+
+  err = parse_xkbconfig_string (&keymap, default_xkb_keymap, "<<INTERNAL>>");
+  if (!err)
+    err = determine_keytypes (&keymap);
+  if (!err)
+    err = interpret_all (&keymap);
+  if (err)
+    {
+      fprintf (stderr, "makekeymap: can't compile the default keymap: %s\n",
+	       strerror (err));
+      return EXIT_FAILURE;
+    }
+  collect_keytypes ();
+
+  printf ("/* This file is generated from xkbdefaults.c by makekeymap. */\n");
+  printf ("/* Do not edit. */\n\n");
+  printf ("#include \"xkb.h\"\n\n");
+  print_symbols ();
+  print_actions ();
+  print_keytypes ();
+  print_keys ();
+
+  return 0;
+}
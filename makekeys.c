@@ -0,0 +1,787 @@
+/*  makekeys.c -- Generate the keysym tables in ks_tables.h.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* Read keysymdef.h from stdin and write ks_tables.h to stdout.  The
+   keysym to UCS-4 mapping is compiled in from ksucsdef.h, the keysym
+   classes are described in ksclass.h.
+
+   The name table is a minimal perfect hash: every keysym name has its
+   own slot in a table that is exactly as large as the amount of
+   names, so XStringToKeysym needs one hash and one strcmp for every
+   lookup.  The hash function itself lives in kshash.h.
+
+   The other tables map a keysym on its properties.  They are two level
+   tables: the high byte of the keysym selects a page, the low byte the
+   entry in that page, so every lookup costs two loads.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <locale.h>
+#include <wctype.h>
+
+#include "kshash.h"
+#include "ksucsdef.h"
+#include "ksclass.h"
+
+#define XK_MISCELLANY
+#define XK_XKB_KEYS
+#include "keysymdef.h"
+
+/* The maximum amount of keysyms that can be read.  */
+#define MAX_KEYSYMS	8192
+
+/* The average amount of names per bucket.  Smaller values make the
+   search for displacements faster but the table larger.  */
+#define NAMES_PER_BUCKET	4
+
+/* Give up when no displacement below this one places a bucket.  */
+#define MAX_DISPLACEMENT	(1 << 24)
+
+/* The name offset of keysyms without a name.  */
+#define KS_NONAME	0xffff
+
+/* A keysym read from keysymdef.h.  */
+struct keysym
+{
+  char *name;
+  /* Name of the keysym this one is an alias for, or NULL.  */
+  char *alias;
+  unsigned long value;
+  uint64_t hash;
+  /* Offset of the name in ks_names.  */
+  unsigned long offset;
+};
+
+static struct keysym keysyms[MAX_KEYSYMS];
+static int ksnum;
+
+/* Bucket numbers sorted on the amount of names in them, the largest
+   first.  */
+static int *bucket_order;
+static int *bucket_size;
+static uint32_t nbuckets;
+
+/* The keysyms of every bucket; those of bucket B start at
+   bucket_members[bucket_start[B]].  */
+static int *bucket_members;
+static int *bucket_start;
+
+/* The displacement of every bucket and the keysym in every slot.  */
+static uint32_t *displacements;
+static int *slots;
+
+/* Find the keysym with the name NAME.  */
+static struct keysym *
+keysym_find (const char *name)
+{
+  int i;
+
+  for (i = 0; i < ksnum; i++)
+    if (!strcmp (keysyms[i].name, name))
+      return &keysyms[i];
+  return NULL;
+}
+
+/* Read all keysyms defined in the file F.  */
+static void
+read_keysymdef (FILE *f)
+{
+  char line[1024];
+  int i;
+
+  while (fgets (line, sizeof (line), f))
+    {
+      char *p = line;
+      char *name;
+      char *value;
+
+      if (strncmp (p, "#define", 7))
+	continue;
+      p += 7;
+
+      while (isspace (*p))
+	p++;
+      if (strncmp (p, "XK_", 3))
+	continue;
+      name = p + 3;
+      while (*p && !isspace (*p))
+	p++;
+      if (!*p)
+	continue;
+      *p++ = '\0';
+
+      while (isspace (*p))
+	p++;
+      value = p;
+      while (*p && !isspace (*p))
+	p++;
+      *p = '\0';
+
+      if (ksnum == MAX_KEYSYMS)
+	{
+	  fprintf (stderr, "makekeys: too many keysyms\n");
+	  exit (EXIT_FAILURE);
+	}
+
+      keysyms[ksnum].name = strdup (name);
+      if (!strncmp (value, "XK_", 3))
+	keysyms[ksnum].alias = strdup (value + 3);
+      else
+	keysyms[ksnum].value = strtoul (value, NULL, 0);
+      keysyms[ksnum].hash = ks_hash (keysyms[ksnum].name);
+      ksnum++;
+    }
+
+  /* Resolve aliases like Oslash -> Ooblique.  */
+  for (i = 0; i < ksnum; i++)
+    if (keysyms[i].alias)
+      {
+	struct keysym *ks = keysym_find (keysyms[i].alias);
+
+	if (!ks || ks->alias)
+	  {
+	    fprintf (stderr, "makekeys: unknown keysym XK_%s\n",
+		     keysyms[i].alias);
+	    exit (EXIT_FAILURE);
+	  }
+	keysyms[i].value = ks->value;
+      }
+}
+
+static int
+bucket_cmp (const void *a, const void *b)
+{
+  return bucket_size[*(const int *) b] - bucket_size[*(const int *) a];
+}
+
+/* Try to place all names in the bucket BUCKET with the displacement
+   DISP.  Return 1 on success.  */
+static int
+try_displacement (int bucket, uint32_t disp)
+{
+  uint32_t placed[NAMES_PER_BUCKET * 8];
+  int *members = &bucket_members[bucket_start[bucket]];
+  int i, j;
+
+  for (i = 0; i < bucket_size[bucket]; i++)
+    {
+      uint32_t slot = ks_hash_slot (keysyms[members[i]].hash, disp, ksnum);
+
+      if (slots[slot] != -1)
+	return 0;
+      for (j = 0; j < i; j++)
+	if (placed[j] == slot)
+	  return 0;
+      placed[i] = slot;
+    }
+
+  for (i = 0; i < bucket_size[bucket]; i++)
+    slots[placed[i]] = members[i];
+
+  return 1;
+}
+
+/* Build the minimal perfect hash for all names.  */
+static void
+build_name_hash (void)
+{
+  int i;
+
+  nbuckets = (ksnum + NAMES_PER_BUCKET - 1) / NAMES_PER_BUCKET;
+  bucket_order = calloc (nbuckets, sizeof (int));
+  bucket_size = calloc (nbuckets, sizeof (int));
+  bucket_start = calloc (nbuckets, sizeof (int));
+  bucket_members = malloc (ksnum * sizeof (int));
+  displacements = calloc (nbuckets, sizeof (uint32_t));
+  slots = malloc (ksnum * sizeof (int));
+  if (!bucket_order || !bucket_size || !bucket_start || !bucket_members
+      || !displacements || !slots)
+    {
+      fprintf (stderr, "makekeys: out of memory\n");
+      exit (EXIT_FAILURE);
+    }
+
+  for (i = 0; i < ksnum; i++)
+    {
+      bucket_size[ks_hash_bucket (keysyms[i].hash, nbuckets)]++;
+      slots[i] = -1;
+    }
+  for (i = 0; i < (int) nbuckets; i++)
+    {
+      bucket_order[i] = i;
+      if (bucket_size[i] > NAMES_PER_BUCKET * 8)
+	{
+	  fprintf (stderr, "makekeys: bucket %d overflows\n", i);
+	  exit (EXIT_FAILURE);
+	}
+      if (i > 0)
+	bucket_start[i] = bucket_start[i - 1] + bucket_size[i - 1];
+    }
+
+  /* Sort the keysyms into their buckets.  */
+  {
+    int *fill = calloc (nbuckets, sizeof (int));
+
+    if (!fill)
+      {
+	fprintf (stderr, "makekeys: out of memory\n");
+	exit (EXIT_FAILURE);
+      }
+    for (i = 0; i < ksnum; i++)
+      {
+	uint32_t b = ks_hash_bucket (keysyms[i].hash, nbuckets);
+	bucket_members[bucket_start[b] + fill[b]++] = i;
+      }
+    free (fill);
+  }
+
+  /* Place the largest buckets first, while there is still room.  */
+  qsort (bucket_order, nbuckets, sizeof (int), bucket_cmp);
+
+  for (i = 0; i < (int) nbuckets; i++)
+    {
+      int bucket = bucket_order[i];
+      uint32_t disp;
+
+      if (!bucket_size[bucket])
+	break;
+
+      for (disp = 0; disp < MAX_DISPLACEMENT; disp++)
+	if (try_displacement (bucket, disp))
+	  break;
+
+      if (disp == MAX_DISPLACEMENT)
+	{
+	  fprintf (stderr, "makekeys: no displacement for bucket %d\n",
+		   bucket);
+	  exit (EXIT_FAILURE);
+	}
+      displacements[bucket] = disp;
+    }
+}
+
+/* Print the table of N elements VALUES, 8 per line.  */
+static void
+print_table (const char *decl, const unsigned long *values, int n,
+	     const char *fmt)
+{
+  int i;
+
+  printf ("%s = {", decl);
+  for (i = 0; i < n; i++)
+    {
+      printf (i % 8 ? " " : "\n");
+      printf (fmt, values[i]);
+      if (i != n - 1)
+	printf (",");
+    }
+  printf ("\n};\n\n");
+}
+
+/* Print the name table.  */
+static void
+print_names (void)
+{
+  unsigned long *offsets = malloc (ksnum * sizeof (unsigned long));
+  unsigned long *values = malloc (ksnum * sizeof (unsigned long));
+  unsigned long *checks = malloc (ksnum * sizeof (unsigned long));
+  unsigned long *disps = malloc (nbuckets * sizeof (unsigned long));
+  unsigned long offset = 0;
+  int i;
+
+  if (!offsets || !values || !checks || !disps)
+    {
+      fprintf (stderr, "makekeys: out of memory\n");
+      exit (EXIT_FAILURE);
+    }
+
+  printf ("#ifdef NEEDKTABLE\n");
+  printf ("#define KSNAMES\t\t%d\n", ksnum);
+  printf ("#define KSBUCKETS\t%u\n\n", nbuckets);
+
+  /* All names, in slot order.  */
+  printf ("static const char ks_names[] =");
+  for (i = 0; i < ksnum; i++)
+    {
+      struct keysym *ks = &keysyms[slots[i]];
+
+      printf ("\n\"%s\\0\"", ks->name);
+      ks->offset = offset;
+      offsets[i] = offset;
+      values[i] = ks->value;
+      checks[i] = ks_hash_check (ks->hash);
+      offset += strlen (ks->name) + 1;
+    }
+  printf (";\n\n");
+
+  if (offset >= KS_NONAME)
+    {
+      fprintf (stderr, "makekeys: name table too large\n");
+      exit (EXIT_FAILURE);
+    }
+
+  for (i = 0; i < (int) nbuckets; i++)
+    disps[i] = displacements[i];
+
+  print_table ("static const unsigned short ks_name_offsets[KSNAMES]",
+	       offsets, ksnum, "0x%04lx");
+  print_table ("static const unsigned int ks_name_values[KSNAMES]",
+	       values, ksnum, "0x%06lx");
+  print_table ("static const unsigned char ks_name_checks[KSNAMES]",
+	       checks, ksnum, "0x%02lx");
+  print_table ("static const unsigned int ks_displacements[KSBUCKETS]",
+	       disps, nbuckets, "0x%08lx");
+  printf ("#endif /* NEEDKTABLE */\n");
+
+  free (offsets);
+  free (values);
+  free (checks);
+  free (disps);
+}
+
+/* Print VALUES, a value for every keysym from 0 to 0xffff, as a
+   two level table.  NAME_pages maps the high byte of a keysym on a
+   page of NAME, which is indexed with the low byte.  Page 0 holds only
+   EMPTY, and pages that are equal are only printed once.  */
+static void
+print_pages (const char *name, const char *type, const unsigned long *values,
+	     unsigned long empty, const char *fmt)
+{
+  unsigned long index[256];
+  int pages[256];
+  int npages = 1;
+  int hi, lo, i;
+
+  pages[0] = -1;
+  for (hi = 0; hi < 256; hi++)
+    {
+      const unsigned long *page = &values[hi << 8];
+
+      for (lo = 0; lo < 256; lo++)
+	if (page[lo] != empty)
+	  break;
+      if (lo == 256)
+	{
+	  index[hi] = 0;
+	  continue;
+	}
+
+      for (i = 1; i < npages; i++)
+	if (!memcmp (&values[pages[i] << 8], page, 256 * sizeof (*page)))
+	  break;
+      if (i == npages)
+	pages[npages++] = hi;
+      index[hi] = i;
+    }
+
+  printf ("#define %s_PAGES\t%d\n\n", name, npages);
+
+  {
+    char decl[256];
+
+    snprintf (decl, sizeof (decl), "static const unsigned char %s_pages[256]",
+	      name);
+    print_table (decl, index, 256, "%3lu");
+  }
+
+  printf ("static const %s %s[%d][256] = {\n", type, name, npages);
+  for (i = 0; i < npages; i++)
+    {
+      printf ("/* Page %d", i);
+      if (pages[i] >= 0)
+	printf (", keysyms 0x%02x00-0x%02xff", pages[i], pages[i]);
+      printf (".  */\n{");
+      for (lo = 0; lo < 256; lo++)
+	{
+	  printf (lo % 8 ? " " : "\n");
+	  printf (fmt, pages[i] >= 0 ? values[(pages[i] << 8) + lo] : empty);
+	  if (lo != 255)
+	    printf (",");
+	}
+      printf ("\n}%s\n", i != npages - 1 ? "," : "");
+    }
+  printf ("};\n\n");
+}
+
+/* Print the table that maps keysyms on the offset of their name.  */
+static void
+print_values (void)
+{
+  static unsigned long names[0x10000];
+  int i;
+
+  for (i = 0; i < 0x10000; i++)
+    names[i] = KS_NONAME;
+
+  /* Keysyms with more names get the first one in keysymdef.h, just
+     like XKeysymToString.  */
+  for (i = 0; i < ksnum; i++)
+    if (keysyms[i].value < 0x10000 && names[keysyms[i].value] == KS_NONAME)
+      names[keysyms[i].value] = keysyms[i].offset;
+
+  printf ("#ifdef NEEDVTABLE\n");
+  printf ("/* The name table, ks_names, is in the NEEDKTABLE part.  */\n");
+  printf ("#define KS_NONAME\t0x%04x\n", KS_NONAME);
+  print_pages ("ks_value_names", "unsigned short", names, KS_NONAME,
+	       "0x%04lx");
+  printf ("#endif /* NEEDVTABLE */\n");
+}
+
+/* Print the table that maps keysyms on UCS-4, and the table that maps
+   UCS-4 back on keysyms.  */
+static void
+print_ucs (void)
+{
+  static unsigned long ucs[0x10000];
+  static unsigned long keysym[0x10000];
+  int i;
+
+  for (i = 0; i < 0x10000; i++)
+    ucs[i] = keysym_to_ucs4_ranges (i);
+
+  /* When more keysyms have the same character, the lowest one is
+     used.  */
+  for (i = 0xffff; i > 0; i--)
+    if (ucs[i])
+      keysym[ucs[i]] = i;
+
+  printf ("#ifdef NEEDUCSTABLE\n");
+  print_pages ("ks_ucs", "unsigned short", ucs, 0, "0x%04lx");
+  print_pages ("ks_from_ucs", "unsigned short", keysym, 0, "0x%04lx");
+  printf ("#endif /* NEEDUCSTABLE */\n");
+}
+
+/* Print the tables that map keysyms on their lowercase and uppercase
+   keysym, like XConvertCase.  The case pairs are found through UCS-4:
+   two keysyms are a pair when their characters are each other's
+   towlower and towupper.  Characters like U+00B5 MICRO SIGN, whose
+   uppercase letter maps back on another lowercase letter, are left
+   alone.  A keysym without a pair is 0 in both tables.  */
+static void
+print_case (void)
+{
+  static unsigned long ucs[0x10000];
+  static unsigned long keysym_of[0x10000];
+  static unsigned long lower[0x10000];
+  static unsigned long upper[0x10000];
+  int i;
+
+  /* The case mapping of the C library is only used here, so the
+     tables don't depend on the locale the driver runs in.  */
+  if (!setlocale (LC_CTYPE, "C.UTF-8")
+      && !setlocale (LC_CTYPE, "en_US.UTF-8"))
+    {
+      fprintf (stderr, "makekeys: no UTF-8 locale for the case tables\n");
+      exit (EXIT_FAILURE);
+    }
+
+  /* When more keysyms have the same character, the lowest one is used
+     as its case partner.  */
+  for (i = 0xffff; i > 0; i--)
+    {
+      ucs[i] = keysym_to_ucs4_ranges (i);
+      if (ucs[i])
+	keysym_of[ucs[i]] = i;
+    }
+
+  for (i = 1; i < 0x10000; i++)
+    {
+      wint_t c = ucs[i];
+      wint_t l = towlower (c);
+      wint_t u = towupper (c);
+
+      if (!c)
+	continue;
+      if (l != c && l < 0x10000 && towupper (l) == c && keysym_of[l])
+	{
+	  lower[i] = keysym_of[l];
+	  upper[i] = i;
+	}
+      else if (u != c && u < 0x10000 && towlower (u) == c && keysym_of[u])
+	{
+	  lower[i] = i;
+	  upper[i] = keysym_of[u];
+	}
+    }
+
+  printf ("#ifdef NEEDCASETABLE\n");
+  print_pages ("ks_lower", "unsigned short", lower, 0, "0x%04lx");
+  print_pages ("ks_upper", "unsigned short", upper, 0, "0x%04lx");
+  printf ("#endif /* NEEDCASETABLE */\n");
+}
+
+/* The keysyms that are sent to the console as a console key.  */
+static const struct
+{
+  unsigned long keysym;
+  enum ks_conskey conskey;
+} conskeys[] =
+  {
+    { XK_Up, KS_CONS_UP }, { XK_KP_Up, KS_CONS_UP },
+    { XK_Down, KS_CONS_DOWN }, { XK_KP_Down, KS_CONS_DOWN },
+    { XK_Left, KS_CONS_LEFT }, { XK_KP_Left, KS_CONS_LEFT },
+    { XK_Right, KS_CONS_RIGHT }, { XK_KP_Right, KS_CONS_RIGHT },
+    { XK_BackSpace, KS_CONS_BACKSPACE },
+    { XK_KP_F1, KS_CONS_F1 }, { XK_KP_F2, KS_CONS_F2 },
+    { XK_KP_F3, KS_CONS_F3 }, { XK_KP_F4, KS_CONS_F4 },
+    { XK_Home, KS_CONS_HOME }, { XK_KP_Home, KS_CONS_HOME },
+    { XK_Insert, KS_CONS_INSERT }, { XK_KP_Insert, KS_CONS_INSERT },
+    { XK_Delete, KS_CONS_DELETE }, { XK_KP_Delete, KS_CONS_DELETE },
+    { XK_End, KS_CONS_END }, { XK_KP_End, KS_CONS_END },
+    { XK_Page_Up, KS_CONS_PAGE_UP }, { XK_KP_Page_Up, KS_CONS_PAGE_UP },
+    { XK_Page_Down, KS_CONS_PAGE_DOWN },
+    { XK_KP_Page_Down, KS_CONS_PAGE_DOWN },
+    { XK_KP_Begin, KS_CONS_BEGIN },
+    { XK_ISO_Left_Tab, KS_CONS_BACKTAB },
+    { XK_Return, KS_CONS_RETURN }, { XK_KP_Enter, KS_CONS_RETURN },
+    { XK_Tab, KS_CONS_TAB }, { XK_KP_Tab, KS_CONS_TAB },
+    { XK_Escape, KS_CONS_ESCAPE }
+  };
+
+/* Return the KS_* flags of the keysym KS.  These are the tests of
+   Xutil.h, except for KS_TEXT.  */
+static unsigned long
+keysym_flags (unsigned long ks)
+{
+  unsigned long flags = 0;
+
+  if (keysym_to_ucs4_ranges (ks))
+    flags |= KS_TEXT;
+
+  if (ks >= XK_KP_Space && ks <= XK_KP_Equal)
+    {
+      flags |= KS_KEYPAD;
+      /* These are their ASCII character with the high bits set.  */
+      if ((ks >= XK_KP_Multiply && ks <= XK_KP_Equal) || ks == XK_KP_Enter)
+	flags |= KS_TEXT;
+    }
+
+  if ((ks >= XK_F1 && ks <= XK_F35) || (ks >= XK_KP_F1 && ks <= XK_KP_F4))
+    flags |= KS_FUNCTION;
+
+  if ((ks >= XK_Home && ks < XK_Select)
+      || (ks >= XK_KP_Home && ks <= XK_KP_Begin))
+    flags |= KS_CURSOR;
+
+  if ((ks >= XK_Shift_L && ks <= XK_Hyper_R)
+      || (ks >= XK_ISO_Lock && ks <= XK_ISO_Last_Group_Lock)
+      || ks == XK_Mode_switch || ks == XK_Num_Lock)
+    flags |= KS_MODIFIER;
+
+  if (ks >= XK_dead_grave && ks <= XK_dead_horn)
+    flags |= KS_DEAD;
+
+  return flags;
+}
+
+/* Print the table with the class of every keysym.  */
+static void
+print_class (void)
+{
+  static unsigned long class[0x10000];
+  unsigned int i;
+
+  for (i = 0; i < 0x10000; i++)
+    class[i] = keysym_flags (i);
+
+  for (i = 0; i < 20; i++)
+    class[XK_F1 + i] |= (KS_CONS_F1 + i) << 8;
+  for (i = 0; i < sizeof (conskeys) / sizeof (conskeys[0]); i++)
+    class[conskeys[i].keysym] |= conskeys[i].conskey << 8;
+
+  printf ("#ifdef NEEDCLASSTABLE\n");
+  print_pages ("ks_class", "unsigned short", class, 0, "0x%04lx");
+  printf ("#endif /* NEEDCLASSTABLE */\n");
+}
+
+/* The dead keys, the suffix of the names of the letters they make and
+   the keysym they make by themselves, after a space or the same dead
+   key.  Aacute is dead_acute followed by A.  Suffixes that end with
+   another suffix come first.  */
+static const struct
+{
+  const char *dead;
+  const char *suffix;
+  const char *spacing;
+} deadkeys[] =
+  {
+    { "dead_doubleacute", "doubleacute", "doubleacute" },
+    { "dead_grave", "grave", "grave" },
+    { "dead_acute", "acute", "acute" },
+    { "dead_acute", "accent", NULL },
+    { "dead_circumflex", "circumflex", "asciicircum" },
+    { "dead_tilde", "tilde", "asciitilde" },
+    { "dead_macron", "macron", "macron" },
+    { "dead_breve", "breve", "breve" },
+    { "dead_abovedot", "abovedot", "abovedot" },
+    { "dead_diaeresis", "diaeresis", "diaeresis" },
+    { "dead_diaeresis", "dieresis", NULL },
+    { "dead_abovering", "ring", "degree" },
+    { "dead_caron", "caron", "caron" },
+    { "dead_cedilla", "cedilla", "cedilla" },
+    { "dead_ogonek", "ogonek", "ogonek" },
+    { "dead_belowdot", "belowdot", NULL },
+    { "dead_hook", "hook", NULL },
+    { "dead_horn", "horn", NULL }
+  };
+
+#define NDEADKEYS	(sizeof (deadkeys) / sizeof (deadkeys[0]))
+
+/* Letters whose name only looks like a letter with an accent.  */
+static const char *const unaccented[] = { "THORN", "thorn" };
+
+/* Return the index in deadkeys of the suffix NAME ends with, or -1.  */
+static int
+dead_suffix (const char *name)
+{
+  size_t len = strlen (name);
+  unsigned int i;
+
+  for (i = 0; i < NDEADKEYS; i++)
+    {
+      size_t slen = strlen (deadkeys[i].suffix);
+
+      if (len > slen && !strcmp (name + len - slen, deadkeys[i].suffix))
+	return i;
+    }
+  return -1;
+}
+
+/* Print the sequences of a dead key and a letter.  They are found
+   through the names of the keysyms: a letter with a suffix of
+   deadkeys is the dead key followed by the letter without the suffix,
+   if that is a keysym too.  Letters with two accents, like Abreveacute,
+   are left to the Compose file.  */
+static void
+print_dead (void)
+{
+  static unsigned long seen[0x10000];
+  struct keysym *space;
+  unsigned long *values = malloc (3 * (ksnum + NDEADKEYS * 2)
+				  * sizeof (unsigned long));
+  int n = 0;
+  unsigned int j;
+  int i;
+
+  if (!values)
+    {
+      fprintf (stderr, "makekeys: out of memory\n");
+      exit (EXIT_FAILURE);
+    }
+
+  for (i = 0; i < ksnum; i++)
+    {
+      int d = dead_suffix (keysyms[i].name);
+      struct keysym *dead;
+      struct keysym *base;
+      char *name;
+
+      if (d < 0 || keysyms[i].value >= 0x10000)
+	continue;
+      for (j = 0; j < sizeof (unaccented) / sizeof (unaccented[0]); j++)
+	if (!strcmp (keysyms[i].name, unaccented[j]))
+	  break;
+      if (j < sizeof (unaccented) / sizeof (unaccented[0]))
+	continue;
+      name = strdup (keysyms[i].name);
+      name[strlen (name) - strlen (deadkeys[d].suffix)] = '\0';
+      base = keysym_find (name);
+      free (name);
+      dead = keysym_find (deadkeys[d].dead);
+      if (!base || !dead || base->value >= 0x10000
+	  || dead_suffix (base->name) >= 0
+	  || !(keysym_flags (base->value) & KS_TEXT))
+	continue;
+
+      /* The first keysym with a name is used, not its aliases.  */
+      if (seen[base->value] & (1UL << (dead->value - XK_dead_grave)))
+	continue;
+      seen[base->value] |= 1UL << (dead->value - XK_dead_grave);
+
+      values[n++] = dead->value;
+      values[n++] = base->value;
+      values[n++] = keysyms[i].value;
+    }
+
+  space = keysym_find ("space");
+  if (!space)
+    {
+      fprintf (stderr, "makekeys: unknown keysym XK_space\n");
+      exit (EXIT_FAILURE);
+    }
+  for (i = 0; i < (int) NDEADKEYS; i++)
+    {
+      struct keysym *dead = keysym_find (deadkeys[i].dead);
+      struct keysym *spacing;
+
+      if (!deadkeys[i].spacing)
+	continue;
+      spacing = keysym_find (deadkeys[i].spacing);
+      if (!dead || !spacing)
+	{
+	  fprintf (stderr, "makekeys: unknown keysym XK_%s\n",
+		   dead ? deadkeys[i].spacing : deadkeys[i].dead);
+	  exit (EXIT_FAILURE);
+	}
+
+      values[n++] = dead->value;
+      values[n++] = space->value;
+      values[n++] = spacing->value;
+      values[n++] = dead->value;
+      values[n++] = dead->value;
+      values[n++] = spacing->value;
+    }
+
+  printf ("#ifdef NEEDDEADTABLE\n");
+  printf ("/* Every entry is a dead key, the keysym that follows it and the "
+	  "keysym\n   they make.  */\n");
+  printf ("#define KSDEAD\t\t%d\n\n", n / 3);
+  printf ("static const unsigned short ks_dead[KSDEAD][3] = {");
+  for (i = 0; i < n; i += 3)
+    printf ("\n{ 0x%04lx, 0x%04lx, 0x%04lx }%s", values[i], values[i + 1],
+	    values[i + 2], i + 3 < n ? "," : "");
+  printf ("\n};\n\n");
+  printf ("#endif /* NEEDDEADTABLE */\n");
+
+  free (values);
+}
+
+int
+main (int argc, char *argv[])
+{
+  read_keysymdef (stdin);
+  if (ksnum == 0)
+    {
+      fprintf (stderr, "makekeys: no keysyms found\n");
+      return EXIT_FAILURE;
+    }
+
+  build_name_hash ();
+
+  printf ("/* This file is generated from keysymdef.h by makekeys. */\n");
+  printf ("/* Do not edit. */\n\n");
+  print_names ();
+  printf ("\n");
+  print_values ();
+  printf ("\n");
+  print_ucs ();
+  printf ("\n");
+  print_case ();
+  printf ("\n");
+  print_class ();
+  printf ("\n");
+  print_dead ();
+
+  return 0;
+}
@@ -19,81 +19,63 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
+#include <fcntl.h>
 #include "xkb.h"
 
-void yyerror(char *);
-int yylex (void);
-static error_t include_section (char *incl, int sectionsymbol, char *dirname,
-				mergemode);
-static error_t include_sections (char *incl, int sectionsymbol, char *dirname,
-				 mergemode);
-void close_include ();
-static void skipsection (void);
-static error_t set_default_action (struct xkb_action *, struct xkb_action **);
-static void key_set_keysym (struct key *key, group_t group, int level,
-			    symbol ks);
-static void key_new (char *keyname);
-static void key_delete (char *keyname);
-void scanner_unput (int c);
+void yyerror (struct parser *parser, const char *s);
+static error_t include_section (struct parser *parser, char *incl,
+				int sectionsymbol, char *dirname, mergemode);
+static error_t include_sections (struct parser *parser, char *incl,
+				 int sectionsymbol, char *dirname, mergemode);
+int close_include (struct parser *parser);
+error_t include_file (struct parser *parser, const char *data, size_t len,
+		      int line, mergemode new_mm, char *fname);
+error_t scanner_open (struct parser *parser, const char *data, size_t len,
+		      int line, char *fname);
+void scanner_close (struct parser *parser);
+void scanner_skip_section (struct parser *parser);
+static error_t set_default_action (struct parser *parser, actiontype_t type);
+static struct xkb_action *new_action (struct parser *parser,
+				      actiontype_t type);
+static error_t key_set_keysym (struct keymap *km, struct key *key,
+			       group_t group, int level, symbol ks);
+static void key_new (struct parser *parser, char *keyname);
+static void key_delete (struct parser *parser, char *keyname);
 static void remove_symbols (struct key *key, group_t group);
 
-struct xkb_interpret *current_interpretation;
-struct xkb_action *current_action;
-struct xkb_indicator indi;
-struct xkb_indicator *current_indicator = &indi;
-struct key defkey;
-struct key *default_key = &defkey;
-
-/* The default settings for actions.  */
-struct xkb_action default_setmods = { SA_SetMods };
-struct xkb_action default_lockmods = { SA_LockMods };
-struct xkb_action default_latchmods = { SA_LatchMods };
-struct xkb_action default_setgroup = { SA_SetGroup };
-struct xkb_action default_latchgroup = { SA_LatchGroup };
-struct xkb_action default_lockgroup = { SA_LockGroup };
-struct xkb_action default_moveptr = { SA_MovePtr };
-struct xkb_action default_ptrbtn = { SA_PtrBtn };
-struct xkb_action default_lockptrbtn = { SA_LockPtrBtn };
-struct xkb_action default_ptrdflt = { SA_SetPtrDflt };
-struct xkb_action default_setcontrols = { SA_SetControls };
-struct xkb_action default_lockcontrols = { SA_LockControls };
-struct xkb_action default_isolock = { SA_ISOLock };
-struct xkb_action default_switchscrn = { SA_SwitchScreen };
-struct xkb_action default_consscroll = { SA_ConsScroll };
-
-static struct key *current_key;
-
-/* The dummy gets used when the original may not be overwritten.  */
-static struct key dummy_key;
-
-/* The current parsed group.  */
-static int current_group;
-static int current_rmod = 0;
-
-/* The current symbol in the currently parsed key.  */
-static int symbolcnt;
-static int actioncnt;
-
-mergemode merge_mode = override;
-
 //#define	YYDEBUG	1
 
 #ifndef YY_NULL
 #define YY_NULL 0
 #endif
-
-static struct keytype *current_keytype;
 %}
 
+/* All state is kept in PARSER, so keymaps can be compiled on several
+   threads at once.  */
+%define api.pure full
+%parse-param {struct parser *parser}
+%lex-param {struct parser *parser}
+
 %union {
   int val;
   char *str;
+  /* Identifiers are not terminated, they point into the scanned
+     file.  */
+  struct
+  {
+    const char *name;
+    size_t len;
+  } ident;
   modmap_t modmap;
   struct xkb_action *action;
   double dbl;
   mergemode mergemode;
 }
 
+%code {
+static int yylex (YYSTYPE *lvalp, struct parser *parser);
+}
+
 %token XKBKEYMAP	"xkb_keymap"
 %token XKBKEYCODES	"xkb_keycodes"
 %token XKBCOMPAT	"xkb_compatibility"
@@ -202,7 +184,8 @@ static struct keytype *current_keytype;
 %token PERCENT		"percent"
 %token CONSSCROLL	"consscroll"
 %token FLOAT		"float"
-%type <str> STR KEYCODE IDENTIFIER
+%type <str> STR KEYCODE
+%type <ident> IDENTIFIER
 %type <val> FLAGS NUM HEX vmod level LEVEL rmod BOOLEAN symbol INTERPMATCH
 %type <val> clearlocks usemodmap latchtolock noaccel button BUTTONNUM
 %type <val> ctrlflags allowexplicit driveskbd
@@ -255,8 +238,8 @@ keycodes:
 
 /* Process the includes on the stack.  */
 keycodesinclude:
-  '{' keycodesect '}'			 { close_include () }
-| keycodesinclude '{' keycodesect '}'	 { close_include () }
+  '{' keycodesect '}'			 { close_include (parser) }
+| keycodesinclude '{' keycodesect '}'	 { close_include (parser) }
 ;
 
 /* The first lines of a keycode section. The amount of keycodes are
@@ -265,38 +248,44 @@ keycodesect:
 /* empty */
 | "minimum" '=' NUM ';' keycodesect
    { 
-     min_keys = $3;
+     parser->keymap->min_keys = $3;
      debug_printf("working on key: %d\n", $3);
-     current_key = &keys[$3];
+     parser->current_key = &parser->keymap->keys[$3];
    }
 | MAXIMUM '=' NUM ';' keycodesect 
    { 
-     max_keys = $3;
-     keys = calloc ($3, sizeof (struct key));
+     parser->keymap->max_keys = $3;
+     parser->keymap->keys = arena_calloc (&parser->keymap->arena, $3,
+					  sizeof (struct key));
+     if (!parser->keymap->keys)
+       {
+	 parser->err = ENOMEM;
+	 YYABORT;
+       }
    }
 | KEYCODE '=' NUM ';'
-   { keyname_add ($1, $3); }
+   { keyname_add (parser->keymap, $1, $3); }
   keycodesect	
 | "replace" KEYCODE '=' NUM ';'
-   { keyname_add ($2, $4); }
+   { keyname_add (parser->keymap, $2, $4); }
   keycodesect
 | "indicator" NUM '=' STR ';' keycodesect {  }
 | "virtual" INDICATOR NUM '=' STR ';' keycodesect
 | "alias" KEYCODE '=' KEYCODE ';'
    { 
-     keycode_t key = keyname_find ($4);
+     keycode_t key = keyname_find (parser->keymap, $4);
      if (key)
-       keyname_add ($2, key);
+       keyname_add (parser->keymap, $2, key);
      else
        {
-	 key = keyname_find ($2);
+	 key = keyname_find (parser->keymap, $2);
 	 if (key)
-	   keyname_add ($4, key);
+	   keyname_add (parser->keymap, $4, key);
        }
    }
   keycodesect
 | include STR 
-   { include_sections ($2, XKBKEYCODES, "keycodes", $1); }
+   { if (include_sections (parser, $2, XKBKEYCODES, "keycodes", $1)) YYABORT; }
   keycodesinclude keycodesect
 ;
 
@@ -309,8 +298,8 @@ types:
 /* A list of virtual modifier declarations (see vmods_def), seperated 
    by commas.  */
 vmodslist:
-  IDENTIFIER { vmod_add ($1); }
-| vmodslist ',' IDENTIFIER { vmod_add ($3) }
+  IDENTIFIER { vmod_add (parser->keymap, $1.name, $1.len); }
+| vmodslist ',' IDENTIFIER { vmod_add (parser->keymap, $3.name, $3.len) }
 ;
 
 /* Virtual modifiers must be declared before they can be used.  */
@@ -321,10 +310,11 @@ vmods_def:
 /* Return the number of the virtual modifier.  */
 vmod:
 	IDENTIFIER
-	{ if (($$ = vmod_find ($1)) != 0)
+	{ if (($$ = vmod_find (parser->keymap, $1.name, $1.len)) != 0)
 	    $$ = 1 << ($$ - 1);
 	  else
-	    fprintf(stderr, "warning: %s virtual modifier is not defined.", $1);
+	    fprintf(stderr, "warning: %.*s virtual modifier is not defined.",
+		    (int) $1.len, $1.name);
 	}
 ;
 
@@ -364,27 +354,37 @@ level:
 type:
 	/* Empty */
 | type MODS '=' mods ';'
-   { current_keytype->modmask = $4 }
+   { parser->current_keytype->modmask = $4 }
 | type MAP '[' mods ']' '=' level ';' 	     
-   { keytype_mapadd (current_keytype, $4, $7) }
+   {
+     if ((parser->err = keytype_mapadd (parser->keymap,
+					parser->current_keytype, $4, $7)))
+       YYABORT;
+   }
 | type "level_name" '[' level ']' '=' STR ';'
 | type "preserve" '[' mods ']' '=' mods ';'    
-   { keytype_preserve_add (current_keytype, $4, $7) }
+   {
+     if ((parser->err = keytype_preserve_add (parser->keymap,
+					      parser->current_keytype,
+					      $4, $7)))
+       YYABORT;
+   }
 ;
 
 /* Process the includes on the stack.  */
 typesinclude:
-  '{' typessect '}'			 { close_include () }
-| typesinclude '{' typessect '}'	 { close_include () }
+  '{' typessect '}'			 { close_include (parser) }
+| typesinclude '{' typessect '}'	 { close_include (parser) }
 ;
 
 /* A keytype section contains keytypes and virtual modifier declarations.  */
 typessect:
 	/* Empty */
 | typessect vmods_def
-| typessect TYPE STR { keytype_new ($3, &current_keytype) }'{' type '}' ';' { }
+| typessect TYPE STR { keytype_new (parser->keymap, $3, parser->merge_mode,
+				   &parser->current_keytype) }'{' type '}' ';' { }
 | typessect include STR 
-   { include_sections ($3, XKBTYPES, "types", $2) }
+   { if (include_sections (parser, $3, XKBTYPES, "types", $2)) YYABORT; }
   typesinclude
 ;
 
@@ -396,9 +396,9 @@ compat:
 
 /* XXX: A symbol can be more than just an identifier (hex).  */
 symbol:
-  IDENTIFIER		{ $$ = (int) XStringToKeysym ( $1) ? : -1;  }
+  IDENTIFIER		{ $$ = (int) XStringToKeysymLen ($1.name, $1.len) ? : -1;  }
 | ANY 			{ $$ = 0  }
-| error 		{ yyerror ("Invalid symbol.") }
+| error 		{ yyerror (parser, "Invalid symbol.") }
 ;
 
 /* Which kinds of modifiers (like base, locked, etc.) can affect the
@@ -424,11 +424,11 @@ indicators:
 
 /* An indicator desciption.  */
 indicator:
-  "mods" '=' mods ';' { current_indicator->modmap = $3 }
-| "groups" '=' groups ';' { current_indicator->groups = $3 }
+  "mods" '=' mods ';' { parser->indicator.modmap = $3 }
+| "groups" '=' groups ';' { parser->indicator.groups = $3 }
 | "controls" '=' ctrls ';'
-| "whichmodstate" '=' whichstate ';' { current_indicator->which_mods = $3 }
-| "whichgroupstate" '=' whichstate ';' { current_indicator->which_mods = $3 }
+| "whichmodstate" '=' whichstate ';' { parser->indicator.which_mods = $3 }
+| "whichgroupstate" '=' whichstate ';' { parser->indicator.which_mods = $3 }
 | allowexplicit ';' {} /* Ignored for now.  */
 | driveskbd ';' {}
 | "index" '=' NUM ';' {}
@@ -458,25 +458,25 @@ interprets:
 /* A single interpretation.  */
 interpret:
   "usemodmap" '=' level ';'
-	{ current_interpretation->match &= 0x7F | ($3 << 7) } /* XXX */
+	{ parser->current_interpretation->match &= 0x7F | ($3 << 7) } /* XXX */
 | repeat ';'
   {
-    current_interpretation->flags &= ~(KEYREPEAT | KEYNOREPEAT);
-    current_interpretation->flags |= $1;
+    parser->current_interpretation->flags &= ~(KEYREPEAT | KEYNOREPEAT);
+    parser->current_interpretation->flags |= $1;
   }
 | locking ';' {}
-| "virtualmod" '=' vmod ';' 	{ current_interpretation->vmod = $3 }
+| "virtualmod" '=' vmod ';' 	{ parser->current_interpretation->vmod = $3 }
 | "action" '=' action ';' 	
    { 
-     memcpy (&current_interpretation->action, $3, sizeof (xkb_action_t));
-     free ($3);
+     memcpy (&parser->current_interpretation->action, $3,
+	     sizeof (xkb_action_t));
    }
 ;
 
 /* Process the includes on the stack.  */
 compatinclude:
-  '{' compatsect '}'			 { close_include () }
-| compatinclude '{' compatsect '}'	 { close_include () }
+  '{' compatsect '}'			 { close_include (parser) }
+| compatinclude '{' compatsect '}'	 { close_include (parser) }
 ;
 
 /* The body of a compatibility section.  */
@@ -484,14 +484,14 @@ compatsect:
 	/* Empty */
 | compatsect vmods_def
 | compatsect "interpret" '.' 
-   { current_interpretation = &default_interpretation }
+   { parser->current_interpretation = &parser->keymap->default_interpretation }
   interpret
 | compatsect "interpret" symbol 
 	{ 
 	  if ($3 != -1)
 	    {
-	      interpret_new (&current_interpretation, $3);
-	      current_interpretation->match |= 1;
+	      interpret_new (parser->keymap, &parser->current_interpretation, $3);
+	      parser->current_interpretation->match |= 1;
 	    }
 	}
   '{' interprets '}' ';'
@@ -499,9 +499,9 @@ compatsect:
 	{
 	  if ($3 != -1)
 	    {
-	      interpret_new (&current_interpretation, $3);
-	      current_interpretation->rmods = $5;
-	      current_interpretation->match |= 4;
+	      interpret_new (parser->keymap, &parser->current_interpretation, $3);
+	      parser->current_interpretation->rmods = $5;
+	      parser->current_interpretation->match |= 4;
 	    }
 	}
   '{' interprets '}' ';'
@@ -509,9 +509,9 @@ compatsect:
 	{
 	  if ($3 != -1)
 	    {
-	      interpret_new (&current_interpretation, $3);
-	      current_interpretation->rmods = 255;
-	      current_interpretation->match |= 2;
+	      interpret_new (parser->keymap, &parser->current_interpretation, $3);
+	      parser->current_interpretation->rmods = 255;
+	      parser->current_interpretation->match |= 2;
 	    }
 	}
   '{' interprets '}' ';'
@@ -519,16 +519,16 @@ compatsect:
         {
 	  if ($3 != -1)
 	    {
-	      interpret_new (&current_interpretation, $3);
-	      current_interpretation->rmods = $7.rmods;
-	      current_interpretation->match |= $5;
+	      interpret_new (parser->keymap, &parser->current_interpretation, $3);
+	      parser->current_interpretation->rmods = $7.rmods;
+	      parser->current_interpretation->match |= $5;
 	    }
 	}
   '{' interprets '}' ';'
 | compatsect GROUP NUM '=' mods ';'
 | compatsect "indicator" STR '{' indicators '}' ';'
 | compatsect include STR
-   { include_sections ($3, XKBCOMPAT, "compat", $2) }
+   { if (include_sections (parser, $3, XKBCOMPAT, "compat", $2)) YYABORT; }
   compatinclude
 | compatsect actiondef
 | compatsect "indicator" '.' indicator
@@ -625,25 +625,25 @@ setmodsparams:
 setmodsparam:
   "mods" '=' mods		
   { 
-    ((action_setmods_t *) current_action)->modmap = $3;
+    ((action_setmods_t *) parser->current_action)->modmap = $3;
   }    
 | "mods" '=' "usemodmap"
-  { ((action_setmods_t *) current_action)->flags |= useModMap;
+  { ((action_setmods_t *) parser->current_action)->flags |= useModMap;
  }
 | clearlocks
   {
-    ((action_setmods_t *) current_action)->flags &= ~clearLocks;
-    ((action_setmods_t *) current_action)->flags |= $1;
+    ((action_setmods_t *) parser->current_action)->flags &= ~clearLocks;
+    ((action_setmods_t *) parser->current_action)->flags |= $1;
   }
 | usemodmap
   { 
-    ((action_setmods_t *) current_action)->flags &= ~useModMap;
-    ((action_setmods_t *) current_action)->flags |= $1;
+    ((action_setmods_t *) parser->current_action)->flags &= ~useModMap;
+    ((action_setmods_t *) parser->current_action)->flags |= $1;
   }
 | latchtolock
   { 
-    ((action_setmods_t *) current_action)->flags &= ~latchToLock;
-    ((action_setmods_t *) current_action)->flags |= $1;
+    ((action_setmods_t *) parser->current_action)->flags &= ~latchToLock;
+    ((action_setmods_t *) parser->current_action)->flags |= $1;
   }
 ;
 
@@ -657,24 +657,24 @@ setgroupparams:
 setgroupparam:
   "group" '=' NUM
    {
-     ((action_setgroup_t *) current_action)->group = $3;
-     ((action_setgroup_t *) current_action)->flags |= groupAbsolute;
+     ((action_setgroup_t *) parser->current_action)->group = $3;
+     ((action_setgroup_t *) parser->current_action)->flags |= groupAbsolute;
    }
 | "group" '=' '+' NUM
    {
-     ((action_setgroup_t *) current_action)->group = $4;
+     ((action_setgroup_t *) parser->current_action)->group = $4;
    }
 | "group" '=' '-' NUM
    {
-     ((action_setgroup_t *) current_action)->group = -$4;
+     ((action_setgroup_t *) parser->current_action)->group = -$4;
    }
 | clearlocks
    {
-     ((action_setgroup_t *) current_action)->flags |= $1;
+     ((action_setgroup_t *) parser->current_action)->flags |= $1;
    }
 | latchtolock
    {
-     ((action_setgroup_t *) current_action)->flags |= $1;
+     ((action_setgroup_t *) parser->current_action)->flags |= $1;
    }
 ;
 
@@ -688,20 +688,20 @@ moveptrparams:
 moveptrparam:
   IDENTIFIER '=' NUM
    {
-     ((action_moveptr_t *) current_action)->x = $3;
-     ((action_setgroup_t *) current_action)->flags |= MoveAbsoluteX;
+     ((action_moveptr_t *) parser->current_action)->x = $3;
+     ((action_setgroup_t *) parser->current_action)->flags |= MoveAbsoluteX;
    }
 | IDENTIFIER '=' '+' NUM
    {
-     ((action_moveptr_t *) current_action)->x = $4;
+     ((action_moveptr_t *) parser->current_action)->x = $4;
    }
 | IDENTIFIER '=' '-' NUM
    {
-     ((action_moveptr_t *) current_action)->x = -$4;
+     ((action_moveptr_t *) parser->current_action)->x = -$4;
    }
 | noaccel
    {
-     ((action_moveptr_t *) current_action)->flags |= NoAcceleration;
+     ((action_moveptr_t *) parser->current_action)->flags |= NoAcceleration;
    }
 ;
 
@@ -728,9 +728,9 @@ ptrbtnparams:
 /* Parameters for the (Set|Lock|Latch)PtrBtn action.  */
 ptrbtnparam:
   "button" '=' button
-   { ((action_ptrbtn_t *) current_action)->button = $3; }
+   { ((action_ptrbtn_t *) parser->current_action)->button = $3; }
 | "count" '=' NUM
-   { ((action_ptrbtn_t *) current_action)->count = $3;  }
+   { ((action_ptrbtn_t *) parser->current_action)->count = $3;  }
 | "affect" '=' affectbtnlock
    {
      //     ((action_ptrbtn_t *) $$)->a = $3;
@@ -811,22 +811,22 @@ switchscrnparams:
 switchscrnparam:
   "screen" '=' NUM
    {
-     ((action_switchscrn_t *) current_action)->screen = $3;
-     ((action_switchscrn_t *) current_action)->flags |= screenAbs;
+     ((action_switchscrn_t *) parser->current_action)->screen = $3;
+     ((action_switchscrn_t *) parser->current_action)->flags |= screenAbs;
    }
 | "screen" '+' '=' NUM
    {
-     ((action_switchscrn_t *) current_action)->screen = $4;
+     ((action_switchscrn_t *) parser->current_action)->screen = $4;
    }
 | "screen" '-' '=' NUM
    {
-     ((action_switchscrn_t *) current_action)->screen = -$4;
+     ((action_switchscrn_t *) parser->current_action)->screen = -$4;
    }
 | sameserver
    {
      /* XXX: Implement this.  */
-/*      ((action_switchscrn_t *) current_action)->flags &= ~0; */
-/*      ((action_switchscrn_t *) current_action)->flags |= $1; */
+/*      ((action_switchscrn_t *) parser->current_action)->flags &= ~0; */
+/*      ((action_switchscrn_t *) parser->current_action)->flags |= $1; */
    }
 ;  
 
@@ -839,29 +839,32 @@ consscrollparams:
 consscrollparam:
   "screen" '+' '=' FLOAT
    {
-     ((action_consscroll_t *) current_action)->screen = $4;
+     ((action_consscroll_t *) parser->current_action)->screen = $4;
    }
 | "screen" '-' '=' FLOAT
    {
-     ((action_consscroll_t *) current_action)->screen = -$4;
+     ((action_consscroll_t *) parser->current_action)->screen = -$4;
    }
 | "line" '=' NUM
    {
-     ((action_consscroll_t *) current_action)->line = $3;
-     ((action_consscroll_t *) current_action)->flags |= lineAbs;
+     ((action_consscroll_t *) parser->current_action)->line = $3;
+     ((action_consscroll_t *) parser->current_action)->flags |= lineAbs;
    }
 | "line" '+' '=' NUM
    {
-     ((action_consscroll_t *) current_action)->line = $4;
+     ((action_consscroll_t *) parser->current_action)->line = $4;
    }
 | "line" '-' '=' NUM
    {
-     ((action_consscroll_t *) current_action)->line = -$4;
+     ((action_consscroll_t *) parser->current_action)->line = -$4;
    }
 | "percent" '=' NUM
    {
-     ((action_consscroll_t *) current_action)->percent = $3;
-     ((action_consscroll_t *) current_action)->flags |= usePercentage;     
+     action_consscroll_t *action;
+
+     action = (action_consscroll_t *) parser->current_action;
+     action->percent = $3;
+     action->flags |= usePercentage;
    }
 ;
 
@@ -884,119 +887,159 @@ privateparam:
 action:
   "setmods" 
    { 
-     if (set_default_action (&default_setmods, &current_action))
+     if (set_default_action (parser, SA_SetMods))
        YYABORT;
    }
-  '(' setmodsparams ')'		{ $$ = current_action }
+  '(' setmodsparams ')'		{ $$ = parser->current_action }
 | "latchmods" 
    { 
-     if (set_default_action (&default_latchmods, &current_action))
+     if (set_default_action (parser, SA_LatchMods))
        YYABORT;
    }
-  '(' setmodsparams ')' 	{ $$ = current_action }
+  '(' setmodsparams ')' 	{ $$ = parser->current_action }
 | "lockmods"
    {
-     if (set_default_action (&default_lockmods, &current_action))
+     if (set_default_action (parser, SA_LockMods))
        YYABORT;
    }
-  '(' setmodsparams ')' 	{ $$ = current_action }
+  '(' setmodsparams ')' 	{ $$ = parser->current_action }
 | "setgroup"
    {
-     if (set_default_action (&default_setgroup, &current_action))
+     if (set_default_action (parser, SA_SetGroup))
        YYABORT;
    }
-  '(' setgroupparams ')' 	{ $$ = current_action }
+  '(' setgroupparams ')' 	{ $$ = parser->current_action }
 | "latchgroup" 
    { 
-     if (set_default_action (&default_latchgroup, &current_action))
+     if (set_default_action (parser, SA_LatchGroup))
        YYABORT;
    }
-  '(' setgroupparams ')' 	{ $$ = current_action }
+  '(' setgroupparams ')' 	{ $$ = parser->current_action }
 | "lockgroup"
    {
-     if (set_default_action (&default_lockgroup, &current_action))
+     if (set_default_action (parser, SA_LockGroup))
        YYABORT;
    }
-     '(' setgroupparams ')' 	{ $$ = current_action }
+     '(' setgroupparams ')' 	{ $$ = parser->current_action }
 | "moveptr"
    { 
-     if (set_default_action (&default_moveptr, &current_action))
+     if (set_default_action (parser, SA_MovePtr))
        YYABORT;
    }
-  '(' moveptrparams ')' 	{ $$ = current_action }
+  '(' moveptrparams ')' 	{ $$ = parser->current_action }
 | "ptrbtn"
    {
-     if (set_default_action (&default_ptrbtn, &current_action))
+     if (set_default_action (parser, SA_PtrBtn))
        YYABORT;
    }
-  '(' ptrbtnparams ')' 		{ $$ = current_action }
+  '(' ptrbtnparams ')' 		{ $$ = parser->current_action }
 | "lockptrbtn"
    {
-     if (set_default_action (&default_lockptrbtn, &current_action))
+     if (set_default_action (parser, SA_LockPtrBtn))
        YYABORT;
    }
-  '(' ptrbtnparams ')' 		{ $$ = current_action }
+  '(' ptrbtnparams ')' 		{ $$ = parser->current_action }
 | "setptrdflt"
    {
-     if (set_default_action (&default_ptrdflt, &current_action))
+     if (set_default_action (parser, SA_SetPtrDflt))
        YYABORT;
    }
-  '(' ptrdfltparams ')'	 	{ $$ = current_action }
+  '(' ptrdfltparams ')'	 	{ $$ = parser->current_action }
 | "setcontrols"
    {
-     if (set_default_action (&default_setcontrols, &current_action))
+     if (set_default_action (parser, SA_SetControls))
        YYABORT;
    }
-  '(' ctrlparams ')'	 	{ $$ = current_action }
+  '(' ctrlparams ')'	 	{ $$ = parser->current_action }
 | "lockcontrols"
    { 
-     if (set_default_action (&default_lockcontrols, &current_action))
+     if (set_default_action (parser, SA_LockControls))
        YYABORT;
    }
-  '(' ctrlparams ')'	 	{ $$ = current_action }
+  '(' ctrlparams ')'	 	{ $$ = parser->current_action }
 | "terminate" '(' ')'
-   { $$ = calloc (1, sizeof (xkb_action_t)); $$->type = SA_TerminateServer }
+   {
+     $$ = new_action (parser, SA_TerminateServer);
+     if (!$$)
+       YYABORT;
+   }
 | "switchscreen"
    {
-     if (set_default_action (&default_switchscrn, &current_action))
+     if (set_default_action (parser, SA_SwitchScreen))
        YYABORT;
    }
-'(' switchscrnparams ')' 	{ $$ = current_action }
+'(' switchscrnparams ')' 	{ $$ = parser->current_action }
 | "consscroll"
    { 
-     if (set_default_action (&default_consscroll, &current_action))
+     if (set_default_action (parser, SA_ConsScroll))
        YYABORT;
    }
-   '(' consscrollparams ')' 	{ $$ = current_action }
+   '(' consscrollparams ')' 	{ $$ = parser->current_action }
 | "isolock"
   {
-    if (set_default_action (&default_isolock, &current_action))
+    if (set_default_action (parser, SA_ISOLock))
       YYABORT;
   }
-  '(' isolockparams ')'	 	{ $$ = current_action }
+  '(' isolockparams ')'	 	{ $$ = parser->current_action }
 | "private" '(' privateparams ')'
-  { $$ = calloc (1, sizeof (xkb_action_t)); $$->type = SA_NoAction }
+  {
+    $$ = new_action (parser, SA_NoAction);
+    if (!$$)
+      YYABORT;
+  }
 | "noaction" '(' ')'
-  { $$ = calloc (1, sizeof (xkb_action_t)); $$->type = SA_NoAction }
-| error ')'	{ yyerror ("Invalid action\n") }
+  {
+    $$ = new_action (parser, SA_NoAction);
+    if (!$$)
+      YYABORT;
+  }
+| error ')'	{ yyerror (parser, "Invalid action\n") }
 ;
 
 /* Define values for default actions.  */
 actiondef:
-  "setmods"      '.' { current_action = &default_setmods   } setmodsparam ';'
-| "latchmods"    '.' { current_action = &default_latchmods } setmodsparam ';'
-| "lockmods"     '.' { current_action = &default_lockmods } setmodsparam ';'
-| "setgroup"     '.' { current_action = &default_setgroup } setgroupparam ';'
-| "latchgroup"   '.' { current_action = &default_latchgroup } setgroupparam ';'
-| "lockgroup"    '.' { current_action = &default_lockgroup } setgroupparam ';'
-| "moveptr"      '.' { current_action = &default_moveptr } moveptrparam ';'
-| "ptrbtn"       '.' { current_action = &default_ptrbtn } ptrbtnparam ';'
-| "lockptrbtn"   '.' { current_action = &default_lockptrbtn } ptrbtnparam ';'
-| "setptrdflt"   '.' { current_action = &default_ptrdflt } ptrdfltparam ';'
-| "setcontrols"  '.' { current_action = &default_setcontrols } ctrlparams ';'
-| "lockcontrols" '.' { current_action = &default_lockcontrols } ctrlparams ';'
-| "isolock"      '.' { current_action = &default_isolock } isolockparam ';'
-| "switchscreen" '.' { current_action = &default_switchscrn } switchscrnparam ';'
+  "setmods" '.'
+   { parser->current_action = &parser->default_actions[SA_SetMods]; }
+  setmodsparam ';'
+| "latchmods" '.'
+   { parser->current_action = &parser->default_actions[SA_LatchMods]; }
+  setmodsparam ';'
+| "lockmods" '.'
+   { parser->current_action = &parser->default_actions[SA_LockMods]; }
+  setmodsparam ';'
+| "setgroup" '.'
+   { parser->current_action = &parser->default_actions[SA_SetGroup]; }
+  setgroupparam ';'
+| "latchgroup" '.'
+   { parser->current_action = &parser->default_actions[SA_LatchGroup]; }
+  setgroupparam ';'
+| "lockgroup" '.'
+   { parser->current_action = &parser->default_actions[SA_LockGroup]; }
+  setgroupparam ';'
+| "moveptr" '.'
+   { parser->current_action = &parser->default_actions[SA_MovePtr]; }
+  moveptrparam ';'
+| "ptrbtn" '.'
+   { parser->current_action = &parser->default_actions[SA_PtrBtn]; }
+  ptrbtnparam ';'
+| "lockptrbtn" '.'
+   { parser->current_action = &parser->default_actions[SA_LockPtrBtn]; }
+  ptrbtnparam ';'
+| "setptrdflt" '.'
+   { parser->current_action = &parser->default_actions[SA_SetPtrDflt]; }
+  ptrdfltparam ';'
+| "setcontrols" '.'
+   { parser->current_action = &parser->default_actions[SA_SetControls]; }
+  ctrlparams ';'
+| "lockcontrols" '.'
+   { parser->current_action = &parser->default_actions[SA_LockControls]; }
+  ctrlparams ';'
+| "isolock" '.'
+   { parser->current_action = &parser->default_actions[SA_ISOLock]; }
+  isolockparam ';'
+| "switchscreen" '.'
+   { parser->current_action = &parser->default_actions[SA_SwitchScreen]; }
+  switchscrnparam ';'
 ;
 
 /* The header of a symbols section.  */
@@ -1014,16 +1057,20 @@ group:
 
 /* A list of keysyms and keycodes bound to a realmodifier.  */
 key_list:
-  key_list ',' KEYCODE		{ set_rmod_keycode ($3, current_rmod) }
-| key_list ',' symbolname 	{ ksrm_add ($3, current_rmod)  }
-| KEYCODE 			{ set_rmod_keycode ($1, current_rmod) }
-| symbolname    		{ ksrm_add ($1, current_rmod)  }
+  key_list ',' KEYCODE
+   { set_rmod_keycode (parser->keymap, $3, parser->current_rmod) }
+| key_list ',' symbolname
+   { ksrm_add (parser->keymap, $3, parser->current_rmod) }
+| KEYCODE
+   { set_rmod_keycode (parser->keymap, $1, parser->current_rmod) }
+| symbolname
+   { ksrm_add (parser->keymap, $1, parser->current_rmod) }
 ;
 
 /* Process the includes on the stack.  */
 symbolinclude:
-  '{' symbolssect '}'			 { close_include () }
-| symbolinclude '{' symbolssect '}'	 { close_include () }
+  '{' symbolssect '}'			 { close_include (parser) }
+| symbolinclude '{' symbolssect '}'	 { close_include (parser) }
 ;
 
 /* A XKB symbol section. It is used to bind keysymbols, actions and
@@ -1034,33 +1081,38 @@ symbolssect:
 | symbolssect NAME '[' group ']' '=' STR ';'
 | symbolssect "key" KEYCODE 
   { 
-    key_new ($3);
-    current_group = 0;
+    key_new (parser, $3);
+    parser->current_group = 0;
   } '{' keydescs '}' ';'
 | symbolssect "replace" "key" KEYCODE 
   { 
-    key_delete ($4);
-    key_new ($4);
-    current_group = 0;
+    key_delete (parser, $4);
+    key_new (parser, $4);
+    parser->current_group = 0;
   } '{' keydescs '}' ';'
 | symbolssect "override" "key" KEYCODE 
   { 
-    key_delete ($4);
-    key_new ($4);
-    current_group = 0;
+    key_delete (parser, $4);
+    key_new (parser, $4);
+    parser->current_group = 0;
   } '{' keydescs '}' ';'
-| symbolssect "modifier_map" rmod { current_rmod = $3 } '{' key_list '}' ';'
+| symbolssect "modifier_map" rmod { parser->current_rmod = $3 }
+  '{' key_list '}' ';'
 | symbolssect include STR
-   { include_sections ($3, XKBSYMBOLS, "symbols", $2) }
+   { if (include_sections (parser, $3, XKBSYMBOLS, "symbols", $2)) YYABORT; }
   symbolinclude
 | symbolssect actiondef
-| symbolssect "key" '.' {debug_printf("working on default key.\n"); current_key = default_key } keydesc ';'
-| symbolssect error ';' { yyerror ("Error in symbol section\n") }
+| symbolssect "key" '.'
+  {
+    debug_printf("working on default key.\n");
+    parser->current_key = &parser->default_key;
+  } keydesc ';'
+| symbolssect error ';' { yyerror (parser, "Error in symbol section\n") }
 ;
 
 /* Returns a keysymbols, the numberic representation.  */
 symbolname:
-  IDENTIFIER { $$ = XStringToKeysym ($1); }
+  IDENTIFIER { $$ = XStringToKeysymLen ($1.name, $1.len); }
 | NUM { $$ = $1 + '0' }
 ;
 
@@ -1069,20 +1121,38 @@ symbolname:
 groupsyms:
 	/* empty */
 | groupsyms ',' symbolname  
-   { key_set_keysym (current_key, current_group, symbolcnt++, $3) }
-| { symbolcnt = 0 } symbolname
+   {
+     if ((parser->err = key_set_keysym (parser->keymap, parser->current_key,
+					parser->current_group,
+					parser->symbolcnt++, $3)))
+       YYABORT;
+   }
+| { parser->symbolcnt = 0 } symbolname
    { 
-     symbolcnt = 0;
-     key_set_keysym (current_key, current_group, symbolcnt++, $2);
+     parser->symbolcnt = 0;
+     if ((parser->err = key_set_keysym (parser->keymap, parser->current_key,
+					parser->current_group,
+					parser->symbolcnt++, $2)))
+       YYABORT;
    }
 ;
 
 /* A list of actions.  */
 actions:
   actions ',' action
-   { key_set_action (current_key, current_group, actioncnt++, $3) }
-|  { actioncnt = 0 } action
-   { key_set_action ( current_key, current_group, actioncnt++, $2) }
+   {
+     if ((parser->err = key_set_action (parser->keymap, parser->current_key,
+					parser->current_group,
+					parser->actioncnt++, $3)))
+       YYABORT;
+   }
+|  { parser->actioncnt = 0 } action
+   {
+     if ((parser->err = key_set_action (parser->keymap, parser->current_key,
+					parser->current_group,
+					parser->actioncnt++, $2)))
+       YYABORT;
+   }
 ;
 
 keydescs:
@@ -1094,34 +1164,48 @@ keydescs:
 keydesc:
   "type" '[' group ']' '=' STR 
    {
-     current_key->groups[$3].keytype = keytype_find ($6);
+     parser->current_key->groups[$3].keytype = keytype_find (parser->keymap,
+							      $6);
    }
-| "type" '[' error ']' 	{ yyerror ("Invalid group.\n") }
+| "type" '[' error ']' 	{ yyerror (parser, "Invalid group.\n") }
 | "type" '=' STR
-   { current_key->groups[current_group].keytype = keytype_find ($3) }
-| { symbolcnt = 0 } "symbols" '[' group ']' { current_group = $4 } '=' '[' groupsyms ']'
    {
-     current_key->numgroups = ($4 + 1) > current_key->numgroups ?
-       ($4 + 1) : current_key->numgroups;
+     struct key *key = parser->current_key;
+
+     key->groups[parser->current_group].keytype = keytype_find (parser->keymap,
+								 $3);
    }
-| {actioncnt = 0 } "actions" '[' group ']' { current_group = $4 } '=' '[' actions ']' 
+| { parser->symbolcnt = 0 } "symbols" '[' group ']'
+  { parser->current_group = $4 } '=' '[' groupsyms ']'
    {
-     current_key->numgroups = ($4 + 1) > current_key->numgroups ?
-       ($4 + 1) : current_key->numgroups;   
+     struct key *key = parser->current_key;
+
+     key->numgroups = ($4 + 1) > key->numgroups ? ($4 + 1) : key->numgroups;
+   }
+| { parser->actioncnt = 0 } "actions" '[' group ']'
+  { parser->current_group = $4 } '=' '[' actions ']'
+   {
+     struct key *key = parser->current_key;
+
+     key->numgroups = ($4 + 1) > key->numgroups ? ($4 + 1) : key->numgroups;
    }
 | "virtualmods" '=' mods
-   { current_key->mods.vmods = $3.vmods }
+   { parser->current_key->mods.vmods = $3.vmods }
 | '[' groupsyms ']'
   {
-     current_group++;
-     current_key->numgroups = current_group > current_key->numgroups ? 
-       current_group : current_key->numgroups;   
+     struct key *key = parser->current_key;
+
+     parser->current_group++;
+     key->numgroups = parser->current_group > key->numgroups ?
+       parser->current_group : key->numgroups;
   }
 | '[' actions ']' 
    {
-     current_group++;
-     current_key->numgroups = current_group > current_key->numgroups ?
-       current_group : current_key->numgroups;   
+     struct key *key = parser->current_key;
+
+     parser->current_group++;
+     key->numgroups = parser->current_group > key->numgroups ?
+       parser->current_group : key->numgroups;
    }
 | locking {}/* This is not implemented - YET.  */
 /* XXX: There 3 features are described in Ivan Pascals docs about XKB,
@@ -1133,8 +1217,8 @@ keydesc:
 | "overlay" '=' KEYCODE  /* If you _REALLY_ need overlays, mail me!!!!  */
 | repeat  
   {
-    current_key->flags &= ~(KEYREPEAT | KEYNOREPEAT);
-    current_key->flags |= $1;
+    parser->current_key->flags &= ~(KEYREPEAT | KEYNOREPEAT);
+    parser->current_key->flags |= $1;
   }
 ;
 
@@ -1142,57 +1226,18 @@ keydesc:
 
 /* The header of a geometry section.  */
 geometry:
-  flags "xkb_geometry" '{' { skipsection () } '}' ';'
-| flags "xkb_geometry" STR '{' { skipsection () } '}' ';'
+  flags "xkb_geometry" '{' { scanner_skip_section (parser) } '}' ';'
+| flags "xkb_geometry" STR '{' { scanner_skip_section (parser) } '}' ';'
 ;
 
 %%
-/* Skip all tokens until a section of the type SECTIONSYMBOL with the
-   name SECTIONNAME is found.  */
-static int
-skip_to_sectionname (char *sectionname, int sectionsymbol)
-{
-  int symbol;
-
-  do 
-    {
-      do 
-	{
-	  symbol = yylex ();
-	} while ((symbol != YY_NULL) && (symbol != sectionsymbol));
-
-      if (symbol != YY_NULL)
-        symbol = yylex ();
-
-      if (symbol == YY_NULL) {
-        return 1;
-      } else if (symbol != STR)
-	continue;
-
-    } while (strcmp (yylval.str, sectionname));
-    return 0;
-}
+int scanner_lex (YYSTYPE *lvalp, void *scanner);
 
-/* Skip all tokens until the default section is found.  */
+/* Get the next token from the scanner of PARSER.  */
 static int
-skip_to_defaultsection (void)
+yylex (YYSTYPE *lvalp, struct parser *parser)
 {
-  int symbol;
-
-  /* Search the default section.  */
-  do
-    {
-      if ((symbol = yylex ()) == YY_NULL)
-          return 1;
-    } while (symbol != DEFAULT);
-
-  do
-    {
-      if ((symbol = yylex ()) == YY_NULL)
-          return 1;
-    } while (symbol != '{');
-  scanner_unput ('{');
-  return 0;
+  return scanner_lex (lvalp, parser->scanner);
 }
 
 /* Include a single file. INCL is the filename. SECTIONSYMBOL is the
@@ -1200,20 +1245,16 @@ skip_to_defaultsection (void)
    of the directory from where the includefiles must be loaded. NEW_MM
    is the mergemode that should be used.  */
 static error_t
-include_section (char *incl, int sectionsymbol, char *dirname,
-		 mergemode new_mm)
+include_section (struct parser *parser, char *incl, int sectionsymbol,
+		 char *dirname, mergemode new_mm)
 {
-  void include_file (FILE *, mergemode, char *);
-  int scanner_get_current_location ();
-  const char* scanner_get_current_file ();
-
   char *filename;
   char *sectionname = NULL;
-  FILE *includefile;
+  struct keymap_file *file;
+  struct keymap_section *section;
+  error_t err;
+
 
-  int current_location = scanner_get_current_location();
-  char* current_file = strdup(scanner_get_current_file());
-  
   sectionname = strchr (incl, '(');
   if (sectionname)
     {
@@ -1235,54 +1276,51 @@ include_section (char *incl, int sectionsymbol, char *dirname,
 	return ENOMEM;
     }
 
-  includefile = fopen (strdup (filename), "r");
-  
-  if (includefile == NULL)
+  err = keymap_file_load (parser, filename, &file);
+  if (err)
     {
       fprintf (stderr, "Couldn't open include file \"%s\"\n", filename);
-      exit (EXIT_FAILURE);
+      free (filename);
+      return err;
     }
-  
-  include_file (includefile, new_mm, strdup (filename));
-  debug_printf("skipping to section %s\n", (sectionname ? sectionname : "default"));
-  /* If there is a sectionname not the entire file should be included,
-     the scanner should be positioned at the required section.  */
-  int err;
-  if (sectionname)
-      err = skip_to_sectionname (sectionname, sectionsymbol);
-  else
-      err = skip_to_defaultsection ();
+  free (filename);
 
-  if (err != 0) {
+  debug_printf("looking up section %s\n", (sectionname ? sectionname : "default"));
+  /* If there is a sectionname not the entire file should be included,
+     only that section is scanned.  */
+  section = keymap_file_section (file, sectionsymbol, sectionname);
+  if (!section) {
      char* tmpbuf = malloc(sizeof(char)*1024);
      if (tmpbuf) {
          snprintf(tmpbuf, 1023, "cannot find section %s in file %s included from %s:%d.\n"
              , (sectionname ? sectionname : "DEFAULT")
-             , filename, current_file, current_location);
-	 yyerror(tmpbuf);
+             , file->path, parser->filename, parser->lineno);
+	 yyerror(parser, tmpbuf);
 	 free(tmpbuf);
      }
-     free(current_file);
-     exit(err);
+     return EINVAL;
   }
-  free(current_file);
-  return 0;
+
+  return include_file (parser, file->data + section->start,
+		       section->end - section->start, section->line, new_mm,
+		       file->path);
 }
 
 /* Include multiple file sections, seperated by '+'. INCL is the
    include string. SECTIONSYMBOL is the token that marks the beginning
    of the section. DIRNAME is the name of the directory from where the
    includefiles must be loaded. NEW_MM is the mergemode that should be
-   used.  */
+   used.  The error is also stored in PARSER, the parser stops.  */
 static error_t
-include_sections (char *incl, int sectionsymbol, char *dirname,
-		  mergemode new_mm)
+include_sections (struct parser *parser, char *incl, int sectionsymbol,
+		  char *dirname, mergemode new_mm)
 {
   char *curstr;
   char *s;
+  error_t err = 0;
 
   if (new_mm == defaultmm)
-    new_mm = merge_mode;
+    new_mm = parser->merge_mode;
 
 /*   printf ("dir: %s - include: %s: %d\n", dirname, incl, new_mm); */
   /* Cut of all includes, starting with the first.  The includes are
@@ -1296,84 +1334,93 @@ include_sections (char *incl, int sectionsymbol, char *dirname,
 
 	s = strdup (curstr);
 	if (s == NULL)
-	  return ENOMEM;
+	  return parser->err = ENOMEM;
 	
-	include_section (s, sectionsymbol, dirname, new_mm);
+	err = include_section (parser, s, sectionsymbol, dirname, new_mm);
 	free (s);
       }
-  } while (curstr);
+  } while (curstr && !err);
   
-  s = strdup (incl);
-  if (s == NULL)
-      return ENOMEM;
-  
-  include_section (s, sectionsymbol, dirname, new_mm);
-  free (s);
-
-  return 0;
-}
-
-/* Skip all tokens until the end of the section is reached.  */
-static void
-skipsection (void)
-{
-  /* Pathesensis counter.  */
-  int p = 0;
-  while (p >= 0)
+  if (!err)
     {
-      int symbol = yylex ();
-      if (symbol == '{')
-	p++;
-      if (symbol == '}')
-	p--;
+      s = strdup (incl);
+      if (s == NULL)
+	return parser->err = ENOMEM;
+
+      err = include_section (parser, s, sectionsymbol, dirname, new_mm);
+      free (s);
     }
-  scanner_unput ('}');
+
+  parser->err = err;
+  return err;
 }
 
-/* Initialize the default action with the default DEF.  */
+/* Make a new action of the type TYPE with the default settings for it
+   the current action of PARSER.  */
 static error_t
-set_default_action (struct xkb_action *def, 
-		    struct xkb_action **newact)
+set_default_action (struct parser *parser, actiontype_t type)
 {
   struct xkb_action *newaction;
-  newaction = malloc (sizeof (struct xkb_action));
+  newaction = arena_alloc (&parser->keymap->arena,
+			   sizeof (struct xkb_action));
   if (newaction == NULL)
-    return ENOMEM;
-  memcpy (newaction, def, sizeof (struct xkb_action));  
+    return parser->err = ENOMEM;
+  memcpy (newaction, &parser->default_actions[type],
+	  sizeof (struct xkb_action));
   
-  *newact = newaction;
+  parser->current_action = newaction;
   
   return 0;
 }
 
-/* Remove all keysyms bound to the group GROUP or the key KEY.  */
+/* Return a new action of the type TYPE without settings, or NULL when
+   memory runs out.  */
+static struct xkb_action *
+new_action (struct parser *parser, actiontype_t type)
+{
+  struct xkb_action *action;
+
+  action = arena_calloc (&parser->keymap->arena, 1,
+			 sizeof (struct xkb_action));
+  if (!action)
+    {
+      parser->err = ENOMEM;
+      return NULL;
+    }
+  action->type = type;
+  return action;
+}
+
+/* Remove all keysyms bound to the group GROUP or the key KEY.  Their
+   memory belongs to the keymap.  */
 static void
 remove_symbols (struct key *key, group_t group)
 {
   //  printf ("rem: group: %d\n", group);
   if (key->groups[group].symbols)
     {
-      free (key->groups[group].symbols);
       key->groups[group].symbols = NULL;
       key->groups[group].width = 0;
     }
 }
 
-/* Set the keysym KS for key KEY on group GROUP and level LEVEL.  */
-static void
-key_set_keysym (struct key *key, group_t group, int level, symbol ks)
+/* Set the keysym KS for key KEY of KM on group GROUP and level
+   LEVEL.  */
+static error_t
+key_set_keysym (struct keymap *km, struct key *key, group_t group,
+		int level, symbol ks)
 {
   symbol *keysyms = key->groups[group].symbols;
+  int width = key->groups[group].width;
 
-  if ((level + 1) > key->groups[group].width)
+  if ((level + 1) > width)
     {
-      keysyms = realloc (keysyms, level + 1);
-
-      if (!keys)
-	{
-	  fprintf (stderr, "No mem\n");
-	  exit (EXIT_FAILURE);
-	}
+      /* The symbols of a key are set one after the other, so they
+	 usually grow in place.  */
+      keysyms = arena_realloc (&km->arena, keysyms, width * sizeof (symbol),
+			       (level + 1) * sizeof (symbol));
+      if (!keysyms)
+	return ENOMEM;
 	 
       key->groups[group].symbols = keysyms;
       key->groups[group].width++;
@@ -1381,58 +1428,62 @@ key_set_keysym (struct key *key, group_t group, int level, symbol ks)
   else
     /* For NoSymbol leave the old symbol intact.  */
     if (!ks) {
-      debug_printf("symbol %d was not added to key.", ks);
-      return;
+      debug_printf("symbol %s was not added to key.", KEYSYM_NAME (ks));
+      return 0;
     }
 
-  debug_printf("symbol '%c'(%d) added to key for group %d and level %d.\n", ks, ks, group, level);
+  debug_printf("symbol %s(%d) added to key for group %d and level %d.\n",
+	       KEYSYM_NAME (ks), ks, group, level);
   keysyms[level++] = ks;
+  return 0;
 }
 
-/* Set the action ACTION for key KEY on group GROUP and level LEVEL.  */
-void
-key_set_action (struct key *key, group_t group, int level, xkb_action_t *action)
+/* Set the action ACTION for key KEY of KM on group GROUP and level
+   LEVEL.  */
+error_t
+key_set_action (struct keymap *km, struct key *key, group_t group,
+		int level, xkb_action_t *action)
 {
   xkb_action_t **actions = key->groups[group].actions;
   size_t width = key->groups[group].actionwidth;
 
   if ((size_t) (level + 1) > width)
     {
-      actions = realloc (actions, level + 1);
-      /* Previous levels have no actions defined.  */
-      memset (&actions[level - 1], 0, level - width);
+      actions = arena_realloc (&km->arena, actions,
+			       width * sizeof (xkb_action_t *),
+			       (level + 1) * sizeof (xkb_action_t *));
+      if (!actions)
+	return ENOMEM;
 
-      if (!keys)
-	{
-	  fprintf (stderr, "No mem\n");
-	  exit (EXIT_FAILURE);
-	}
+      /* Previous levels have no actions defined.  */
+      memset (&actions[width], 0, (level - width) * sizeof (*actions));
 	 
       key->groups[group].actions = actions;
       key->groups[group].actionwidth += level - width + 1;
     }
 
   actions[level++] = action;
+  return 0;
 }
 
 /* Delete keycode to keysym mapping.  */
-void
-key_delete (char *keyname)
+static void
+key_delete (struct parser *parser, char *keyname)
 {
   group_t group;
-  keycode_t kc = keyname_find (keyname);
+  keycode_t kc = keyname_find (parser->keymap, keyname);
   
-  current_key = &keys[kc];
-  for (group = 0; group < current_key->numgroups; group++)
-    remove_symbols (current_key, group);
-  memset (current_key, 0, sizeof (struct key));
+  parser->current_key = &parser->keymap->keys[kc];
+  for (group = 0; group < parser->current_key->numgroups; group++)
+    remove_symbols (parser->current_key, group);
+  memset (parser->current_key, 0, sizeof (struct key));
 
 }
 
 /* Create a new keycode to keysym mapping, check if the old one should
    be removed or preserved.  */
 static void
-key_new (char *keyname)
+key_new (struct parser *parser, char *keyname)
 {
   group_t group;
 
@@ -1445,132 +1496,157 @@ key_new (char *keyname)
       return 1;
     }
 
-  keycode_t kc = keyname_find (keyname);
+  keycode_t kc = keyname_find (parser->keymap, keyname);
 
-  if (merge_mode == augment)
+  if (parser->merge_mode == augment)
     {
-      if (!isempty ((char *) &keys[kc], sizeof (struct key)))
+      if (!isempty ((char *) &parser->keymap->keys[kc], sizeof (struct key)))
 	{
-	  current_key = &dummy_key;
+	  parser->current_key = &parser->dummy_key;
           debug_printf ("working on dummy key due to merge mode.\n");
 	  return;
 	}
       else
-	current_key = &keys[kc];
+	parser->current_key = &parser->keymap->keys[kc];
     }
     
-  if (merge_mode == override)
-      current_key = &keys[kc];
+  if (parser->merge_mode == override)
+      parser->current_key = &parser->keymap->keys[kc];
 
-  if (merge_mode == replace)
+  if (parser->merge_mode == replace)
     {
-      key_delete (keyname);
-      current_key = &keys[kc];
+      key_delete (parser, keyname);
+      parser->current_key = &parser->keymap->keys[kc];
     }
 
   debug_printf("working on key %s(%d)", keyname, kc);
 
-  if (current_key->numgroups == 0 || merge_mode == replace)
+  if (parser->current_key->numgroups == 0 || parser->merge_mode == replace)
     {
       debug_printf(" cloned default key");
       /* Clone the default key.  */
-      memcpy (current_key, default_key, sizeof (struct key));
+      memcpy (parser->current_key, &parser->default_key, sizeof (struct key));
       for (group = 0; group < 3; group++)
 	{
-	  current_key->groups[group].symbols = NULL;
-	  current_key->groups[group].actions = NULL;
-	  current_key->groups[group].actionwidth = 0;
-	  current_key->groups[group].width = 0;
+	  parser->current_key->groups[group].symbols = NULL;
+	  parser->current_key->groups[group].actions = NULL;
+	  parser->current_key->groups[group].actionwidth = 0;
+	  parser->current_key->groups[group].width = 0;
 	}
     }
   debug_printf("\n");
 }
 
-/* Load the XKB configuration from the section XKBKEYMAP in the
-   keymapfile XKBKEYMAPFILE. Use XKBDIR as root directory for relative
-   pathnames.  */
-error_t
-parse_xkbconfig (char *xkbdir, char *xkbkeymapfile, char *xkbkeymap)
+/* Prepare PARSER to compile into KM the files in the NDIRS
+   directories DIRFDS.  */
+static void
+parser_init (struct parser *parser, struct keymap *km, int *dirfds,
+	     int ndirs)
+{
+  int type;
+
+  memset (parser, 0, sizeof (*parser));
+  parser->keymap = km;
+  parser->dirfds = dirfds;
+  parser->ndirs = ndirs;
+  parser->merge_mode = override;
+  for (type = 0; type <= SA_ConsScroll; type++)
+    parser->default_actions[type].type = type;
+}
+
+/* Parse the LEN bytes DATA, which start on the line LINE of the file
+   FNAME, with PARSER.  Then close the scanner and forget the files
+   that were read.  */
+static error_t
+parse_keymap (struct parser *parser, const char *data, size_t len, int line,
+	      char *fname)
 {
   error_t err;
-  char *cwd = getcwd (NULL, 0);
-  extern FILE *yyin;
-  extern char *filename;
 
-  //  xkbkeymap = 0;
+  err = scanner_open (parser, data, len, line, fname);
+  if (!err)
+    {
+      if (yyparse (parser) || parser->nerrs > 0)
+	err = parser->err ? : EINVAL;
+    }
+  scanner_close (parser);
+  keymap_files_free (parser);
+  return err;
+}
 
-  //  xkbkeymapfile = 0;
+/* Load the XKB configuration from the section XKBKEYMAP, or the
+   default section, of the file XKBKEYMAPFILE in the search path XKBDIR
+   into KM.  */
+error_t
+parse_xkbconfig (struct keymap *km, char *xkbdir, char *xkbkeymapfile,
+		 char *xkbkeymap)
+{
+  struct parser parser;
+  struct keymap_file *file;
+  struct keymap_section *section;
+  int *dirfds;
+  int ndirs;
+  error_t err;
 
-  //  xkbdir = "/etc/X11/xkb";
-  //  xkbdir ="/home/marco/xkb";
-  //  xkbkeymapfile = "keymap/hurd";
-  //  xkbkeymap = "hack";
-    
   debug_printf ("Dir: %s, file: %s sect: %s\n", xkbdir, xkbkeymapfile, xkbkeymap);
 
-  //  xkbkeymapfile = "default.xkb";
-  //xkbkeymap = "us";
-  //  yydebug = 1;
-  if (xkbkeymapfile)
+  /* The file names are relative to the directories of XKBDIR.  The
+     working directory is left alone, it is shared by all threads.  */
+  err = keymap_dirs_open (xkbdir, &dirfds, &ndirs);
+  if (err)
     {
-      filename = xkbkeymapfile;
-
-      if (chdir (xkbdir) == -1)
-	{
-	  fprintf (stderr, "Could not set \"%s\" as the active directory\n", 
-		   xkbdir);
-	  return errno;
-	}
-
-      yyin = fopen (xkbkeymapfile, "r");
-      if (yyin == NULL)
-	{
-	  fprintf (stderr, "Couldn't open keymap file\n");
-	  return errno;
-	}
+      fprintf (stderr, "Could not open the directory \"%s\"\n", xkbdir);
+      return err;
+    }
+  parser_init (&parser, km, dirfds, ndirs);
 
-      if (xkbkeymap)
-	skip_to_sectionname (xkbkeymap, XKBKEYMAP);
-      else
-        skip_to_defaultsection();
-    } 
-  else /* Use defaults.  */
+  err = keymap_file_load (&parser, xkbkeymapfile, &file);
+  if (err)
     {
-      extern char *default_xkb_keymap;
-      filename = "<<INTERNAL>>";
-
-      yyin = tmpfile ();
-      //yyin = fopen ("TEST", "w+");
-
-      if (yyin == NULL)
-	{
-	  fprintf (stderr, "Couldn't create tmp file.\n");
-	  return errno;
-	}
-      /* XXX: error handling.  */
-      fprintf (yyin, "%s\n", default_xkb_keymap);
-      
-      rewind (yyin);
+      fprintf (stderr, "Couldn't open keymap file\n");
+      keymap_files_free (&parser);
+      keymap_dirs_close (dirfds, ndirs);
+      return err;
     }
-  err = yyparse ();
-  fclose (yyin);
 
-  if (err || yynerrs > 0)
-    return EINVAL;
-
-  if (xkbkeymapfile)
+  section = keymap_file_section (file, XKBKEYMAP, xkbkeymap);
+  if (!section)
     {
-      if (chdir (cwd) == -1)
-	{
-	  fprintf (stderr, 
-		   "Could not set \"%s\" as the active directory\n", cwd);
-	  return errno;
-	}
+      fprintf (stderr, "Couldn't find keymap %s in %s\n",
+	       xkbkeymap ? : "default", xkbkeymapfile);
+      keymap_files_free (&parser);
+      keymap_dirs_close (dirfds, ndirs);
+      return EINVAL;
     }
 
+  err = parse_keymap (&parser, file->data + section->start,
+		      section->end - section->start, section->line,
+		      file->path);
+  keymap_dirs_close (dirfds, ndirs);
+  if (err)
+    return err;
+
   /* Apply keysym to realmodifier mappings.  */
-  ksrm_apply ();
+  ksrm_apply (km);
+  return 0;
+}
+
+/* Load the XKB configuration from the keymap in the string KEYMAP,
+   which is called NAME in messages, into KM.  makekeymap uses this for
+   the default keymap.  */
+error_t
+parse_xkbconfig_string (struct keymap *km, const char *keymap, char *name)
+{
+  struct parser parser;
+  int cwd = AT_FDCWD;
+  error_t err;
 
-  free (cwd);
+  parser_init (&parser, km, &cwd, 1);
+  err = parse_keymap (&parser, keymap, strlen (keymap), 1, name);
+  if (err)
+    return err;
+
+  /* Apply keysym to realmodifier mappings.  */
+  ksrm_apply (km);
   return 0;
 }
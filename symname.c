@@ -1,86 +1,39 @@
+#include <stdio.h>
 #include <string.h>
+#include <wctype.h>
 #define NEEDKTABLE
+#define NEEDVTABLE
+#define NEEDCASETABLE
+#define NEEDCLASSTABLE
 #include "ks_tables.h"
+#include "kshash.h"
+#include "ksclass.h"
 #include "keysymdef.h"
 
 #define NoSymbol 0
 
-typedef unsigned long Signature;
 typedef unsigned long KeySym;
 
-KeySym XStringToKeysym(char *s)
+KeySym keysymdb_lookup (const char *name, size_t len);
+const char *keysymdb_name (KeySym ks);
+
+/* Return the vendor or Unicode keysym with the name of the LEN
+   characters at S.  */
+static KeySym
+string_to_other_keysym (const char *s, size_t len)
 {
-  register int i, n;
-  int h;
-  register Signature sig = 0;
-  register const char *p = s;
+  register const char *p;
   register int c;
-  register int idx;
-  const unsigned char *entry;
-  unsigned char sig1, sig2;
   KeySym val;
 
-  while ((c = *p++))
-    sig = (sig << 1) + c;
-  i = sig % KTABLESIZE;
-  h = i + 1;
-  sig1 = (sig >> 8) & 0xff;
-  sig2 = sig & 0xff;
-  n = KMAXHASH;
-  while ((idx = hashString[i]))
-    {
-      entry = &_XkeyTable[idx];
-      if ((entry[0] == sig1) && (entry[1] == sig2) &&
-	  !strcmp(s, (char *)entry + 4))
-        {
-	  val = (entry[2] << 8) | entry[3];
-	  if (!val)
-	    val = XK_VoidSymbol;
-	  return val;
-        }
-      if (!--n)
-	break;
-      i += h;
-      if (i >= KTABLESIZE)
-
-	i -= KTABLESIZE;
-    }
-
-  /*
-
-  The KeysymDB is not yet supported.
+  /* Vendor keysyms from XKeysymDB, if it was loaded.  */
+  val = keysymdb_lookup (s, len);
+  if (val != NoSymbol)
+    return val;
 
-  if (!initialized)
-    (void)_XInitKeysymDB();
-  if (keysymdb)
-    {
-      XrmValue result;
-      XrmRepresentation from_type;
-      char c;
-      XrmQuark names[2];
-
-      names[0] = _XrmInternalStringToQuark(s, p - s - 1, sig, False);
-      names[1] = NULLQUARK;
-      (void)XrmQGetResource(keysymdb, names, Qkeysym, &from_type, &result);
-      if (result.addr && (result.size > 1))
-        {
-	  val = 0;
-	  for (i = 0; i < result.size - 1; i++)
-            {
-	      c = ((char *)result.addr)[i];
-	      if ('0' <= c && c <= '9') val = (val<<4)+c-'0';
-	      else if ('a' <= c && c <= 'f') val = (val<<4)+c-'a'+10;
-	      else if ('A' <= c && c <= 'F') val = (val<<4)+c-'A'+10;
-	      else return NoSymbol;
-            }
-	  return val;
-        }
-    }
-  */
-
-  if (*s == 'U') {
+  if (len && *s == 'U') {
     val = 0;
-    for (p = &s[1]; *p; p++) {
+    for (p = &s[1]; p < &s[len]; p++) {
       c = *p;
       if ('0' <= c && c <= '9') val = (val<<4)+c-'0';
       else if ('a' <= c && c <= 'f') val = (val<<4)+c-'a'+10;
@@ -94,3 +47,117 @@ KeySym XStringToKeysym(char *s)
   }
   return (NoSymbol);
 }
+
+/* The slot of the hash H in the minimal perfect hash of ks_tables.h,
+   which holds all names in keysymdef.h.  It is the only candidate for
+   the name with hash H.  Return -1 if the name is certainly not in the
+   table.  */
+static inline int
+ks_name_slot (uint64_t h)
+{
+  uint32_t slot;
+
+  slot = ks_hash_slot (h, ks_displacements[ks_hash_bucket (h, KSBUCKETS)],
+		       KSNAMES);
+  if (ks_name_checks[slot] != ks_hash_check (h))
+    return -1;
+  return slot;
+}
+
+KeySym XStringToKeysym(char *s)
+{
+  int slot = ks_name_slot (ks_hash (s));
+
+  if (slot >= 0 && !strcmp (s, &ks_names[ks_name_offsets[slot]]))
+    return ks_name_values[slot];
+  return string_to_other_keysym (s, strlen (s));
+}
+
+/* Like XStringToKeysym, for the name of the LEN characters at S, which
+   need not be terminated.  */
+KeySym XStringToKeysymLen(const char *s, size_t len)
+{
+  int slot = ks_name_slot (ks_hash_len (s, len));
+
+  if (slot >= 0)
+    {
+      const char *name = &ks_names[ks_name_offsets[slot]];
+
+      if (!strncmp (s, name, len) && name[len] == '\0')
+	return ks_name_values[slot];
+    }
+  return string_to_other_keysym (s, len);
+}
+
+/* Return the name of the keysym KS, or NULL if it has none.  The
+   names of keysymdef.h are looked up in the static name table, the
+   vendor keysyms in the keysym database.  The result must not be
+   freed.  Unicode keysyms are not given a "U+" name, keysym_name does
+   that in a buffer.  */
+char *XKeysymToString(KeySym ks)
+{
+  unsigned short offset;
+
+  if (ks == XK_VoidSymbol)
+    return "VoidSymbol";
+  if (ks > 0xffff)
+    return (char *) keysymdb_name (ks);
+
+  offset = ks_value_names[ks_value_names_pages[ks >> 8]][ks & 0xff];
+  if (offset == KS_NONAME)
+    return (char *) keysymdb_name (ks);
+  return (char *) &ks_names[offset];
+}
+
+/* Return the name of the keysym KS for diagnostics.  A keysym without
+   a name is written to the SIZE bytes at BUF, as U+XXXX when it is a
+   Unicode keysym and as its value in hex otherwise, and BUF is
+   returned.  */
+const char *keysym_name(KeySym ks, char *buf, size_t size)
+{
+  const char *name = XKeysymToString (ks);
+
+  if (name)
+    return name;
+  if ((ks & 0xff000000) == 0x01000000)
+    snprintf (buf, size, "U+%04lX", ks & 0x00ffffff);
+  else
+    snprintf (buf, size, "0x%08lx", ks);
+  return buf;
+}
+
+/* Store the lowercase and the uppercase keysym of SYM in LOWER and
+   UPPER.  Both are SYM when it has no case.  */
+void XConvertCase(KeySym sym, KeySym *lower, KeySym *upper)
+{
+  *lower = *upper = sym;
+
+  /* Unicode keysyms are not in the tables, use the C library for
+     them.  */
+  if ((sym & 0xff000000) == 0x01000000)
+    {
+      wint_t c = sym & 0x00ffffff;
+
+      *lower = towlower (c) | 0x01000000;
+      *upper = towupper (c) | 0x01000000;
+      return;
+    }
+  if (sym > 0xffff)
+    return;
+
+  if (ks_lower[ks_lower_pages[sym >> 8]][sym & 0xff])
+    {
+      *lower = ks_lower[ks_lower_pages[sym >> 8]][sym & 0xff];
+      *upper = ks_upper[ks_upper_pages[sym >> 8]][sym & 0xff];
+    }
+}
+
+/* Return the class of the keysym KS, see ksclass.h.  */
+int keysym_class(KeySym ks)
+{
+  if ((ks & 0xff000000) == 0x01000000)
+    return KS_TEXT;
+  if (ks > 0xffff)
+    return 0;
+  return ks_class[ks_class_pages[ks >> 8]][ks & 0xff];
+}
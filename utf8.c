@@ -0,0 +1,260 @@
+/*  utf8.c -- Convert between UCS-4 and UTF-8.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* The console wants UTF-8, the keymaps produce UCS-4.  Keyboard input
+   is mostly ASCII, so runs of ASCII characters are narrowed several at
+   a time: with SSE2 eight characters per step, otherwise two per step
+   with a 64 bit word.  Everything else goes through the scalar
+   encoder.
+
+   The other way around is only needed to type text, see inject.c.  */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <wchar.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* The character that replaces code points that can't be encoded.  */
+#define REPLACEMENT_CHARACTER	0xfffd
+
+/* Encode the character C in OUT, which has room for SIZE bytes.  Return
+   the length of the encoding, or 0 if it doesn't fit.  */
+static inline size_t
+encode_char (uint32_t c, char *out, size_t size)
+{
+  unsigned char *p = (unsigned char *) out;
+
+  if ((c >= 0xd800 && c <= 0xdfff) || c > 0x10ffff)
+    c = REPLACEMENT_CHARACTER;
+
+  if (c < 0x80)
+    {
+      if (size < 1)
+	return 0;
+      p[0] = c;
+      return 1;
+    }
+  if (c < 0x800)
+    {
+      if (size < 2)
+	return 0;
+      p[0] = 0xc0 | (c >> 6);
+      p[1] = 0x80 | (c & 0x3f);
+      return 2;
+    }
+  if (c < 0x10000)
+    {
+      if (size < 3)
+	return 0;
+      p[0] = 0xe0 | (c >> 12);
+      p[1] = 0x80 | ((c >> 6) & 0x3f);
+      p[2] = 0x80 | (c & 0x3f);
+      return 3;
+    }
+  if (size < 4)
+    return 0;
+  p[0] = 0xf0 | (c >> 18);
+  p[1] = 0x80 | ((c >> 12) & 0x3f);
+  p[2] = 0x80 | ((c >> 6) & 0x3f);
+  p[3] = 0x80 | (c & 0x3f);
+  return 4;
+}
+
+/* Copy the ASCII characters at the start of the N characters IN to
+   OUT, at most SIZE.  Return the amount of characters copied.  This
+   may stop before the first non-ASCII character, the caller handles
+   the rest one by one.  */
+static inline size_t
+encode_ascii (const uint32_t *in, size_t n, char *out, size_t size)
+{
+  size_t i = 0;
+
+  if (size < n)
+    n = size;
+
+#ifdef __SSE2__
+  {
+    const __m128i high = _mm_set1_epi32 (~0x7f);
+
+    for (; i + 8 <= n; i += 8)
+      {
+	__m128i a = _mm_loadu_si128 ((const __m128i *) &in[i]);
+	__m128i b = _mm_loadu_si128 ((const __m128i *) &in[i + 4]);
+	__m128i bits = _mm_and_si128 (_mm_or_si128 (a, b), high);
+	__m128i narrow;
+
+	if (_mm_movemask_epi8 (_mm_cmpeq_epi32 (bits, _mm_setzero_si128 ()))
+	    != 0xffff)
+	  break;
+
+	/* All eight are below 0x80, so saturation never kicks in.  */
+	narrow = _mm_packs_epi32 (a, b);
+	narrow = _mm_packus_epi16 (narrow, narrow);
+	_mm_storel_epi64 ((__m128i *) &out[i], narrow);
+      }
+  }
+#else
+  for (; i + 2 <= n; i += 2)
+    {
+      uint64_t pair;
+
+      memcpy (&pair, &in[i], sizeof (pair));
+      if (pair & 0xffffff80ffffff80ULL)
+	break;
+      out[i] = in[i];
+      out[i + 1] = in[i + 1];
+    }
+#endif
+
+  return i;
+}
+
+/* Encode the N UCS-4 characters IN as UTF-8 in OUT, which has room for
+   SIZE bytes.  Surrogates and characters above U+10FFFF are encoded
+   as U+FFFD.  Return the amount of bytes written and store the amount
+   of characters that were encoded in DONE, which is less than N when
+   OUT is full.  */
+size_t
+ucs4_to_utf8 (const wchar_t *in, size_t n, char *out, size_t size,
+	      size_t *done)
+{
+  const uint32_t *ucs = (const uint32_t *) in;
+  size_t i = 0;
+  size_t len = 0;
+
+  while (i < n)
+    {
+      size_t ascii = encode_ascii (&ucs[i], n - i, &out[len], size - len);
+      size_t clen;
+
+      i += ascii;
+      len += ascii;
+      if (i == n)
+	break;
+
+      clen = encode_char (ucs[i], &out[len], size - len);
+      if (!clen)
+	break;
+      i++;
+      len += clen;
+    }
+
+  *done = i;
+  return len;
+}
+
+/* Decode the character at the start of the LEN bytes P into C.
+   Return the length of its encoding, 0 if it is invalid, or LEN + 1 if
+   it is cut off at the end of P.  */
+static inline size_t
+decode_char (const unsigned char *p, size_t len, uint32_t *c)
+{
+  uint32_t min;
+  size_t clen;
+  size_t j;
+
+  *c = p[0];
+  if (*c < 0x80)
+    return 1;
+
+  if (*c >= 0xc2 && *c <= 0xdf)
+    {
+      clen = 2;
+      min = 0x80;
+      *c &= 0x1f;
+    }
+  else if (*c >= 0xe0 && *c <= 0xef)
+    {
+      clen = 3;
+      min = 0x800;
+      *c &= 0x0f;
+    }
+  else if (*c >= 0xf0 && *c <= 0xf4)
+    {
+      clen = 4;
+      min = 0x10000;
+      *c &= 0x07;
+    }
+  else
+    return 0;
+
+  for (j = 1; j < clen && j < len; j++)
+    {
+      if ((p[j] & 0xc0) != 0x80)
+	return 0;
+      *c = (*c << 6) | (p[j] & 0x3f);
+    }
+  if (j < clen)
+    return len + 1;
+  if (*c < min || *c > 0x10ffff || (*c >= 0xd800 && *c <= 0xdfff))
+    return 0;
+  return clen;
+}
+
+/* Decode the LEN bytes of UTF-8 IN into OUT, which has room for N
+   characters.  Invalid sequences are decoded as U+FFFD, one byte at a
+   time.  A sequence that is cut off at the end of IN is left alone.
+   Return the amount of characters stored and store the amount of
+   bytes decoded in USED.  */
+size_t
+utf8_to_ucs4 (const char *in, size_t len, wchar_t *out, size_t n,
+	      size_t *used)
+{
+  const unsigned char *p = (const unsigned char *) in;
+  size_t i = 0;
+  size_t count = 0;
+
+  while (i < len && count < n)
+    {
+      uint32_t c;
+      size_t clen = decode_char (&p[i], len - i, &c);
+
+      if (clen > len - i)
+	/* Cut off, maybe the rest comes later.  */
+	break;
+
+      if (clen)
+	i += clen;
+      else
+	{
+	  c = REPLACEMENT_CHARACTER;
+	  i++;
+	}
+      out[count++] = c;
+    }
+
+  *used = i;
+  return count;
+}
+
+/* Return nonzero if the LEN bytes IN are valid UTF-8.  */
+int
+utf8_valid (const char *in, size_t len)
+{
+  const unsigned char *p = (const unsigned char *) in;
+  size_t i = 0;
+
+  while (i < len)
+    {
+      uint32_t c;
+      size_t clen = decode_char (&p[i], len - i, &c);
+
+      if (!clen || clen > len - i)
+	return 0;
+      i += clen;
+    }
+  return 1;
+}
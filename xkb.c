@@ -21,15 +21,16 @@
   
 #include <fcntl.h>
 #include <string.h>
+#include <unistd.h>
 #include <stdio.h>
 #include <errno.h>
 #include <ctype.h>
 #include <stdlib.h>
-#include <iconv.h>
 #include <locale.h>
 #include <error.h>
 #include <device/device.h>
 #include <mach/mach_port.h>
+#include <cthreads.h>
 
 #include "xkb.h"
 #include <hurd/console.h>
@@ -49,18 +50,6 @@ int gnumach_v1_compat;
 
 
 #define	NoSymbol	0
-  
-  /* The converter.  */
-  static iconv_t cd;
-
-/* All interpretations for compatibility.  (Translation from keysymbol
-   to actions).  */
-xkb_interpret_t *interpretations;
-
-/* All keysymbols and how they are handled by XKB.  */
-struct key *keys = NULL;
-int min_keys;
-int max_keys;
 
 /* The current set of modifiers.  */
 static modmap_t bmods;
@@ -86,6 +75,27 @@ modcount_t modsc;
 
 keystate_t keystate[255];
 
+/* The keys of the keyboard, their repeats and the keys that are typed
+   by inject.c all change the modifiers, groups and key states above,
+   so they change them one key at a time with this lock held.  It is
+   released before what a key produces is composed and sent to the
+   console, and never held while a timer is added or removed.  */
+struct mutex xkb_input_lock = MUTEX_INITIALIZER;
+
+/* The keymap of the read only DEFAULT_KEYS, which is used when the
+   keymap file can't be read.  */
+static struct keymap default_keymap;
+
+/* The keymap in use when this file loaded it, NULL when it is
+   DEFAULT_KEYMAP or a keymap that keymap_layouts_precompile keeps.
+   It is freed when it is replaced.  KEYMAP_RELOAD_LOCK serializes
+   the reloads.  */
+static struct keymap *keymap;
+static struct mutex keymap_reload_lock = MUTEX_INITIALIZER;
+
+/* The directory with the compiled keymaps.  */
+static const char *keymap_cachedir;
+
 /* The locked modifiers. Lock simply works an an invertion.  */
 static modmap_t lmods = {0, 0};
 
@@ -115,6 +125,16 @@ static char *repeater_node;
 /* The repeater node.  */
 static consnode_t cnode;
 
+/* The name of the node that types the text written to it, and the
+   node.  */
+static char *inject_node;
+static consnode_t inject_cnode;
+
+/* The name of the node that loads the keymap whose name is written to
+   it, and the node.  */
+static char *keymap_node;
+static consnode_t keymap_cnode;
+
 int
 debug_printf (const char *f, ...)
 {
@@ -282,184 +302,34 @@ read_keycode (void)
 }
 
 
+#ifdef XKB_DEBUG
+/* Print the symbols of every key of KM by name, with its keytype.  */
 static void
-interpret_kc (keycode_t kc)
-{
-  int cursym;
-  int rmods = keys[kc].mods.rmods;
-  struct xkb_interpret *interp;
-
-  for (interp = interpretations; interp; interp = interp->next)
-    {
-      group_t group;
-
-      for (group = 0; group < keys[kc].numgroups; group++)
-	{
-	  int width =  keys[kc].groups[group].width;
-
-	  for (cursym = 0; cursym < width; cursym++)
-	    {
-	      int symbol = keys[kc].groups[group].symbols[cursym];
-
-	      /* Check if a keysymbol requirement exists or if it
-		 matches.  */
-	      if (interp->symbol == 0 ||
-		  (symbol && (interp->symbol == symbol)))
-		{
-		  int flags = interp->match & 0x7f;
-
-		  /* XXX: use enum.  */
-		  if ((flags == 0 && (!(interp->rmods & rmods))) ||
-		      (flags == 1) ||
-		      (flags == 2 && (interp->rmods & rmods)) ||
-		      (flags == 3 && ((interp->rmods & rmods) ==
-				      interp->rmods)) ||
-		      (flags == 4 && interp->rmods == rmods))
-		    {
-		      xkb_action_t *action;
-
-		      if (keys[kc].groups[group].actionwidth > cursym && 
-			  keys[kc].groups[group].actions[cursym] &&
-			  keys[kc].groups[group].actions[cursym]->type != 
-			  SA_NoAction)
-			continue;
-
-/* 		      if (action->type == 13) */
-/* 			printf ("AA %d AAAAAAAAAAAAAAA %d: %d - %d\n", kc, flags, symbol, interp->symbol);  */
-
-		      action = malloc (sizeof (xkb_action_t));
-		      memcpy (action, &interp->action, sizeof (xkb_action_t));
-		      
-		      key_set_action (&keys[kc], group, cursym, action);
-
-		      keys[kc].flags = interp->flags | KEYHASACTION;
-		      if (!keys[kc].mods.vmods)
-			keys[kc].mods.vmods = interp->vmod;
-		    }  
-		}
-	    }
-	}
-    }
-
-}
-
-
-/*  Test if c is an uppercase letter. */
-static int islatin_upper (int c)
-{
-  return (c >= 'A' && c <= 'Z');
-}
-
-/*  Test if c is an lowercase letter. */
-static int islatin_lower (int c)
-{
-  return (c >= 'a' && c <= 'z');
-}
-
-/*  A key is of the keytype KEYPAD when one of the symbols that can be produced
-    by this key is in the KEYPAD symbol range.  */
-static int
-iskeypad (int width, int *sym)
-{
-  int i;
-  
-  for (i = 0; i <= width; i++, sym++)
-    {
-      /* Numlock is in the keypad range but shouldn't be of the type
-	 keypad because it will depend on itself in that case.  */
-      if (*sym == XK_Num_Lock)
-	return 0;
-      if (*sym >= KEYPAD_FIRST_KEY && *sym <= KEYPAD_LAST_KEY)
-	return 1;
-    }
-  return 0;   
-}
-
-/* Get the keytype (the keytype determines which modifiers are used
-   for shifting.
-
-   See FindAutomaticType@xkbcomp/symbols.c
-
-   These rules are used:
-
-   Simple recipe:
-     - ONE_LEVEL for width 0/1
-     - ALPHABETIC for 2 shift levels, with lower/upercase
-     - KEYPAD for keypad keys.
-     - TWO_LEVEL for other 2 shift level keys.
-     and the same for four level keys.
-
-   Otherwise, the key type is TWO_LEVEL.
- */
-static struct keytype *
-get_keytype (int width, symbol *sym)
-{
-  struct keytype *ktfound = NULL;
-
-  if (!sym)
-    ktfound = keytype_find ("TWO_LEVEL");
-  else if ((width == 1) || (width == 0))
-    ktfound = keytype_find ("ONE_LEVEL");
-  else if (width == 2) {
-    if (islatin_lower (sym[0]) && islatin_upper (sym[1]))
-      ktfound = keytype_find ("ALPHABETIC");
-    else if (iskeypad (width, sym))
-      ktfound = keytype_find ("KEYPAD");
-    else
-      ktfound = keytype_find ("TWO_LEVEL");
-  }
-  else if (width <= 4) {
-    if (islatin_lower (sym[0]) && islatin_upper (sym[1]))
-      if (islatin_lower(sym[2]) && islatin_upper(sym[3]))
-        ktfound = keytype_find ("FOUR_LEVEL_ALPHABETIC");
-      else
-        ktfound = keytype_find ("FOUR_LEVEL_SEMIALPHABETIC");
-    else if (iskeypad (2, sym))
-      ktfound = keytype_find ("FOUR_LEVEL_KEYPAD");
-    else
-      ktfound = keytype_find ("FOUR_LEVEL");
-  }
-
-  if (!ktfound)
-    ktfound = keytype_find ("TWO_LEVEL");
-  if (!ktfound)
-    {
-      console_error (L"Default keytypes have not been defined!\n");
-      exit (1);
-    }
-
-  return ktfound;
-}
-
-/* Create XKB style actions for every action described by keysymbols.  */
-static void
-interpret_all (void)
-{
-  keycode_t curkc;
-
-  /* Check every key.  */
-  for (curkc = 0; curkc < max_keys; curkc++)
-    interpret_kc (curkc);
-}
-
-static void
-determine_keytypes (void)
+dump_keymap (struct keymap *km)
 {
+  struct key *keys = km->keys;
   keycode_t curkc;
 
-  /* Check every key.  */
-  for (curkc = 0; curkc < max_keys; curkc++)
+  for (curkc = km->min_keys; curkc < km->max_keys; curkc++)
     {
       group_t group;
       for (group = 0; group < 4; group++)
 	{
 	  struct keygroup *kg = &keys[curkc].groups[group];
+	  int level;
 
-	  if (!kg->keytype)
-	    kg->keytype = get_keytype (kg->width, kg->symbols);
+	  if (!kg->width)
+	    continue;
+
+	  debug_printf ("key %d group %d (%s):", curkc, group,
+			kg->keytype ? kg->keytype->name : "none");
+	  for (level = 0; level < kg->width; level++)
+	    debug_printf (" %s", KEYSYM_NAME (kg->symbols[level]));
+	  debug_printf ("\n");
 	}
     }
 }
+#endif
 
 /* Wrap the group GROUP into a valid group range. The method to use is
    defined by the GroupsWrap control.  */
@@ -884,6 +754,8 @@ static symbol handle_key (keypress_t);
 static int
 action_exec (xkb_action_t *action, keypress_t key)
 {
+  struct key *keys = key.keymap->keys;
+
   if (!action) 
     return KEYNOTCONSUMED;
 
@@ -1156,10 +1028,11 @@ action_exec (xkb_action_t *action, keypress_t key)
 
 /* Calculate the shift level for a specific key.  */
 static int
-calc_shift (keycode_t key)
+calc_shift (keypress_t key)
 {
   /* The keytype for this key.  */
-  struct keytype *keytype = keys[key].groups[egroup].keytype;
+  struct keytype *keytype
+    = key.keymap->keys[key.keycode].groups[egroup].keytype;
   struct typemap *map;
   
   /* XXX: Shouldn't happen, another way to fix this?  */
@@ -1231,10 +1104,12 @@ symtoctrlsym (symbol c)
    symbol if one is generated by this key. If redirected_key contains
    1 this is keypress generated by the action SA_RedirectKey, don't
    change the effective modifiers because they exist and have been
-   changed by SA_RedirectKey.  */
+   changed by SA_RedirectKey.  The symbol is composed later, by
+   xkb_output.  */
 static symbol
 handle_key (keypress_t key)
 {
+  struct key *keys = key.keymap->keys;
   int actioncompl = 0;
 
   modmap_t oldmods;
@@ -1284,7 +1159,7 @@ handle_key (keypress_t key)
       oldmods = emods;
       oldgroup = egroup;
       
-      level = calc_shift (key.keycode);// % 
+      level = calc_shift (key);// % 
 
       if (keys[key.keycode].groups[egroup].actionwidth >= level + 1
 	  && keys[key.keycode].groups[egroup].actions[level])
@@ -1319,7 +1194,7 @@ handle_key (keypress_t key)
   emods.rmods |= latchedmods.rmods;
   emods.vmods |= latchedmods.vmods;
 
-  level = calc_shift (key.keycode) % keys[key.keycode].groups[egroup].width;
+  level = calc_shift (key) % keys[key.keycode].groups[egroup].width;
 
   /* The latched modifier is used for a symbol, clear it.  */
   latchedmods.rmods = latchedmods.vmods = 0;
@@ -1330,162 +1205,116 @@ handle_key (keypress_t key)
   
   /* Convert keypad symbols to symbols. XXX: Is this the right place
      to do this? */
-  if ((sym >= XK_KP_Multiply && sym <= XK_KP_Equal) || sym == XK_KP_Enter)
-    sym &= ~0xFF80;
-
-  /* Check if this keypress was a part of a compose sequence.  */
-  sym = compose_symbols (sym);
+  if ((keysym_class (sym) & (KS_KEYPAD | KS_TEXT)) == (KS_KEYPAD | KS_TEXT))
+    keypad_to_ascii (sym);
 
   return sym;
 }
 
+/* The escape sequences of the console keys, see ksclass.h.  */
+static const char *const conskey_escseqs[KS_CONS_MAX] =
+  {
+    [KS_CONS_UP] = CONS_KEY_UP,
+    [KS_CONS_DOWN] = CONS_KEY_DOWN,
+    [KS_CONS_LEFT] = CONS_KEY_LEFT,
+    [KS_CONS_RIGHT] = CONS_KEY_RIGHT,
+    [KS_CONS_BACKSPACE] = CONS_KEY_BACKSPACE,
+    [KS_CONS_F1] = CONS_KEY_F1,
+    [KS_CONS_F2] = CONS_KEY_F2,
+    [KS_CONS_F3] = CONS_KEY_F3,
+    [KS_CONS_F4] = CONS_KEY_F4,
+    [KS_CONS_F5] = CONS_KEY_F5,
+    [KS_CONS_F6] = CONS_KEY_F6,
+    [KS_CONS_F7] = CONS_KEY_F7,
+    [KS_CONS_F8] = CONS_KEY_F8,
+    [KS_CONS_F9] = CONS_KEY_F9,
+    [KS_CONS_F10] = CONS_KEY_F10,
+    [KS_CONS_F11] = CONS_KEY_F11,
+    [KS_CONS_F12] = CONS_KEY_F12,
+    [KS_CONS_F13] = CONS_KEY_F13,
+    [KS_CONS_F14] = CONS_KEY_F14,
+    [KS_CONS_F15] = CONS_KEY_F15,
+    [KS_CONS_F16] = CONS_KEY_F16,
+    [KS_CONS_F17] = CONS_KEY_F17,
+    [KS_CONS_F18] = CONS_KEY_F18,
+    [KS_CONS_F19] = CONS_KEY_F19,
+    [KS_CONS_F20] = CONS_KEY_F20,
+    [KS_CONS_HOME] = CONS_KEY_HOME,
+    [KS_CONS_INSERT] = CONS_KEY_IC,
+    [KS_CONS_DELETE] = CONS_KEY_DC,
+    [KS_CONS_END] = CONS_KEY_END,
+    [KS_CONS_PAGE_UP] = CONS_KEY_PPAGE,
+    [KS_CONS_PAGE_DOWN] = CONS_KEY_NPAGE,
+    [KS_CONS_BEGIN] = CONS_KEY_B2,
+    [KS_CONS_BACKTAB] = CONS_KEY_BTAB,
+    [KS_CONS_RETURN] = "\x0d",
+    [KS_CONS_TAB] = "\t",
+    [KS_CONS_ESCAPE] = "\e"
+  };
+
 /* CTRL + Alt + Backspace will terminate the console client by
    default, this hardcoded behaviour can be disabled.  */
 int ctrlaltbs;
 
+/* Handle the key KEY and store what it produces in RES.  The caller
+   holds XKB_INPUT_LOCK, and passes RES to xkb_output after releasing
+   it.  */
 void
-xkb_input (keypress_t key)
+xkb_input (keypress_t key, keyresult_t *res)
 {
-  char buf[100];
-  size_t size = 0;      
-  wchar_t input;
-
   debug_printf ("input: %d, rel: %d, rep: %d\n", key.keycode, key.rel, key.repeat);
   
   if (key.rel)
     keystate[key.keycode].lmods = lmods;
-  input = handle_key (key);
+  res->sym = handle_key (key);
+  res->emods = emods;
+  res->bmods = bmods;
+  res->compose = key.compose;
+}
+
+/* Compose the symbol of RES, the result of xkb_input, and send what
+   it produces to the console.  This only uses RES and the compose
+   context in it, so it is called without XKB_INPUT_LOCK.  */
+void
+xkb_output (keyresult_t *res)
+{
+  char buf[100];
+  size_t size = 0;      
+  wchar_t input = res->sym;
+  const char *string = NULL;
+  size_t stringlen;
+
   //printf ("sym: %d\n", input);
 
-  debug_printf ("handle: %d\n", input);
+  /* Check if this keypress was a part of a compose sequence.  */
+  if (input != -1 && res->compose)
+    input = compose_symbols (res->compose, input, &string, &stringlen);
+
+  /* A compose sequence that produces a string was completed.  The
+     string is already UTF-8, so it is sent as it is.  */
+  if (string)
+    {
+      console_input ((char *) string, stringlen);
+      return;
+    }
+
+  debug_printf ("handle: %s(%d)\n", KEYSYM_NAME (input), input);
   if (input == -1)
     return;
 
   /* If the realmodifier MOD1 (AKA Alt) is set generate an ESC
      symbol.  */
-  if (emods.rmods & RMOD_MOD1)
+  if (res->emods.rmods & RMOD_MOD1)
     buf[size++] = '\e';
 
   buf[size] = '\0';
 
-  debug_printf ("input: %d\n", input);
+  debug_printf ("input: %s(%d)\n", KEYSYM_NAME (input), input);
   if (!input)
     return;
 
   /* Special key, generate escape sequence.  */
-  char *escseq = NULL;
-
-  switch (input)
-    {
-    case XK_Up: case XK_KP_Up:
-      escseq = CONS_KEY_UP;
-      break;
-    case XK_Down: case XK_KP_Down:
-      escseq = CONS_KEY_DOWN;
-      break;
-    case XK_Left: case XK_KP_Left:
-      escseq = CONS_KEY_LEFT;
-      break;
-    case XK_Right: case XK_KP_Right:
-      escseq = CONS_KEY_RIGHT;
-      break;
-    case XK_BackSpace:
-      escseq = CONS_KEY_BACKSPACE;
-      break;
-    case XK_F1: case XK_KP_F1:
-      escseq = CONS_KEY_F1;
-      break;
-    case XK_F2: case XK_KP_F2:
-      escseq = CONS_KEY_F2;
-      break;
-    case XK_F3: case XK_KP_F3:
-      escseq = CONS_KEY_F3;
-      break;
-    case XK_F4: case XK_KP_F4:
-      escseq = CONS_KEY_F4;
-      break;
-    case XK_F5:
-      escseq = CONS_KEY_F5;
-      break;
-    case XK_F6:
-      escseq = CONS_KEY_F6;
-      break;
-    case XK_F7:
-      escseq = CONS_KEY_F7;
-      break;
-    case XK_F8:
-      escseq = CONS_KEY_F8;
-      break;
-    case XK_F9:
-      escseq = CONS_KEY_F9;
-      break;
-    case XK_F10:
-      escseq = CONS_KEY_F10;
-      break;
-    case XK_F11:
-      escseq = CONS_KEY_F11;
-      break;
-    case XK_F12:
-      escseq = CONS_KEY_F12;
-      break;
-    case XK_F13:
-      escseq = CONS_KEY_F13;
-      break;
-    case XK_F14:
-      escseq = CONS_KEY_F14;
-      break;
-    case XK_F15:
-      escseq = CONS_KEY_F15;
-      break;
-    case XK_F16:
-      escseq = CONS_KEY_F16;
-      break;
-    case XK_F17:
-      escseq = CONS_KEY_F17;
-      break;
-    case XK_F18:
-      escseq = CONS_KEY_F18;
-      break;
-    case XK_F19:
-      escseq = CONS_KEY_F19;
-      break;
-    case XK_F20:
-      escseq = CONS_KEY_F20;
-      break;
-    case XK_Home: case XK_KP_Home:
-      escseq = CONS_KEY_HOME;
-      break;
-    case XK_Insert: case XK_KP_Insert:
-      escseq = CONS_KEY_IC;
-      break;
-    case XK_Delete: case XK_KP_Delete:
-      escseq = CONS_KEY_DC;
-      break;
-    case XK_End: case XK_KP_End:
-      escseq = CONS_KEY_END;
-      break;
-    case XK_Page_Up: case XK_KP_Page_Up:
-      escseq = CONS_KEY_PPAGE;
-      break;
-    case XK_Page_Down: case XK_KP_Page_Down:
-      escseq = CONS_KEY_NPAGE;
-      break;
-    case XK_KP_Begin:
-      escseq = CONS_KEY_B2;
-      break;
-    case XK_ISO_Left_Tab:
-      escseq = CONS_KEY_BTAB;
-      break;
-    case XK_Return: case XK_KP_Enter:
-      escseq = "\x0d";
-      break;
-    case XK_Tab: case XK_KP_Tab:
-      escseq = "\t";
-      break;
-    case XK_Escape:
-      escseq = "\e";
-      break;
-    }
+  const char *escseq = conskey_escseqs[KS_CONSKEY (keysym_class (input))];
 
   debug_printf ("bla\n");
   if (escseq != NULL)
@@ -1495,43 +1324,32 @@ xkb_input (keypress_t key)
     }
   else
     {
-      char *buffer = &buf[size];
-      size_t left = sizeof (buf) - size;
-      char *inbuf = (char *) &input;
-      size_t inbufsize = sizeof (wchar_t);
-      size_t nr;
+      size_t done;
 
       /* Control key behaviour.  */
-      if (bmods.rmods & RMOD_CTRL)
+      if (res->bmods.rmods & RMOD_CTRL)
 	input = symtoctrlsym (input);
 	  
+      /* If CAPSLOCK is active capitalize the symbol.  */
+      if (res->emods.rmods & RMOD_LOCK)
+	{
+	  KeySym lower, upper;
+
+	  XConvertCase (input, &lower, &upper);
+	  input = upper;
+	}
+
       /* Convert the Keysym to a UCS4 characted.  */
       input = KeySymToUcs4 (input);
       /* 	      if (!input) */
       /* 		continue; */
 
       debug_printf ("UCS4: %d -- %c\n", (int) input, input);
-
-      /* If CAPSLOCK is active capitalize the symbol.  */
-      if (emods.rmods & 2)
-      	input = towupper (input);
 		      
-      nr = iconv (cd, &inbuf, &inbufsize, &buffer, &left);
-      if (nr == (size_t) -1)
-	{
-	  if (errno == E2BIG)
-	    console_error (L"Input buffer overflow");
-	  else if (errno == EILSEQ)
-	    console_error
-	      (L"Input contained invalid byte sequence");
-	  else if (errno == EINVAL)
-	    console_error
-	      (L"Input contained incomplete byte sequence");
-	  else
-	    console_error
-	      (L"Input caused unexpected error");
-	}
-      size = sizeof (buf) - left;
+      size += ucs4_to_utf8 (&input, 1, &buf[size], sizeof (buf) - size,
+			    &done);
+      if (!done)
+	console_error (L"Input buffer overflow");
     }
 
   //  printf ("SIZE: %d\n", size);
@@ -1540,6 +1358,59 @@ xkb_input (keypress_t key)
   size = 0;
 }
 
+/* Press and release the key KEYCODE of the keymap KM in the group
+   GROUP with exactly the modifiers MODS.  The modifiers and groups are restored
+   afterwards, so locked or latched modifiers don't change what is
+   typed and the typed key doesn't change them either.  */
+void
+xkb_type_key (struct keymap *km, keycode_t keycode, group_t group,
+	      modmap_t mods)
+{
+  modmap_t oldbmods;
+  modmap_t oldlmods;
+  modmap_t oldlatchedmods;
+  group_t oldbgroup;
+  group_t oldlgroup;
+  keyresult_t press, release;
+  keypress_t key;
+
+  mutex_lock (&xkb_input_lock);
+  oldbmods = bmods;
+  oldlmods = lmods;
+  oldlatchedmods = latchedmods;
+  oldbgroup = bgroup;
+  oldlgroup = lgroup;
+
+  bmods = mods;
+  lmods.rmods = lmods.vmods = 0;
+  latchedmods.rmods = latchedmods.vmods = 0;
+  bgroup = group;
+  lgroup = 0;
+
+  key.keycode = keycode;
+  key.prevkc = 0;
+  key.repeat = 0;
+  key.redir = 1;
+  key.rel = 0;
+  /* Typed text is never composed, and doesn't interrupt a sequence
+     that is typed on the keyboard.  */
+  key.compose = NULL;
+  key.keymap = km;
+  xkb_input (key, &press);
+  key.rel = 1;
+  xkb_input (key, &release);
+
+  bmods = oldbmods;
+  lmods = oldlmods;
+  latchedmods = oldlatchedmods;
+  bgroup = oldbgroup;
+  lgroup = oldlgroup;
+  mutex_unlock (&xkb_input_lock);
+
+  xkb_output (&press);
+  xkb_output (&release);
+}
+
 any_t
 input_loop (any_t foo)
 {
@@ -1550,8 +1421,16 @@ input_loop (any_t foo)
       /* The previous keypress.  */
       //  static keypress_t prevkey = { 0 };
       keypress_t key;
-
-      key.keycode = read_keycode () + min_keys;
+      keycode_t kc;
+      struct keymap *km;
+      int phase;
+      int quit;
+
+      kc = read_keycode ();
+      /* The keymap is only held while the key is handled, never while
+	 waiting for the next one, so it can be replaced then.  */
+      km = keymap_enter (&phase);
+      key.keycode = kc + km->min_keys;
       key.rel = key.keycode & 0x80;
       key.redir = 0;
 
@@ -1566,22 +1445,31 @@ input_loop (any_t foo)
 	key.repeat = 0;  
 
       if (key.repeat)
-	continue;
+	{
+	  keymap_leave (phase);
+	  continue;
+	}
+
+      mutex_lock (&xkb_input_lock);
 
       /* The keycombination CTRL+Alt+Backspace terminates the console
 	 client. Keycodes instead of modifiers+symbols are used to
 	 make it able to exit the client, even when the keymaps are
 	 faulty.  */
-      if ((keystate[64].keypressed || keystate[113].keypressed) /* Alt */
-	  && (keystate[37].keypressed || keystate[109].keypressed) /* CTRL*/
-	  && keystate[22].keypressed && ctrlaltbs) /* Backspace.  */
-	console_exit ();
+      quit = ((keystate[64].keypressed || keystate[113].keypressed) /* Alt */
+	      && (keystate[37].keypressed || keystate[109].keypressed) /* CTRL*/
+	      && keystate[22].keypressed && ctrlaltbs); /* Backspace.  */
 
       debug_printf ("---%d %d %d---\n", keystate[64].keypressed, 
 		    keystate[37].keypressed, keystate[22].keypressed);
+      mutex_unlock (&xkb_input_lock);
+
+      if (quit)
+	console_exit ();
 
       if (!key.repeat)
-	xkb_input_key (key.keycode);
+	xkb_input_key (km, key.keycode);
+      keymap_leave (phase);
       prevkey = key.keycode;
     }
 }
@@ -1642,11 +1530,14 @@ static struct arguments
   char *keymapfile;
   char *keymap;
   char *composefile;
+  char *keysymdb;
+  char *keysymdbcache;
+  char *cachedir;
+  int precompile;
   int ctrlaltbs;
   int pos;
 } arguments = { ctrlaltbs: 1 };
 
-error_t parse_xkbconfig (char *xkbdir, char *xkbkeymapfile, char *xkbkeymap);
 
 static error_t xkb_start (void *handle);
 static error_t xkb_init (void **handle, int no_exit, int argc, char *argv[],
@@ -1655,19 +1546,34 @@ static error_t xkb_init (void **handle, int no_exit, int argc, char *argv[],
 /* const char *argp_program_version = "XKB plugin 0.003"; */
 /* const char *argp_program_bug_address = "metgerards@student.han.nl"; */
 static struct argp_option options[] = {
-  {"xkbdir",     'x', "DIR",          0, 
-   "directory containing the XKB configuration files" },
+  {"xkbdir",     'x', "DIR[:DIR...]", 0,
+   "directories containing the XKB configuration files, searched in order" },
   {"keymapfile", 'f', "FILE",         0,
    "file containing the keymap" },
   {"keymap",     'k', "SECTIONNAME" , 0,
    "choose keymap"},
   {"compose",    'o', "COMPOSEFILE", 0,
-   "Compose file to load (default none)"},
+   "Compose file to load (default XCOMPOSEFILE or the one of the locale)"},
+  {"keysymdb",   'd', "FILE",         0,
+   "XKeysymDB file with vendor keysyms to load (default none)"},
+  {"keysymdb-cache", 'D', "FILE",     0,
+   "cache for the parsed XKeysymDB (default " KEYSYMDB_CACHE ")"},
+  {"cache-dir",  'C', "DIR",          0,
+   "directory for compiled keymaps and Compose files (default "
+   XKB_CACHE_DIR ")"},
+  {"precompile", 'P', "THREADS",      OPTION_ARG_OPTIONAL,
+   "compile all keymaps of the keymap file in the background on THREADS "
+   "threads (default one per processor) and report their compile times"},
   {"ctrlaltbs",  'c', 0		     , 0,
    "CTRL + Alt + Backspace will exit the console client (default)."},
   {"no-ctrlaltbs",  'n', 0	    , 0,
    "CTRL + Alt + Backspace will not exit the console client."},
   {"repeat",		'r', "NODE", 0, "Set a repeater translator on NODE"},
+  {"inject",		'i', "NODE", 0,
+   "Type the UTF-8 text that is written to NODE"},
+  {"keymap-node",	'K', "NODE", 0,
+   "Load the keymap whose name is written to NODE, an empty name loads "
+   "the default keymap"},
   {0}
 };
 
@@ -1694,6 +1600,27 @@ parse_opt (int key, char *arg, struct argp_state *state)
       arguments->composefile = arg;
       break;
 
+    case 'd':
+      arguments->keysymdb = arg;
+      break;
+
+    case 'D':
+      arguments->keysymdbcache = arg;
+      break;
+
+    case 'C':
+      arguments->cachedir = arg;
+      break;
+
+    case 'P':
+      if (arg)
+	arguments->precompile = atoi (arg);
+      else
+	arguments->precompile = sysconf (_SC_NPROCESSORS_ONLN);
+      if (arguments->precompile < 1)
+	arguments->precompile = 1;
+      break;
+
     case 'c':
       arguments->ctrlaltbs = 1;
       break;
@@ -1706,6 +1633,14 @@ parse_opt (int key, char *arg, struct argp_state *state)
       repeater_node = arg;
       break;
 
+    case 'i':
+      inject_node = arg;
+      break;
+
+    case 'K':
+      keymap_node = arg;
+      break;
+
     case ARGP_KEY_END:
       break;
       
@@ -1719,6 +1654,158 @@ parse_opt (int key, char *arg, struct argp_state *state)
 
 static struct argp argp = {options, parse_opt, 0, 0};
 
+/* Load the keymap NAME of the keymap file into a new keymap in *KMP.
+   It is compiled unless there is an up to date compiled keymap in the
+   cache.  */
+static error_t
+keymap_load (char *name, struct keymap **kmp)
+{
+  struct keymap *km;
+  error_t err;
+
+  km = malloc (sizeof (*km));
+  if (!km)
+    return ENOMEM;
+  err = keymap_init (km);
+  if (err)
+    {
+      free (km);
+      return err;
+    }
+
+  /* A keymap that was compiled before is used as it is.  */
+  if (!keymap_cache_load (km, keymap_cachedir, arguments.xkbdir,
+			  arguments.keymapfile, name))
+    goto out;
+
+  err = parse_xkbconfig (km, arguments.xkbdir, arguments.keymapfile,
+			 name);
+  if (!err)
+    err = determine_keytypes (km);
+  if (!err)
+    err = interpret_all (km);
+  if (err)
+    {
+      keymap_free (km);
+      free (km);
+      return err;
+    }
+
+  /* Like the Compose file, the keymap still works without a cache.  */
+  keymap_cache_write (km, keymap_cachedir, arguments.xkbdir,
+		      arguments.keymapfile, name);
+
+ out:
+  *kmp = km;
+  return 0;
+}
+
+/* Replace the keymap in use by the keymap NAME of the keymap file,
+   NULL for its default keymap.  The new keymap is taken from the ones
+   that --precompile compiled or else compiled while keys are still
+   handled with the old one, and put in use at once.  The old keymap
+   is freed when no key is handled with it anymore, the keys that are
+   held down are released through it first.  When the new keymap can't
+   be loaded the old one stays in use.
+
+   This waits for the keys that are handled with the old keymap, so it
+   must never be called while a key is handled: not between
+   keymap_enter and keymap_leave, and not with XKB_INPUT_LOCK held.
+   The input thread, the timer thread and the inject node can't call
+   it, the keymap node calls it from the thread of its RPC.  */
+error_t
+xkb_keymap_reload (char *name)
+{
+  struct keymap *km;
+  struct keymap *old;
+  struct keymap *compiled = NULL;
+  error_t err = 0;
+
+  mutex_lock (&keymap_reload_lock);
+
+  km = keymap_layout_find (name);
+  if (!km)
+    {
+      err = keymap_load (name, &compiled);
+      if (err)
+	goto out;
+      km = compiled;
+    }
+
+  old = keymap_publish (km);
+
+  /* The keys that are held down were pressed with the old keymap,
+     release them through it before it is freed.  */
+  if (old != km)
+    xkb_keys_release (old);
+
+  if (keymap)
+    {
+      keymap_free (keymap);
+      free (keymap);
+    }
+  keymap = compiled;
+
+ out:
+  mutex_unlock (&keymap_reload_lock);
+  return err;
+}
+
+/* Load the keymap whose name is written to the keymap node.  One
+   write holds one name, a trailing newline is ignored, so `echo us >
+   NODE' works.  */
+static error_t
+keymap_node_write (struct protid *cred, char *data,
+		   mach_msg_type_number_t datalen, off_t offset,
+		   mach_msg_type_number_t *amount)
+{
+  char *name;
+  size_t len = datalen;
+  error_t err;
+
+  if (!cred)
+    return EOPNOTSUPP;
+  else if (!(cred->po->openstat & O_WRITE))
+    return EBADF;
+
+  while (len > 0 && (data[len - 1] == '\n' || data[len - 1] == '\r'))
+    len--;
+  name = strndup (data, len);
+  if (!name)
+    return ENOMEM;
+
+  err = xkb_keymap_reload (*name ? name : NULL);
+  free (name);
+  if (err)
+    return err;
+
+  *amount = datalen;
+  return 0;
+}
+
+/* Make the node NODENAME to which the name of a keymap is written to
+   load it, and return it in *CN.  */
+static error_t
+keymap_setnode (const char *nodename, consnode_t *cn)
+{
+  error_t err;
+
+  err = console_create_consnode (nodename, cn);
+  if (err)
+    return err;
+
+  (*cn)->read = 0;
+  (*cn)->write = keymap_node_write;
+  (*cn)->select = 0;
+  (*cn)->open = 0;
+  (*cn)->close = 0;
+  (*cn)->demuxer = 0;
+
+  console_register_consnode (*cn);
+
+  return 0;
+}
+
 static error_t
 xkb_init (void **handle, int no_exit, int argc, char **argv, int *next)
 {
@@ -1745,22 +1832,53 @@ xkb_init (void **handle, int no_exit, int argc, char **argv, int *next)
     
   ctrlaltbs = arguments.ctrlaltbs;
   
-  if (arguments.composefile)
+  if (arguments.keysymdb)
     {
-      err = read_composefile (arguments.composefile);
+      err = keysymdb_load (arguments.keysymdb,
+			   arguments.keysymdbcache ? : KEYSYMDB_CACHE);
       if (err)
 	return err;
     }
 
-  xkb_data_init ();
-  err = parse_xkbconfig (arguments.xkbdir, arguments.keymapfile,
-			 arguments.keymap);
-  
+  keymap_cachedir = arguments.cachedir ? : XKB_CACHE_DIR;
+  err = compose_init (arguments.composefile, keymap_cachedir);
   if (err)
     return err;
 
-  determine_keytypes ();
-  interpret_all ();
+  err = keymap_load (arguments.keymap, &keymap);
+  if (err == EINVAL || err == ENOMEM)
+    return err;
+  if (err)
+    {
+      /* The keymap file can't be read, for example on a rescue boot.
+	 The default keymap was compiled when the driver was built, it
+	 needs no files and no memory.  */
+      printf ("Warning: could not read the keymap file %s: %s, "
+	      "using the default keymap\n", arguments.keymapfile,
+	      strerror (err));
+      err = keymap_init (&default_keymap);
+      if (err)
+	return err;
+      default_keymap.keys = (struct key *) default_keys;
+      default_keymap.min_keys = default_min_keys;
+      default_keymap.max_keys = default_max_keys;
+    }
+
+  /* The other layouts are compiled while the console runs.  */
+  if (arguments.precompile)
+    {
+      err = keymap_layouts_precompile (keymap_cachedir, arguments.xkbdir,
+				       arguments.keymapfile,
+				       arguments.precompile);
+      if (err)
+	printf ("Warning: could not precompile the keymaps of %s: %s\n",
+		arguments.keymapfile, strerror (err));
+    }
+
+  keymap_publish (keymap ? : &default_keymap);
+#ifdef XKB_DEBUG
+  dump_keymap (keymap ? : &default_keymap);
+#endif
 
   return 0;
 }
@@ -1785,10 +1903,6 @@ xkb_start (void *handle)
   error_t err;
   device_t device_master;
 
-  cd = iconv_open ("UTF-8", "WCHAR_T");
-  if (cd == (iconv_t) -1)
-    return errno;
-
   xkb_init_repeat (100L, 10L);
 
   err = get_privileged_ports (0, &device_master);
@@ -1823,6 +1937,20 @@ xkb_start (void *handle)
 
   if (repeater_node)
     kbd_setrepeater (repeater_node, &cnode);
+  if (inject_node)
+    {
+      err = inject_setnode (inject_node, &inject_cnode);
+      if (err)
+	printf ("Warning: could not make the node %s: %s\n", inject_node,
+		strerror (err));
+    }
+  if (keymap_node)
+    {
+      err = keymap_setnode (keymap_node, &keymap_cnode);
+      if (err)
+	printf ("Warning: could not make the node %s: %s\n", keymap_node,
+		strerror (err));
+    }
   
   cthread_detach (cthread_fork (input_loop, NULL));
 
@@ -1844,6 +1972,16 @@ xkb_fini (void *handle, int force)
 
   console_unregister_consnode (cnode);
   console_destroy_consnode (cnode);
+  if (inject_cnode)
+    {
+      console_unregister_consnode (inject_cnode);
+      console_destroy_consnode (inject_cnode);
+    }
+  if (keymap_cnode)
+    {
+      console_unregister_consnode (keymap_cnode);
+      console_destroy_consnode (keymap_cnode);
+    }
   
   return 0;
 }
@@ -15,7 +15,14 @@
     GNU General Public License for more details.  */
 
 #include <errno.h>
+#include <stdio.h>
 #include <argp.h>
+#include <wchar.h>
+#include <hurd/ihash.h>
+#include <cthreads.h>
+#include "ksclass.h"
+#include "cache.h"
+#include "arena.h"
 //#include "kbd_driver.h"
 
 typedef int keycode_t;
@@ -41,8 +48,6 @@ typedef enum mergemode
     defaultmm
   } mergemode;
 
-extern mergemode merge_mode;
-
 typedef unsigned long KeySym;
 
 /* Real modifiers.  */
@@ -92,9 +97,7 @@ typedef struct typemap
   struct typemap *next;
 } typemap_t;
 
-/* The keypad symbol range.  */
-#define KEYPAD_FIRST_KEY 0xFF80
-#define KEYPAD_LAST_KEY  0xFFB9
+/* The bits that make a keypad symbol from an ASCII symbol.  */
 #define KEYPAD_MASK      0xFF80
 
 /* Convert a keypad symbol to a ASCII symbol.  */
@@ -189,7 +192,6 @@ typedef struct xkb_interpret
   struct xkb_interpret *next;
 } xkb_interpret_t;
 
-extern xkb_interpret_t *interpretations;
 extern int interpret_count;
 
 /* These are the parameter names that are used by the actions that
@@ -299,9 +301,52 @@ typedef struct key
   struct modmap mods;
 } keyinf_t;
 
-extern struct key *keys;
-extern int min_keys;
-extern int max_keys;
+#define	KTHSZ	16
+
+/* A keymap, the keys and everything they are compiled from.  Every
+   compile fills in its own, so several keymaps can be compiled at
+   once.  All its objects are allocated from its arena, so they are
+   freed at once when the keymap is.  */
+struct keymap
+{
+  struct arena arena;
+
+  /* All keysymbols and how they are handled by XKB.  */
+  struct key *keys;
+  int min_keys;
+  int max_keys;
+
+  /* Keysyms to the keys that type them, see inject.c.  INJECT_KEYS
+     is NULL until the index is built.  */
+  struct hurd_ihash inject_index;
+  struct inject_key *inject_keys;
+
+  /* The rest is only used while compiling.  */
+
+  /* All interpretations for compatibility.  (Translation from
+     keysymbol to actions).  The ones without a keysymbol are last.  */
+  xkb_interpret_t *interpretations;
+  xkb_interpret_t *last_interp;
+  /* The defaults for new interpretations.  */
+  xkb_interpret_t default_interpretation;
+  /* All keytypes.  */
+  struct keytype *kthash[KTHSZ];
+  /* The dummy gets used when the original may not be overwritten.  */
+  struct keytype dummy_keytype;
+  /* Keynames to keycodes and keysyms to realmodifiers.  */
+  struct hurd_ihash keynames;
+  struct hurd_ihash ksrm;
+  /* The virtual modifier names, the last one first.  */
+  struct vmodname *vmods;
+  int lastvmod;
+  /* The files the keymap is compiled from.  */
+  struct cache_dep *deps;
+  unsigned int ndeps;
+
+  /* The mapped cache the key table is in, or NULL.  */
+  void *cache;
+  size_t cache_size;
+};
 
 /* The current state of every key.  */
 typedef struct keystate
@@ -320,10 +365,23 @@ typedef struct keystate
   boolctrls bool;
   group_t prevgroup;
   group_t oldgroup;
+  /* The keymap the key was pressed with, it repeats and is released
+     with it even when another keymap was put in use meanwhile.  */
+  struct keymap *keymap;
 } keystate_t;
 
 extern struct keystate keystate[255];
 
+/* The progress of a compose sequence.  The compiled Compose table is
+   shared read only, every source of keys has its own context, so
+   sequences typed on different keyboards don't mix.  A context is
+   only used by one thread at a time.  */
+struct compose_context
+{
+  /* The state in the compose trie, 0 when no sequence is typed.  */
+  unsigned int state;
+};
+
 typedef struct keypress
 {
   keycode_t keycode;
@@ -332,8 +390,26 @@ typedef struct keypress
   unsigned short repeat:1;	/* It this a real keypress?.  */
   unsigned short redir:1;	/* This is not a real keypress.  */
   unsigned short rel;		/* Key release.  */
+  /* The compose sequence the key is part of, or NULL if the key is
+     never composed.  */
+  struct compose_context *compose;
+  /* The keymap the key is handled with.  */
+  struct keymap *keymap;
 } keypress_t;
 
+/* What a key produced while XKB_INPUT_LOCK was held, which is
+   composed and sent to the console after it is released.  */
+typedef struct keyresult
+{
+  /* The symbol of the key, -1 if it has none.  */
+  symbol sym;
+  /* The effective and the base modifiers of the key.  */
+  modmap_t emods;
+  modmap_t bmods;
+  /* The compose sequence of the key, see keypress_t.  */
+  struct compose_context *compose;
+} keyresult_t;
+
 /* Flags for indicators.  */
 #define	IM_NoExplicit	0x80
 #define	IM_NoAutomatic	0x40
@@ -357,76 +433,374 @@ typedef struct xkb_indicator
 } xkb_indicator_t;
 
 unsigned int KeySymToUcs4(int keysym);
-symbol compose_symbols (symbol symbol);
-error_t read_composefile (char *);
+unsigned int Ucs4ToKeySym(unsigned int ucs);
+symbol compose_symbols (struct compose_context *ctx, symbol symbol,
+			const char **string, size_t *stringlen);
+error_t compose_init (const char *composefn, const char *cachedir);
 KeySym XStringToKeysym(char *s);
-struct keytype *keytype_find (char *name);
-
-void key_set_action (struct key *key, group_t group, int level,
-		     xkb_action_t *action);
+KeySym XStringToKeysymLen(const char *s, size_t len);
+char *XKeysymToString(KeySym ks);
+const char *keysym_name(KeySym ks, char *buf, size_t size);
+void XConvertCase(KeySym sym, KeySym *lower, KeySym *upper);
+int keysym_class(KeySym ks);
+
+/* Encode the N UCS-4 characters IN as UTF-8 in OUT, which has room for
+   SIZE bytes.  Return the amount of bytes written, DONE is set to the
+   amount of characters encoded.  */
+size_t ucs4_to_utf8 (const wchar_t *in, size_t n, char *out, size_t size,
+		     size_t *done);
+
+/* Decode the LEN bytes of UTF-8 IN into OUT, which has room for N
+   characters.  Return the amount of characters stored, USED is set to
+   the amount of bytes decoded.  */
+size_t utf8_to_ucs4 (const char *in, size_t len, wchar_t *out, size_t n,
+		     size_t *used);
+
+/* Return nonzero if the LEN bytes IN are valid UTF-8.  */
+int utf8_valid (const char *in, size_t len);
+
+/* The default cache of the X keysym database.  */
+#define KEYSYMDB_CACHE	XKB_CACHE_DIR "/XKeysymDB.cache"
+
+/* Load the X keysym database DBFILE, using the cache CACHEFILE if it
+   is not NULL.  */
+error_t keysymdb_load (const char *dbfile, const char *cachefile);
+void keysymdb_free (void);
+KeySym keysymdb_lookup (const char *name, size_t len);
+const char *keysymdb_name (KeySym ks);
+
+/* The size of a buffer for keysym_name, enough for "0x" and the 16
+   digits of a 64 bit keysym.  */
+#define KEYSYM_NAME_MAX	19
+
+/* The name of the keysym KS for diagnostics, never NULL.  The name of
+   a keysym without one is made in a buffer of the caller, which lasts
+   until the end of the block KEYSYM_NAME is used in.  */
+#define KEYSYM_NAME(ks)							\
+  keysym_name ((ks), (char [KEYSYM_NAME_MAX]) { 0 }, KEYSYM_NAME_MAX)
+
+/* Set the action ACTION for key KEY of KM on group GROUP and level
+   LEVEL.  */
+error_t key_set_action (struct keymap *km, struct key *key, group_t group,
+			int level, xkb_action_t *action);
 
 
 /* Interfaces for xkbdata.c:  */
-extern struct xkb_interpret default_interpretation;
-
 
-/* Assign the name KEYNAME to the keycode KEYCODE.  */
-error_t keyname_add (char *keyname, int keycode);
+/* Assign the name KEYNAME to the keycode KEYCODE in KM.  */
+error_t keyname_add (struct keymap *km, char *keyname, int keycode);
 
 /* Find the numberic representation of the keycode with the name
-   KEYNAME.  */
-int keyname_find (char *keyname);
+   KEYNAME in KM.  */
+int keyname_find (struct keymap *km, char *keyname);
 
-/* Search the keytype with the name NAME.  */
-struct keytype *keytype_find (char *name);
+/* Search the keytype with the name NAME in KM.  */
+struct keytype *keytype_find (struct keymap *km, char *name);
 
 /* Remove the keytype KT.  */
 void keytype_delete (struct keytype *kt);
 
-/* Create a new keytype with the name NAME.  */
-error_t keytype_new (char *name, struct keytype **new_kt);
+/* Create a new keytype with the name NAME in KM, the merge mode
+   MERGE_MODE says what happens to an existing one.  */
+error_t keytype_new (struct keymap *km, char *name, mergemode merge_mode,
+		     struct keytype **new_kt);
 
-/* Add a level (LEVEL) to modifiers (MODS) mapping to the current
-   keytype.  */
-error_t keytype_mapadd (struct keytype *kt, modmap_t mods, int level);
+/* Add a level (LEVEL) to modifiers (MODS) mapping to the keytype KT
+   of KM.  */
+error_t keytype_mapadd (struct keymap *km, struct keytype *kt,
+			modmap_t mods, int level);
 
-/* For the current keytype the modifiers PRESERVE should be preserved
+/* For the keytype KT of KM the modifiers PRESERVE should be preserved
    when the modifiers MODS are pressed.  */
-error_t keytype_preserve_add (struct keytype *kt, modmap_t mods,
-			      modmap_t preserve);
+error_t keytype_preserve_add (struct keymap *km, struct keytype *kt,
+			      modmap_t mods, modmap_t preserve);
 
-/* Add a new interpretation.  */
-error_t interpret_new (xkb_interpret_t **new_interpret, symbol ks);
+/* Add a new interpretation to KM.  */
+error_t interpret_new (struct keymap *km, xkb_interpret_t **new_interpret,
+		       symbol ks);
 
-/* Get the number assigned to the virtualmodifier with the name
-   VMODNAME.  */
-int vmod_find (char *vmodname);
+/* Get the number assigned to the virtualmodifier with the name of
+   the LEN characters at VMODNAME in KM.  */
+int vmod_find (struct keymap *km, const char *vmodname, size_t len);
 
-/* Give the virtualmodifier VMODNAME a number and add it to the
-   hashtable.  */
-error_t vmod_add (char *vmodname);
-
-/* Initialize the list for keysyms to realmodifiers mappings.  */
-void ksrm_init ();
+/* Give the virtualmodifier with the name of the LEN characters at
+   VMODNAME a number in KM and add it to the hashtable.  */
+error_t vmod_add (struct keymap *km, const char *vmodname, size_t len);
 
 /* Add keysym to realmodifier mapping.  */
-error_t ksrm_add (symbol ks, int rmod);
+error_t ksrm_add (struct keymap *km, symbol ks, int rmod);
 
-/* Apply the rkms (realmods to keysyms) table to all keysyms.  */
-void ksrm_apply (void);
+/* Apply the rkms (realmods to keysyms) table to all keysyms of KM.  */
+void ksrm_apply (struct keymap *km);
 
-/* Set the current rmod for the key with keyname KEYNAME.  */
+/* Set the current rmod for the key with keyname KEYNAME in KM.  */
 /* XXX: It shouldn't be applied immediatly because the key can be
    replaced.  */
-void set_rmod_keycode (char *keyname, int rmod);
+void set_rmod_keycode (struct keymap *km, char *keyname, int rmod);
+
+/* Initialize the keymap KM for a compile.  */
+error_t keymap_init (struct keymap *km);
 
-/* Initialize XKB data structures.  */
-error_t xkb_data_init (void);
+/* Free the keymap KM and everything in it.  */
+void keymap_free (struct keymap *km);
 
-error_t xkb_input_key (int key);
+/* Held while the modifiers, groups and key states are changed, see
+   xkb.c.  */
+extern struct mutex xkb_input_lock;
+
+/* Handle the keycode KEY of the keyboard with the keymap KM.  */
+error_t xkb_input_key (struct keymap *km, int key);
 
 error_t xkb_init_repeat (int delay, int repeat);
 
-void xkb_input (keypress_t key);
+/* Release the keys that are down and were pressed with the keymap KM,
+   and stop their repeat.  */
+void xkb_keys_release (struct keymap *km);
+
+/* Handle the key KEY and store what it produces in RES.  The caller
+   holds XKB_INPUT_LOCK.  */
+void xkb_input (keypress_t key, keyresult_t *res);
+
+/* Compose and send to the console what a key produced, RES of
+   xkb_input.  The caller doesn't hold XKB_INPUT_LOCK.  */
+void xkb_output (keyresult_t *res);
+
+/* Press and release the key KEYCODE of the keymap KM in the group
+   GROUP with the modifiers MODS.  */
+void xkb_type_key (struct keymap *km, keycode_t keycode, group_t group,
+		   modmap_t mods);
+
+/* Replace the keymap in use by the keymap NAME of the keymap file,
+   NULL for its default keymap.  This waits until no key is handled
+   with the old keymap, never call it between keymap_enter and
+   keymap_leave or with XKB_INPUT_LOCK held.  */
+error_t xkb_keymap_reload (char *name);
+
+/* Interfaces for xkbcache.c:  */
+
+/* Record the file PATH, which the parser opened as FD, as a file the
+   keymap KM is compiled from.  */
+error_t keymap_dep_add (struct keymap *km, const char *path, int fd);
+
+/* Forget the files the keymap KM was compiled from.  */
+void keymap_deps_free (struct keymap *km);
+
+/* Load the keymap KEYMAP of the file FILE in XKBDIR into KM from its
+   cache in CACHEDIR, if there is one and it is up to date.  */
+error_t keymap_cache_load (struct keymap *km, const char *cachedir,
+			   const char *xkbdir, const char *file,
+			   const char *keymap);
+
+/* Write the keymap KM that was just compiled from the keymap KEYMAP of
+   the file FILE in XKBDIR to a cache in CACHEDIR.  The files it was
+   compiled from are forgotten.  */
+error_t keymap_cache_write (struct keymap *km, const char *cachedir,
+			    const char *xkbdir, const char *file,
+			    const char *keymap);
+
+/* Return the size of the keys of the keymap KM and everything they
+   point to, as they are kept in a cache.  */
+size_t keymap_cache_size (struct keymap *km);
+
+/* Interfaces for parser.y:  */
+
+#define	MAX_INCLUDE_DEPTH	50
+
+/* An include file on the stack of the scanner.  */
+struct include
+{
+  struct yy_buffer_state *buffer;
+  mergemode merge_mode;
+  int currline;
+  char *filename;
+};
+
+/* Everything the parser and the scanner use while a keymap is
+   compiled.  The parser is pure and the scanner is reentrant, they
+   keep all their state here.  */
+struct parser
+{
+  /* The keymap that is compiled.  */
+  struct keymap *keymap;
+  /* The directories the files are searched in, in order.  */
+  int *dirfds;
+  int ndirs;
+  /* The files that were loaded during this compile.  */
+  struct keymap_file *files;
+  /* The error that stopped the parser, if it was not a syntax
+     error.  */
+  error_t err;
+  int nerrs;
+
+  /* The scanner and the file and line it is at, see lex.l.  */
+  void *scanner;
+  struct include include_stack[MAX_INCLUDE_DEPTH];
+  int include_stack_ptr;
+  struct scan_data *scan_data;
+  char *filename;
+  int lineno;
+  mergemode merge_mode;
+
+  /* What is being parsed.  */
+  struct key *current_key;
+  struct key default_key;
+  /* The dummy gets used when the original may not be overwritten.  */
+  struct key dummy_key;
+  /* The current parsed group.  */
+  int current_group;
+  int current_rmod;
+  /* The current symbol in the currently parsed key.  */
+  int symbolcnt;
+  int actioncnt;
+  struct keytype *current_keytype;
+  struct xkb_interpret *current_interpretation;
+  struct xkb_action *current_action;
+  struct xkb_indicator indicator;
+  /* The default settings for actions, by type.  */
+  struct xkb_action default_actions[SA_ConsScroll + 1];
+};
+
+/* Load the XKB configuration from the section XKBKEYMAP, or the
+   default section, of the file XKBKEYMAPFILE in the search path XKBDIR
+   into KM.  */
+error_t parse_xkbconfig (struct keymap *km, char *xkbdir,
+			 char *xkbkeymapfile, char *xkbkeymap);
+
+/* Load the XKB configuration from the keymap in the string KEYMAP,
+   which is called NAME in messages, into KM.  */
+error_t parse_xkbconfig_string (struct keymap *km, const char *keymap,
+				char *name);
+
+/* Interfaces for xkbcompile.c:  */
+
+/* Give every key group of KM without a keytype the keytype that fits
+   its symbols.  */
+error_t determine_keytypes (struct keymap *km);
+
+/* Create XKB style actions for every action described by keysymbols
+   in KM.  */
+error_t interpret_all (struct keymap *km);
+
+/* Interfaces for xkbfile.c:  */
+
+/* A section of a keymap file.  */
+struct keymap_section
+{
+  /* The token of the section keyword, like XKBSYMBOLS.  */
+  int type;
+  int isdefault;
+  /* The name, which is not terminated, or NULL.  */
+  const char *name;
+  size_t namelen;
+  /* The section runs from the byte START, its `{', up to END, after
+     the matching `}'.  START is on the line LINE.  */
+  size_t start;
+  size_t end;
+  int line;
+  /* The amount of braces around the section.  */
+  int depth;
+};
+
+/* A keymap file, read during this compile.  */
+struct keymap_file
+{
+  char *path;
+  /* The contents, terminated.  */
+  char *data;
+  size_t len;
+  struct keymap_section *sections;
+  int nsections;
+  /* The error of opening the file when it was not found, then there
+     is nothing else.  */
+  error_t err;
+  struct keymap_file *next;
+};
+
+/* Open the directories of the search path XKBDIR, whose directories
+   are separated by colons, and store them in DIRFDS and their number
+   in NDIRS.  Directories that can't be opened are left out.  */
+error_t keymap_dirs_open (const char *xkbdir, int **dirfds, int *ndirs);
+
+/* Close the NDIRS directories DIRFDS.  */
+void keymap_dirs_close (int *dirfds, int ndirs);
+
+/* Load the keymap file PATH from the search path of PARSER, or find
+   it when it was loaded before during this compile, and store it in
+   FILE.  */
+error_t keymap_file_load (struct parser *parser, const char *path,
+			  struct keymap_file **file);
+
+/* Return the section of the type TYPE with the name NAME in FILE, or
+   its default section when NAME is NULL.  Return NULL when there is no
+   such section.  */
+struct keymap_section *keymap_file_section (struct keymap_file *file,
+					    int type, const char *name);
+
+/* Store the names of the sections of the type TYPE in the keymap file
+   PATH in the NDIRS directories DIRFDS in NAMES and their number in
+   COUNT.  The name of a section without one is NULL.  Store the index
+   of the default section in DEF, or -1 when there is none.  */
+error_t keymap_file_section_names (const int *dirfds, int ndirs,
+				   const char *path, int type,
+				   char ***names, int *count, int *def);
+
+/* Forget all files that were loaded during the compile of PARSER.  */
+void keymap_files_free (struct parser *parser);
+
+/* Return the first byte after the comment or string that starts at P,
+   or P when there is none there.  Count the newlines of comments in
+   LINE.  END is the end of the data.  */
+const char *keymap_skip_comment (const char *p, const char *end, int *line);
+
+/* Interfaces for xkblayout.c:  */
+
+/* Compile every keymap of the keymap file FILE in XKBDIR on NTHREADS
+   threads in the background, or load it from its cache in CACHEDIR,
+   and keep them.  Report how long every compile took and how much
+   memory the keymap takes when all are done.  */
+error_t keymap_layouts_precompile (const char *cachedir, char *xkbdir,
+				   char *file, int nthreads);
+
+/* Return the keymap NAME of the keymap file that
+   keymap_layouts_precompile compiled, its default keymap when NAME is
+   NULL, or NULL when it is not compiled (yet).  */
+struct keymap *keymap_layout_find (const char *name);
+
+/* Interfaces for xkbswap.c:  */
+
+/* Return the keymap in use, which stays valid until keymap_leave is
+   called with the phase that is stored in PHASE.  */
+struct keymap *keymap_enter (int *phase);
+
+/* The keymap that keymap_enter returned with PHASE is not used
+   anymore.  */
+void keymap_leave (int phase);
+
+/* Put the keymap KM in use.  Return the keymap it replaced when no key
+   is handled with it anymore.  */
+struct keymap *keymap_publish (struct keymap *km);
+
+/* Interfaces for keymap_tables.c, which makekeymap generates:  */
+
+/* The keymap of xkbdefaults.c, compiled when the driver is built.  It
+   is read only and can be used as the keys of a keymap without any
+   further work.  */
+extern const struct key default_keys[];
+extern const int default_min_keys;
+extern const int default_max_keys;
+
+/* Interfaces for inject.c:  */
+
+/* Type the N UCS-4 characters TEXT.  */
+error_t xkb_inject_ucs4 (const wchar_t *text, size_t n);
+
+/* Type the UTF-8 string TEXT of LEN bytes.  */
+error_t xkb_inject_utf8 (const char *text, size_t len);
+
+struct consnode;
+
+/* Make the node NODENAME to which text is written to type it, and
+   return it in *CN.  */
+error_t inject_setnode (const char *nodename, struct consnode **cn);
 
 int debug_printf (const char *f, ...);
@@ -0,0 +1,612 @@
+/*  xkbcache.c -- Cache of compiled keymaps.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* Compiling a keymap means parsing the keymap file and every file it
+   includes, choosing the keytypes and applying the interpretations to
+   every key.  The result is written to a cache, so the next start maps
+   the cache and uses the key table in it without parsing anything.
+
+   The cache holds the key table, the keytypes it uses and everything
+   they point to.  Pointers are stored as offsets from the start of the
+   cache, 0 is NULL.  The cache is mapped privately and the offsets are
+   turned into pointers in place when it is loaded.  It looks like
+   this, every part starts at a multiple of 8:
+
+     struct keymap_cache_header
+     the dependencies, depsize bytes, the first is the keymap file
+     the selection, selsize bytes: xkbdir, the keymap file and the
+       keymap section, each terminated
+     struct key keys[max_keys]
+     struct keytype keytypes[nkeytypes]
+     struct typemap maps[nmaps]
+     struct xkb_action *slots[nslots], the actions of the keys
+     struct xkb_action actions[nactions]
+     symbol symbols[nsymbols]
+     char names[namesize], the names of the keytypes
+
+   A cache is only used for the selection it was made from, so it is
+   named after it.  The interpretations, virtual modifier names and
+   keynames are only needed while compiling, they are not cached.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "xkb.h"
+#include "kshash.h"
+
+#define KEYMAP_CACHE_MAGIC	"XKBKMAP"
+/* Increase this when the layout of the cache or of the key table
+   changes.  */
+#define KEYMAP_CACHE_VERSION	1
+
+#define KEYMAP_CACHE_ALIGN(size)	(((size) + 7) & ~(size_t) 7)
+
+struct keymap_cache_header
+{
+  char magic[8];
+  uint32_t version;
+  /* The cache holds pointers, it is only valid for this size.  */
+  uint32_t ptrsize;
+  int32_t min_keys;
+  int32_t max_keys;
+  uint32_t nkeytypes;
+  uint32_t nmaps;
+  uint32_t nslots;
+  uint32_t nactions;
+  uint32_t nsymbols;
+  uint32_t namesize;
+  uint32_t ndeps;
+  uint32_t depsize;
+  uint32_t selsize;
+  uint32_t unused;
+};
+
+/* The parts of the cache after the selection.  */
+enum keymap_part
+  {
+    KC_KEYS,
+    KC_KEYTYPES,
+    KC_MAPS,
+    KC_SLOTS,
+    KC_ACTIONS,
+    KC_SYMBOLS,
+    KC_NAMES,
+    KC_NPARTS
+  };
+
+struct keymap_part_layout
+{
+  size_t offset;
+  size_t elsize;
+  size_t count;
+};
+
+/* Record the file PATH, which the parser opened as FD, as a file the
+   keymap KM is compiled from.  */
+error_t
+keymap_dep_add (struct keymap *km, const char *path, int fd)
+{
+  struct stat st;
+
+  if (fstat (fd, &st) < 0)
+    return errno;
+  return cache_dep_add (&km->deps, &km->ndeps, path, &st);
+}
+
+/* Forget the files the keymap KM was compiled from.  */
+void
+keymap_deps_free (struct keymap *km)
+{
+  cache_deps_free (km->deps, km->ndeps);
+  km->deps = NULL;
+  km->ndeps = 0;
+}
+
+/* Store the selection, the keymap section KEYMAP of the file FILE in
+   XKBDIR, in SEL and its size, with the terminators, in SELSIZE.  */
+static error_t
+keymap_selection (const char *xkbdir, const char *file, const char *keymap,
+		  char **sel, size_t *selsize)
+{
+  size_t dirlen = strlen (xkbdir) + 1;
+  size_t filelen = strlen (file) + 1;
+  size_t keymaplen = (keymap ? strlen (keymap) : 0) + 1;
+
+  *selsize = dirlen + filelen + keymaplen;
+  *sel = calloc (1, KEYMAP_CACHE_ALIGN (*selsize));
+  if (!*sel)
+    return ENOMEM;
+  memcpy (*sel, xkbdir, dirlen);
+  memcpy (*sel + dirlen, file, filelen);
+  if (keymap)
+    memcpy (*sel + dirlen + filelen, keymap, keymaplen);
+  return 0;
+}
+
+/* Store the name of the cache for the selection SEL of SELSIZE bytes
+   in CACHEDIR in CACHEFILE.  */
+static error_t
+keymap_cache_name (const char *cachedir, const char *sel, size_t selsize,
+		   char **cachefile)
+{
+  if (asprintf (cachefile, "%s/keymap-%08x.cache", cachedir,
+		(unsigned int) ks_hash_len (sel, selsize)) < 0)
+    return ENOMEM;
+  return 0;
+}
+
+/* Fill in the layout PARTS of the cache with the header HEADER.
+   Return the size of the cache.  */
+static size_t
+keymap_cache_layout (const struct keymap_cache_header *header,
+		     struct keymap_part_layout *parts)
+{
+  size_t offset;
+  int i;
+
+  parts[KC_KEYS].elsize = sizeof (struct key);
+  parts[KC_KEYS].count = header->max_keys;
+  parts[KC_KEYTYPES].elsize = sizeof (struct keytype);
+  parts[KC_KEYTYPES].count = header->nkeytypes;
+  parts[KC_MAPS].elsize = sizeof (struct typemap);
+  parts[KC_MAPS].count = header->nmaps;
+  parts[KC_SLOTS].elsize = sizeof (struct xkb_action *);
+  parts[KC_SLOTS].count = header->nslots;
+  parts[KC_ACTIONS].elsize = sizeof (struct xkb_action);
+  parts[KC_ACTIONS].count = header->nactions;
+  parts[KC_SYMBOLS].elsize = sizeof (symbol);
+  parts[KC_SYMBOLS].count = header->nsymbols;
+  parts[KC_NAMES].elsize = 1;
+  parts[KC_NAMES].count = header->namesize;
+
+  offset = (sizeof (*header) + KEYMAP_CACHE_ALIGN (header->depsize)
+	    + KEYMAP_CACHE_ALIGN (header->selsize));
+  for (i = 0; i < KC_NPARTS; i++)
+    {
+      parts[i].offset = offset;
+      offset += KEYMAP_CACHE_ALIGN (parts[i].count * parts[i].elsize);
+    }
+  return offset;
+}
+
+/* Return the offset of the element INDEX of the part PART.  */
+static inline uintptr_t
+keymap_part_offset (const struct keymap_part_layout *part, size_t index)
+{
+  return part->offset + index * part->elsize;
+}
+
+/* Turn the offset OFFSET in the cache at BASE into a pointer to COUNT
+   elements of the part PART.  Clear VALID if they are not in PART.  */
+static void *
+keymap_cache_ptr (char *base, uintptr_t offset,
+		  const struct keymap_part_layout *part, size_t count,
+		  int *valid)
+{
+  if (!offset)
+    return NULL;
+  if (offset < part->offset
+      || (offset - part->offset) % part->elsize
+      || (offset - part->offset) / part->elsize > part->count
+      || count > part->count - (offset - part->offset) / part->elsize)
+    {
+      *valid = 0;
+      return NULL;
+    }
+  return base + offset;
+}
+
+/* Turn the offsets in the cache at BASE with the header HEADER and the
+   layout PARTS into pointers.  Return 0 if the cache is broken.  */
+static int
+keymap_cache_relocate (char *base, const struct keymap_cache_header *header,
+		       const struct keymap_part_layout *parts)
+{
+  struct key *ckeys = (struct key *) (base + parts[KC_KEYS].offset);
+  struct keytype *kts = (struct keytype *) (base + parts[KC_KEYTYPES].offset);
+  struct typemap *maps = (struct typemap *) (base + parts[KC_MAPS].offset);
+  struct xkb_action **slots;
+  int valid = 1;
+  size_t i;
+
+  slots = (struct xkb_action **) (base + parts[KC_SLOTS].offset);
+
+  for (i = 0; i < header->nkeytypes; i++)
+    {
+      kts[i].maps = keymap_cache_ptr (base, (uintptr_t) kts[i].maps,
+				      &parts[KC_MAPS], 1, &valid);
+      kts[i].name = keymap_cache_ptr (base, (uintptr_t) kts[i].name,
+				      &parts[KC_NAMES], 1, &valid);
+      kts[i].hnext = NULL;
+      kts[i].prevp = NULL;
+    }
+  for (i = 0; i < header->nmaps; i++)
+    maps[i].next = keymap_cache_ptr (base, (uintptr_t) maps[i].next,
+				     &parts[KC_MAPS], 1, &valid);
+  for (i = 0; i < header->nslots; i++)
+    slots[i] = keymap_cache_ptr (base, (uintptr_t) slots[i],
+				 &parts[KC_ACTIONS], 1, &valid);
+
+  for (i = 0; i < (size_t) header->max_keys; i++)
+    {
+      int group;
+
+      if (ckeys[i].numgroups < 0 || ckeys[i].numgroups > 4)
+	return 0;
+      for (group = 0; group < 4; group++)
+	{
+	  struct keygroup *kg = &ckeys[i].groups[group];
+
+	  if (kg->width < 0 || kg->actionwidth < 0)
+	    return 0;
+	  kg->symbols = keymap_cache_ptr (base, (uintptr_t) kg->symbols,
+					  &parts[KC_SYMBOLS], kg->width,
+					  &valid);
+	  kg->actions = keymap_cache_ptr (base, (uintptr_t) kg->actions,
+					  &parts[KC_SLOTS], kg->actionwidth,
+					  &valid);
+	  kg->keytype = keymap_cache_ptr (base, (uintptr_t) kg->keytype,
+					  &parts[KC_KEYTYPES], 1, &valid);
+	  if ((kg->width && !kg->symbols) || (kg->actionwidth && !kg->actions))
+	    return 0;
+	}
+    }
+
+  /* The names must be terminated.  */
+  if (header->namesize
+      && base[parts[KC_NAMES].offset + header->namesize - 1] != '\0')
+    return 0;
+
+  return valid;
+}
+
+/* Load the keymap KEYMAP of the file FILE in XKBDIR into KM from its
+   cache in CACHEDIR, if there is one and it is up to date.  */
+error_t
+keymap_cache_load (struct keymap *km, const char *cachedir,
+		   const char *xkbdir, const char *file, const char *keymap)
+{
+  struct keymap_part_layout parts[KC_NPARTS];
+  struct keymap_cache_header *header;
+  char *cachefile;
+  char *sel;
+  size_t selsize;
+  void *map;
+  size_t size;
+  int *dirfds;
+  int ndirs;
+  int valid;
+  error_t err;
+
+  err = keymap_selection (xkbdir, file, keymap, &sel, &selsize);
+  if (err)
+    return err;
+  err = keymap_cache_name (cachedir, sel, selsize, &cachefile);
+  if (!err)
+    {
+      err = cache_map_private (cachefile, &map, &size);
+      free (cachefile);
+    }
+  if (err)
+    {
+      free (sel);
+      return err;
+    }
+
+  header = map;
+  valid = (size >= sizeof (*header)
+	   && !memcmp (header->magic, KEYMAP_CACHE_MAGIC,
+		       sizeof (header->magic))
+	   && header->version == KEYMAP_CACHE_VERSION
+	   && header->ptrsize == sizeof (void *)
+	   && header->min_keys >= 0 && header->max_keys >= header->min_keys
+	   && header->depsize % 8 == 0
+	   && header->depsize <= size - sizeof (*header)
+	   && header->selsize == selsize
+	   && keymap_cache_layout (header, parts) == size
+	   && !memcmp ((char *) (header + 1) + header->depsize, sel, selsize));
+  free (sel);
+
+  if (valid)
+    {
+      valid = !keymap_dirs_open (xkbdir, &dirfds, &ndirs);
+      if (valid)
+	{
+	  valid = cache_deps_valid (dirfds, ndirs, header + 1,
+				    header->depsize, header->ndeps, file);
+	  keymap_dirs_close (dirfds, ndirs);
+	}
+    }
+
+  if (!valid || !keymap_cache_relocate (map, header, parts))
+    {
+      munmap (map, size);
+      return EINVAL;
+    }
+
+  km->cache = map;
+  km->cache_size = size;
+  km->keys = (struct key *) ((char *) map + parts[KC_KEYS].offset);
+  km->min_keys = header->min_keys;
+  km->max_keys = header->max_keys;
+  return 0;
+}
+
+/* Return the index of the keytype KT in the NKTS keytypes KTS, or
+   NKTS.  */
+static unsigned int
+keytype_index (struct keytype **kts, unsigned int nkts, struct keytype *kt)
+{
+  unsigned int i;
+
+  for (i = 0; i < nkts; i++)
+    if (kts[i] == kt)
+      break;
+  return i;
+}
+
+/* Count the parts of the cache of the keymap KM in HEADER, which is
+   cleared first, and store the keytypes its keys use in KTS and their
+   number in NKTS.  */
+static error_t
+keymap_cache_count (struct keymap *km, struct keymap_cache_header *header,
+		    struct keytype ***kts, unsigned int *nkts)
+{
+  unsigned int nmaps = 0, nslots = 0, nactions = 0, nsymbols = 0;
+  unsigned int namesize = 0;
+  keycode_t kc;
+
+  *kts = NULL;
+  *nkts = 0;
+
+  /* Only the keytypes the keys use are needed.  */
+  for (kc = 0; kc < km->max_keys; kc++)
+    {
+      group_t group;
+
+      for (group = 0; group < 4; group++)
+	{
+	  struct keygroup *kg = &km->keys[kc].groups[group];
+	  struct typemap *map;
+	  int level;
+
+	  if (kg->symbols)
+	    nsymbols += kg->width;
+	  if (kg->actions)
+	    {
+	      nslots += kg->actionwidth;
+	      for (level = 0; level < kg->actionwidth; level++)
+		if (kg->actions[level])
+		  nactions++;
+	    }
+
+	  if (!kg->keytype
+	      || keytype_index (*kts, *nkts, kg->keytype) < *nkts)
+	    continue;
+	  if (!(*nkts & (*nkts - 1)))
+	    {
+	      struct keytype **newkts;
+
+	      newkts = realloc (*kts, (*nkts ? *nkts * 2 : 1)
+				* sizeof (**kts));
+	      if (!newkts)
+		{
+		  free (*kts);
+		  *kts = NULL;
+		  return ENOMEM;
+		}
+	      *kts = newkts;
+	    }
+	  (*kts)[(*nkts)++] = kg->keytype;
+	  for (map = kg->keytype->maps; map; map = map->next)
+	    nmaps++;
+	  if (kg->keytype->name)
+	    namesize += strlen (kg->keytype->name) + 1;
+	}
+    }
+
+  memset (header, 0, sizeof (*header));
+  header->min_keys = km->min_keys;
+  header->max_keys = km->max_keys;
+  header->nkeytypes = *nkts;
+  header->nmaps = nmaps;
+  header->nslots = nslots;
+  header->nactions = nactions;
+  header->nsymbols = nsymbols;
+  header->namesize = namesize;
+  return 0;
+}
+
+/* Return the size of the keys of the keymap KM and everything they
+   point to, as they are kept in a cache.  Return 0 when there is not
+   enough memory to count them.  */
+size_t
+keymap_cache_size (struct keymap *km)
+{
+  struct keymap_part_layout parts[KC_NPARTS];
+  struct keymap_cache_header header;
+  struct keytype **kts;
+  unsigned int nkts;
+
+  if (keymap_cache_count (km, &header, &kts, &nkts))
+    return 0;
+  free (kts);
+  return keymap_cache_layout (&header, parts) - sizeof (header);
+}
+
+/* Write the keymap KM that was just compiled from the keymap KEYMAP of
+   the file FILE in XKBDIR to a cache in CACHEDIR.  The files it was
+   compiled from are forgotten.  */
+error_t
+keymap_cache_write (struct keymap *km, const char *cachedir,
+		    const char *xkbdir, const char *file, const char *keymap)
+{
+  struct keymap_part_layout parts[KC_NPARTS];
+  struct keymap_cache_header header;
+  struct keytype **kts = NULL;
+  struct key *ckeys;
+  struct keytype *ckts;
+  struct typemap *cmaps;
+  struct xkb_action **cslots;
+  struct xkb_action *cactions;
+  symbol *csymbols;
+  char *cnames;
+  char *buf = NULL;
+  char *cachefile = NULL;
+  char *sel = NULL;
+  size_t selsize;
+  size_t size;
+  unsigned int nmaps, nslots, nactions, nsymbols;
+  unsigned int namesize;
+  unsigned int nkts;
+  unsigned int i;
+  keycode_t kc;
+  struct iovec iov;
+  error_t err;
+
+  err = keymap_selection (xkbdir, file, keymap, &sel, &selsize);
+  if (!err)
+    err = keymap_cache_name (cachedir, sel, selsize, &cachefile);
+  if (err)
+    goto out;
+
+  err = keymap_cache_count (km, &header, &kts, &nkts);
+  if (err)
+    goto out;
+
+  memcpy (header.magic, KEYMAP_CACHE_MAGIC, sizeof (header.magic));
+  header.version = KEYMAP_CACHE_VERSION;
+  header.ptrsize = sizeof (void *);
+  header.ndeps = km->ndeps;
+  header.depsize = cache_deps_size (km->deps, km->ndeps);
+  header.selsize = selsize;
+  size = keymap_cache_layout (&header, parts);
+
+  buf = calloc (1, size);
+  if (!buf)
+    {
+      err = ENOMEM;
+      goto out;
+    }
+  memcpy (buf, &header, sizeof (header));
+  cache_deps_store (km->deps, km->ndeps, buf + sizeof (header));
+  memcpy (buf + sizeof (header) + header.depsize, sel, selsize);
+
+  ckeys = (struct key *) (buf + parts[KC_KEYS].offset);
+  ckts = (struct keytype *) (buf + parts[KC_KEYTYPES].offset);
+  cmaps = (struct typemap *) (buf + parts[KC_MAPS].offset);
+  cslots = (struct xkb_action **) (buf + parts[KC_SLOTS].offset);
+  cactions = (struct xkb_action *) (buf + parts[KC_ACTIONS].offset);
+  csymbols = (symbol *) (buf + parts[KC_SYMBOLS].offset);
+  cnames = buf + parts[KC_NAMES].offset;
+
+  nmaps = namesize = 0;
+  for (i = 0; i < nkts; i++)
+    {
+      struct typemap *map;
+
+      ckts[i] = *kts[i];
+      ckts[i].hnext = NULL;
+      ckts[i].prevp = NULL;
+      ckts[i].maps = NULL;
+      ckts[i].name = NULL;
+      if (kts[i]->name)
+	{
+	  strcpy (&cnames[namesize], kts[i]->name);
+	  ckts[i].name = (char *) keymap_part_offset (&parts[KC_NAMES],
+						      namesize);
+	  namesize += strlen (kts[i]->name) + 1;
+	}
+
+      /* The maps of a keytype are stored in the order of the list.  */
+      for (map = kts[i]->maps; map; map = map->next)
+	{
+	  cmaps[nmaps] = *map;
+	  cmaps[nmaps].next = NULL;
+	  if (map == kts[i]->maps)
+	    ckts[i].maps = (struct typemap *)
+	      keymap_part_offset (&parts[KC_MAPS], nmaps);
+	  else
+	    cmaps[nmaps - 1].next = (struct typemap *)
+	      keymap_part_offset (&parts[KC_MAPS], nmaps);
+	  nmaps++;
+	}
+    }
+
+  nslots = nactions = nsymbols = 0;
+  for (kc = 0; kc < km->max_keys; kc++)
+    {
+      group_t group;
+
+      ckeys[kc] = km->keys[kc];
+      for (group = 0; group < 4; group++)
+	{
+	  struct keygroup *kg = &km->keys[kc].groups[group];
+	  struct keygroup *ckg = &ckeys[kc].groups[group];
+	  int level;
+
+	  ckg->symbols = NULL;
+	  if (kg->symbols)
+	    {
+	      memcpy (&csymbols[nsymbols], kg->symbols,
+		      kg->width * sizeof (symbol));
+	      ckg->symbols = (symbol *)
+		keymap_part_offset (&parts[KC_SYMBOLS], nsymbols);
+	      nsymbols += kg->width;
+	    }
+	  else
+	    ckg->width = 0;
+
+	  ckg->actions = NULL;
+	  if (kg->actions)
+	    {
+	      ckg->actions = (struct xkb_action **)
+		keymap_part_offset (&parts[KC_SLOTS], nslots);
+	      for (level = 0; level < kg->actionwidth; level++, nslots++)
+		if (kg->actions[level])
+		  {
+		    cactions[nactions] = *kg->actions[level];
+		    cslots[nslots] = (struct xkb_action *)
+		      keymap_part_offset (&parts[KC_ACTIONS], nactions);
+		    nactions++;
+		  }
+	    }
+	  else
+	    ckg->actionwidth = 0;
+
+	  ckg->keytype = NULL;
+	  if (kg->keytype)
+	    ckg->keytype = (struct keytype *)
+	      keymap_part_offset (&parts[KC_KEYTYPES],
+				  keytype_index (kts, nkts, kg->keytype));
+	}
+    }
+
+  iov.iov_base = buf;
+  iov.iov_len = size;
+  err = cache_write (cachefile, &iov, 1);
+
+ out:
+  keymap_deps_free (km);
+  free (buf);
+  free (kts);
+  free (cachefile);
+  free (sel);
+  return err;
+}
@@ -0,0 +1,237 @@
+/*  xkbcompile.c -- Compile the parsed keymap.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* The parser fills in the symbols of every key.  What is left is to
+   choose a keytype for the keys that don't name one and to turn the
+   symbols into actions with the interpretations.
+
+   This is kept apart from the driver in xkb.c, so makekeymap can
+   compile the default keymap when the driver is built.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xkb.h"
+
+
+static error_t
+interpret_kc (struct keymap *km, keycode_t kc)
+{
+  struct key *key = &km->keys[kc];
+  int cursym;
+  int rmods = key->mods.rmods;
+  struct xkb_interpret *interp;
+  error_t err;
+
+  for (interp = km->interpretations; interp; interp = interp->next)
+    {
+      group_t group;
+
+      for (group = 0; group < key->numgroups; group++)
+	{
+	  int width =  key->groups[group].width;
+
+	  for (cursym = 0; cursym < width; cursym++)
+	    {
+	      int symbol = key->groups[group].symbols[cursym];
+
+	      /* Check if a keysymbol requirement exists or if it
+		 matches.  */
+	      if (interp->symbol == 0 ||
+		  (symbol && (interp->symbol == symbol)))
+		{
+		  int flags = interp->match & 0x7f;
+
+		  /* XXX: use enum.  */
+		  if ((flags == 0 && (!(interp->rmods & rmods))) ||
+		      (flags == 1) ||
+		      (flags == 2 && (interp->rmods & rmods)) ||
+		      (flags == 3 && ((interp->rmods & rmods) ==
+				      interp->rmods)) ||
+		      (flags == 4 && interp->rmods == rmods))
+		    {
+		      xkb_action_t *action;
+
+		      if (key->groups[group].actionwidth > cursym && 
+			  key->groups[group].actions[cursym] &&
+			  key->groups[group].actions[cursym]->type != 
+			  SA_NoAction)
+			continue;
+
+/* 		      if (action->type == 13) */
+/* 			printf ("AA %d AAAAAAAAAAAAAAA %d: %d - %d\n", kc, flags, symbol, interp->symbol);  */
+
+		      action = arena_alloc (&km->arena, sizeof (xkb_action_t));
+		      if (!action)
+			return ENOMEM;
+		      memcpy (action, &interp->action, sizeof (xkb_action_t));
+		      
+		      err = key_set_action (km, key, group, cursym, action);
+		      if (err)
+			return err;
+
+		      key->flags = interp->flags | KEYHASACTION;
+		      if (!key->mods.vmods)
+			key->mods.vmods = interp->vmod;
+		    }  
+		}
+	    }
+	}
+    }
+
+  return 0;
+}
+
+
+/* Test if the keysym KS is an uppercase letter.  */
+static int
+iskeysym_upper (symbol ks)
+{
+  KeySym lower, upper;
+
+  XConvertCase (ks, &lower, &upper);
+  return ks == upper && lower != upper;
+}
+
+/* Test if the keysym KS is a lowercase letter.  */
+static int
+iskeysym_lower (symbol ks)
+{
+  KeySym lower, upper;
+
+  XConvertCase (ks, &lower, &upper);
+  return ks == lower && lower != upper;
+}
+
+/*  A key is of the keytype KEYPAD when one of the symbols that can be produced
+    by this key is in the KEYPAD symbol range.  */
+static int
+iskeypad (int width, int *sym)
+{
+  int i;
+  int keypad = 0;
+  
+  for (i = 0; i < width; i++, sym++)
+    {
+      int class = keysym_class (*sym);
+
+      /* Numlock shouldn't be of the type keypad because it will
+	 depend on itself in that case, the same goes for the other
+	 modifiers.  */
+      if (class & KS_MODIFIER)
+	return 0;
+      if (class & KS_KEYPAD)
+	keypad = 1;
+    }
+  return keypad;
+}
+
+/* Get the keytype (the keytype determines which modifiers are used
+   for shifting.
+
+   See FindAutomaticType@xkbcomp/symbols.c
+
+   These rules are used:
+
+   Simple recipe:
+     - ONE_LEVEL for width 0/1
+     - ALPHABETIC for 2 shift levels, with lower/upercase
+     - KEYPAD for keypad keys.
+     - TWO_LEVEL for other 2 shift level keys.
+     and the same for four level keys.
+
+   Otherwise, the key type is TWO_LEVEL.  Return NULL when not even
+   TWO_LEVEL is defined.
+ */
+static struct keytype *
+get_keytype (struct keymap *km, int width, symbol *sym)
+{
+  struct keytype *ktfound = NULL;
+
+  if (!sym)
+    ktfound = keytype_find (km, "TWO_LEVEL");
+  else if ((width == 1) || (width == 0))
+    ktfound = keytype_find (km, "ONE_LEVEL");
+  else if (width == 2) {
+    if (iskeysym_lower (sym[0]) && iskeysym_upper (sym[1]))
+      ktfound = keytype_find (km, "ALPHABETIC");
+    else if (iskeypad (width, sym))
+      ktfound = keytype_find (km, "KEYPAD");
+    else
+      ktfound = keytype_find (km, "TWO_LEVEL");
+  }
+  else if (width <= 4) {
+    if (iskeysym_lower (sym[0]) && iskeysym_upper (sym[1]))
+      if (iskeysym_lower (sym[2]) && iskeysym_upper (sym[3]))
+        ktfound = keytype_find (km, "FOUR_LEVEL_ALPHABETIC");
+      else
+        ktfound = keytype_find (km, "FOUR_LEVEL_SEMIALPHABETIC");
+    else if (iskeypad (2, sym))
+      ktfound = keytype_find (km, "FOUR_LEVEL_KEYPAD");
+    else
+      ktfound = keytype_find (km, "FOUR_LEVEL");
+  }
+
+  if (!ktfound)
+    ktfound = keytype_find (km, "TWO_LEVEL");
+
+  return ktfound;
+}
+
+/* Create XKB style actions for every action described by keysymbols
+   in KM.  */
+error_t
+interpret_all (struct keymap *km)
+{
+  keycode_t curkc;
+  error_t err;
+
+  /* Check every key.  */
+  for (curkc = 0; curkc < km->max_keys; curkc++)
+    {
+      err = interpret_kc (km, curkc);
+      if (err)
+	return err;
+    }
+  return 0;
+}
+
+/* Give every key group of KM without a keytype the keytype that fits
+   its symbols.  */
+error_t
+determine_keytypes (struct keymap *km)
+{
+  keycode_t curkc;
+
+  /* Check every key.  */
+  for (curkc = 0; curkc < km->max_keys; curkc++)
+    {
+      group_t group;
+      for (group = 0; group < 4; group++)
+	{
+	  struct keygroup *kg = &km->keys[curkc].groups[group];
+
+	  if (kg->keytype)
+	    continue;
+
+	  kg->keytype = get_keytype (km, kg->width, kg->symbols);
+	  if (!kg->keytype)
+	    {
+	      fprintf (stderr, "Default keytypes have not been defined!\n");
+	      return EINVAL;
+	    }
+	}
+    }
+
+  return 0;
+}
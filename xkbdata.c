@@ -19,6 +19,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <hurd/ihash.h>
 #include "xkb.h"
 
@@ -39,17 +40,6 @@ struct keyname
   int rmods;
 };
 
-static struct hurd_ihash kn_mapping;
-
-/* Initialize the keyname hashtable.  */
-static void
-keyname_init ()
-{
-  hurd_ihash_init (&kn_mapping, HURD_IHASH_NO_LOCP);
-  debug_printf ("Kn_mapping init");
-  /* XXX: error.  */
-}
-
 static inline int
 keyname_hash(char *keyname)
 {
@@ -58,14 +48,14 @@ keyname_hash(char *keyname)
   return tmp[0] + (tmp[1] << 8) + (tmp[2] << 16) + (tmp[3] << 24);
 }
 
-/* Assign the name KEYNAME to the keycode KEYCODE.  */
+/* Assign the name KEYNAME to the keycode KEYCODE in KM.  */
 error_t
-keyname_add (char *keyname, int keycode)
+keyname_add (struct keymap *km, char *keyname, int keycode)
 {
   struct keyname *kn;
   int kn_int;
 
-  kn = malloc (sizeof (struct keyname));
+  kn = arena_alloc (&km->arena, sizeof (struct keyname));
   if (!kn)
     return ENOMEM;
 
@@ -84,15 +74,15 @@ keyname_add (char *keyname, int keycode)
 
   kn_int = keyname_hash(keyname);
   debug_printf ("add key %s(%d) hash: %d\n", keyname, keycode, kn_int);
-  hurd_ihash_add (&kn_mapping, kn_int, kn);
+  hurd_ihash_add (&km->keynames, kn_int, kn);
 
   return 0;
 }
 
 /* Find the numberic representation of the keycode with the name
-   KEYNAME.  */
+   KEYNAME in KM.  */
 int
-keyname_find (char *keyname)
+keyname_find (struct keymap *km, char *keyname)
 {
   struct keyname *kn;
   int kn_int;
@@ -108,7 +98,7 @@ keyname_find (char *keyname)
     } 
   kn_int = keyname_hash(keyname);
 
-  kn = hurd_ihash_find (&kn_mapping, kn_int);
+  kn = hurd_ihash_find (&km->keynames, kn_int);
   if (kn)
     return kn->keycode;
 /*   int h = name_hash (keyname); */
@@ -128,65 +118,39 @@ keyname_find (char *keyname)
 
 /* Keytypes and keytype maps.  */
 
-/* The dummy gets used when the original may not be overwritten.  */
-static struct keytype dummy_keytype;
-
-#define	KTHSZ	16
 #if	((KTHSZ&(KTHSZ-1)) == 0)
 #define	KTHASH(ktttl)	((ktttl)&(KTHSZ-1))
 #else
 #define	KTHASH(ktttl)	(((unsigned)(kt))%KTHSZ)
 #endif
 
-/* All keytypes.  */
-struct keytype *kthash[KTHSZ];
-
-/* Initialize the keytypes hashtable.  */
-static void
-keytype_init ()
-{
-  int n;
-  for (n = 0; n < KTHSZ; n++)
-    kthash[n] = 0;
-}
-
-/* Search the keytype with the name NAME.  */
+/* Search the keytype with the name NAME in KM.  */
 struct keytype *
-keytype_find (char *name)
+keytype_find (struct keymap *km, char *name)
 {
   int nhash = name_hash (name);
   struct keytype *kt;
 
-  for (kt = kthash[KTHASH(nhash)]; kt; kt = kt->hnext)
+  for (kt = km->kthash[KTHASH(nhash)]; kt; kt = kt->hnext)
     if (!strcmp (name, kt->name))
       return kt;
   return NULL;
 }
 
-/* Remove the keytype KT.  */
+/* Remove the keytype KT.  Its memory belongs to the keymap.  */
 void
 keytype_delete (struct keytype *kt)
 {
-  struct typemap *map;
-
-
   *kt->prevp = kt->hnext;
   if (kt->hnext)
     kt->hnext->prevp = kt->prevp;
-      
-  map = kt->maps;
-  while (map)
-    {
-      struct typemap *nextmap = map->next;
-      free (map);
-      map = nextmap;
-    }
-  
 }
 
-/* Create a new keytype with the name NAME.  */
+/* Create a new keytype with the name NAME in KM, the merge mode
+   MERGE_MODE says what happens to an existing one.  */
 error_t
-keytype_new (char *name, struct keytype **new_kt)
+keytype_new (struct keymap *km, char *name, mergemode merge_mode,
+	     struct keytype **new_kt)
 {
   struct keytype *kt;
   struct keytype *ktlist;
@@ -195,46 +159,49 @@ keytype_new (char *name, struct keytype **new_kt)
   nhash = name_hash (name);
   debug_printf ("New: %s\n", name);
 
-  kt = keytype_find (name);
+  kt = keytype_find (km, name);
 
   if (kt)
     {
       /* If the merge mode is augement don't replace it.  */
       if (merge_mode == augment)
 	{
-	  *new_kt = &dummy_keytype;
+	  *new_kt = &km->dummy_keytype;
 	  return 0;
 	}
       else /* This keytype should replace the old one, remove the old one.  */
 	keytype_delete (kt);
     }
 
-  ktlist = kthash[KTHASH(nhash)];
-  kt = calloc (1, sizeof (struct keytype));
+  ktlist = km->kthash[KTHASH(nhash)];
+  kt = arena_calloc (&km->arena, 1, sizeof (struct keytype));
   if (kt == NULL)
     return ENOMEM;
+  kt->name = arena_strndup (&km->arena, name, strlen (name));
+  if (kt->name == NULL)
+    return ENOMEM;
 
   kt->hnext = ktlist;
-  kt->name = strdup (name);
-  kt->prevp = &kthash[KTHASH(nhash)];
+  kt->prevp = &km->kthash[KTHASH(nhash)];
   kt->maps = NULL;
-  if (kthash[KTHASH(nhash)])
-    kthash[KTHASH(nhash)]->prevp = &(kt->hnext);
-  kthash[KTHASH(nhash)] = kt;
+  if (km->kthash[KTHASH(nhash)])
+    km->kthash[KTHASH(nhash)]->prevp = &(kt->hnext);
+  km->kthash[KTHASH(nhash)] = kt;
 
   *new_kt = kt;
   return 0;
 }
 
-/* Add a level (LEVEL) to modifiers (MODS) mapping to the current
-   keytype.  */
+/* Add a level (LEVEL) to modifiers (MODS) mapping to the keytype KT
+   of KM.  */
 error_t
-keytype_mapadd (struct keytype *kt, modmap_t mods, int level)
+keytype_mapadd (struct keymap *km, struct keytype *kt, modmap_t mods,
+		int level)
 {
   struct typemap *map;
   modmap_t nulmap = {0, 0};
 
-  map = malloc (sizeof (struct typemap));
+  map = arena_alloc (&km->arena, sizeof (struct typemap));
   if (!map)
     return ENOMEM;
 
@@ -249,10 +216,11 @@ keytype_mapadd (struct keytype *kt, modmap_t mods, int level)
   return 0;
 }
 
-/* For the current keytype the modifiers PRESERVE should be preserved
+/* For the keytype KT of KM the modifiers PRESERVE should be preserved
    when the modifiers MODS are pressed.  */
 error_t
-keytype_preserve_add (struct keytype *kt, modmap_t mods, modmap_t preserve)
+keytype_preserve_add (struct keymap *km, struct keytype *kt, modmap_t mods,
+		      modmap_t preserve)
 {
   error_t err;
   struct typemap *map;
@@ -269,11 +237,11 @@ keytype_preserve_add (struct keytype *kt, modmap_t mods, modmap_t preserve)
     }
 
   /* No map has been found, add the default map.  */
-  err = keytype_mapadd (kt, mods, 0);
+  err = keytype_mapadd (km, kt, mods, 0);
   if (err)
     return err;
 
-  keytype_preserve_add (kt, mods, preserve);
+  keytype_preserve_add (km, kt, mods, preserve);
 
   return 0;
 }
@@ -281,40 +249,37 @@ keytype_preserve_add (struct keytype *kt, modmap_t mods, modmap_t preserve)
 
 /* Interpretations.  */
 
-struct xkb_interpret *last_interp;
-struct xkb_interpret default_interpretation;
-
-
-/* Add a new interpretation.  */
+/* Add a new interpretation to KM.  */
 error_t
-interpret_new (xkb_interpret_t **new_interpret, symbol ks)
+interpret_new (struct keymap *km, xkb_interpret_t **new_interpret, symbol ks)
 {
   struct xkb_interpret *new_interp;
 
-  new_interp = malloc (sizeof (struct xkb_interpret));
+  new_interp = arena_alloc (&km->arena, sizeof (struct xkb_interpret));
   if (!new_interp)
     return ENOMEM;
 
-  memcpy (new_interp, &default_interpretation, sizeof (struct xkb_interpret));
+  memcpy (new_interp, &km->default_interpretation,
+	  sizeof (struct xkb_interpret));
   new_interp->symbol = ks;
 
   if (ks)
     {
-      new_interp->next = interpretations;
-      interpretations = new_interp;
+      new_interp->next = km->interpretations;
+      km->interpretations = new_interp;
 
-      if (!last_interp)
-	last_interp = new_interp;
+      if (!km->last_interp)
+	km->last_interp = new_interp;
     }
   else
     {
-      if (last_interp)
-	last_interp->next = new_interp;
+      if (km->last_interp)
+	km->last_interp->next = new_interp;
       
-      last_interp = new_interp;
+      km->last_interp = new_interp;
       
-      if (!interpretations)
-	interpretations = new_interp; 
+      if (!km->interpretations)
+	km->interpretations = new_interp; 
     }
 
   *new_interpret = new_interp;
@@ -325,8 +290,6 @@ interpret_new (xkb_interpret_t **new_interpret, symbol ks)
 
 /* XXX: Dead code!?  */
 /* Virtual modifiers name to number mapping.  */
-/* Last number assigned to a virtual modifier.  */
-static int lastvmod = 0;
 
 /* One virtual modifiername -> vmod number mapping.  */
 struct vmodname
@@ -335,21 +298,18 @@ struct vmodname
   struct vmodname *next;
 };
 
-/* A list of virtualmodifier names and its numberic representation.  */
-static struct vmodname *vmodnamel;
-
-/* Get the number assigned to the virtualmodifier with the name
-   VMODNAME.  */
+/* Get the number assigned to the virtualmodifier with the name of
+   the LEN characters at VMODNAME in KM.  */
 int
-vmod_find (char *vmodname)
+vmod_find (struct keymap *km, const char *vmodname, size_t len)
 {
   int i = 0;
-  struct vmodname *vmn = vmodnamel;
+  struct vmodname *vmn = km->vmods;
 
   while (vmn)
     {
-      if (!strcmp (vmn->name, vmodname))
-	return (lastvmod - i);
+      if (!strncmp (vmn->name, vmodname, len) && vmn->name[len] == '\0')
+	return (km->lastvmod - i);
       vmn = vmn->next;
       i++;
     }
@@ -357,27 +317,29 @@ vmod_find (char *vmodname)
   return 0;
 }
 
-/* Give the virtualmodifier VMODNAME a number and add it to the
-   hashtable.  */
+/* Give the virtualmodifier with the name of the LEN characters at
+   VMODNAME a number in KM and add it to the hashtable.  */
 error_t
-vmod_add (char *vmodname)
+vmod_add (struct keymap *km, const char *vmodname, size_t len)
 {
   struct vmodname *vmn;
 
-  if (vmod_find (vmodname))
+  if (vmod_find (km, vmodname, len))
     return 0;
 
-  vmn = malloc (sizeof (struct vmodname));
+  vmn = arena_alloc (&km->arena, sizeof (struct vmodname));
   if (vmn == NULL)
     return ENOMEM;
 
-  vmn->name = vmodname;
-  vmn->next = vmodnamel;
-  vmodnamel = vmn;
+  vmn->name = arena_strndup (&km->arena, vmodname, len);
+  if (vmn->name == NULL)
+    return ENOMEM;
+  vmn->next = km->vmods;
+  km->vmods = vmn;
 
-  lastvmod++;
-  if (lastvmod > 16)
-	  debug_printf("warning: only sixteen virtual modifiers are supported, %s will not be functional.\n", vmodname);
+  km->lastvmod++;
+  if (km->lastvmod > 16)
+	  debug_printf("warning: only sixteen virtual modifiers are supported, %s will not be functional.\n", vmn->name);
 
   return 0;
 }
@@ -390,44 +352,35 @@ struct ksrm
 
   int rmods;
 };
-static struct hurd_ihash ksrm_mapping;
-
-/* Initialize the list for keysyms to realmodifiers mappings.  */
-void
-ksrm_init ()
-{
-  hurd_ihash_init (&ksrm_mapping, HURD_IHASH_NO_LOCP);
-  debug_printf ("KSRM MAP IHASH CREATED \n");
-}
 
 /* Add keysym to realmodifier mapping.  */
 error_t
-ksrm_add (symbol ks, int rmod)
+ksrm_add (struct keymap *km, symbol ks, int rmod)
 {
-  hurd_ihash_add (&ksrm_mapping, ks, (void *) rmod);
+  hurd_ihash_add (&km->ksrm, ks, (void *) rmod);
 
   return 0;
 }
 
-/* Apply the rkms (realmods to keysyms) table to all keysyms.  */
+/* Apply the rkms (realmods to keysyms) table to all keysyms of KM.  */
 void
-ksrm_apply (void)
+ksrm_apply (struct keymap *km)
 {
   keycode_t kc;
-  for (kc = 0; kc < max_keys; kc++)
+  for (kc = 0; kc < km->max_keys; kc++)
     {
       int group;
       for (group = 0; group < 4; group++)
 	{
 	  int cursym;
-	  for (cursym = 0; cursym < keys[kc].groups[group].width; cursym++)
+	  for (cursym = 0; cursym < km->keys[kc].groups[group].width; cursym++)
 	    {
-	      symbol ks = keys[kc].groups[group].symbols[cursym];
-	      int rmods = (int) hurd_ihash_find (&ksrm_mapping, ks);
+	      symbol ks = km->keys[kc].groups[group].symbols[cursym];
+	      int rmods = (int) hurd_ihash_find (&km->ksrm, ks);
 
 		if (rmods)
 		  {
-		    keys[kc].mods.rmods = rmods;
+		    km->keys[kc].mods.rmods = rmods;
 		  }
 	    }
 	}
@@ -441,24 +394,40 @@ ksrm_apply (void)
 
 /* Keycode to realmodifier mapping.  */
 
-/* Set the current rmod for the key with keyname KEYNAME.  */
+/* Set the current rmod for the key with keyname KEYNAME in KM.  */
 /* XXX: It shouldn't be applied immediatly because the key can be
    replaced.  */
 void
-set_rmod_keycode (char *keyname, int rmod)
+set_rmod_keycode (struct keymap *km, char *keyname, int rmod)
 {
-  keycode_t kc = keyname_find (keyname);
-  keys[kc].mods.rmods = rmod;
+  keycode_t kc = keyname_find (km, keyname);
+  km->keys[kc].mods.rmods = rmod;
   debug_printf ("%s (kc %d) rmod: %d\n", keyname, kc, rmod);
 }
 
-/* Initialize XKB data structures.  */
+/* Initialize the keymap KM for a compile.  */
 error_t
-xkb_data_init (void)
+keymap_init (struct keymap *km)
 {
-  keyname_init ();
-  keytype_init ();
-  ksrm_init ();
+  memset (km, 0, sizeof (*km));
+  arena_init (&km->arena);
+  hurd_ihash_init (&km->keynames, HURD_IHASH_NO_LOCP);
+  hurd_ihash_init (&km->ksrm, HURD_IHASH_NO_LOCP);
+  hurd_ihash_init (&km->inject_index, HURD_IHASH_NO_LOCP);
 
   return 0;
 }
+
+/* Free the keymap KM and everything in it.  */
+void
+keymap_free (struct keymap *km)
+{
+  keymap_deps_free (km);
+  hurd_ihash_destroy (&km->keynames);
+  hurd_ihash_destroy (&km->ksrm);
+  hurd_ihash_destroy (&km->inject_index);
+  if (km->cache)
+    munmap (km->cache, km->cache_size);
+  arena_free (&km->arena);
+  memset (km, 0, sizeof (*km));
+}
@@ -0,0 +1,512 @@
+/*  xkbfile.c -- Keymap files and the index of their sections.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* The same file is usually included many times while a keymap is
+   compiled, symbols/pc for example is included by almost every
+   layout.  So every file is read only once per compile and kept by the
+   parser, together with an index of its sections.  The index is made with a
+   raw scan over the bytes of the file, which understands just enough
+   of the syntax to find the sections: comments, strings, braces and
+   the words in front of a `{'.  An include looks its section up in the
+   index and the scanner gets only the bytes of that section.
+
+   The files are searched in the directories of the search path in
+   order, so a file in a directory of the user overrides the one of
+   the system.  A file that is in none of them is remembered as well,
+   so it is looked for only once per compile.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "xkb.h"
+#include "parser.tab.h"
+
+/* The section keywords and their tokens.  */
+static const struct
+{
+  const char *word;
+  int type;
+} section_words[] =
+  {
+    { "xkb_keymap", XKBKEYMAP },
+    { "xkb_keycodes", XKBKEYCODES },
+    { "xkb_types", XKBTYPES },
+    { "xkb_compatibility", XKBCOMPAT },
+    { "xkb_symbols", XKBSYMBOLS },
+    { "xkb_geometry", XKBGEOMETRY }
+  };
+
+#define NSECTION_WORDS	(sizeof (section_words) / sizeof (section_words[0]))
+
+/* Return the first byte after the comment or string that starts at P,
+   or P when there is none there.  Count the newlines of comments in
+   LINE, the scanner doesn't count the ones in strings.  END is the end
+   of the data.  */
+const char *
+keymap_skip_comment (const char *p, const char *end, int *line)
+{
+  if (p + 1 < end && p[0] == '/' && p[1] == '/')
+    {
+      /* The newline is left for the caller.  */
+      const char *nl = memchr (p, '\n', end - p);
+
+      return nl ? nl : end;
+    }
+
+  if (p + 1 < end && p[0] == '/' && p[1] == '*')
+    {
+      for (p += 2; p + 1 < end; p++)
+	{
+	  if (p[0] == '*' && p[1] == '/')
+	    return p + 2;
+	  if (*p == '\n')
+	    (*line)++;
+	}
+      return end;
+    }
+
+  if (*p == '"')
+    {
+      for (p++; p < end && *p != '"'; p++)
+	if (p[0] == '\\' && p + 1 < end && p[1] == '"')
+	  p++;
+      return p < end ? p + 1 : end;
+    }
+
+  return p;
+}
+
+/* Add a section of the type TYPE that starts at the byte START on the
+   line LINE to FILE.  Its name is the NAMELEN bytes at NAME.  */
+static error_t
+keymap_file_add_section (struct keymap_file *file, int type, int isdefault,
+			 const char *name, size_t namelen, size_t start,
+			 int line, int depth)
+{
+  struct keymap_section *s;
+
+  if (!(file->nsections & (file->nsections - 1)))
+    {
+      struct keymap_section *sections;
+
+      sections = realloc (file->sections, (file->nsections
+					   ? file->nsections * 2 : 1)
+			  * sizeof (*sections));
+      if (!sections)
+	return ENOMEM;
+      file->sections = sections;
+    }
+
+  s = &file->sections[file->nsections++];
+  s->type = type;
+  s->isdefault = isdefault;
+  s->name = name;
+  s->namelen = namelen;
+  s->start = start;
+  s->end = 0;
+  s->line = line;
+  s->depth = depth;
+  return 0;
+}
+
+/* Make the index of the sections of FILE.  */
+static error_t
+keymap_file_index (struct keymap_file *file)
+{
+  const char *data = file->data;
+  const char *end = data + file->len;
+  const char *p = data;
+  /* The section whose header is being read.  */
+  int type = 0;
+  int isdefault = 0;
+  const char *name = NULL;
+  size_t namelen = 0;
+  int depth = 0;
+  int line = 1;
+  int i;
+  error_t err;
+
+  while (p < end)
+    {
+      const char *q = keymap_skip_comment (p, end, &line);
+
+      if (q != p)
+	{
+	  /* The first string after the keyword is the name.  */
+	  if (*p == '"' && type && !name)
+	    {
+	      name = p + 1;
+	      namelen = q - p - 2;
+	    }
+	  p = q;
+	  continue;
+	}
+
+      if (isalpha (*p) || *p == '_')
+	{
+	  unsigned int w;
+
+	  for (q = p; q < end && (isalnum (*q) || *q == '_'); q++)
+	    ;
+	  if (q - p == 7 && !strncasecmp (p, "default", 7))
+	    isdefault = 1;
+	  for (w = 0; w < NSECTION_WORDS; w++)
+	    if (strlen (section_words[w].word) == q - p
+		&& !strncasecmp (p, section_words[w].word, q - p))
+	      {
+		type = section_words[w].type;
+		name = NULL;
+	      }
+	  p = q;
+	  continue;
+	}
+
+      switch (*p)
+	{
+	case '\n':
+	  line++;
+	  break;
+
+	case '{':
+	  if (type)
+	    {
+	      err = keymap_file_add_section (file, type, isdefault, name,
+					     namelen, p - data, line, depth);
+	      if (err)
+		return err;
+	    }
+	  depth++;
+	  type = isdefault = 0;
+	  name = NULL;
+	  break;
+
+	case '}':
+	  depth--;
+	  for (i = file->nsections - 1; i >= 0; i--)
+	    if (!file->sections[i].end && file->sections[i].depth == depth)
+	      {
+		file->sections[i].end = p + 1 - data;
+		break;
+	      }
+	  type = isdefault = 0;
+	  name = NULL;
+	  break;
+
+	case ';':
+	  type = isdefault = 0;
+	  name = NULL;
+	  break;
+	}
+      p++;
+    }
+
+  /* A section that is not closed runs to the end of the file, the
+     parser will complain about it.  */
+  for (i = 0; i < file->nsections; i++)
+    if (!file->sections[i].end)
+      file->sections[i].end = file->len;
+
+  return 0;
+}
+
+/* Read the file FD into FILE.  */
+static error_t
+keymap_file_read (struct keymap_file *file, int fd)
+{
+  struct stat st;
+
+  if (fstat (fd, &st) < 0)
+    return errno;
+  file->data = malloc (st.st_size + 1);
+  if (!file->data)
+    return ENOMEM;
+
+  file->len = 0;
+  while (file->len < st.st_size)
+    {
+      ssize_t n = read (fd, file->data + file->len, st.st_size - file->len);
+
+      if (n < 0)
+	return errno;
+      if (n == 0)
+	break;
+      file->len += n;
+    }
+  file->data[file->len] = '\0';
+  return 0;
+}
+
+/* Free FILE and everything in it.  */
+static void
+keymap_file_free (struct keymap_file *file)
+{
+  free (file->path);
+  free (file->data);
+  free (file->sections);
+  free (file);
+}
+
+/* Open the directories of the search path XKBDIR, whose directories
+   are separated by colons, and store them in DIRFDS and their number
+   in NDIRS.  Directories that can't be opened are left out.  */
+error_t
+keymap_dirs_open (const char *xkbdir, int **dirfds, int *ndirs)
+{
+  const char *dir;
+  int n = 1;
+
+  for (dir = xkbdir; *dir; dir++)
+    if (*dir == ':')
+      n++;
+  *dirfds = malloc (n * sizeof (int));
+  if (!*dirfds)
+    return ENOMEM;
+
+  *ndirs = 0;
+  for (dir = xkbdir; dir; )
+    {
+      const char *end = strchrnul (dir, ':');
+      char *name = strndup (dir, end - dir);
+      int fd;
+
+      if (!name)
+	{
+	  keymap_dirs_close (*dirfds, *ndirs);
+	  return ENOMEM;
+	}
+      fd = open (*name ? name : ".", O_RDONLY | O_DIRECTORY);
+      free (name);
+      if (fd >= 0)
+	(*dirfds)[(*ndirs)++] = fd;
+      dir = *end ? end + 1 : NULL;
+    }
+
+  if (*ndirs == 0)
+    {
+      free (*dirfds);
+      return ENOENT;
+    }
+  return 0;
+}
+
+/* Close the NDIRS directories DIRFDS.  */
+void
+keymap_dirs_close (int *dirfds, int ndirs)
+{
+  while (ndirs > 0)
+    close (dirfds[--ndirs]);
+  free (dirfds);
+}
+
+/* Open the file PATH in the first of the NDIRS directories DIRFDS that
+   has it.  Return the descriptor, or -1 and set errno.  */
+static int
+keymap_dirs_openat (const int *dirfds, int ndirs, const char *path)
+{
+  int fd = -1;
+  int i;
+
+  errno = ENOENT;
+  for (i = 0; i < ndirs; i++)
+    {
+      fd = openat (dirfds[i], path, O_RDONLY);
+      if (fd >= 0 || errno != ENOENT)
+	break;
+    }
+  return fd;
+}
+
+/* Read the keymap file PATH from the NDIRS directories DIRFDS, make
+   the index of its sections and store it in FILE.  Add it to the files
+   KM depends on, unless KM is NULL.  */
+static error_t
+keymap_file_open (const int *dirfds, int ndirs, const char *path,
+		  struct keymap *km, struct keymap_file **file)
+{
+  struct keymap_file *f;
+  int fd;
+  error_t err;
+
+  fd = keymap_dirs_openat (dirfds, ndirs, path);
+  if (fd < 0)
+    return errno;
+
+  f = calloc (1, sizeof (*f));
+  if (!f)
+    {
+      close (fd);
+      return ENOMEM;
+    }
+  f->path = strdup (path);
+  err = f->path ? 0 : ENOMEM;
+  if (!err && km)
+    err = keymap_dep_add (km, path, fd);
+  if (!err)
+    err = keymap_file_read (f, fd);
+  close (fd);
+  if (!err)
+    err = keymap_file_index (f);
+  if (err)
+    {
+      keymap_file_free (f);
+      return err;
+    }
+
+  *file = f;
+  return 0;
+}
+
+/* Load the keymap file PATH from the search path of PARSER, or find
+   it when it was loaded before during this compile, and store it in
+   FILE.  */
+error_t
+keymap_file_load (struct parser *parser, const char *path,
+		  struct keymap_file **file)
+{
+  struct keymap_file *f;
+  error_t err;
+
+  for (f = parser->files; f; f = f->next)
+    if (!strcmp (f->path, path))
+      {
+	if (f->err)
+	  return f->err;
+	*file = f;
+	return 0;
+      }
+
+  err = keymap_file_open (parser->dirfds, parser->ndirs, path,
+			  parser->keymap, &f);
+  if (err == ENOENT)
+    {
+      /* Remember that it is not there.  */
+      f = calloc (1, sizeof (*f));
+      if (f)
+	f->path = strdup (path);
+      if (f && f->path)
+	{
+	  f->err = err;
+	  f->next = parser->files;
+	  parser->files = f;
+	}
+      else
+	free (f);
+    }
+  if (err)
+    return err;
+
+  f->next = parser->files;
+  parser->files = f;
+  *file = f;
+  return 0;
+}
+
+/* Store the names of the sections of the type TYPE in the keymap file
+   PATH in the NDIRS directories DIRFDS in NAMES and their number in
+   COUNT.  The name of a section without one is NULL.  Store the index
+   of the default section in DEF, or -1 when there is none.  The names
+   and NAMES are freed with free.  */
+error_t
+keymap_file_section_names (const int *dirfds, int ndirs, const char *path,
+			   int type, char ***names, int *count, int *def)
+{
+  struct keymap_file *file;
+  int i, n = 0;
+  error_t err;
+
+  err = keymap_file_open (dirfds, ndirs, path, NULL, &file);
+  if (err)
+    return err;
+
+  *def = -1;
+  *names = calloc (file->nsections ? : 1, sizeof (char *));
+  if (!*names)
+    {
+      keymap_file_free (file);
+      return ENOMEM;
+    }
+
+  for (i = 0; i < file->nsections; i++)
+    {
+      struct keymap_section *s = &file->sections[i];
+
+      if (s->type != type)
+	continue;
+      if (s->isdefault)
+	*def = n;
+      if (s->name)
+	{
+	  (*names)[n] = strndup (s->name, s->namelen);
+	  if (!(*names)[n])
+	    {
+	      err = ENOMEM;
+	      break;
+	    }
+	}
+      n++;
+    }
+
+  keymap_file_free (file);
+  if (err)
+    {
+      while (n > 0)
+	free ((*names)[--n]);
+      free (*names);
+      return err;
+    }
+
+  *count = n;
+  return 0;
+}
+
+/* Return the section of the type TYPE with the name NAME in FILE, or
+   its default section when NAME is NULL.  Return NULL when there is no
+   such section.  */
+struct keymap_section *
+keymap_file_section (struct keymap_file *file, int type, const char *name)
+{
+  size_t len = name ? strlen (name) : 0;
+  int i;
+
+  for (i = 0; i < file->nsections; i++)
+    {
+      struct keymap_section *s = &file->sections[i];
+
+      if (s->type != type)
+	continue;
+      if (name ? (s->name && s->namelen == len
+		  && !strncmp (s->name, name, len))
+	  : s->isdefault)
+	return s;
+    }
+
+  return NULL;
+}
+
+/* Forget all files that were loaded during the compile of PARSER.  */
+void
+keymap_files_free (struct parser *parser)
+{
+  while (parser->files)
+    {
+      struct keymap_file *next = parser->files->next;
+
+      keymap_file_free (parser->files);
+      parser->files = next;
+    }
+}
@@ -0,0 +1,250 @@
+/*  xkblayout.c -- Compile all keymaps of a keymap file ahead of time.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* A keymap file like keymap/hurd has a keymap section for every
+   layout.  With --precompile all of them are compiled while the
+   console already runs, on a few threads that take the next layout
+   that is not compiled yet until none is left.  Every keymap is
+   written to the cache and kept, so switching to another layout
+   compiles nothing, its keys are used as they are.  A keymap that has
+   an up to date cache is loaded from it instead.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cthreads.h>
+
+#include "xkb.h"
+#include "parser.tab.h"
+
+/* A keymap of the keymap file.  */
+struct layout
+{
+  /* The name of the keymap section, NULL when it has
+     none.  */
+  char *name;
+  /* The section is the default keymap of the file.  */
+  int isdefault;
+  struct keymap keymap;
+  /* Set when the keymap is compiled or failed to compile.  */
+  int done;
+  error_t err;
+  /* The keymap was loaded from its cache.  */
+  int cached;
+  /* How long the compile took and the memory of the keys.  */
+  double secs;
+  size_t size;
+};
+
+/* The keymap file and the cache directory.  */
+static const char *layouts_cachedir;
+static char *layouts_xkbdir;
+static char *layouts_file;
+
+/* All keymaps of the keymap file.  LAYOUTS_LOCK protects NEXT_LAYOUT,
+   NWORKERS and DONE.  */
+static struct layout *layouts;
+static int nlayouts;
+static int next_layout;
+static int nworkers;
+static struct mutex layouts_lock = MUTEX_INITIALIZER;
+
+/* Return the time in seconds.  */
+static double
+now (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Compile the keymap of LAYOUT, or load it from its cache.  */
+static void
+layout_compile (struct layout *layout)
+{
+  struct keymap *km = &layout->keymap;
+  double start = now ();
+  error_t err;
+
+  err = keymap_init (km);
+  if (err)
+    goto out;
+
+  if (!keymap_cache_load (km, layouts_cachedir, layouts_xkbdir,
+			  layouts_file, layout->name))
+    {
+      layout->cached = 1;
+      goto out;
+    }
+
+  err = parse_xkbconfig (km, layouts_xkbdir, layouts_file, layout->name);
+  if (!err)
+    err = determine_keytypes (km);
+  if (!err)
+    err = interpret_all (km);
+  if (err)
+    {
+      keymap_free (km);
+      goto out;
+    }
+  keymap_cache_write (km, layouts_cachedir, layouts_xkbdir, layouts_file,
+		      layout->name);
+
+ out:
+  layout->secs = now () - start;
+  layout->err = err;
+  if (!err)
+    layout->size = keymap_cache_size (km);
+}
+
+/* Print how long every compile took and the memory of every
+   keymap.  */
+static void
+layouts_report (void)
+{
+  int i;
+
+  for (i = 0; i < nlayouts; i++)
+    {
+      struct layout *layout = &layouts[i];
+
+      if (layout->err)
+	printf ("Warning: could not compile the keymap %s: %s\n",
+		layout->name ? : "(default)", strerror (layout->err));
+      else if (layout->cached)
+	printf ("Keymap %s: loaded in %.1f ms, %lu bytes\n",
+		layout->name ? : "(default)", layout->secs * 1000,
+		(unsigned long) layout->size);
+      else
+	printf ("Keymap %s: compiled in %.1f ms, %lu bytes, "
+		"%lu bytes while compiling\n",
+		layout->name ? : "(default)", layout->secs * 1000,
+		(unsigned long) layout->size,
+		(unsigned long) layout->keymap.arena.size);
+    }
+}
+
+/* Compile keymaps until all are compiled.  The last worker that
+   finishes reports them.  */
+static any_t
+layout_worker (any_t unused)
+{
+  struct layout *layout;
+  int last;
+
+  for (;;)
+    {
+      mutex_lock (&layouts_lock);
+      if (next_layout == nlayouts)
+	break;
+      layout = &layouts[next_layout++];
+      mutex_unlock (&layouts_lock);
+
+      layout_compile (layout);
+
+      mutex_lock (&layouts_lock);
+      layout->done = 1;
+      mutex_unlock (&layouts_lock);
+    }
+
+  last = --nworkers == 0;
+  mutex_unlock (&layouts_lock);
+
+  if (last)
+    layouts_report ();
+  return 0;
+}
+
+/* Compile every keymap of the keymap file FILE in XKBDIR on NTHREADS
+   threads in the background, or load it from its cache in CACHEDIR,
+   and keep them.  Report how long every compile took and how much
+   memory the keymap takes when all are done.  */
+error_t
+keymap_layouts_precompile (const char *cachedir, char *xkbdir, char *file,
+			   int nthreads)
+{
+  char **names;
+  int *dirfds;
+  int ndirs;
+  int def;
+  int i;
+  error_t err;
+
+  if (layouts)
+    return EBUSY;
+
+  err = keymap_dirs_open (xkbdir, &dirfds, &ndirs);
+  if (err)
+    return err;
+  err = keymap_file_section_names (dirfds, ndirs, file, XKBKEYMAP, &names,
+				   &nlayouts, &def);
+  keymap_dirs_close (dirfds, ndirs);
+  if (err)
+    return err;
+
+  layouts = calloc (nlayouts ? : 1, sizeof (*layouts));
+  if (!layouts)
+    {
+      for (i = 0; i < nlayouts; i++)
+	free (names[i]);
+      free (names);
+      nlayouts = 0;
+      return ENOMEM;
+    }
+  for (i = 0; i < nlayouts; i++)
+    layouts[i].name = names[i];
+  if (def >= 0)
+    layouts[def].isdefault = 1;
+  free (names);
+
+  layouts_cachedir = cachedir;
+  layouts_xkbdir = xkbdir;
+  layouts_file = file;
+
+  if (nthreads > nlayouts)
+    nthreads = nlayouts;
+  nworkers = nthreads;
+  for (i = 0; i < nthreads; i++)
+    cthread_detach (cthread_fork (layout_worker, NULL));
+
+  return 0;
+}
+
+/* Return the keymap NAME of the keymap file that
+   keymap_layouts_precompile compiled, its default keymap when NAME is
+   NULL, or NULL when it is not compiled (yet).  */
+struct keymap *
+keymap_layout_find (const char *name)
+{
+  struct keymap *km = NULL;
+  int i;
+
+  mutex_lock (&layouts_lock);
+  for (i = 0; i < nlayouts; i++)
+    {
+      struct layout *layout = &layouts[i];
+
+      if (name ? !layout->name || strcmp (layout->name, name)
+	  : !layout->isdefault)
+	continue;
+      if (layout->done && !layout->err)
+	km = &layout->keymap;
+      break;
+    }
+  mutex_unlock (&layouts_lock);
+
+  return km;
+}
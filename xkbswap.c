@@ -0,0 +1,83 @@
+/*  xkbswap.c -- Replace the keymap in use while keys are typed.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.  */
+
+/* The keymap in use is published through a single pointer.  The input
+   thread and the timer thread handle every key between keymap_enter
+   and keymap_leave, which only count them, so they never wait for a
+   new keymap and every key is handled with one keymap from the press
+   to the end of its actions.  keymap_publish stores the new pointer
+   and then waits until every key that was handled with the old
+   keymap is done, after that nothing uses the old keymap anymore and
+   it can be freed.
+
+   The keys that are handled are counted in one of two counters, the
+   one of the phase they entered in.  Publishing switches the phase
+   and waits until the counter of the old phase is zero, so keys that
+   enter after the switch don't keep it waiting.  This is done twice,
+   so both counters are waited for after the new keymap was stored: a
+   key that read the phase before a switch can be counted in the
+   counter of that phase after it.  */
+
+#include <cthreads.h>
+
+#include "xkb.h"
+
+/* The keymap in use.  */
+static struct keymap *keymap_current;
+
+/* The phase, only its lowest bit is used, and the number of keys that
+   are handled with a keymap in each phase.  */
+static unsigned int keymap_phase;
+static unsigned int keymap_readers[2];
+
+/* Only one keymap is published at a time.  */
+static struct mutex keymap_publish_lock = MUTEX_INITIALIZER;
+
+/* Return the keymap in use, which stays valid until keymap_leave is
+   called with the phase that is stored in PHASE.  */
+struct keymap *
+keymap_enter (int *phase)
+{
+  *phase = __atomic_load_n (&keymap_phase, __ATOMIC_SEQ_CST) & 1;
+  __atomic_add_fetch (&keymap_readers[*phase], 1, __ATOMIC_SEQ_CST);
+  return __atomic_load_n (&keymap_current, __ATOMIC_SEQ_CST);
+}
+
+/* The keymap that keymap_enter returned with PHASE is not used
+   anymore.  */
+void
+keymap_leave (int phase)
+{
+  __atomic_sub_fetch (&keymap_readers[phase], 1, __ATOMIC_RELEASE);
+}
+
+/* Put the keymap KM in use.  Return the keymap it replaced when no key
+   is handled with it anymore.  */
+struct keymap *
+keymap_publish (struct keymap *km)
+{
+  struct keymap *old;
+  int i;
+
+  mutex_lock (&keymap_publish_lock);
+  old = __atomic_exchange_n (&keymap_current, km, __ATOMIC_SEQ_CST);
+  for (i = 0; i < 2; i++)
+    {
+      unsigned int phase;
+
+      phase = __atomic_fetch_add (&keymap_phase, 1, __ATOMIC_SEQ_CST) & 1;
+      while (__atomic_load_n (&keymap_readers[phase], __ATOMIC_SEQ_CST))
+	cthread_yield ();
+    }
+  mutex_unlock (&keymap_publish_lock);
+  return old;
+}
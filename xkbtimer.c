@@ -63,8 +63,32 @@ static struct per_key_timer
 /* The last pressed key. Only this key may generate keyrepeat events.  */
 static int lastkey = 0;
 
-error_t
-xkb_handle_key (keycode_t kc)
+/* The timers above, LASTKEY and the key states are changed with
+   XKB_INPUT_LOCK held.  The timer thread calls key_timing and
+   key_enable with the lock of the timers held, and they take
+   XKB_INPUT_LOCK, so a timer is only added or removed without it.  A
+   timer whose key is released or replaced is marked stopped before it
+   is removed, so when it expires meanwhile it does nothing.  Only the
+   input thread adds the timers of a key, and only after removing
+   them, so no other thread changes a timer that is set up.  */
+
+/* The compose sequences typed on the keyboard and of the keys the
+   timer thread produces: repeats and, with SlowKeys, the keys it
+   accepts.  Every thread composes in a context of its own, without a
+   lock: the input thread in KEYBOARD_COMPOSE and the timer thread in
+   TIMER_COMPOSE.  So a repeat is not part of a sequence that was
+   started on the keyboard.  Keys that are released are never
+   composed.  */
+static struct compose_context keyboard_compose;
+static struct compose_context timer_compose;
+
+/* Handle the key KC of the keyboard, which is released when 128 is set
+   in it, with the keymap KM, or with the keymap it was pressed with
+   while it is down.  Store what it produces, for the compose context
+   COMPOSE, in RES.  The caller holds XKB_INPUT_LOCK.  */
+static void
+xkb_handle_key (struct keymap *km, keycode_t kc,
+		struct compose_context *compose, keyresult_t *res)
 {
   static keycode_t prevkc = 0;
   keypress_t key;
@@ -74,11 +98,52 @@ xkb_handle_key (keycode_t kc)
   key.repeat = (prevkc == kc);
   key.redir = 0;
   key.rel = kc & 128;
+  key.compose = compose;
+  if (keystate[key.keycode].keypressed && keystate[key.keycode].keymap)
+    km = keystate[key.keycode].keymap;
+  key.keymap = km;
   keystate[key.keycode & 127].keypressed = key.rel ? 0 : 1;
+  keystate[key.keycode].keymap = key.rel ? NULL : km;
   debug_printf ("PRESSED: %d\n", !(key.rel));
-  xkb_input (key);
+  xkb_input (key, res);
   prevkc = key.keycode;
-  return 0;
+}
+
+/* Release the keys that are down and were pressed with the keymap KM,
+   which was replaced, through KM and stop their repeat.  Otherwise the
+   modifiers and groups they set stay set, as the keys are released
+   with a keymap that may not set them at all.  The keys that are
+   still held down are ignored until they are pressed again.  */
+void
+xkb_keys_release (struct keymap *km)
+{
+  char stopped[128];
+  keyresult_t res;
+  int kc;
+
+  mutex_lock (&xkb_input_lock);
+  for (kc = 0; kc < 128; kc++)
+    {
+      stopped[kc] = 0;
+      if (!keystate[kc].keypressed || keystate[kc].keymap != km)
+	continue;
+
+      if (per_key_timers[kc].enable_status != timer_stopped)
+	{
+	  per_key_timers[kc].enable_status = timer_stopped;
+	  stopped[kc] = 1;
+	}
+      if (kc == lastkey)
+	lastkey = 0;
+
+      /* A released key produces nothing to send.  */
+      xkb_handle_key (km, kc | 128, NULL, &res);
+    }
+  mutex_unlock (&xkb_input_lock);
+
+  for (kc = 0; kc < 128; kc++)
+    if (stopped[kc])
+      timer_remove (&per_key_timers[kc].enable_timer);
 }
 
 error_t
@@ -101,7 +166,9 @@ key_enable (void *handle)
   int key = (int) handle;
   
   /* Enable the key.  */
+  mutex_lock (&xkb_input_lock);
   keystate[key].disabled = 0;
+  mutex_unlock (&xkb_input_lock);
   
   return 0;
 }
@@ -112,16 +179,31 @@ static int
 key_timing (void *handle)
 {
   int current_key = (int) handle;
-
-  xkb_handle_key (current_key);
-
-  /* Another key was pressed after this key, stop repeating.  */
-  if (lastkey != current_key)
+  struct keymap *km;
+  keyresult_t res;
+  int phase;
+  int ret = 1;
+
+  km = keymap_enter (&phase);
+  mutex_lock (&xkb_input_lock);
+
+  /* The key was released, or another key was pressed after this key,
+     stop repeating.  */
+  if (per_key_timers[current_key].enable_status == timer_stopped
+      || lastkey != current_key)
     {
       per_key_timers[current_key].enable_status = timer_stopped;
+      mutex_unlock (&xkb_input_lock);
+      keymap_leave (phase);
       return 0;
     }
 
+  xkb_handle_key (km, current_key, &timer_compose, &res);
+  /* The key repeats with the keymap it was pressed with, which need
+     not be the one in use.  */
+  if (keystate[current_key].keymap)
+    km = keystate[current_key].keymap;
+
   switch (per_key_timers[current_key].enable_status)
     {
     case timer_stopped:
@@ -132,11 +214,11 @@ key_timing (void *handle)
 	= fetch_jiffies () + key_delay;
       lastkey = current_key;
       
-      if (keys[current_key].flags & KEYNOREPEAT)
+      if (km->keys[current_key].flags & KEYNOREPEAT)
 	{
 	  per_key_timers[current_key].enable_status = timer_stopped;
 	  /* Stop the timer.  */
-	  return 0;
+	  ret = 0;
 	}
       else
 	{
@@ -151,20 +233,35 @@ key_timing (void *handle)
 	= fetch_jiffies () + key_repeat;
       break;
     }
-  return 1;
+
+  mutex_unlock (&xkb_input_lock);
+  keymap_leave (phase);
+  xkb_output (&res);
+  return ret;
 }
 
+/* Handle the keycode KEY of the keyboard with the keymap KM.  It is
+   called by the input thread only.  */
 error_t
-xkb_input_key (int key)
+xkb_input_key (struct keymap *km, int key)
 {
   int pressed = !(key & 128);
   int keyc = key & 127;
+  int stop = 0;
+  int norepeat = 0;
+  keyresult_t res;
 
   debug_printf ("KEYIN: %d\n", key);
 
+  res.sym = -1;
+  mutex_lock (&xkb_input_lock);
+
   /* Filter out any double or disabled keys.  */
   if (key == lastkey || keystate[keyc].disabled)
-    return 0;
+    {
+      mutex_unlock (&xkb_input_lock);
+      return 0;
+    }
 
   /* Always handle keyrelease events.  */
   if (!pressed)
@@ -172,8 +269,8 @@ xkb_input_key (int key)
       /* Stop the timer for this released key.  */
       if (per_key_timers[keyc].enable_status != timer_stopped)
 	{
-	  timer_remove (&per_key_timers[keyc].enable_timer);
 	  per_key_timers[keyc].enable_status = timer_stopped;
+	  stop = 1;
 	}
 
       /* No more last key; it was released.  */
@@ -183,14 +280,21 @@ xkb_input_key (int key)
       /* Make sure the key was pressed before releasing it, it might
 	 not have been accepted.  */
       if (keystate[key & 127].keypressed)
-	xkb_handle_key (key);
+	xkb_handle_key (km, key, &keyboard_compose, &res);
 
       /* If bouncekeys is active, disable the key.  */
+      if (bouncekeys_active)
+	keystate[keyc].disabled = 1;
+      mutex_unlock (&xkb_input_lock);
+
+      if (stop)
+	timer_remove (&per_key_timers[keyc].enable_timer);
+      xkb_output (&res);
+
       if (bouncekeys_active)
 	{
-	  keystate[keyc].disabled = 1;
-	    
 	  /* Setup a timer to enable the key.  */
+	  timer_remove (&per_key_timers[keyc].disable_timer);
 	  timer_clear (&per_key_timers[keyc].disable_timer);
 	  per_key_timers[keyc].disable_timer.fnc = key_enable;
 	  per_key_timers[keyc].disable_timer.fnc_data = (void *) keyc;
@@ -202,9 +306,35 @@ xkb_input_key (int key)
       return 0;
     }
 
-  /* Setup the timer for slowkeys.  */
-  timer_clear (&per_key_timers[keyc].enable_timer);
+  /* The timer of the key may still run, when the key was pressed
+     before the last key and is pressed again now.  */
+  per_key_timers[keyc].enable_status = timer_stopped;
   lastkey = keyc;
+
+  if (!slowkeys_active)
+    {
+      /* Immediatly report the keypress.  */
+      xkb_handle_key (km, keyc, &keyboard_compose, &res);
+
+      /* Check if this repeat is allowed for this keycode.  */
+      norepeat = keystate[keyc].keymap->keys[keyc].flags & KEYNOREPEAT;
+    }
+  mutex_unlock (&xkb_input_lock);
+
+  timer_remove (&per_key_timers[keyc].enable_timer);
+  xkb_output (&res);
+  if (norepeat)
+    return 0; /* Nope.  */
+
+  /* Setup the timer for slowkeys or repeat.  */
+  mutex_lock (&xkb_input_lock);
+  if (lastkey != keyc)
+    {
+      /* The keymap was replaced, which released the key.  */
+      mutex_unlock (&xkb_input_lock);
+      return 0;
+    }
+  timer_clear (&per_key_timers[keyc].enable_timer);
   per_key_timers[keyc].enable_timer.fnc = key_timing;
   per_key_timers[keyc].enable_timer.fnc_data = (void *) keyc;
 
@@ -216,17 +346,11 @@ xkb_input_key (int key)
     }
   else
     {
-      /* Immediatly report the keypress.  */
-      xkb_handle_key (keyc);
-
-      /* Check if this repeat is allowed for this keycode.  */
-      if (keys[keyc].flags & KEYNOREPEAT)
-	return 0; /* Nope.  */
-
       per_key_timers[keyc].enable_status = timer_repeat_delay;
       per_key_timers[keyc].enable_timer.expires
 	= fetch_jiffies () + key_delay;
     }
+  mutex_unlock (&xkb_input_lock);
   timer_add (&per_key_timers[keyc].enable_timer);
 
   return 0;